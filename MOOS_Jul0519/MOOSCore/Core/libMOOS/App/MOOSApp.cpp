@@ -44,6 +44,7 @@
 #include <iostream>
 #include <sstream>
 #include <iterator>
+#include <algorithm>
 
 
 #ifdef ASYNCHRONOUS_CLIENT
@@ -146,6 +147,14 @@ CMOOSApp::CMOOSApp()
     m_dfLastRunTime = -1;
     m_bCommandMessageFiltering = false;
     m_dfLastStatusTime = -1;
+    m_dfNextIterateDeadline = -1;
+    m_nIterateOverruns = 0;
+    m_bLockStep = false;
+    m_bLockStepTickPending = false;
+    m_dfLockStepTick = -1;
+    m_dfLockStepFirstIterate = -1;
+    m_nLockStepIterates = 0;
+    m_nLockStepStalls = 0;
     m_bSortMailByTime = true;
 	m_bAppError = false;
     m_bQuitOnIterateFail = false;
@@ -203,7 +212,7 @@ void CMOOSApp::PrintDefaultCommandLineSwitches()
 
 
 
-	std::cout<<"  --moos_iterate_Mode=<0,1,2> : set app iterate mode \n";
+	std::cout<<"  --moos_iterate_Mode=<0,1,2,3> : set app iterate mode \n";
 	std::cout<<"  --moos_time_warp=<number>   : set time warp \n";
     std::cout<<"  --moos_suicide_channel=<str>: suicide monitoring channel (IP address) \n";
     std::cout<<"  --moos_suicide_port=<int>   : suicide monitoring port  \n";
@@ -216,6 +225,7 @@ void CMOOSApp::PrintDefaultCommandLineSwitches()
 	std::cout<<"  --moos_no_comms             : don't start communications \n";
 	std::cout<<"  --moos_quiet                : don't print banner information \n";
 	std::cout<<"  --moos_quit_on_iterate_fail : quit if iterate fails \n";
+	std::cout<<"  --moos_lockstep             : run on simulated time served by MOOSDB \n";
 	std::cout<<"  --moos_no_colour            : disable colour printing \n";
     std::cout<<"  --moos_suicide_disable      : disable suicide monitoring \n";
     std::cout<<"  --moos_suicide_print        : print suicide conditions \n";
@@ -578,10 +588,30 @@ bool CMOOSApp::Configure()
 		case 0: SetIterateMode(REGULAR_ITERATE_AND_MAIL); break;
 		case 1: SetIterateMode(COMMS_DRIVEN_ITERATE_AND_MAIL); break;
 		case 2: SetIterateMode(REGULAR_ITERATE_AND_COMMS_DRIVEN_MAIL); break;
+		case 3: SetIterateMode(DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL); break;
 		default:SetIterateMode(REGULAR_ITERATE_AND_MAIL); break;
 
 	}
 
+	//are we running on simulated time served by a lockstep MOOSDB?
+	//this is a mission wide (global) setting as all apps must take part
+    m_MissionReader.GetValue("LockStep",m_bLockStep);
+    if(GetFlagFromCommandLineOrConfigurationFile("moos_lockstep"))
+    {
+        m_bLockStep = true;
+    }
+    if(m_bLockStep && !m_Comms.IsAsynchronous())
+    {
+        std::cerr<<"lockstep needs an asynchronous client - ignoring LockStep\n";
+        m_bLockStep = false;
+    }
+    if(m_bLockStep)
+    {
+        //the acknowledgement must leave after everything else we write
+        //in a tick so it goes in the lowest priority lane
+        m_Comms.SetOutgoingPriority(MOOS_LOCKSTEP_DONE,"low");
+    }
+
 
 
 	//do we want to enable command filtering (default is set in constructor)
@@ -664,6 +694,9 @@ void CMOOSApp::DoBanner()
 				std::cout<<"at up to "<<m_dfMaxAppTick<<"Hz\n";
 
 			break;
+		case DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL:
+			std::cout<<" |--Iterate Mode 3 :\n   -Iterate on a fixed schedule at "<<m_dfFreq<<" Hz. \n   |-Immediate message delivery\n";
+			break;
 		}
 	}
 	else
@@ -672,6 +705,8 @@ void CMOOSApp::DoBanner()
 		MOOSTrace(" |\t Baseline CommsTick @ %d Hz\n",m_nCommsFreq);
 	}
 
+	if(m_bLockStep)
+		MOOSTrace(" |--Lockstep : iterate and mail driven by MOOSDB simulated time\n");
 	if(GetMOOSTimeWarp()!=1.0)
 		MOOSTrace("\t|-Time Warp @ %.1f \n",GetMOOSTimeWarp());
 	if(m_Comms.GetCommsControlTimeWarpScaleFactor()>0.0  && GetMOOSTimeWarp()>1.0)
@@ -726,6 +761,9 @@ bool CMOOSApp::DoRunWork()
         }
         
 
+        if(m_bLockStep)
+            bIterateRequired = IsLockStepIterateDue();
+
         if(m_Comms.IsConnected() ||  CanIterateWithoutComms() )
         {
             //do private work
@@ -754,6 +792,13 @@ bool CMOOSApp::DoRunWork()
             
             m_nIterateCount++;
         }
+
+        //tell the DB we have finished with this tick
+        if(m_bLockStepTickPending)
+        {
+            m_Comms.Notify(MOOS_LOCKSTEP_DONE,m_dfLockStepTick);
+            m_bLockStepTickPending = false;
+        }
     }
     else
     {
@@ -803,12 +848,27 @@ void CMOOSApp::SleepAsRequired(bool &  bIterateShouldRun)
 	bIterateShouldRun = true;
 
 	//do we need to sleep at all?
-	if(m_dfFreq<=0.0)
+	if(m_dfFreq<=0.0 && !m_bLockStep)
 	{
 		//no we are being told to go flat out
 		return;
 	}
 
+#ifdef ASYNCHRONOUS_CLIENT
+	if(m_bLockStep)
+	{
+		WaitForLockStepTick();
+		bIterateShouldRun = false;
+		return;
+	}
+
+	if(m_IterationMode==DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL)
+	{
+		WaitForMailOrDeadline(bIterateShouldRun);
+		return;
+	}
+#endif
+
 	//first thing we do is look to see how long we need to sleep in
 	//vanilla case
 	int nAppPeriod_ms = static_cast<int> (1000.0/m_dfFreq);
@@ -890,6 +950,113 @@ void CMOOSApp::SleepAsRequired(bool &  bIterateShouldRun)
 
 }
 
+void CMOOSApp::WaitForMailOrDeadline(bool &  bIterateShouldRun)
+{
+#ifdef ASYNCHRONOUS_CLIENT
+	//the schedule runs on a monotonic (wall) clock so the period shrinks
+	//with time warp just as it does in the other modes
+	double dfPeriod = 1.0/(m_dfFreq*GetMOOSTimeWarp());
+	double dfNow = MOOS::MonotonicTime();
+
+	if(m_dfNextIterateDeadline<0.0)
+		m_dfNextIterateDeadline = dfNow;
+
+	while(true)
+	{
+		if(dfNow>=m_dfNextIterateDeadline)
+		{
+			//time to iterate - note how late we are
+			double dfLate = dfNow-m_dfNextIterateDeadline;
+			if(m_IterateLateness.size()<4096)
+				m_IterateLateness.push_back(dfLate);
+
+			//next deadline is one period on from the last one (not from now)
+			//so the rate does not drift. If we have missed whole periods
+			//don't try to catch up - start afresh from now.
+			m_dfNextIterateDeadline+=dfPeriod;
+			if(m_dfNextIterateDeadline<=dfNow)
+			{
+				m_nIterateOverruns+=static_cast<unsigned int>((dfNow-m_dfNextIterateDeadline)/dfPeriod)+1;
+				m_dfNextIterateDeadline = dfNow+dfPeriod;
+			}
+
+			bIterateShouldRun = true;
+			return;
+		}
+
+		//mail is handed over as soon as it arrives
+		bIterateShouldRun = false;
+		if(m_Comms.GetNumberOfUnreadMessages()>0)
+			return;
+
+		long nWait_us = static_cast<long>(1e6*(m_dfNextIterateDeadline-dfNow))+1;
+		if(m_pMailEvent->tryWaitMicroseconds(nWait_us))
+			return;
+
+		dfNow = MOOS::MonotonicTime();
+	}
+#else
+	bIterateShouldRun = true;
+#endif
+}
+
+
+void CMOOSApp::WaitForLockStepTick()
+{
+#ifdef ASYNCHRONOUS_CLIENT
+	//nothing happens until mail (hopefully the next tick) arrives
+	if(m_Comms.GetNumberOfUnreadMessages()>0 || m_pMailEvent->tryWait(500))
+		return;
+
+	if(!m_Comms.IsConnected())
+		return;
+
+	//Nothing for a while. The DB only pushes mail when it is sent a
+	//notification so if a tick was published when a client left it may be
+	//sat in our outbox - poke it. Repeats are ignored by the DB.
+	if(m_dfLockStepTick<0.0)
+		m_Comms.Notify(MOOS_LOCKSTEP_JOIN,GetAppName());
+	else
+		m_Comms.Notify(MOOS_LOCKSTEP_DONE,m_dfLockStepTick);
+
+	if(++m_nLockStepStalls==10 && m_dfLockStepTick<0.0)
+	{
+		std::cerr<<MOOS::ConsoleColours::yellow()<<"no "<<MOOS_LOCKSTEP_TICK
+				<<" received - is the MOOSDB running with --lockstep?\n"<<MOOS::ConsoleColours::reset();
+	}
+#endif
+}
+
+bool CMOOSApp::IsLockStepIterateDue()
+{
+	if(!m_bLockStepTickPending)
+		return false;
+
+	//flat out means every tick
+	if(m_dfFreq<=0.0)
+		return true;
+
+	//AppTick is honoured in simulated time. Iterations are due at whole
+	//multiples of the period from the first one - summing periods would
+	//accumulate rounding error (times are large numbers).
+	double dfPeriod = 1.0/m_dfFreq;
+	if(m_dfLockStepFirstIterate<0.0)
+	{
+		m_dfLockStepFirstIterate = m_dfLockStepTick;
+		m_nLockStepIterates = 0;
+	}
+
+	//allow for rounding when the period is a multiple of the DB's step
+	double dfDue = m_dfLockStepFirstIterate+m_nLockStepIterates*dfPeriod;
+	if(m_dfLockStepTick<dfDue-1e-4*dfPeriod)
+		return false;
+
+	//skip any whole periods we have stepped over
+	m_nLockStepIterates = static_cast<unsigned long>(
+			(m_dfLockStepTick-m_dfLockStepFirstIterate)/dfPeriod+1e-4)+1;
+
+	return true;
+}
 
 bool CMOOSApp::AddMessageRouteToActiveQueue(const std::string & sQueueName,
                     const std::string & sMsgName)
@@ -1499,6 +1666,23 @@ std::string CMOOSApp::MakeStatusString()
     }
 
 
+    if(m_IterationMode==DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL && !m_IterateLateness.empty())
+    {
+        //how late (ms) Iterate started over the last status period
+        std::vector<double> L = m_IterateLateness;
+        std::vector<double>::iterator p99 = L.begin()+(L.size()*99)/100;
+        std::nth_element(L.begin(),p99,L.end());
+        double dfMean = 0.0;
+        for(std::vector<double>::iterator q = L.begin();q!=L.end();++q)
+            dfMean+=*q;
+        dfMean/=L.size();
+
+        ssStatus<<MOOSFormat("iterate_jitter_mean_ms=%.3f,",1e3*dfMean);
+        ssStatus<<MOOSFormat("iterate_jitter_p99_ms=%.3f,",1e3*(*p99));
+        ssStatus<<MOOSFormat("iterate_jitter_max_ms=%.3f,",1e3*(*std::max_element(L.begin(),L.end())));
+        ssStatus<<"iterate_overruns="<<m_nIterateOverruns<<",";
+    }
+
     ssStatus<<"MOOSName="<<GetAppName()<<",";
 
     ssStatus<<"Publishing=\"";
@@ -1524,6 +1708,14 @@ void CMOOSApp::OnConnectToServerPrivate()
     {
         m_Comms.Register(GetCommandKey(),0);
     }
+
+    if(m_bLockStep)
+    {
+        //registration is processed by the DB before the join so we
+        //can't miss the first tick
+        m_Comms.Register(MOOS_LOCKSTEP_TICK,0);
+        m_Comms.Notify(MOOS_LOCKSTEP_JOIN,GetAppName());
+    }
 }
 
 /** here we do our private mail processing*/
@@ -1532,6 +1724,45 @@ void CMOOSApp::OnNewMailPrivate(MOOSMSG_LIST & Mail)
     //look to handle a command string
     if(m_bCommandMessageFiltering)
         LookForAndHandleAppCommand(Mail);
+
+    if(m_bLockStep)
+        LookForLockStepTick(Mail);
+}
+
+void CMOOSApp::LookForLockStepTick(MOOSMSG_LIST & Mail)
+{
+    //ticks are consumed here - derived classes never see them
+    MOOSMSG_LIST::iterator q = Mail.begin();
+    while(q!=Mail.end())
+    {
+        if(q->GetKey()==MOOS_LOCKSTEP_TICK)
+        {
+            if(q->GetDouble()>m_dfLockStepTick)
+            {
+                m_dfLockStepTick = q->GetDouble();
+                m_bLockStepTickPending = true;
+                m_nLockStepStalls = 0;
+                SetMOOSVirtualTime(m_dfLockStepTick);
+            }
+            q = Mail.erase(q);
+        }
+        else
+        {
+            ++q;
+        }
+    }
+
+    //mail posted during the current tick may or may not have reached us
+    //yet depending on who ran first. To be repeatable we only ever hand
+    //over what was posted in earlier ticks - the rest waits for the next.
+    Mail.splice(Mail.begin(),m_LockStepHeldMail);
+    q = Mail.begin();
+    while(q!=Mail.end())
+    {
+        MOOSMSG_LIST::iterator r = q++;
+        if(r->GetTime()==m_dfLockStepTick)
+            m_LockStepHeldMail.splice(m_LockStepHeldMail.end(),Mail,r);
+    }
 }
 
 void CMOOSApp::IteratePrivate()
@@ -1542,5 +1773,9 @@ void CMOOSApp::IteratePrivate()
         MOOSToUpper(sStatus);
         m_Comms.Notify(sStatus,MakeStatusString());
         m_dfLastStatusTime = MOOSTime();
+
+        //jitter statistics are per status period
+        m_IterateLateness.clear();
+        m_nIterateOverruns = 0;
     }
 }
@@ -0,0 +1,4 @@
+//this file is auto generated and defines various preprocessor macros needed by the CMOOSApp
+#ifndef ASYNCHRONOUS_CLIENT
+#define ASYNCHRONOUS_CLIENT
+#endif
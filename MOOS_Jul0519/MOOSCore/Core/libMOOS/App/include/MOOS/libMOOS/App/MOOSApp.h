@@ -44,6 +44,7 @@
 #include "MOOS/libMOOS/App/ClientDefines.h"
 
 #include <set>
+#include <vector>
 #include <map>
 
 #define DEFAULT_MOOS_APP_COMMS_FREQ 5
@@ -430,7 +431,8 @@ protected:
 	{
 		REGULAR_ITERATE_AND_MAIL=0,
 		COMMS_DRIVEN_ITERATE_AND_MAIL,
-		REGULAR_ITERATE_AND_COMMS_DRIVEN_MAIL
+		REGULAR_ITERATE_AND_COMMS_DRIVEN_MAIL,
+		DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL
 	}m_IterationMode;
 
 	//set up the iteration mode of the app
@@ -723,6 +725,50 @@ private:
 
     /** controls the rate at which application runs */
     void SleepAsRequired(bool & bIterateShouldRun);
+
+    /** DEADLINE_ITERATE_AND_COMMS_DRIVEN_MAIL: wait until mail arrives or
+    the next iterate is due (whichever is first) */
+    void WaitForMailOrDeadline(bool & bIterateShouldRun);
+
+    /** monotonic time at which the next Iterate is due (deadline mode) */
+    double m_dfNextIterateDeadline;
+
+    /** how late each Iterate started since the last status message (deadline mode)*/
+    std::vector<double> m_IterateLateness;
+
+    /** number of whole periods missed since the last status message (deadline mode)*/
+    unsigned int m_nIterateOverruns;
+
+    /** lockstep: wait for mail (the next tick) to arrive */
+    void WaitForLockStepTick();
+
+    /** lockstep: has a tick arrived at which Iterate is due (AppTick in
+    simulated time)? */
+    bool IsLockStepIterateDue();
+
+    /** lockstep: pick ticks out of the mail and move our clock on */
+    void LookForLockStepTick(MOOSMSG_LIST & Mail);
+
+    /** true if time is served by a lockstep MOOSDB (LockStep=true) */
+    bool m_bLockStep;
+
+    /** a tick has arrived which we have not yet acknowledged */
+    bool m_bLockStepTickPending;
+
+    /** simulated time of the last tick (-1 before the first) */
+    double m_dfLockStepTick;
+
+    /** simulated time of the first Iterate (-1 before it) */
+    double m_dfLockStepFirstIterate;
+
+    /** Iterate is next due m_nLockStepIterates periods after the first */
+    unsigned long m_nLockStepIterates;
+
+    /** consecutive waits in which no tick arrived */
+    unsigned int m_nLockStepStalls;
+
+    /** mail posted during the current tick - delivered with the next one */
+    MOOSMSG_LIST m_LockStepHeldMail;
 	
 	/** ::Run continues forever or until this variable is false*/
 	bool m_bQuitRequested;
@@ -45,6 +45,7 @@
 
 #include "MOOS/libMOOS/Comms/MOOSAsyncCommClient.h"
 #include "MOOS/libMOOS/Comms/XPCTcpSocket.h"
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 
 #ifdef max
 #   undef min  // undefine so we can use std::min()
@@ -259,6 +260,33 @@ bool MOOSAsyncCommClient::WritingLoop() {
 
 
 
+void MOOSAsyncCommClient::ApplyOutgoingPolicy(MOOSMSG_LIST & StuffToSend)
+{
+    MOOS::ScopedLock L(OutgoingPolicyLock_);
+
+    //nothing configured - leave the mail exactly as posted
+    if (OutgoingPolicy_.empty() || StuffToSend.size() < 2)
+        return;
+
+    MOOS::PriorityOutbox Outbox;
+    while (!StuffToSend.empty())
+    {
+        MOOSMSG_LIST::iterator q = StuffToSend.begin();
+        std::map<std::string, std::pair<int, bool> >::const_iterator p;
+        if (q->IsType(MOOS_NOTIFY)
+                && (p = OutgoingPolicy_.find(q->GetKey())) != OutgoingPolicy_.end())
+        {
+            Outbox.Splice(StuffToSend, q, p->second.first, p->second.second);
+        }
+        else
+        {
+            Outbox.Splice(StuffToSend, q);
+        }
+    }
+
+    Outbox.Drain(StuffToSend);
+}
+
 bool MOOSAsyncCommClient::DoWriting() {
 
     //this is the IO Loop
@@ -271,6 +299,8 @@ bool MOOSAsyncCommClient::DoWriting() {
 
         OutGoingQueue_.AppendToOtherInConstantTime(StuffToSend);
 
+        ApplyOutgoingPolicy(StuffToSend);
+
         for (MOOSMSG_LIST::iterator q = StuffToSend.begin(); q
                 != StuffToSend.end(); ++q)
         {
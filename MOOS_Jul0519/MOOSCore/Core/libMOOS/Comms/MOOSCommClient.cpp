@@ -58,6 +58,7 @@
 #include "MOOS/libMOOS/Utils/ThreadPriority.h"
 #include "MOOS/libMOOS/Utils/IPV4Address.h"
 #include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 
 #include "MOOS/libMOOS/Comms/XPCTcpSocket.h"
 #include "MOOS/libMOOS/Comms/MOOSCommClient.h"
@@ -1371,6 +1372,61 @@ bool CMOOSCommClient::Register(const std::string & sVarPattern,const std::string
 	return Post(MsgR);
 }
 
+bool CMOOSCommClient::Register(const std::string & sVar,double dfInterval,
+                               const std::string & sPriority, bool bCoalesce)
+{
+	if(!IsConnected())
+		return false;
+
+	if(sVar.empty())
+		return MOOSFail("\n ** WARNING ** Cannot register for \"\" (empty string)\n");
+
+	//the options ride in the (otherwise unused) string field
+	CMOOSMsg MsgR(MOOS_REGISTER,sVar.c_str(),dfInterval);
+	MOOSAddValToString(MsgR.m_sVal,"Priority",sPriority);
+	MOOSAddValToString(MsgR.m_sVal,"Coalesce",bCoalesce ? "true" : "false");
+
+	bool bSuccess =  Post(MsgR);
+	if(bSuccess)
+	{
+		m_Registered.insert(sVar);
+	}
+	return bSuccess;
+}
+
+bool CMOOSCommClient::Register(const std::string & sVarPattern,const std::string & sAppPattern,
+                               double dfInterval, const std::string & sPriority, bool bCoalesce)
+{
+	std::string sMsg;
+
+	if(sVarPattern.empty())
+	{
+		return MOOSFail("empty variable pattern in CMOOSCommClient::Register");
+	}
+
+	if(sAppPattern.empty())
+	{
+		return MOOSFail("empty source pattern in CMOOSCommClient::Register");
+	}
+
+	MOOSAddValToString(sMsg,"AppPattern",sAppPattern);
+	MOOSAddValToString(sMsg,"VarPattern",sVarPattern);
+	MOOSAddValToString(sMsg,"Interval",dfInterval);
+	MOOSAddValToString(sMsg,"Priority",sPriority);
+	MOOSAddValToString(sMsg,"Coalesce",bCoalesce ? "true" : "false");
+
+	CMOOSMsg MsgR(MOOS_WILDCARD_REGISTER,m_sMyName,sMsg);
+
+	return Post(MsgR);
+}
+
+void CMOOSCommClient::SetOutgoingPriority(const std::string & sVar,
+                                          const std::string & sPriority, bool bCoalesce)
+{
+	MOOS::ScopedLock L(OutgoingPolicyLock_);
+	OutgoingPolicy_[sVar] = std::make_pair(MOOS::PriorityOutbox::PriorityFromString(sPriority),bCoalesce);
+}
+
 
 
 bool CMOOSCommClient::IsRegisteredFor(const std::string & sVariable)
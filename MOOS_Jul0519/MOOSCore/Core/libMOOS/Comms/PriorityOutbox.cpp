@@ -0,0 +1,224 @@
+/*
+ * PriorityOutbox.cpp
+ *
+ *  An outbox of messages split into priority lanes with optional
+ *  "latest value only" coalescing per variable.
+ */
+
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+#include <iterator>
+
+namespace MOOS {
+
+PriorityOutbox::PriorityOutbox() {
+	size_ = 0;
+	coalesced_ = 0;
+}
+
+PriorityOutbox::PriorityOutbox(const PriorityOutbox & Other) {
+	size_ = 0;
+	coalesced_ = 0;
+	*this = Other;
+}
+
+PriorityOutbox & PriorityOutbox::operator=(const PriorityOutbox & Other)
+{
+	if(this==&Other)
+		return *this;
+
+	Clear();
+	for(int i = HIGH;i<NUM_PRIORITIES;i++)
+	{
+		lanes_[i] = Other.lanes_[i];
+		queued_at_[i] = Other.queued_at_[i];
+	}
+
+	//the index holds iterators so translate them by position
+	std::map<std::string, Slot>::const_iterator q;
+	for(q = Other.coalesce_index_.begin();q!=Other.coalesce_index_.end();++q)
+	{
+		const Slot & rTheirs = q->second;
+		MOOSMSG_LIST::const_iterator Theirs = rTheirs.msg_;
+		MOOSMSG_LIST::difference_type n = std::distance(Other.lanes_[rTheirs.lane_].begin(),Theirs);
+
+		Slot Mine;
+		Mine.lane_ = rTheirs.lane_;
+		Mine.msg_ = lanes_[Mine.lane_].begin();
+		std::advance(Mine.msg_,n);
+		Mine.queued_at_ = queued_at_[Mine.lane_].begin();
+		std::advance(Mine.queued_at_,n);
+		coalesce_index_[q->first] = Mine;
+	}
+
+	size_ = Other.size_;
+	coalesced_ = Other.coalesced_;
+	return *this;
+}
+
+int PriorityOutbox::ClampPriority(int nPriority)
+{
+	if(nPriority<HIGH)
+		return HIGH;
+	if(nPriority>LOW)
+		return LOW;
+	return nPriority;
+}
+
+int PriorityOutbox::PriorityFromString(const std::string & sPriority)
+{
+	if(MOOSStrCmp(sPriority,"high"))
+		return HIGH;
+	if(MOOSStrCmp(sPriority,"low"))
+		return LOW;
+	return NORMAL;
+}
+
+std::string PriorityOutbox::PriorityToString(int nPriority)
+{
+	switch(ClampPriority(nPriority))
+	{
+	case HIGH:
+		return "high";
+	case LOW:
+		return "low";
+	default:
+		return "normal";
+	}
+}
+
+bool PriorityOutbox::FindCoalesced(const std::string & sKey, int nPriority, Slot & S)
+{
+	std::map<std::string, Slot>::iterator q = coalesce_index_.find(sKey);
+	if(q==coalesce_index_.end())
+		return false;
+
+	S = q->second;
+	if(S.lane_==nPriority)
+		return true;
+
+	//the subscription changed lanes - drop the old message, the new one
+	//will be queued at the back of its new lane
+	lanes_[S.lane_].erase(S.msg_);
+	queued_at_[S.lane_].erase(S.queued_at_);
+	coalesce_index_.erase(q);
+	size_--;
+	coalesced_++;
+	return false;
+}
+
+bool PriorityOutbox::Push(const CMOOSMsg & M, int nPriority, bool bCoalesce, double dfQueuedAt)
+{
+	nPriority = ClampPriority(nPriority);
+
+	if(bCoalesce)
+	{
+		Slot S;
+		if(FindCoalesced(M.GetKey(),nPriority,S))
+		{
+			//newest value takes the place of the unsent older one
+			*S.msg_ = M;
+			*S.queued_at_ = dfQueuedAt;
+			coalesced_++;
+			return false;
+		}
+	}
+
+	lanes_[nPriority].push_back(M);
+	queued_at_[nPriority].push_back(dfQueuedAt);
+	size_++;
+
+	if(bCoalesce)
+	{
+		Slot S;
+		S.lane_ = nPriority;
+		S.msg_ = --lanes_[nPriority].end();
+		S.queued_at_ = --queued_at_[nPriority].end();
+		coalesce_index_[M.GetKey()] = S;
+	}
+
+	return true;
+}
+
+bool PriorityOutbox::Splice(MOOSMSG_LIST & Source, MOOSMSG_LIST::iterator it,
+		int nPriority, bool bCoalesce, double dfQueuedAt)
+{
+	nPriority = ClampPriority(nPriority);
+	MOOSMSG_LIST & rLane = lanes_[nPriority];
+
+	if(bCoalesce)
+	{
+		Slot S;
+		if(FindCoalesced(it->GetKey(),nPriority,S))
+		{
+			//move the new message in front of the old one then drop the old
+			rLane.splice(S.msg_,Source,it);
+			rLane.erase(S.msg_);
+			*S.queued_at_ = dfQueuedAt;
+			coalesce_index_[it->GetKey()].msg_ = it;
+			coalesced_++;
+			return false;
+		}
+	}
+
+	rLane.splice(rLane.end(),Source,it);
+	queued_at_[nPriority].push_back(dfQueuedAt);
+	size_++;
+
+	if(bCoalesce)
+	{
+		Slot S;
+		S.lane_ = nPriority;
+		S.msg_ = it;
+		S.queued_at_ = --queued_at_[nPriority].end();
+		coalesce_index_[it->GetKey()] = S;
+	}
+
+	return true;
+}
+
+void PriorityOutbox::Drain(MOOSMSG_LIST & Out, std::vector<double> * pQueuedAt)
+{
+	for(int i = HIGH;i<NUM_PRIORITIES;i++)
+	{
+		if(pQueuedAt!=NULL)
+			pQueuedAt->insert(pQueuedAt->end(),queued_at_[i].begin(),queued_at_[i].end());
+
+		Out.splice(Out.end(),lanes_[i]);
+		queued_at_[i].clear();
+	}
+	coalesce_index_.clear();
+	size_ = 0;
+}
+
+void PriorityOutbox::Discard(size_t n)
+{
+	for(int i = LOW;i>=HIGH && n>0;i--)
+	{
+		MOOSMSG_LIST & rLane = lanes_[i];
+		while(n>0 && !rLane.empty())
+		{
+			std::map<std::string, Slot>::iterator q = coalesce_index_.find(rLane.front().GetKey());
+			if(q!=coalesce_index_.end() && q->second.msg_==rLane.begin())
+				coalesce_index_.erase(q);
+
+			rLane.pop_front();
+			queued_at_[i].pop_front();
+			size_--;
+			n--;
+		}
+	}
+}
+
+void PriorityOutbox::Clear()
+{
+	for(int i = HIGH;i<NUM_PRIORITIES;i++)
+	{
+		lanes_[i].clear();
+		queued_at_[i].clear();
+	}
+	coalesce_index_.clear();
+	size_ = 0;
+}
+
+}
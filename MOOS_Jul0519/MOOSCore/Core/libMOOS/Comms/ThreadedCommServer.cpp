@@ -275,7 +275,9 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
             if(m_bQuiet)
                 InhibitMOOSTraceInThisThread(false);
 
-            double dfTNow = MOOS::Time();
+            //under lockstep MOOS::Time() stands still between ticks so
+            //only then fall back to the wall clock
+            double dfTNow = IsMOOSTimeVirtual() ? MOOSLocalTime(false) : MOOS::Time();
 
             MOOSMSG_LIST MsgLstRx,MsgLstTx;
 
@@ -297,7 +299,7 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
             {
             	if(q->IsType(MOOS_NOTIFY))
             	{
-            		if(dfTNow-q->GetTime()>dfLargeDelay)
+            		if(!IsMOOSTimeVirtual() && dfTNow-q->GetTime()>dfLargeDelay)
             		{
             			std::cout<<"WARNING : Message "<<q->GetKey()<<" from "<<q->GetSource()<<" is "<<(dfTNow-q->GetTime())*1000<<" ms delayed\n";
             		}
@@ -600,7 +602,7 @@ bool ThreadedCommServer::ClientThread::AsynchronousReadLoop()
     struct timeval timeout;        // The timeout value for the select system call
     fd_set fdset;                // Set of "watched" file descriptors
 
-    double dfLastGoodComms = MOOSLocalTime();
+    double dfLastGoodComms = MOOSLocalTime(false);
 
     //this is an io-bound important thread...
     if(m_bBoostThread)
@@ -827,7 +829,7 @@ bool ThreadedCommServer::ClientThread::HandleClientWrite()
         	throw std::runtime_error("failed packet read and no exception handled");
         }
 
-        m_ClientSocket.SetReadTime(MOOS::Time());
+        m_ClientSocket.SetReadTime(IsMOOSTimeVirtual() ? MOOSLocalTime(false) : MOOS::Time());
 
         //push this data back to the central thread
         m_SharedDataIncoming.Push(SDUpChain);
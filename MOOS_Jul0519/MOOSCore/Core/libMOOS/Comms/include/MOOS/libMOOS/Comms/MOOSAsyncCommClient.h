@@ -130,6 +130,13 @@ namespace MOOS
 	     */
 	    bool DoWriting();
 
+	    /**
+	     * reorder (and coalesce) a batch of outgoing mail according to
+	     * the policy set by SetOutgoingPriority
+	     * @param StuffToSend mail about to be written
+	     */
+	    void ApplyOutgoingPolicy(MOOSMSG_LIST & StuffToSend);
+
 
 	    //data members below here
 	    CMOOSThread WritingThread_; //handles writing
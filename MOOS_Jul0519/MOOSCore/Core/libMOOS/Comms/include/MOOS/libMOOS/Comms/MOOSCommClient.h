@@ -118,6 +118,33 @@ public:
      */
     bool Register(const std::string & sVarPattern,const std::string & sAppPattern, double dfInterval);
 
+    /**
+     * Register asking the DB to hold notifications for us in a priority lane
+     * @param sVar name of variable of interest
+     * @param dfInterval minimum time between notifications
+     * @param sPriority "high", "normal" or "low" - high priority mail is
+     * delivered ahead of everything else waiting for us
+     * @param bCoalesce if true only the newest unsent value of sVar is kept
+     * @return true on success
+     */
+    bool Register(const std::string & sVar,double dfInterval,
+                  const std::string & sPriority, bool bCoalesce=false);
+
+    /** Wild card registration with a priority lane and optional coalescing */
+    bool Register(const std::string & sVarPattern,const std::string & sAppPattern,
+                  double dfInterval, const std::string & sPriority, bool bCoalesce=false);
+
+    /**
+     * Set how notifications of sVar are queued when written by an
+     * asynchronous client. High priority mail is written ahead of anything
+     * else waiting and with bCoalesce only the newest unsent value is kept.
+     * @param sVar name of variable
+     * @param sPriority "high", "normal" or "low"
+     * @param bCoalesce keep only the latest value
+     */
+    void SetOutgoingPriority(const std::string & sVar,
+                             const std::string & sPriority, bool bCoalesce=false);
+
 
     /** UnRegister for notification in changes of named variable
     @param sVar name of variable of interest*/
@@ -621,6 +648,17 @@ protected:
      */
     CMOOSLock ActiveQueuesLock_;
 
+    /**
+     * outgoing priority lane and coalescing for named variables
+     * @see SetOutgoingPriority
+     */
+    std::map<std::string, std::pair<int,bool> > OutgoingPolicy_;
+
+    /*
+     * a mutex protecting OutgoingPolicy_
+     */
+    CMOOSLock OutgoingPolicyLock_;
+
     /*
      * an inernal helper function which sorts some mail into
      * active queues (if any have been installed)
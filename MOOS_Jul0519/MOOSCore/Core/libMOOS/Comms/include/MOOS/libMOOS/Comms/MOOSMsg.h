@@ -62,6 +62,11 @@
 //5 seconds time difference between client clock and MOOSDB clock will be allowed
 #define SKEW_TOLERANCE 5
 
+//variables used between a lockstep MOOSDB (the time server) and its clients
+#define MOOS_LOCKSTEP_JOIN "MOOS_LOCKSTEP_JOIN"
+#define MOOS_LOCKSTEP_DONE "MOOS_LOCKSTEP_DONE"
+#define MOOS_LOCKSTEP_TICK "MOOS_LOCKSTEP_TICK"
+
 /** @brief MOOS Comms Messaging class.
 This is a class encapsulating the data which the MOOS Comms API shuttles
 between the MOOSDB and other clients. It is the fundamental datatype of
@@ -0,0 +1,106 @@
+/*
+ * PriorityOutbox.h
+ *
+ *  An outbox of messages split into priority lanes with optional
+ *  "latest value only" coalescing per variable. Used by the DB for the
+ *  mail it holds for each client and by MOOSAsyncCommClient for the mail
+ *  it is about to write. Not thread safe - owners supply locking.
+ */
+
+#ifndef PRIORITYOUTBOX_H_
+#define PRIORITYOUTBOX_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "MOOS/libMOOS/Comms/MOOSMsg.h"
+#include "MOOS/libMOOS/Comms/CommsTypes.h"
+
+namespace MOOS {
+
+class PriorityOutbox {
+public:
+	enum Priority
+	{
+		HIGH = 0,
+		NORMAL = 1,
+		LOW = 2,
+		NUM_PRIORITIES = 3
+	};
+
+	PriorityOutbox();
+
+	/** copies rebuild the coalescing index against their own lanes */
+	PriorityOutbox(const PriorityOutbox & Other);
+	PriorityOutbox & operator=(const PriorityOutbox & Other);
+
+	/**
+	 * copy a message into the outbox.
+	 * @param M message to queue
+	 * @param nPriority lane to queue in (HIGH, NORMAL or LOW)
+	 * @param bCoalesce if true and an unsent message with the same key is
+	 * already queued, M replaces it (taking its place in the queue)
+	 * @param dfQueuedAt time stamp recorded alongside the message
+	 * @return true if M was appended, false if it replaced an older message
+	 */
+	bool Push(const CMOOSMsg & M, int nPriority = NORMAL,
+			bool bCoalesce = false, double dfQueuedAt = 0.0);
+
+	/**
+	 * as Push() but moves the element pointed to by it out of Source
+	 * rather than copying it
+	 */
+	bool Splice(MOOSMSG_LIST & Source, MOOSMSG_LIST::iterator it,
+			int nPriority = NORMAL, bool bCoalesce = false,
+			double dfQueuedAt = 0.0);
+
+	/**
+	 * move everything to the end of Out, highest priority first and in
+	 * queue order within a lane. Leaves the outbox empty.
+	 * @param pQueuedAt if not NULL the queue time of each message is
+	 * appended here in the same order
+	 */
+	void Drain(MOOSMSG_LIST & Out, std::vector<double> * pQueuedAt = NULL);
+
+	/** remove the n oldest messages from the lowest priority lanes first */
+	void Discard(size_t n);
+
+	void Clear();
+
+	size_t Size() const {return size_;}
+	bool Empty() const {return size_==0;}
+
+	/** how many messages have been replaced by newer ones (ever) */
+	unsigned long Coalesced() const {return coalesced_;}
+
+	/** "high", "normal" or "low" (case insensitive) to a lane index */
+	static int PriorityFromString(const std::string & sPriority);
+	static std::string PriorityToString(int nPriority);
+
+private:
+	static int ClampPriority(int nPriority);
+
+	struct Slot
+	{
+		int lane_;
+		MOOSMSG_LIST::iterator msg_;
+		std::list<double>::iterator queued_at_;
+	};
+
+	/** if a coalesced message for sKey is queued, take it out of the
+	index (and its lane if not in nPriority) returning true and its
+	position if it may be reused */
+	bool FindCoalesced(const std::string & sKey, int nPriority, Slot & S);
+
+	MOOSMSG_LIST lanes_[NUM_PRIORITIES];
+	std::list<double> queued_at_[NUM_PRIORITIES];
+	std::map<std::string, Slot> coalesce_index_;
+	size_t size_;
+	unsigned long coalesced_;
+};
+
+}
+
+#endif /* PRIORITYOUTBOX_H_ */
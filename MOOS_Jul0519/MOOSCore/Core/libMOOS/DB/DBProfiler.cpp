@@ -0,0 +1,344 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "MOOS/libMOOS/DB/DBProfiler.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace MOOS
+{
+
+//sub buckets per power of two and number of octaves covered
+static const unsigned int kSubBucketBits = 4;
+static const unsigned int kSubBuckets = 1<<kSubBucketBits;
+static const unsigned int kOctaves = 36;
+
+LatencyHistogram::LatencyHistogram()
+	: counts_(kSubBuckets*(kOctaves+1),0)
+{
+	total_ = 0;
+	sum_ = 0.0;
+	max_ = 0.0;
+}
+
+unsigned int LatencyHistogram::BucketIndex(unsigned long long nMicros)
+{
+	if(nMicros<kSubBuckets)
+		return static_cast<unsigned int>(nMicros);
+
+	//find the octave (position of the most significant bit)
+	unsigned int nOctave = 0;
+	unsigned long long n = nMicros;
+	while(n>>=1)
+		nOctave++;
+
+	unsigned int nShift = nOctave-kSubBucketBits;
+	unsigned int nSub = static_cast<unsigned int>((nMicros>>nShift)&(kSubBuckets-1));
+	unsigned int nIndex = kSubBuckets*(nShift+1)+nSub;
+
+	return std::min<unsigned int>(nIndex,kSubBuckets*(kOctaves+1)-1);
+}
+
+unsigned long long LatencyHistogram::BucketUpperValue(unsigned int nIndex)
+{
+	if(nIndex<kSubBuckets)
+		return nIndex;
+
+	unsigned int nShift = nIndex/kSubBuckets-1;
+	unsigned long long nLower = static_cast<unsigned long long>(kSubBuckets+nIndex%kSubBuckets)<<nShift;
+	return nLower+(1ULL<<nShift)-1;
+}
+
+void LatencyHistogram::Add(double dfSeconds)
+{
+	if(dfSeconds<0.0)
+		dfSeconds = 0.0;
+
+	counts_[BucketIndex(static_cast<unsigned long long>(dfSeconds*1e6))]++;
+	total_++;
+	sum_+=dfSeconds;
+	max_ = std::max(max_,dfSeconds);
+}
+
+double LatencyHistogram::Percentile(double dfFraction) const
+{
+	if(total_==0)
+		return 0.0;
+
+	unsigned long nTarget = static_cast<unsigned long>(dfFraction*total_+0.5);
+	nTarget = std::max<unsigned long>(nTarget,1);
+
+	unsigned long nSeen = 0;
+	for(unsigned int i = 0;i<counts_.size();i++)
+	{
+		nSeen+=counts_[i];
+		if(nSeen>=nTarget)
+			return std::min(BucketUpperValue(i)*1e-6,max_);
+	}
+	return max_;
+}
+
+double LatencyHistogram::Max() const
+{
+	return max_;
+}
+
+double LatencyHistogram::Mean() const
+{
+	return total_ ? sum_/total_ : 0.0;
+}
+
+unsigned long LatencyHistogram::Count() const
+{
+	return total_;
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram & Other)
+{
+	for(unsigned int i = 0;i<counts_.size();i++)
+		counts_[i]+=Other.counts_[i];
+	total_+=Other.total_;
+	sum_+=Other.sum_;
+	max_ = std::max(max_,Other.max_);
+}
+
+void LatencyHistogram::Clear()
+{
+	std::fill(counts_.begin(),counts_.end(),0);
+	total_ = 0;
+	sum_ = 0.0;
+	max_ = 0.0;
+}
+
+
+DBProfiler::ClientStats::ClientStats()
+{
+	msgs_in_ = 0;
+	bytes_in_ = 0;
+	msgs_out_ = 0;
+	bytes_out_ = 0;
+	depth_ = 0;
+	max_depth_ = 0;
+}
+
+DBProfiler::VarStats::VarStats()
+{
+	writes_ = 0;
+	bytes_ = 0;
+	deliveries_ = 0;
+}
+
+DBProfiler::DBProfiler()
+{
+	enabled_ = false;
+	start_time_ = MOOS::Time();
+}
+
+void DBProfiler::Enable(bool bEnable)
+{
+	enabled_ = bEnable;
+	if(enabled_)
+	{
+		start_time_ = MOOS::Time();
+		clients_.clear();
+		vars_.clear();
+	}
+}
+
+double DBProfiler::ToRealSeconds(double dfMOOSTimeInterval)
+{
+	return dfMOOSTimeInterval/GetMOOSTimeWarp();
+}
+
+void DBProfiler::OnReceived(const std::string & sClient, const CMOOSMsg & M)
+{
+	if(!enabled_)
+		return;
+
+	unsigned int nBytes = M.GetSizeInBytesWhenSerialised();
+
+	ClientStats & rClient = clients_[sClient];
+	rClient.msgs_in_++;
+	rClient.bytes_in_+=nBytes;
+
+	if(M.IsType(MOOS_NOTIFY))
+	{
+		VarStats & rVar = vars_[M.GetKey()];
+		rVar.writes_++;
+		rVar.bytes_+=nBytes;
+	}
+}
+
+void DBProfiler::OnQueued(const std::string & sClient, const CMOOSMsg & M,
+		double dfTimeNow, size_t nDepth)
+{
+	if(!enabled_)
+		return;
+
+	double dfLatency = ToRealSeconds(dfTimeNow-M.GetTime());
+
+	ClientStats & rClient = clients_[sClient];
+	rClient.rx_to_queue_.Add(dfLatency);
+	rClient.depth_ = nDepth;
+	rClient.max_depth_ = std::max(rClient.max_depth_,nDepth);
+
+	VarStats & rVar = vars_[M.GetKey()];
+	rVar.deliveries_++;
+	rVar.rx_to_queue_.Add(dfLatency);
+}
+
+void DBProfiler::OnSent(const std::string & sClient, const MOOSMSG_LIST & Outbox,
+		const std::vector<double> & QueuedAt, double dfTimeNow)
+{
+	if(!enabled_ || Outbox.empty())
+		return;
+
+	ClientStats & rClient = clients_[sClient];
+	rClient.depth_ = 0;
+
+	MOOSMSG_LIST::const_iterator q;
+	std::vector<double>::const_iterator t = QueuedAt.begin();
+	for(q = Outbox.begin();q!=Outbox.end();++q)
+	{
+		rClient.msgs_out_++;
+		rClient.bytes_out_+=q->GetSizeInBytesWhenSerialised();
+
+		//messages queued before profiling was enabled have no time stamp
+		if(t!=QueuedAt.end())
+		{
+			if(*t>0.0)
+				rClient.queue_to_tx_.Add(ToRealSeconds(dfTimeNow-*t));
+			++t;
+		}
+	}
+}
+
+void DBProfiler::OnDiscarded(const std::string & sClient)
+{
+	std::map<std::string, ClientStats>::iterator q = clients_.find(sClient);
+	if(q!=clients_.end())
+		q->second.depth_ = 0;
+}
+
+void DBProfiler::RemoveClient(const std::string & sClient)
+{
+	clients_.erase(sClient);
+}
+
+namespace
+{
+std::string FormatLatency(const LatencyHistogram & H)
+{
+	return MOOSFormat("%8.2f %8.2f %8.2f",
+			H.Percentile(0.5)*1e3,
+			H.Percentile(0.99)*1e3,
+			H.Max()*1e3);
+}
+
+struct HotterThan
+{
+	bool operator()(const std::pair<unsigned long, std::string> & a,
+			const std::pair<unsigned long, std::string> & b) const
+	{
+		return a.first>b.first;
+	}
+};
+}
+
+std::string DBProfiler::GetReport(unsigned int nTopK) const
+{
+	std::ostringstream ss;
+
+	if(!enabled_)
+	{
+		ss<<"profiling disabled (run MOOSDB with --profile)\n";
+		return ss.str();
+	}
+
+	double dfElapsed = std::max(MOOS::Time()-start_time_,1e-3);
+	ss<<MOOSFormat("DB profile over %.1f s (latencies in ms: p50 p99 max)\n\n",dfElapsed);
+
+	ss<<std::left<<std::setw(20)<<"client"
+			<<std::right
+			<<std::setw(10)<<"msgs_in"
+			<<std::setw(12)<<"bytes_in"
+			<<std::setw(10)<<"msgs_out"
+			<<std::setw(12)<<"bytes_out"
+			<<std::setw(8)<<"queue"
+			<<std::setw(8)<<"max_q"
+			<<"   rx->queue                  queue->tx\n";
+
+	std::map<std::string, ClientStats>::const_iterator c;
+	for(c = clients_.begin();c!=clients_.end();++c)
+	{
+		const ClientStats & rC = c->second;
+		ss<<std::left<<std::setw(20)<<c->first
+				<<std::right
+				<<std::setw(10)<<rC.msgs_in_
+				<<std::setw(12)<<rC.bytes_in_
+				<<std::setw(10)<<rC.msgs_out_
+				<<std::setw(12)<<rC.bytes_out_
+				<<std::setw(8)<<rC.depth_
+				<<std::setw(8)<<rC.max_depth_
+				<<"   "<<FormatLatency(rC.rx_to_queue_)
+				<<"   "<<FormatLatency(rC.queue_to_tx_)<<"\n";
+	}
+
+	//rank variables by the number of writes
+	std::vector<std::pair<unsigned long, std::string> > Ranked;
+	Ranked.reserve(vars_.size());
+	std::map<std::string, VarStats>::const_iterator v;
+	for(v = vars_.begin();v!=vars_.end();++v)
+		Ranked.push_back(std::make_pair(v->second.writes_,v->first));
+
+	unsigned int nShow = std::min<unsigned int>(nTopK,static_cast<unsigned int>(Ranked.size()));
+	std::partial_sort(Ranked.begin(),Ranked.begin()+nShow,Ranked.end(),HotterThan());
+
+	ss<<"\n"<<std::left<<std::setw(30)<<"variable"
+			<<std::right
+			<<std::setw(10)<<"writes"
+			<<std::setw(10)<<"hz"
+			<<std::setw(12)<<"bytes"
+			<<std::setw(12)<<"delivered"
+			<<"   rx->queue\n";
+
+	for(unsigned int i = 0;i<nShow;i++)
+	{
+		const VarStats & rV = vars_.find(Ranked[i].second)->second;
+		ss<<std::left<<std::setw(30)<<Ranked[i].second
+				<<std::right
+				<<std::setw(10)<<rV.writes_
+				<<std::setw(10)<<MOOSFormat("%.2f",rV.writes_/dfElapsed)
+				<<std::setw(12)<<rV.bytes_
+				<<std::setw(12)<<rV.deliveries_
+				<<"   "<<FormatLatency(rV.rx_to_queue_)<<"\n";
+	}
+
+	return ss.str();
+}
+
+}
@@ -370,8 +370,11 @@ bool CHTTPConnection::MakeWebPage()
         if(!m_pMOOSComms->IsConnected())
             throw CMOOSException("No DB Connection");
 
+        //the profile page is not a variable - ask the DB for its report
+        bool bProfile = MOOSStrCmp(m_sFocusVariable,"DB_PROFILE");
+
         MOOSMSG_LIST MsgList;
-        if(!m_pMOOSComms->ServerRequest("ALL",MsgList))
+        if(!m_pMOOSComms->ServerRequest(bProfile ? "DB_PROFILE" : "ALL",MsgList))
             throw CMOOSException("Failed ServerRequest");
 
         
@@ -393,7 +396,11 @@ bool CHTTPConnection::MakeWebPage()
                 CHTMLTag CellData(wp,"TD","valign=\"middle\" align=\"center\"");
 
 
-                if(m_sFocusVariable.empty())
+                if(bProfile)
+                {
+                    BuildProfileWebPageContents(wp,MsgList);
+                }
+                else if(m_sFocusVariable.empty())
                 {
                     //we have no focus variable eg localhost:9080/DB_TIME
                     //so show the whole load
@@ -487,6 +494,24 @@ bool CHTTPConnection::BuildSingleVariableWebPageContents( std::ostringstream & w
     return true;
 }
 
+bool CHTTPConnection::BuildProfileWebPageContents( std::ostringstream & wp,MOOSMSG_LIST & MsgList)
+{
+    wp<<CHTMLTag::Print("H1","ALIGN=middle","Profile of MOOSDB : "+m_pMOOSComms->GetDescription());
+
+    CMOOSMsg Msg;
+    if(m_pMOOSComms->PeekMail(MsgList,"DB_PROFILE",Msg))
+    {
+        CHTMLTag Pre(wp,"PRE","style=\"text-align:left\"");
+        wp<<Msg.GetString();
+    }
+
+    wp<<"<p>\r\n";
+    wp<<CHTMLTag::Print("A","href = /","home");
+    wp<<CHTMLTag::Print("A","href = /DB_PROFILE","refresh");
+
+    return true;
+}
+
 bool CHTTPConnection::BuildFullDBWebPageContents( std::ostringstream & wp,MOOSMSG_LIST & MsgList)
 {
 
@@ -548,7 +573,7 @@ bool CHTTPConnection::BuildFullDBWebPageContents( std::ostringstream & wp,MOOSMS
     }
 
 
-    wp<<CHTMLTag::Print("p","","Click on a name column for individual variable pages. <A href = /> refresh </A>");
+    wp<<CHTMLTag::Print("p","","Click on a name column for individual variable pages. <A href = /> refresh </A> <A href = /DB_PROFILE> profile </A>");
 
 
     //make a Poke table
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "MOOS/libMOOS/DB/LockStepClock.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+namespace MOOS
+{
+
+LockStepClock::LockStepClock()
+{
+	enabled_ = false;
+	step_ = 0.05;
+	min_participants_ = 1;
+	start_ = -1.0;
+	now_ = 0.0;
+	ticks_ = 0;
+}
+
+void LockStepClock::Configure(double dfStep, unsigned int nMinParticipants, double dfStart)
+{
+	if(dfStep>0.0)
+		step_ = dfStep;
+	min_participants_ = nMinParticipants>0 ? nMinParticipants : 1;
+	start_ = dfStart;
+}
+
+void LockStepClock::Enable(bool bEnable)
+{
+	enabled_ = bEnable;
+}
+
+bool LockStepClock::ReadyToAdvance() const
+{
+	if(!enabled_ || participants_.empty())
+		return false;
+
+	if(ticks_==0)
+		return participants_.size()>=min_participants_;
+
+	return waiting_for_.empty();
+}
+
+bool LockStepClock::Join(const std::string & sClient)
+{
+	participants_.insert(sClient);
+	return ReadyToAdvance();
+}
+
+bool LockStepClock::Done(const std::string & sClient, double dfTickTime)
+{
+	if(ticks_==0 || dfTickTime!=now_)
+		return false;
+
+	if(waiting_for_.erase(sClient)==0)
+		return false;
+
+	return ReadyToAdvance();
+}
+
+bool LockStepClock::Leave(const std::string & sClient)
+{
+	bool bWasParticipant = participants_.erase(sClient)>0;
+	waiting_for_.erase(sClient);
+	return bWasParticipant && ticks_>0 && ReadyToAdvance();
+}
+
+double LockStepClock::Advance()
+{
+	if(ticks_==0 && start_<0.0)
+		start_ = MOOSLocalTime(false);
+
+	//time is a multiple of the step from the start so that rounding
+	//does not accumulate over long runs
+	now_ = start_+ticks_*step_;
+	ticks_++;
+
+	waiting_for_ = participants_;
+	return now_;
+}
+
+}
@@ -235,6 +235,10 @@ void PrintHelpAndExit()
 	std::cout<<"--audit_port=<unsigned int>        specify port on which to transmit statistics\n";
     std::cout<<"--event_log=<file name>            specify file in which to record events\n";
     std::cout<<"--print_heart_beat                 indicate DB heartbeat every second\n";
+    std::cout<<"--profile                          record per client/variable latency statistics\n";
+    std::cout<<"--lockstep                         serve simulated time, advancing when all clients are done\n";
+    std::cout<<"--lockstep_dt=<positive_float>     simulated seconds per lockstep tick (default 0.05)\n";
+    std::cout<<"--lockstep_clients=<unsigned int>  clients to wait for before the first tick (default 1)\n";
 
 
 
@@ -340,6 +344,35 @@ bool CMOOSDB::Run(int argc,  char * argv[] )
     }
 
 
+    ///////////////////////////////////////////////////////////
+    //do we want to record latency histograms and traffic statistics?
+    bool bProfile = false;
+    m_MissionReader.GetValue("DBProfile",bProfile);
+    if(P.GetFlag("--profile"))
+        bProfile = true;
+    m_Profiler.Enable(bProfile);
+
+    ///////////////////////////////////////////////////////////
+    //are we serving simulated time to lockstep clients?
+    bool bLockStep = false;
+    m_MissionReader.GetValue("LockStep",bLockStep);
+    if(P.GetFlag("--lockstep"))
+        bLockStep = true;
+
+    double dfLockStepDT = 0.05;
+    m_MissionReader.GetValue("LockStepDT",dfLockStepDT);
+    P.GetVariable("--lockstep_dt",dfLockStepDT);
+
+    unsigned int nLockStepClients = 1;
+    m_MissionReader.GetValue("LockStepClients",nLockStepClients);
+    P.GetVariable("--lockstep_clients",nLockStepClients);
+
+    double dfLockStepStart = -1.0;
+    m_MissionReader.GetValue("LockStepStartTime",dfLockStepStart);
+
+    m_LockStep.Configure(dfLockStepDT,nLockStepClients,dfLockStepStart);
+    m_LockStep.Enable(bLockStep);
+
     ///////////////////////////////////////////////////////////
 	double dfWarningLatencyMS = 50;
 	m_MissionReader.GetValue("WarningLatency",dfWarningLatencyMS);
@@ -589,6 +622,9 @@ bool CMOOSDB::OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgListRx,MOOSM
     
     for(p = MsgListRx.begin();p!=MsgListRx.end();++p)
     {
+        if(m_Profiler.IsEnabled())
+            m_Profiler.OnReceived(sClient,*p);
+
         ProcessMsg(*p,MsgListTx);
     }
     
@@ -618,37 +654,16 @@ bool CMOOSDB::OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgListRx,MOOSM
     {
         
         //now we fill in the packet with our replies to THIS CLIENT
-        MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sClient);
-        
-        if(q==m_HeldMailMap.end())
-        {
-            
-            //CMOOSMsg & rMsg = MsgListRx.front();
-            //there is no mail waiting to be sent to this client
-            //should only happen at start up...
-            //string sClient = MsgListRx.front().m_sSrc;
-            
-            MOOSMSG_LIST NewList;
-            
-            m_HeldMailMap[sClient] = NewList;
-            
-            q = m_HeldMailMap.find(sClient);
-            
-            assert(q!=m_HeldMailMap.end());
-        }
-                
-        if(q!=m_HeldMailMap.end())
-        {
-            //MOOSTrace("%f OnRxPkt %d messages held for client %s\n",MOOSTime(),q->second.size(),sClient.c_str());
+        //(there is no mail waiting for a client the first time it calls
+        //in - operator[] makes it an empty outbox)
+        MOOS::PriorityOutbox & rBox = m_HeldMailMap[sClient];
 
-            if(!q->second.empty())
-            {
-                //copy all the held mail to MsgListTx
-                MsgListTx.splice(MsgListTx.begin(),
-                		q->second,
-                		q->second.begin(),
-                		q->second.end());
-            }
+        //MOOSTrace("%f OnRxPkt %d messages held for client %s\n",MOOSTime(),rBox.Size(),sClient.c_str());
+
+        if(!rBox.Empty())
+        {
+            //copy all the held mail to MsgListTx
+            DrainClientBox(sClient,rBox,MsgListTx);
         }
     }
     
@@ -657,20 +672,37 @@ bool CMOOSDB::OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgListRx,MOOSM
 
 bool CMOOSDB::OnFetchAllMail(const std::string & sWho,MOOSMSG_LIST & MsgListTx)
 {
-	MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sWho);
+	OUTBOX_STRING_MAP::iterator q = m_HeldMailMap.find(sWho);
 	if(q!=m_HeldMailMap.end())
 	{
-		if(!q->second.empty())
+		if(!q->second.Empty())
 		{
-            MsgListTx.splice(MsgListTx.begin(),
-            		q->second,
-            		q->second.begin(),
-            		q->second.end());
+            DrainClientBox(sWho,q->second,MsgListTx);
 		}
 	}
 	return true;
 }
 
+/** move everything held for sClient (highest priority first) to the front
+of MsgListTx */
+void CMOOSDB::DrainClientBox(const std::string &sClient,MOOS::PriorityOutbox & Box,
+                             MOOSMSG_LIST & MsgListTx)
+{
+    MOOSMSG_LIST Held;
+    if(m_Profiler.IsEnabled())
+    {
+        std::vector<double> QueuedAt;
+        Box.Drain(Held,&QueuedAt);
+        m_Profiler.OnSent(sClient,Held,QueuedAt,HPMOOSTime());
+    }
+    else
+    {
+        Box.Drain(Held);
+    }
+
+    MsgListTx.splice(MsgListTx.begin(),Held);
+}
+
 /** This functions decides what needs to be done on a message by message basis */
 bool CMOOSDB::ProcessMsg(CMOOSMsg &MsgRx,MOOSMSG_LIST & MsgListTx)
 {
@@ -679,6 +711,12 @@ bool CMOOSDB::ProcessMsg(CMOOSMsg &MsgRx,MOOSMSG_LIST & MsgListTx)
     switch(MsgRx.m_cMsgType)
     {
     case MOOS_NOTIFY:    //NOTIFICATION
+        if(m_LockStep.IsEnabled() && MsgRx.m_sKey.compare(0,14,"MOOS_LOCKSTEP_")==0)
+        {
+            bool bOK = OnNotify(MsgRx);
+            OnLockStepMsg(MsgRx);
+            return bOK;
+        }
         return OnNotify(MsgRx);
         break;
     case MOOS_WILDCARD_UNREGISTER:
@@ -702,6 +740,39 @@ bool CMOOSDB::ProcessMsg(CMOOSMsg &MsgRx,MOOSMSG_LIST & MsgListTx)
 }
 
 
+/** a lockstep client has joined or finished a tick. As a client's
+notifications arrive in order, everything it published during the tick has
+already been queued for subscribers by the time we see it is done.*/
+void CMOOSDB::OnLockStepMsg(const CMOOSMsg & Msg)
+{
+    bool bAdvance = false;
+    if(Msg.m_sKey==MOOS_LOCKSTEP_JOIN)
+    {
+        bAdvance = m_LockStep.Join(Msg.m_sSrc);
+        m_EventLogger.AddEvent("lockstep",Msg.m_sSrc,"client joins lockstep");
+    }
+    else if(Msg.m_sKey==MOOS_LOCKSTEP_DONE)
+    {
+        bAdvance = m_LockStep.Done(Msg.m_sSrc,Msg.m_dfVal);
+    }
+
+    if(bAdvance)
+        PublishLockStepTick();
+}
+
+void CMOOSDB::PublishLockStepTick()
+{
+    double dfNow = m_LockStep.Advance();
+
+    //the DB runs on simulated time too so its own time stamps agree
+    SetMOOSVirtualTime(dfNow);
+
+    CMOOSMsg Tick(MOOS_NOTIFY,MOOS_LOCKSTEP_TICK,dfNow,dfNow);
+    Tick.m_sOriginatingCommunity = m_sCommunityName;
+    Tick.m_sSrc = m_sDBName;
+    OnNotify(Tick);
+}
+
 /** called when the in focus client is telling us something
 has changed. Ie this is a notify packet */
 bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
@@ -716,26 +787,21 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
 
 
         //look to see if any existing wildcards make us want to subscribe
-		//to this new message
-		HASH_MAP_TYPE<std::string, std::set<MOOS::MsgFilter> >::const_iterator g;
-		for (g = m_ClientFilters.begin(); g != m_ClientFilters.end(); ++g)
+		//to this new message - the index only hands back filters that match
+		std::vector<MOOS::WildcardIndex::Subscription> Matches;
+		m_WildcardIndex.Find(Msg.GetKey(),Msg.GetSource(),Matches);
+
+		std::vector<MOOS::WildcardIndex::Subscription>::const_iterator h;
+		for (h = Matches.begin(); h != Matches.end(); ++h)
 		{
-			//for every client
-			std::set<MOOS::MsgFilter>::const_iterator h;
-			for (h = g->second.begin(); h != g->second.end(); ++h)
+			//add the filter owner as a subscriber
+			rVar.AddSubscriber(h->first, h->second.period(),
+					h->second.priority(), h->second.coalesce());
+			if(!m_bQuiet)
 			{
-				//for every filter
-				if (h->Matches(Msg))
-				{
-					//add the filter owner (client *g) as a subscriber
-					rVar.AddSubscriber(g->first, h->period());
-					if(!m_bQuiet)
-					{
-                        std::cout<<"+ subs of \""<<g->first<<"\" to \""
-                                <<Msg.GetKey()<<"\" via wildcard \""<<h->as_string()
-                                <<"\""<<std::endl;
-					}
-				}
+                std::cout<<"+ subs of \""<<h->first<<"\" to \""
+                        <<Msg.GetKey()<<"\" via wildcard \""<<h->second.as_string()
+                        <<"\""<<std::endl;
 			}
 		}
 
@@ -826,7 +892,7 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
                 Msg.m_cMsgType = MOOS_NOTIFY;
                 
                 
-                AddMessageToClientBox(sClient,Msg);
+                AddMessageToClientBox(sClient,Msg,rInfo.m_nPriority,rInfo.m_bCoalesce);
                 
 
                 //finally we remember when we sent this to the client in question
@@ -853,25 +919,24 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
 
 /** we now want to store some message in anoth cleints message box, when they next call
 in they shall be informed of the change by stuffing this msg into a return packet */
-bool    CMOOSDB::AddMessageToClientBox(const string &sClient,CMOOSMsg & Msg)
+bool    CMOOSDB::AddMessageToClientBox(const string &sClient,CMOOSMsg & Msg,
+                                       int nPriority, bool bCoalesce)
 {
-    MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sClient);
-    
-    if(q==m_HeldMailMap.end())
+    //rBox is a reference to the messages that will be sent to sClient the
+    //next time it calls into the database (if there is no mail waiting
+    //for this client, which should only happen at start up, it is made)
+    MOOS::PriorityOutbox & rBox = m_HeldMailMap[sClient];
+
+    if(m_Profiler.IsEnabled())
     {
-        //there is no mail waiting to be sent to this client
-        //should only happen at start up...
-        MOOSMSG_LIST NewList;
-        m_HeldMailMap[sClient] = NewList;
-        
-        q = m_HeldMailMap.find(sClient);
-        
-        assert(q!=m_HeldMailMap.end());
+        double dfTimeNow = HPMOOSTime();
+        rBox.Push(Msg,nPriority,bCoalesce,dfTimeNow);
+        m_Profiler.OnQueued(sClient,Msg,dfTimeNow,rBox.Size());
+    }
+    else
+    {
+        rBox.Push(Msg,nPriority,bCoalesce);
     }
-    
-    //q->second is now a reference to a list of messages that will be
-    //sent to sClient the next time it calls into the database...   
-    q->second.push_back(Msg);
     
     return true;
 }
@@ -903,13 +968,20 @@ bool CMOOSDB::OnUnRegister(CMOOSMsg &Msg)
 		MOOSValFromString(var_pattern,Msg.GetString(),"VarPattern");
 		MOOS::MsgFilter F(app_pattern,var_pattern,period);
 
+		//variables created from now on should no longer match
+		m_WildcardIndex.Remove(Msg.GetSource(),F);
+
+		//only variables sharing the literal prefix of the pattern can match
+		std::string sPrefix = MOOS::WildcardIndex::LiteralPrefix(var_pattern);
+
 		DBVAR_MAP::iterator q;
-		for(q = m_VarMap.begin();q!=m_VarMap.end();++q)
+		for(q = m_VarMap.lower_bound(sPrefix);
+				q!=m_VarMap.end() && q->first.compare(0,sPrefix.size(),sPrefix)==0;
+				++q)
 		{
-			CMOOSMsg M;
-			Var2Msg(q->second,M);
-			if(F.Matches(M))
+			if(F.Matches(q->first,q->second.m_sWhoChangedMe))
 			{
+				CMOOSMsg M;
 				M.m_cMsgType = MOOS_UNREGISTER;
 				M.m_cDataType = MOOS_STRING;
 				M.m_sSrc = Msg.GetSource();
@@ -923,6 +995,18 @@ bool CMOOSDB::OnUnRegister(CMOOSMsg &Msg)
 }
 
 
+/** subscriptions may carry "Priority=high|normal|low,Coalesce=true|false"
+selecting the outbox lane notifications are held in and whether only the
+newest unsent value of a variable is kept*/
+static void ParseSubscriptionOptions(const std::string & sOptions,int & nPriority,bool & bCoalesce)
+{
+    std::string sPriority;
+    if(MOOSValFromString(sPriority,sOptions,"Priority"))
+        nPriority = MOOS::PriorityOutbox::PriorityFromString(sPriority);
+
+    MOOSValFromString(bCoalesce,sOptions,"Coalesce");
+}
+
 /** Called when a msg containing a registration (subscription) 
 request is received */
 bool CMOOSDB::OnRegister(CMOOSMsg &Msg)
@@ -943,7 +1027,12 @@ bool CMOOSDB::OnRegister(CMOOSMsg &Msg)
 //		if(rVar.HasSubscriber(Msg.m_sSrc))
 //			return true;
 
-		if(!rVar.AddSubscriber(Msg.m_sSrc,Msg.m_dfVal))
+		//optional outbox priority and coalescing ride in the string field
+		int nPriority = MOOS::PriorityOutbox::NORMAL;
+		bool bCoalesce = false;
+		ParseSubscriptionOptions(Msg.m_sVal,nPriority,bCoalesce);
+
+		if(!rVar.AddSubscriber(Msg.m_sSrc,Msg.m_dfVal,nPriority,bCoalesce))
 			return false;
 
         double dfActualPeriod;
@@ -964,7 +1053,7 @@ bool CMOOSDB::OnRegister(CMOOSMsg &Msg)
 
 			ReplyMsg.m_cMsgType = MOOS_NOTIFY;
 
-			AddMessageToClientBox(Msg.m_sSrc,ReplyMsg);
+			AddMessageToClientBox(Msg.m_sSrc,ReplyMsg,nPriority,bCoalesce);
 
         	rVar.m_Subscribers[Msg.m_sSrc].SetLastTimeSent(MOOS::Time());
 
@@ -981,29 +1070,40 @@ bool CMOOSDB::OnRegister(CMOOSMsg &Msg)
 		MOOSValFromString(app_pattern,Msg.GetString(),"AppPattern");
 		MOOSValFromString(var_pattern,Msg.GetString(),"VarPattern");
 		MOOSValFromString(period,Msg.GetString(),"Interval");
-		MOOS::MsgFilter F(app_pattern,var_pattern,period);
+
+		int nPriority = MOOS::PriorityOutbox::NORMAL;
+		bool bCoalesce = false;
+		ParseSubscriptionOptions(Msg.GetString(),nPriority,bCoalesce);
+
+		MOOS::MsgFilter F(app_pattern,var_pattern,period,nPriority,bCoalesce);
 
 		//store this filter we will need it later when new
 		//as yet undiscovered variables are written
-		m_ClientFilters[Msg.GetSource()].insert(F);
+		m_WildcardIndex.Add(Msg.GetSource(),F);
 
 
         m_EventLogger.AddEvent("wildcard",Msg.m_sSrc,Msg.GetString());
 
 
 		//now iterate over all existing variables and see if they match
-		//if the do simply register for them...
+		//if the do simply register for them... The variable map is sorted
+		//so only the range sharing the pattern's literal prefix is visited
+		std::string sPrefix = MOOS::WildcardIndex::LiteralPrefix(var_pattern);
+
 		DBVAR_MAP::iterator q;
-		for(q = m_VarMap.begin();q!=m_VarMap.end();++q)
+		for(q = m_VarMap.lower_bound(sPrefix);
+				q!=m_VarMap.end() && q->first.compare(0,sPrefix.size(),sPrefix)==0;
+				++q)
 		{
-			CMOOSMsg M;
-			Var2Msg(q->second,M);
-			if(F.Matches(M))
+			if(F.Matches(q->first,q->second.m_sWhoChangedMe))
 			{
+				CMOOSMsg M;
 				M.m_cMsgType = MOOS_REGISTER;
 				M.m_cDataType = MOOS_DOUBLE;
 				M.m_dfVal = period;
 				M.m_sSrc = Msg.GetSource();
+				M.m_sKey = q->first;
+				M.m_sVal = Msg.GetString();
 
 				if(!m_bQuiet)
 				{
@@ -1123,12 +1223,14 @@ bool CMOOSDB::OnDisconnect(string &sClient)
         
         rVar.RemoveSubscriber(sClient);
     }
-    if(m_ClientFilters.find(sClient)!=m_ClientFilters.end())
-    {
-    	m_ClientFilters[sClient].clear();
-    }
+    m_WildcardIndex.RemoveClient(sClient);
     
     m_HeldMailMap.erase(sClient);
+    m_Profiler.RemoveClient(sClient);
+
+    //don't let a departed client hold up simulated time
+    if(m_LockStep.IsEnabled() && m_LockStep.Leave(sClient))
+        PublishLockStepTick();
     
     if(!m_bQuiet)
         std::cout<<MOOS::ConsoleColours::Green()<<"[OK]\n"<<MOOS::ConsoleColours::reset();
@@ -1165,6 +1267,10 @@ bool CMOOSDB::DoServerRequest(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
     {
         return OnClearRequested(Msg,MsgTxList);
     }
+    else if(Msg.m_sKey.find("DB_PROFILE")!=string::npos)
+    {
+        return OnProfileRequested(Msg,MsgTxList);
+    }
     
     
     
@@ -1375,6 +1481,32 @@ bool CMOOSDB::OnVarSummaryRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
 
 
 
+bool CMOOSDB::OnProfileRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
+{
+    //how many of the hottest variables should be listed? (DB_PROFILE:20)
+    unsigned int nTopK = 20;
+    std::string sKey = Msg.m_sKey;
+    MOOSChomp(sKey,":");
+    if(!sKey.empty() && MOOSIsNumeric(sKey))
+        nTopK = atoi(sKey.c_str());
+
+    CMOOSMsg Reply;
+
+    //so the client knows the query result correspondences
+    Reply.m_nID = Msg.m_nID;
+    Reply.m_cMsgType = MOOS_NOTIFY;
+    Reply.m_cDataType = MOOS_STRING;
+    Reply.m_dfTime = MOOSTime();
+    Reply.m_sSrc = m_sDBName;
+    Reply.m_sKey = "DB_PROFILE";
+    Reply.m_sVal = m_Profiler.GetReport(nTopK);
+    Reply.m_dfVal = -1;
+
+    MsgTxList.push_front(Reply);
+
+    return true;
+}
+
 
 
 bool CMOOSDB::OnClearRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
@@ -1397,12 +1529,12 @@ bool CMOOSDB::OnClearRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
     
     
     MOOSTrace("    Removing %d existing notification queues...",m_HeldMailMap.size());
-    MOOSMSG_LIST_STRING_MAP::iterator q;
+    OUTBOX_STRING_MAP::iterator q;
     
     for(q = m_HeldMailMap.begin();q!=m_HeldMailMap.end();++q)
     {
-        MOOSMSG_LIST & rList = q->second;
-        rList.clear();
+        q->second.Clear();
+        m_Profiler.OnDiscarded(q->first);
     }
     MOOSTrace("done\n");
     
@@ -84,7 +84,8 @@ bool CMOOSDBVar::GetUpdatePeriod(const string & sClient, double & dfPeriod){
     return true;
 }
 
-bool CMOOSDBVar::AddSubscriber(const string &sClient, double dfPeriod)
+bool CMOOSDBVar::AddSubscriber(const string &sClient, double dfPeriod,
+                               int nPriority, bool bCoalesce)
 {
 
     if(sClient.empty())
@@ -96,6 +97,8 @@ bool CMOOSDBVar::AddSubscriber(const string &sClient, double dfPeriod)
     CMOOSRegisterInfo Info;
     Info.m_sClientName = sClient;
     Info.m_dfPeriod = dfPeriod;
+    Info.m_nPriority = nPriority;
+    Info.m_bCoalesce = bCoalesce;
     m_Subscribers[sClient] = Info;
 
     return true;
@@ -25,6 +25,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "MOOS/libMOOS/DB/MOOSRegisterInfo.h"
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -34,6 +35,8 @@ CMOOSRegisterInfo::CMOOSRegisterInfo()
 {
     m_dfLastTimeSent = 0;
     m_dfPeriod = 0.5;
+    m_nPriority = MOOS::PriorityOutbox::NORMAL;
+    m_bCoalesce = false;
 }
 
 CMOOSRegisterInfo::~CMOOSRegisterInfo()
@@ -39,6 +39,12 @@ bool MsgFilter::Matches(const CMOOSMsg & M) const
 			MOOSWildCmp(var_filter(),M.GetKey() );
 }
 
+bool MsgFilter::Matches(const std::string & sVar, const std::string & sSrc) const
+{
+	return MOOSWildCmp(filters_.second,sVar) &&
+			MOOSWildCmp(filters_.first,sSrc);
+}
+
 std::string MsgFilter::app_filter() const
 {
 	return filters_.first;
@@ -57,14 +63,29 @@ double MsgFilter::period() const
 {
 	return period_;
 }
+int MsgFilter::priority() const
+{
+	return priority_;
+}
+
+bool MsgFilter::coalesce() const
+{
+	return coalesce_;
+}
+
 MsgFilter::MsgFilter()
 {
 	period_ = 0.0;
+	priority_ = PriorityOutbox::NORMAL;
+	coalesce_ = false;
 	filters_=std::make_pair("","");
 }
-MsgFilter::MsgFilter(const std::string & A, const std::string & V, double p)
+MsgFilter::MsgFilter(const std::string & A, const std::string & V, double p,
+		int priority, bool coalesce)
 {
 	period_ = p;
+	priority_ = priority;
+	coalesce_ = coalesce;
 	filters_=std::make_pair(A,V);
 }
 
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "MOOS/libMOOS/DB/WildcardIndex.h"
+
+namespace MOOS
+{
+
+WildcardIndex::Trie::Trie()
+{
+	//node zero is the root and always exists
+	nodes_.push_back(TrieNode());
+}
+
+bool WildcardIndex::Trie::Insert(const std::string & sKey, const Subscription & S)
+{
+	unsigned int n = 0;
+	for(std::string::size_type i = 0;i<sKey.size();i++)
+	{
+		std::map<char,unsigned int>::iterator q = nodes_[n].children_.find(sKey[i]);
+		if(q==nodes_[n].children_.end())
+		{
+			unsigned int nChild = static_cast<unsigned int>(nodes_.size());
+			nodes_[n].children_[sKey[i]] = nChild;
+			nodes_.push_back(TrieNode());
+			n = nChild;
+		}
+		else
+		{
+			n = q->second;
+		}
+	}
+	return nodes_[n].subscriptions_.insert(S).second;
+}
+
+bool WildcardIndex::Trie::Erase(const std::string & sKey, const Subscription & S)
+{
+	//nodes are never reclaimed - the set of distinct prefixes seen
+	//by a DB is small and bounded by the patterns clients use
+	unsigned int n = 0;
+	for(std::string::size_type i = 0;i<sKey.size();i++)
+	{
+		std::map<char,unsigned int>::const_iterator q = nodes_[n].children_.find(sKey[i]);
+		if(q==nodes_[n].children_.end())
+			return false;
+		n = q->second;
+	}
+	return nodes_[n].subscriptions_.erase(S)>0;
+}
+
+void WildcardIndex::Trie::Collect(const std::string & sName,
+		const std::string & sVar,
+		const std::string & sSrc,
+		std::vector<Subscription> & Matches) const
+{
+	//walk down the trie along sName - every node we pass holds filters
+	//whose literal prefix is a prefix of sName. Only these need the
+	//(more expensive) glob test.
+	unsigned int n = 0;
+	std::string::size_type i = 0;
+	while(true)
+	{
+		const TrieNode & rNode = nodes_[n];
+		SubscriptionSet::const_iterator p;
+		for(p = rNode.subscriptions_.begin();p!=rNode.subscriptions_.end();++p)
+		{
+			if(p->second.Matches(sVar,sSrc))
+				Matches.push_back(*p);
+		}
+
+		if(i==sName.size())
+			break;
+
+		std::map<char,unsigned int>::const_iterator q = rNode.children_.find(sName[i++]);
+		if(q==rNode.children_.end())
+			break;
+		n = q->second;
+	}
+}
+
+WildcardIndex::WildcardIndex()
+{
+	size_ = 0;
+}
+
+std::string WildcardIndex::LiteralPrefix(const std::string & sPattern)
+{
+	return sPattern.substr(0,sPattern.find_first_of("*?"));
+}
+
+WildcardIndex::Bucket WildcardIndex::Classify(const MsgFilter & F, std::string & sKey)
+{
+	sKey = LiteralPrefix(F.var_filter());
+	if(!sKey.empty())
+		return VAR_TRIE;
+
+	sKey = LiteralPrefix(F.app_filter());
+	if(!sKey.empty())
+		return APP_TRIE;
+
+	return RESIDUAL;
+}
+
+bool WildcardIndex::Add(const std::string & sClient, const MsgFilter & F)
+{
+	if(!client_filters_[sClient].insert(F).second)
+		return false;
+
+	Subscription S(sClient,F);
+	std::string sKey;
+	switch(Classify(F,sKey))
+	{
+	case VAR_TRIE:
+		var_trie_.Insert(sKey,S);
+		break;
+	case APP_TRIE:
+		app_trie_.Insert(sKey,S);
+		break;
+	case RESIDUAL:
+		residual_.insert(S);
+		break;
+	}
+	size_++;
+	return true;
+}
+
+bool WildcardIndex::Remove(const std::string & sClient, const MsgFilter & F)
+{
+	std::map<std::string, std::set<MsgFilter> >::iterator q = client_filters_.find(sClient);
+	if(q==client_filters_.end())
+		return false;
+
+	//look up the stored filter - it carries the period we indexed with
+	std::set<MsgFilter>::iterator f = q->second.find(F);
+	if(f==q->second.end())
+		return false;
+
+	Subscription S(sClient,*f);
+	std::string sKey;
+	switch(Classify(*f,sKey))
+	{
+	case VAR_TRIE:
+		var_trie_.Erase(sKey,S);
+		break;
+	case APP_TRIE:
+		app_trie_.Erase(sKey,S);
+		break;
+	case RESIDUAL:
+		residual_.erase(S);
+		break;
+	}
+
+	q->second.erase(f);
+	if(q->second.empty())
+		client_filters_.erase(q);
+
+	size_--;
+	return true;
+}
+
+void WildcardIndex::RemoveClient(const std::string & sClient)
+{
+	std::map<std::string, std::set<MsgFilter> >::iterator q = client_filters_.find(sClient);
+	if(q==client_filters_.end())
+		return;
+
+	//copy as Remove() modifies the set we would be iterating over
+	std::set<MsgFilter> Filters = q->second;
+	std::set<MsgFilter>::iterator f;
+	for(f = Filters.begin();f!=Filters.end();++f)
+		Remove(sClient,*f);
+}
+
+unsigned int WildcardIndex::Find(const std::string & sVar,
+		const std::string & sSrc,
+		std::vector<Subscription> & Matches) const
+{
+	std::vector<Subscription>::size_type nBefore = Matches.size();
+
+	var_trie_.Collect(sVar,sVar,sSrc,Matches);
+	app_trie_.Collect(sSrc,sVar,sSrc,Matches);
+
+	SubscriptionSet::const_iterator p;
+	for(p = residual_.begin();p!=residual_.end();++p)
+	{
+		if(p->second.Matches(sVar,sSrc))
+			Matches.push_back(*p);
+	}
+
+	return static_cast<unsigned int>(Matches.size()-nBefore);
+}
+
+unsigned int WildcardIndex::Size() const
+{
+	return size_;
+}
+
+}
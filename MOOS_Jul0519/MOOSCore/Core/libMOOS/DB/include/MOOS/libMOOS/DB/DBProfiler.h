@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+#ifndef DBPROFILERH
+#define DBPROFILERH
+
+#include <string>
+#include <map>
+#include <vector>
+
+#include "MOOS/libMOOS/Comms/MOOSMsg.h"
+#include "MOOS/libMOOS/Comms/CommsTypes.h"
+
+namespace MOOS
+{
+
+/** A fixed memory latency histogram in the spirit of HdrHistogram. Values
+are held in microseconds in buckets which are linear within each power of
+two (16 sub buckets per octave) so relative error is bounded at ~6% over
+the whole range from 1us to over an hour.*/
+class LatencyHistogram
+{
+public:
+	LatencyHistogram();
+
+	/** record a latency given in seconds */
+	void Add(double dfSeconds);
+
+	/** returns the latency (seconds) below which dfFraction (0-1) of
+	samples lie */
+	double Percentile(double dfFraction) const;
+
+	double Max() const;
+	double Mean() const;
+	unsigned long Count() const;
+
+	void Merge(const LatencyHistogram & Other);
+	void Clear();
+
+private:
+	static unsigned int BucketIndex(unsigned long long nMicros);
+	static unsigned long long BucketUpperValue(unsigned int nIndex);
+
+	std::vector<unsigned long> counts_;
+	unsigned long total_;
+	double sum_;
+	double max_;
+};
+
+
+/** Opt-in instrumentation of the DB hot path. When enabled the DB reports
+every message it receives, queues and sends and the profiler keeps
+per-client and per-variable traffic counts and latency histograms.
+"rx->queue" is the time from a message's own time stamp (when the
+sender posted it) to it being placed in a subscriber's outbox and so
+includes the sender's outbox and the network. "queue->tx" is the time a
+message sits in an outbox before being handed to the comms layer.*/
+class DBProfiler
+{
+public:
+	DBProfiler();
+
+	void Enable(bool bEnable);
+	bool IsEnabled() const {return enabled_;}
+
+	/** a message has been received from sClient */
+	void OnReceived(const std::string & sClient, const CMOOSMsg & M);
+
+	/** M has been placed in sClient's outbox which now holds nDepth
+	messages*/
+	void OnQueued(const std::string & sClient, const CMOOSMsg & M,
+			double dfTimeNow, size_t nDepth);
+
+	/** every message in Outbox is about to be handed to the comms layer
+	for sClient, QueuedAt holds the time each was queued */
+	void OnSent(const std::string & sClient, const MOOSMSG_LIST & Outbox,
+			const std::vector<double> & QueuedAt, double dfTimeNow);
+
+	/** sClient's outbox has been emptied without sending */
+	void OnDiscarded(const std::string & sClient);
+
+	/** sClient has gone away */
+	void RemoveClient(const std::string & sClient);
+
+	/** a human readable report, nTopK hottest variables are listed */
+	std::string GetReport(unsigned int nTopK) const;
+
+private:
+	struct ClientStats
+	{
+		ClientStats();
+		unsigned long msgs_in_;
+		unsigned long long bytes_in_;
+		unsigned long msgs_out_;
+		unsigned long long bytes_out_;
+		size_t depth_;
+		size_t max_depth_;
+		LatencyHistogram rx_to_queue_;
+		LatencyHistogram queue_to_tx_;
+	};
+
+	struct VarStats
+	{
+		VarStats();
+		unsigned long writes_;
+		unsigned long long bytes_;
+		unsigned long deliveries_;
+		LatencyHistogram rx_to_queue_;
+	};
+
+	/** convert a MOOSTime interval to wall clock seconds */
+	static double ToRealSeconds(double dfMOOSTimeInterval);
+
+	bool enabled_;
+	double start_time_;
+	std::map<std::string, ClientStats> clients_;
+	std::map<std::string, VarStats> vars_;
+};
+
+}
+#endif
@@ -177,6 +177,8 @@ protected:
     bool HandlePoke(std::string sPokeURL);
     /* build webpage of single variable */
     bool BuildSingleVariableWebPageContents( std::ostringstream & wp,MOOSMSG_LIST & MsgList);
+    /** build web page of the DB latency and traffic profile*/
+    bool BuildProfileWebPageContents( std::ostringstream & wp,MOOSMSG_LIST & MsgList);
     /** build we page of whole DB*/
     bool BuildFullDBWebPageContents( std::ostringstream & wp,MOOSMSG_LIST & MsgList);
 	/** read a request header*/
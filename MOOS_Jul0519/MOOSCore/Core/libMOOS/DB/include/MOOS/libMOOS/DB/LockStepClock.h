@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+#ifndef LOCKSTEPCLOCKH
+#define LOCKSTEPCLOCKH
+
+#include <string>
+#include <set>
+
+namespace MOOS
+{
+
+/** Book keeping for a DB serving simulated time. Clients join and from
+then on the clock only moves forward (by a fixed step) once every
+participant has said it has finished with the current tick. Simulated time
+therefore runs as fast as the slowest participant allows and the sequence
+of ticks each client sees is independent of machine load.*/
+class LockStepClock
+{
+public:
+	LockStepClock();
+
+	/** @param dfStep simulated seconds per tick
+	@param nMinParticipants how many clients must join before the first tick
+	@param dfStart simulated time of the first tick (<0 uses the wall clock) */
+	void Configure(double dfStep, unsigned int nMinParticipants, double dfStart);
+
+	void Enable(bool bEnable);
+	bool IsEnabled() const {return enabled_;}
+
+	/** sClient wants to take part - it is waited on from the next tick.
+	@return true if the clock should now advance */
+	bool Join(const std::string & sClient);
+
+	/** sClient has finished with the tick at dfTickTime (stale or
+	repeated acknowledgements are ignored)
+	@return true if the clock should now advance */
+	bool Done(const std::string & sClient, double dfTickTime);
+
+	/** sClient has gone away
+	@return true if the clock should now advance */
+	bool Leave(const std::string & sClient);
+
+	/** move to the next tick and return its simulated time */
+	double Advance();
+
+	double Now() const {return now_;}
+	double Step() const {return step_;}
+	unsigned long Ticks() const {return ticks_;}
+	size_t Participants() const {return participants_.size();}
+
+private:
+	bool ReadyToAdvance() const;
+
+	bool enabled_;
+	double step_;
+	unsigned int min_participants_;
+	double start_;
+	double now_;
+	unsigned long ticks_;
+	std::set<std::string> participants_;
+	std::set<std::string> waiting_for_;
+};
+
+}
+#endif
@@ -38,16 +38,21 @@
 
 #include "MOOS/libMOOS/Comms/CommsTypes.h"
 #include "MOOS/libMOOS/Comms/MOOSMsg.h"
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 #include "MOOS/libMOOS/Comms/ThreadedCommServer.h"
 #include "MOOS/libMOOS/Comms/SuicidalSleeper.h"
 
 #include "MOOS/libMOOS/DB/MOOSDBVar.h"
 #include "MOOS/libMOOS/DB/MOOSDBHTTPServer.h"
 #include "MOOS/libMOOS/DB/MsgFilter.h"
+#include "MOOS/libMOOS/DB/WildcardIndex.h"
+#include "MOOS/libMOOS/DB/DBProfiler.h"
+#include "MOOS/libMOOS/DB/LockStepClock.h"
 #include "MOOS/libMOOS/DB/MOOSDBLogger.h"
 
 #define HASH_MAP_TYPE std::map
 typedef HASH_MAP_TYPE<std::string,MOOSMSG_LIST> MOOSMSG_LIST_STRING_MAP;
+typedef HASH_MAP_TYPE<std::string,MOOS::PriorityOutbox> OUTBOX_STRING_MAP;
 typedef HASH_MAP_TYPE<std::string,CMOOSDBVar> DBVAR_MAP;
 
 
@@ -105,7 +110,11 @@ protected:
 
     bool OnClearRequested(CMOOSMsg & Msg, MOOSMSG_LIST & MsgTxList);
     void Var2Msg(CMOOSDBVar & Var, CMOOSMsg &Msg);
-    bool AddMessageToClientBox(const std::string &sClient,CMOOSMsg & Msg);
+    bool AddMessageToClientBox(const std::string &sClient,CMOOSMsg & Msg,
+                               int nPriority = MOOS::PriorityOutbox::NORMAL,
+                               bool bCoalesce = false);
+    void DrainClientBox(const std::string &sClient,MOOS::PriorityOutbox & Box,
+                        MOOSMSG_LIST & MsgListTx);
     bool VariableExists(const std::string & sVar);
     bool DoVarLookup(CMOOSMsg & Msg, MOOSMSG_LIST &MsgTxList);
 
@@ -116,6 +125,7 @@ protected:
     bool OnServerAllRequested(CMOOSMsg & Msg, MOOSMSG_LIST & MsgTxList);
     bool OnProcessSummaryRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList);
     bool OnVarSummaryRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList);
+    bool OnProfileRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList);
 
     void UpdateDBTimeVars();
     void UpdateDBClientsVar();
@@ -129,6 +139,8 @@ protected:
     bool OnUnRegister(CMOOSMsg &Msg);
     bool OnNotify(CMOOSMsg & Msg);
     bool ProcessMsg(CMOOSMsg & MsgRx,MOOSMSG_LIST & MsgLstTx);
+    void OnLockStepMsg(const CMOOSMsg & Msg);
+    void PublishLockStepTick();
     double GetStartTime(){return m_dfStartTime;}
     void OnPrintVersionAndExit();
 
@@ -142,14 +154,16 @@ private:
     double m_dfSummaryTime;
 
 
-    /**a map of client name to a list of Msgs that will be sent
+    /**a map of client name to the (prioritised) Msgs that will be sent
     the next time a client calls in*/
-    MOOSMSG_LIST_STRING_MAP m_HeldMailMap;
+    OUTBOX_STRING_MAP m_HeldMailMap;
     DBVAR_MAP    m_VarMap;
 
 
 
-    HASH_MAP_TYPE<std::string,std::set< MOOS::MsgFilter > > m_ClientFilters;
+    /**wildcard subscriptions of all clients indexed by the literal
+    prefixes of their patterns*/
+    MOOS::WildcardIndex m_WildcardIndex;
 
     //pointer to a webserver if one is needed
     MOOS::ScopedPtr<CMOOSDBHTTPServer> m_pWebServer;
@@ -159,6 +173,12 @@ private:
 
     MOOS::MOOSDBLogger m_EventLogger;
 
+    /**opt-in latency and traffic instrumentation (--profile)*/
+    MOOS::DBProfiler m_Profiler;
+
+    /**opt-in simulated time served to clients (--lockstep)*/
+    MOOS::LockStepClock m_LockStep;
+
     MOOS::SuicidalSleeper m_SuicidalSleeper;
 
 
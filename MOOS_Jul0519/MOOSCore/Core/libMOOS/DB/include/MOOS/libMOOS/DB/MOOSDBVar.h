@@ -42,6 +42,7 @@ using namespace std;
 typedef set<string> STRING_SET;
 
 #include "MOOSRegisterInfo.h"
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 
 
 typedef map<string,CMOOSRegisterInfo> REGISTER_INFO_MAP;
@@ -57,7 +58,9 @@ public:
 
     bool Reset();
     void RemoveSubscriber(string & sWho);
-    bool AddSubscriber(const string & sClient, double dfPeriod);
+    bool AddSubscriber(const string & sClient, double dfPeriod,
+                       int nPriority = MOOS::PriorityOutbox::NORMAL,
+                       bool bCoalesce = false);
     bool HasSubscriber(const string & sClient);
     bool GetUpdatePeriod(const string & sClient, double & dfPeriod);
 
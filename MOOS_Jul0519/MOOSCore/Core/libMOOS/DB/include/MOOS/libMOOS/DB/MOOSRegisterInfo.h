@@ -46,6 +46,11 @@ public:
     string m_sClientName;
     double m_dfLastTimeSent;
 
+    //outbox lane (see MOOS::PriorityOutbox) notifications are queued in
+    int m_nPriority;
+    //only hold the newest unsent notification for the client
+    bool m_bCoalesce;
+
     CMOOSRegisterInfo();
     virtual ~CMOOSRegisterInfo();
 
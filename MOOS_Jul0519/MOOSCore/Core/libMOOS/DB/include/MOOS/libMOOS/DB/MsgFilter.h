@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include "MOOS/libMOOS/Comms/PriorityOutbox.h"
 class CMOOSMsg;
 
 namespace MOOS
@@ -34,17 +35,23 @@ class MsgFilter
 {
 public:
 	MsgFilter();
-	MsgFilter(const std::string & A, const std::string & V, double p=0.0);
+	MsgFilter(const std::string & A, const std::string & V, double p=0.0,
+			int priority=PriorityOutbox::NORMAL, bool coalesce=false);
 	bool Matches(const CMOOSMsg & M) const;
+	bool Matches(const std::string & sVar, const std::string & sSrc) const;
 	std::string as_string() const;
 	bool operator< (const MsgFilter & F) const;
 	std::string app_filter() const;
 	std::string var_filter() const;
 	double period() const;
+	int priority() const;
+	bool coalesce() const;
 
 protected:
 	std::pair<std::string,std::string> filters_;
 	double period_;
+	int priority_;
+	bool coalesce_;
 };
 };
 #endif
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Public License
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/gpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+#ifndef WILDCARDINDEXH
+#define WILDCARDINDEXH
+
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "MOOS/libMOOS/DB/MsgFilter.h"
+
+namespace MOOS
+{
+
+/** A compiled index over the wildcard subscriptions held by the DB. Each
+filter is filed under the literal (wildcard free) prefix of its variable
+pattern in a character trie. Filters whose variable pattern starts with
+a wildcard are filed under the literal prefix of their app pattern in a
+second trie and only filters with no literal prefix at all live in a
+residual list. Looking up a new variable therefore only visits filters
+whose literal prefix is a prefix of the variable (or source) name and the
+remainder of the pattern is checked with the usual glob matcher.*/
+class WildcardIndex
+{
+public:
+	/** a (client, filter) pair as returned by a lookup */
+	typedef std::pair<std::string, MsgFilter> Subscription;
+
+	WildcardIndex();
+
+	/** add a filter for a client, returns false if the client already
+	has an identical filter (in which case nothing changes) */
+	bool Add(const std::string & sClient, const MsgFilter & F);
+
+	/** remove a single filter owned by a client */
+	bool Remove(const std::string & sClient, const MsgFilter & F);
+
+	/** remove every filter owned by a client */
+	void RemoveClient(const std::string & sClient);
+
+	/** fill Matches with every (client,filter) pair whose filter matches
+	a variable called sVar written by sSrc. Returns the number found*/
+	unsigned int Find(const std::string & sVar,
+			const std::string & sSrc,
+			std::vector<Subscription> & Matches) const;
+
+	/** how many filters are held in total */
+	unsigned int Size() const;
+
+	/** the characters of sPattern preceding the first '*' or '?' */
+	static std::string LiteralPrefix(const std::string & sPattern);
+
+protected:
+	typedef std::set<Subscription> SubscriptionSet;
+
+	/** one node of a character trie, children are indices into the
+	node vector of the owning trie */
+	struct TrieNode
+	{
+		std::map<char, unsigned int> children_;
+		SubscriptionSet subscriptions_;
+	};
+
+	class Trie
+	{
+	public:
+		Trie();
+		bool Insert(const std::string & sKey, const Subscription & S);
+		bool Erase(const std::string & sKey, const Subscription & S);
+		void Collect(const std::string & sName,
+				const std::string & sVar,
+				const std::string & sSrc,
+				std::vector<Subscription> & Matches) const;
+	private:
+		std::vector<TrieNode> nodes_;
+	};
+
+	enum Bucket
+	{
+		VAR_TRIE,
+		APP_TRIE,
+		RESIDUAL
+	};
+	static Bucket Classify(const MsgFilter & F, std::string & sKey);
+
+	Trie var_trie_;
+	Trie app_trie_;
+	SubscriptionSet residual_;
+
+	/** what filters does each client own */
+	std::map<std::string, std::set<MsgFilter> > client_filters_;
+	unsigned int size_;
+};
+
+}
+#endif
@@ -59,6 +59,12 @@ AppCastingMOOSApp::AppCastingMOOSApp()
 
   m_comms_policy = "open";
   m_comms_policy_config = "open";
+
+  m_appcast_deltas = false;
+  m_appcast_keyframe_interval = 20;
+  m_appcast_seq = 0;
+  m_appcast_since_keyframe = 0;
+  m_appcast_keyframe_due = true;
 }
 
 //----------------------------------------------------------------
@@ -201,8 +207,75 @@ void AppCastingMOOSApp::PostReport(const string& directive)
     m_new_run_warning = false;
     m_new_cfg_warning = false;
     m_last_report_time_appcast = m_curr_time;
-    m_Comms.Notify("APPCAST", m_ac.getAppCastString());
+    m_Comms.Notify("APPCAST", appcastPostString());
+  }
+}
+
+//----------------------------------------------------------------
+// Procedure: appcastPostString()
+//      Note: In delta mode each post is a delta relative to the prior
+//            post, except for periodic keyframes. A keyframe is also
+//            sent when a new client requests appcasts, so it needn't
+//            wait for the next periodic keyframe. A client that
+//            misses a post drops deltas until the next keyframe.
+
+string AppCastingMOOSApp::appcastPostString()
+{
+  string full = m_ac.getAppCastString();
+  if(!m_appcast_deltas)
+    return(full);
+
+  m_appcast_seq++;
+  m_appcast_since_keyframe++;
+  if(m_appcast_since_keyframe >= m_appcast_keyframe_interval)
+    m_appcast_keyframe_due = true;
+
+  string post;
+  if(!m_appcast_keyframe_due) {
+    post = appCastDelta(m_appcast_last, full, m_appcast_seq, m_appcast_seq-1);
+    if(post.length() >= full.length())
+      post = "";
+  }
+  if(post == "") {
+    post = appCastKeyFrame(full, m_appcast_seq);
+    m_appcast_since_keyframe = 0;
+    m_appcast_keyframe_due = false;
   }
+
+  m_appcast_last = full;
+  return(post);
+}
+
+//----------------------------------------------------------------
+// Procedure: reuseReportSection()
+//   Returns: true if the named section was built before with the
+//            same inputs, and its text has been written to m_msgs.
+
+bool AppCastingMOOSApp::reuseReportSection(const string& name,
+					   const string& inputs)
+{
+  map<string, string>::iterator p = m_map_section_inputs.find(name);
+  if((p != m_map_section_inputs.end()) && (p->second == inputs)) {
+    map<string, string>::iterator q = m_map_section_text.find(name);
+    if(q != m_map_section_text.end()) {
+      m_msgs << q->second;
+      return(true);
+    }
+  }
+
+  m_map_section_inputs[name] = inputs;
+  m_map_section_text.erase(name);
+  return(false);
+}
+
+//----------------------------------------------------------------
+// Procedure: postReportSection()
+
+void AppCastingMOOSApp::postReportSection(const string& name,
+					  const string& text)
+{
+  m_map_section_text[name] = text;
+  m_msgs << text;
 }
 
 //----------------------------------------------------------------
@@ -395,6 +468,21 @@ bool AppCastingMOOSApp::OnStartUpDirectives(string directives)
 	cout << "+++++++++++++++++++++++++++++++++++++++++++++++++" << endl;      
       }
     }
+    else if(param == "APPCAST_DELTAS") {
+      if(MOOSStrCmp(value, "true"))
+	m_appcast_deltas = true;
+      else if(MOOSStrCmp(value, "false"))
+	m_appcast_deltas = false;
+      else
+	reportConfigWarning("Invalid APPCAST_DELTAS: " + value);
+    }
+    else if(param == "APPCAST_KEYFRAME_INTERVAL") {
+      int ival = atoi(value.c_str());
+      if(!MOOSIsNumeric(value) || (ival < 1))
+	reportConfigWarning("Invalid APPCAST_KEYFRAME_INTERVAL: " + value);
+      else
+	m_appcast_keyframe_interval = (unsigned int)(ival);
+    }
     else if(param == "MAX_APPCAST_RUN_WARNINGS") {
       if(!MOOSIsNumeric(value))
 	reportConfigWarning("Invalid MAX_APPCAST_EVENTS: " + value);
@@ -529,6 +617,13 @@ void AppCastingMOOSApp::handleMailAppCastRequest(const string& str)
   d_duration = (d_duration < 0) ? 0 : d_duration;
   d_duration = (d_duration > 30) ? 30 : d_duration;
 
+  // A client new, or returning after its request lapsed, may have
+  // missed prior posts and needs a keyframe to build on.
+  if(m_map_bcast_duration.count(s_key) == 0)
+    m_appcast_keyframe_due = true;
+  else if((m_curr_time - m_map_bcast_tstart[s_key]) >= m_map_bcast_duration[s_key])
+    m_appcast_keyframe_due = true;
+
   m_map_bcast_duration[s_key] = d_duration;
   m_map_bcast_tstart[s_key]   = m_curr_time;
   m_map_bcast_thresh[s_key]   = s_thresh;
@@ -600,7 +695,8 @@ void AppCastingMOOSApp::reportUnhandledConfigWarning(const string& orig)
   if((param == "APPTICK")    || (param == "APP_LOGGING")          ||
      (param == "MAXAPPTICK") || (param == "TERM_REPORT_INTERVAL") ||
      (param == "COMMSTICK")  || (param == "MAX_APPCAST_EVENTS")   ||
-     (param == "DEPRECATED_OK"))
+     (param == "DEPRECATED_OK") || (param == "APPCAST_DELTAS") ||
+     (param == "APPCAST_KEYFRAME_INTERVAL"))
     return;
 
   reportConfigWarning("Unhandled config line: " + orig);
@@ -0,0 +1,78 @@
+/*****************************************************************/
+/*    FILE: AppCastDelta.h                                       */
+/*                                                               */
+/* This program is free software; you can redistribute it and/or */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation; either version  */
+/* 2 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* This program is distributed in the hope that it will be       */
+/* useful, but WITHOUT ANY WARRANTY; without even the implied    */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the GNU General Public License for more details. */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with this program; if not, write to the Free    */
+/* Software Foundation, Inc., 59 Temple Place - Suite 330,       */
+/* Boston, MA 02111-1307, USA.                                   */
+/*****************************************************************/
+
+#ifndef APP_CAST_DELTA_HEADER
+#define APP_CAST_DELTA_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+
+// An appcast string may be posted in one of three forms:
+//
+//   Plain:    "proc=uFoo!@#iter=3!@#...."        (the original form)
+//   Keyframe: "acseq=7!@#proc=uFoo!@#iter=3!@#...."
+//   Delta:    "acdelta=8!@#acbase=7!@#proc=uFoo!@#node=abe!@#ops=..."
+//
+// A delta is an edit script against the keyframe or delta with the
+// sequence number acbase, over the "lines" of the appcast string,
+// i.e., the pieces between the "!@" separators. Ops are separated
+// by "!@" and are one of:
+//
+//   =N     copy the next N lines of the base
+//   -N     skip the next N lines of the base
+//   +text  insert the line text
+//
+// Older readers ignore the acseq field of a keyframe, and will see
+// a delta as an appcast with no content.
+
+std::string appCastKeyFrame(const std::string& full, unsigned int seq);
+
+std::string appCastDelta(const std::string& base, const std::string& full,
+			 unsigned int seq, unsigned int base_seq);
+
+bool isAppCastDelta(const std::string&);
+
+//----------------------------------------------------------------
+// AppCastDeltaCache: Held by a reader of appcasts. Holds the most
+// recent full appcast string for each node/proc so that deltas may
+// be expanded. A delta whose base is not held (e.g., the base was
+// missed) is dropped until the next keyframe arrives.
+
+class AppCastDeltaCache
+{
+ public:
+  AppCastDeltaCache() {m_dropped=0;}
+  ~AppCastDeltaCache() {}
+
+  // Returns false if the given string is a delta that cannot be
+  // expanded. Otherwise full holds the plain appcast string.
+  bool resolve(const std::string& str, std::string& full);
+
+  unsigned int getDropped() const {return(m_dropped);}
+  void         clear()            {m_seq.clear(); m_full.clear();}
+
+ protected:
+  std::map<std::string, unsigned int> m_seq;
+  std::map<std::string, std::string>  m_full;
+
+  unsigned int m_dropped;
+};
+
+#endif
@@ -96,6 +96,11 @@ public:
 		/// became signalled within the specified
 		/// time interval, false otherwise.
 
+	bool tryWaitMicroseconds(long microseconds);
+		/// As tryWait() but with a timeout in microseconds.
+		/// Where the platform allows it the timeout is measured
+		/// on a monotonic clock.
+
 	void reset();
 		/// Resets the event to unsignalled state.
 
@@ -133,6 +138,12 @@ inline bool Event::tryWait(long milliseconds)
 }
 
 
+inline bool Event::tryWaitMicroseconds(long microseconds)
+{
+	return waitMicrosecondsImpl(microseconds);
+}
+
+
 inline void Event::reset()
 {
 	resetImpl();
@@ -59,6 +59,7 @@ protected:
 	void setImpl();
 	void waitImpl();
 	bool waitImpl(long milliseconds);
+	bool waitMicrosecondsImpl(long microseconds);
 	void resetImpl();
 
 private:
@@ -58,6 +58,7 @@ protected:
 	void setImpl();
 	void waitImpl();
 	bool waitImpl(long milliseconds);
+	bool waitMicrosecondsImpl(long microseconds);
 	void resetImpl();
 
 private:
@@ -38,6 +38,14 @@
 
 #include "MOOS/libMOOS/Thirdparty/PocoBits/Event_POSIX.h"
 #include <sys/time.h>
+#include <time.h>
+#include <climits>
+
+//on linux the condition variable runs on the monotonic clock so timed waits
+//are not disturbed by changes to the wall clock
+#if defined(__linux__) && defined(CLOCK_MONOTONIC)
+#define MOOS_POCO_EVENT_MONOTONIC
+#endif
 
 
 namespace MOOS {
@@ -48,8 +56,19 @@ EventImpl::EventImpl(bool autoReset): _auto(autoReset), _state(false)
 {
 	if (pthread_mutex_init(&_mutex, NULL))
 		throw SystemException("cannot create event (mutex)");
+#if defined(MOOS_POCO_EVENT_MONOTONIC)
+	pthread_condattr_t attr;
+	if (pthread_condattr_init(&attr))
+		throw SystemException("cannot create event (condition attribute)");
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	int rc = pthread_cond_init(&_cond, &attr);
+	pthread_condattr_destroy(&attr);
+	if (rc)
+		throw SystemException("cannot create event (condition)");
+#else
 	if (pthread_cond_init(&_cond, NULL))
 		throw SystemException("cannot create event (condition)");
+#endif
 }
 
 
@@ -79,20 +98,34 @@ void EventImpl::waitImpl()
 
 
 bool EventImpl::waitImpl(long milliseconds)
+{
+	if (milliseconds > LONG_MAX/1000)
+		milliseconds = LONG_MAX/1000;
+	return waitMicrosecondsImpl(milliseconds*1000);
+}
+
+
+bool EventImpl::waitMicrosecondsImpl(long microseconds)
 {
 	int rc = 0;
 	struct timespec abstime;
 
 #if defined(__VMS)
 	struct timespec delta;
-	delta.tv_sec  = milliseconds / 1000;
-	delta.tv_nsec = (milliseconds % 1000)*1000000;
+	delta.tv_sec  = microseconds / 1000000;
+	delta.tv_nsec = (microseconds % 1000000)*1000;
 	pthread_get_expiration_np(&delta, &abstime);
+#else
+#if defined(MOOS_POCO_EVENT_MONOTONIC)
+	clock_gettime(CLOCK_MONOTONIC, &abstime);
 #else
 	struct timeval tv;
 	gettimeofday(&tv, NULL);
-	abstime.tv_sec  = tv.tv_sec + milliseconds / 1000;
-	abstime.tv_nsec = tv.tv_usec*1000 + (milliseconds % 1000)*1000000;
+	abstime.tv_sec  = tv.tv_sec;
+	abstime.tv_nsec = tv.tv_usec*1000;
+#endif
+	abstime.tv_sec  += microseconds / 1000000;
+	abstime.tv_nsec += (microseconds % 1000000)*1000;
 	if (abstime.tv_nsec >= 1000000000)
 	{
 		abstime.tv_nsec -= 1000000000;
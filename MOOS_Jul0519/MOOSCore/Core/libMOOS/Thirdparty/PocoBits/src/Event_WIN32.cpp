@@ -82,5 +82,12 @@ bool EventImpl::waitImpl(long milliseconds)
 }
 
 
+bool EventImpl::waitMicrosecondsImpl(long microseconds)
+{
+	//the best we can do here is whole milliseconds
+	return waitImpl((microseconds+999)/1000);
+}
+
+
 } // namespace Poco
 } // namespace MOOS
@@ -44,6 +44,7 @@
 #include <memory>
 #include <cstring>
 #include <map>
+#include <atomic>
 #include <time.h>
 #include <stdarg.h>
 #include <math.h>
@@ -102,6 +103,11 @@ typedef std::map<pthread_t,bool> THREAD2TRACE_MAP;
 double gdfMOOSTimeWarp = 1.0;
 double gdfMOOSSkew =0.0;
 
+//lockstep simulation - time is served by the MOOSDB rather than the system clock
+std::atomic<bool> gbMOOSVirtualTime(false);
+double gdfMOOSVirtualTime = 0.0;
+CMOOSLock gVirtualTimeLock;
+
 //NB new V10 functions will be namespaced....
 namespace MOOS
 {
@@ -110,6 +116,28 @@ namespace MOOS
 		return MOOSTime();
 	}
 
+	double MonotonicTime()
+	{
+#ifdef _WIN32
+		static LARGE_INTEGER liFreq;
+		static bool bFreqKnown = false;
+		if(!bFreqKnown)
+		{
+			QueryPerformanceFrequency(&liFreq);
+			bFreqKnown = true;
+		}
+		LARGE_INTEGER liNow;
+		QueryPerformanceCounter(&liNow);
+		return static_cast<double>(liNow.QuadPart)/static_cast<double>(liFreq.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC,&ts);
+		return ts.tv_sec+ts.tv_nsec*1e-9;
+#else
+		return MOOSLocalTime(false);
+#endif
+	}
+
 	std::string TimeToDate(double dfTime,bool bDate,bool bTime)
 	{
 	    struct timeval TimeVal;
@@ -190,6 +218,30 @@ double GetMOOSSkew()
 	return gdfMOOSSkew;
 }
 
+void SetMOOSVirtualTime(double dfTime)
+{
+    MOOS::ScopedLock Lock(gVirtualTimeLock);
+    gdfMOOSVirtualTime = dfTime;
+    gbMOOSVirtualTime = true;
+}
+
+void ClearMOOSVirtualTime()
+{
+    MOOS::ScopedLock Lock(gVirtualTimeLock);
+    gbMOOSVirtualTime = false;
+}
+
+bool IsMOOSTimeVirtual()
+{
+    return gbMOOSVirtualTime;
+}
+
+static double GetMOOSVirtualTime()
+{
+    MOOS::ScopedLock Lock(gVirtualTimeLock);
+    return gdfMOOSVirtualTime;
+}
+
 
 
 /** returns true if architecture is LittleEndian (true for x86 Architectures)
@@ -230,6 +282,11 @@ bool SetWin32HighPrecisionTiming(bool bEnable)
 
 double MOOSLocalTime(bool bApplyTimeWarping)
 {
+    //simulated time is already "warped" - un-warped requests are for
+    //the wall clock (timeouts, comms scheduling) and so fall through
+    if(bApplyTimeWarping && gbMOOSVirtualTime)
+        return GetMOOSVirtualTime();
+
 #ifndef _WIN32
 	double dfT=0.0;
 	struct timeval TimeVal;
@@ -314,6 +371,10 @@ double HPMOOSTime(bool bApplyTimeWarping)
 
 double MOOSTime(bool bApplyTimeWarping)
 {
+    //the DB is the time server in lockstep mode so there is no skew
+    if(bApplyTimeWarping && gbMOOSVirtualTime)
+        return GetMOOSVirtualTime();
+
     return MOOSLocalTime(bApplyTimeWarping)+gdfMOOSSkew;
 }
 
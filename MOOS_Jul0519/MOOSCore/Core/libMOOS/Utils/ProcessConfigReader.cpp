@@ -72,18 +72,19 @@ bool CProcessConfigReader::GetConfigurationAndPreserveSpace(std::string sAppName
 {
 	Params.clear();
 
-	Reset();
+	//the block is found from the line index rather than by a scan
+	//of the file (see CMOOSFileReader::IndexLines())
+	int nLine = FindIndexedBlock(sAppName);
+	int nLines = (int)m_IndexedLines.size();
 
-	std::string sKey = "PROCESSCONFIG="+sAppName;
-
-	if(GoTo(sKey))
+	if(nLine>=0)
 	{
-		std::string sBracket = GetNextValidLine();
+		std::string sBracket = nLine<nLines ? m_IndexedLines[nLine] : std::string();
 		if(MOOSStartsWith(sBracket, "{"))
 		{
-			while(!GetFile()->eof())
+			while(++nLine<nLines)
 			{
-				std::string sLine = GetNextValidLine();
+				std::string sLine = m_IndexedLines[nLine];
 				MOOSTrimWhiteSpace(sLine);
 
 				if(!MOOSStartsWith(sLine, "}"))
@@ -132,18 +133,17 @@ bool CProcessConfigReader::GetConfiguration(std::string sAppName, STRING_LIST &P
     
     Params.clear();
     
-    Reset();
-    
-    std::string sKey = "PROCESSCONFIG="+sAppName;
+    int nLine = FindIndexedBlock(sAppName);
+    int nLines = (int)m_IndexedLines.size();
     
-    if(GoTo(sKey))
+    if(nLine>=0)
     {
-        std::string sBracket = GetNextValidLine();
+        std::string sBracket = nLine<nLines ? m_IndexedLines[nLine] : std::string();
         if(sBracket.find("{")==0)
         {
-            while(!GetFile()->eof())
+            while(++nLine<nLines)
             {
-                std::string sLine = GetNextValidLine();
+                std::string sLine = m_IndexedLines[nLine];
                 
                 MOOSRemoveChars(sLine," \t\r");
                 
@@ -297,8 +297,6 @@ bool CProcessConfigReader::GetConfigurationParam(std::string sAppName,std::strin
 ///                               READ STRINGS
 bool CProcessConfigReader::GetConfigurationParam(std::string sAppName,std::string sParam, std::string &sVal)
 {
-    Reset();
-
     //remember all names we were asked for....
     std::string sl = sParam;
     MOOSToLower(sl);
@@ -39,6 +39,7 @@
 #include <fstream>
 #include <string>
 #include <map>
+#include <vector>
 
 #ifdef _WIN32
     typedef std::map<int,std::ifstream*> THREAD2FILE_MAP;
@@ -102,7 +103,7 @@ public:
     bool DoVariableExpansion(std::string & sVal);
     bool BuildLocalShellVars();
     bool MakeOverloadedCopy(const std::string & sCopyName,std::map<std::string, std::string> & OverLoads);
-	void EnableVerbatimQuoting(bool bEnable=true){m_bEnableVerbatimQuoting = bEnable;};
+	void EnableVerbatimQuoting(bool bEnable=true){m_bEnableVerbatimQuoting = bEnable;m_bLinesIndexed=false;};
 
 
 protected:
@@ -122,6 +123,19 @@ protected:
     std::ifstream * GetFile();
     CMOOSLock *m_pLock;
     static bool    IsComment(std::string & sLine);
+
+    /** removes a trailing "//" comment (not in quotes) from a line*/
+    void RemoveTrailingComment(std::string & sLine);
+
+    /** reads the whole file once, noting every line GetNextValidLine()
+    would return in a pass from the start of the file, and where each
+    ProcessConfig block begins. Lookups are then served from memory
+    rather than by rescanning the file. Returns false if the file
+    cannot be read*/
+    bool IndexLines();
+
+    /** index of the first line after "ProcessConfig = sAppName" or -1*/
+    int FindIndexedBlock(const std::string & sAppName);
     std::string    m_sFileName;
     std::ifstream m_File;
 
@@ -133,6 +147,14 @@ protected:
 	//characters not treated as comments
 	bool m_bEnableVerbatimQuoting;
 
+    /** the valid lines of the file, built on first lookup*/
+    bool m_bLinesIndexed;
+    std::vector<std::string> m_IndexedLines;
+    /** upper case "PROCESSCONFIG=NAME" -> index of line that follows*/
+    std::map<std::string, int> m_IndexedBlocks;
+    /** upper case token -> first value given for it in the file*/
+    std::map<std::string, std::string> m_IndexedValues;
+
 };
 
 #endif // !defined(AFX_MOOSFILEREADER_H__B355D791_3CC0_4612_B755_020A269204F2__INCLUDED_)
@@ -44,6 +44,9 @@
 namespace MOOS
 {
 	double Time();
+	/** seconds on a clock which only ever moves forwards at a steady rate
+	(not time warped, arbitrary origin) - use it for measuring intervals */
+	double MonotonicTime();
     std::string TimeToDate(double dfTime,bool bDate=true,bool bTime=true);
 	void Pause(int milliseconds, bool bApplyTimeWarp = true );
 	std::string Chomp(std::string &sStr, const std::string &sTk,bool bInsensitive=false);
@@ -165,6 +168,18 @@ bool SetMOOSTimeWarp(double dfWarp);
 /** return the current time warp factor */
 double GetMOOSTimeWarp();
 
+/** make MOOSTime() and MOOSLocalTime() return dfTime (rather than reading the
+system clock) until the next call or ClearMOOSVirtualTime(). Used in lockstep
+simulation where the MOOSDB serves time. Calls which ask for un-warped time
+still get the wall clock.*/
+void SetMOOSVirtualTime(double dfTime);
+
+/** go back to using the system clock */
+void ClearMOOSVirtualTime();
+
+/** true if time is currently being served by SetMOOSVirtualTime() */
+bool IsMOOSTimeVirtual();
+
 /**pause for nMS milliseconds */
 void MOOSPause(int nMS,bool bApplyTimeWarping = true);
 
@@ -0,0 +1,4 @@
+#pragma once
+//this file is auto generated and defines a 
+//string capturing the current git SHA1 code
+#define MOOS_GIT_VERSION "libMOOS git SHA1 is not known"
@@ -16,8 +16,12 @@
 #include <stdexcept>
 #include <iostream>
 #include "Listener.h"
+#include "Sender.h"
 #include "MOOS/libMOOS/Utils/ConsoleColours.h"
 
+//how many datagrams we try to pick up per system call
+#define DATAGRAMS_PER_READ 16
+
 
 namespace MOOS {
 
@@ -40,6 +44,33 @@ bool Listener::Run()
 	thread_.Initialise(dispatch, this);
 	return thread_.Start();
 }
+void Listener::OnDatagram(unsigned char * data, unsigned int size)
+{
+	if(!Sender::IsBatch(data,size))
+	{
+		//deserialise
+		CMOOSMsg msg;
+		msg.Serialize(data, size, false);
+
+		//push onto queue
+		queue_.Push(msg);
+		return;
+	}
+
+	//a batch is a marker followed by any number of serialised messages
+	unsigned int offset = Sender::HeaderSize();
+	while(offset<size)
+	{
+		CMOOSMsg msg;
+		int consumed = msg.Serialize(data+offset, size-offset, false);
+		if(consumed<=0)
+			break;
+
+		queue_.Push(msg);
+		offset+=consumed;
+	}
+}
+
 bool Listener::ListenLoop()
 {
 	try
@@ -96,6 +127,39 @@ bool Listener::ListenLoop()
 		}
 
 
+#ifdef __linux__
+		//make receive buffers - we read as many datagrams as are waiting
+		//(up to DATAGRAMS_PER_READ) with each system call
+		const unsigned int datagram_space = 64*1024;
+		std::vector<unsigned char > incoming_buffer(DATAGRAMS_PER_READ*datagram_space);
+		struct mmsghdr headers[DATAGRAMS_PER_READ];
+		struct iovec vectors[DATAGRAMS_PER_READ];
+
+		while(!thread_.IsQuitRequested())
+		{
+			memset(headers, 0, sizeof(headers));
+			for(unsigned int i = 0;i<DATAGRAMS_PER_READ;i++)
+			{
+				vectors[i].iov_base = incoming_buffer.data()+i*datagram_space;
+				vectors[i].iov_len = datagram_space;
+				headers[i].msg_hdr.msg_iov = &vectors[i];
+				headers[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			//block for the first then take whatever else is there
+			int num_read = recvmmsg(socket_fd, headers, DATAGRAMS_PER_READ,
+					MSG_WAITFORONE, NULL);
+
+			for(int i = 0;i<num_read;i++)
+			{
+				if(headers[i].msg_len>0)
+				{
+					OnDatagram(static_cast<unsigned char*>(vectors[i].iov_base),
+							headers[i].msg_len);
+				}
+			}
+		}
+#else
 		//make a receive buffer
 		std::vector<unsigned char > incoming_buffer(2*64*1024);
 
@@ -108,17 +172,11 @@ bool Listener::ListenLoop()
 
 			if(num_bytes_read>0)
 			{
-
-				//deserialise
-				CMOOSMsg msg;
-				msg.Serialize(incoming_buffer.data(), incoming_buffer.size(), false);
-
-
-				//push onto queue
-				queue_.Push(msg);
+				OnDatagram(incoming_buffer.data(), num_bytes_read);
 			}
 
 		}
+#endif
 	}
 	catch(const std::exception & e)
 	{
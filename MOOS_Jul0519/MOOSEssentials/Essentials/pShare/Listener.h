@@ -29,6 +29,9 @@ public:
 	bool multicast(){return multicast_;};
 protected:
 	bool ListenLoop();
+
+	/** unpack a received datagram (one message or a batch) onto the queue */
+	void OnDatagram(unsigned char * data, unsigned int size);
 	CMOOSThread thread_;
 	SafeList<CMOOSMsg > & queue_;
 
@@ -0,0 +1,217 @@
+/*
+ * Sender.cpp
+ *
+ *  Outgoing udp traffic with optional per destination batching.
+ */
+#ifndef _WIN32
+#include "unistd.h"
+#endif
+
+#include <sys/socket.h>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+#include "Sender.h"
+
+//a batch starts with these bytes. A plain datagram starts with the (little
+//endian) length of the message it holds and a message can never be this long
+//so the two can be told apart.
+static const unsigned char kBatchMarker[4] = {'M', 'S', 'B', 0x01};
+
+//most datagrams we will hand to a single sendmmsg
+static const unsigned int kMaxDatagramsPerCall = 64;
+
+namespace MOOS {
+
+Sender::Sender()
+{
+	batching_ = false;
+	max_bytes_ = 1472;
+	max_delay_ = 0.0;
+	messages_sent_ = 0;
+	datagrams_sent_ = 0;
+	system_calls_ = 0;
+}
+
+void Sender::SetBatching(bool enable, unsigned int max_bytes, double max_delay)
+{
+	batching_ = enable;
+	max_bytes_ = std::max(max_bytes, HeaderSize()+1);
+	max_delay_ = std::max(max_delay, 0.0);
+}
+
+bool Sender::IsBatch(const unsigned char * data, unsigned int size)
+{
+	return size>=sizeof(kBatchMarker) &&
+			memcmp(data, kBatchMarker, sizeof(kBatchMarker))==0;
+}
+
+unsigned int Sender::HeaderSize()
+{
+	return sizeof(kBatchMarker);
+}
+
+void Sender::Send(int socket_fd,
+		const struct sockaddr_in & address,
+		const unsigned char * data,
+		unsigned int size,
+		double now)
+{
+	messages_sent_++;
+
+	if(!batching_)
+	{
+		//goes on its own, exactly as it always has
+		if (sendto(socket_fd, data, size, 0,
+				(struct sockaddr*) (&address),
+				sizeof(address)) < 0)
+		{
+			throw std::runtime_error("failed \"sendto\"");
+		}
+		datagrams_sent_++;
+		system_calls_++;
+		return;
+	}
+
+	std::map<int, Batch>::iterator q = open_.find(socket_fd);
+	if(size+HeaderSize()>max_bytes_)
+	{
+		//too big to batch so it goes on its own, but only after anything
+		//already queued for this socket so nothing is reordered
+		if(q!=open_.end())
+		{
+			Close(socket_fd, q->second);
+			open_.erase(q);
+		}
+
+		std::vector<Batch> & ready = ready_[socket_fd];
+		ready.push_back(Batch());
+		ready.back().address = address;
+		ready.back().buffer.assign(data, data+size);
+		ready.back().count = 1;
+
+		Transmit(socket_fd, ready);
+		return;
+	}
+
+	if(q!=open_.end() && q->second.buffer.size()+size>max_bytes_)
+	{
+		//no room - this one is full
+		Close(socket_fd, q->second);
+		open_.erase(q);
+		q = open_.end();
+	}
+
+	if(q==open_.end())
+	{
+		Batch & batch = open_[socket_fd];
+		batch.address = address;
+		batch.buffer.reserve(max_bytes_);
+		batch.buffer.assign(kBatchMarker, kBatchMarker+sizeof(kBatchMarker));
+		batch.count = 0;
+		batch.opened = now;
+		q = open_.find(socket_fd);
+	}
+
+	q->second.buffer.insert(q->second.buffer.end(), data, data+size);
+	q->second.count++;
+}
+
+void Sender::Close(int socket_fd, Batch & batch)
+{
+	if(batch.count==1)
+	{
+		//a batch of one is sent as a plain message
+		batch.buffer.erase(batch.buffer.begin(), batch.buffer.begin()+HeaderSize());
+	}
+
+	std::vector<Batch> & ready = ready_[socket_fd];
+	ready.push_back(Batch());
+	ready.back().address = batch.address;
+	ready.back().buffer.swap(batch.buffer);
+	ready.back().count = batch.count;
+}
+
+void Sender::Flush(double now, bool force)
+{
+	std::map<int, Batch>::iterator q = open_.begin();
+	while(q!=open_.end())
+	{
+		if(force || now-q->second.opened>=max_delay_)
+		{
+			Close(q->first, q->second);
+			open_.erase(q++);
+		}
+		else
+		{
+			++q;
+		}
+	}
+
+	Transmit();
+}
+
+void Sender::Transmit()
+{
+	std::map<int, std::vector<Batch> >::iterator q;
+	for(q = ready_.begin();q!=ready_.end();++q)
+		Transmit(q->first, q->second);
+}
+
+void Sender::Transmit(int socket_fd, std::vector<Batch> & ready)
+{
+#ifdef __linux__
+	//one system call for many datagrams
+	for(unsigned int i = 0;i<ready.size();i+=kMaxDatagramsPerCall)
+	{
+		unsigned int n = std::min<unsigned int>(kMaxDatagramsPerCall,
+				static_cast<unsigned int>(ready.size())-i);
+
+		struct mmsghdr headers[kMaxDatagramsPerCall];
+		struct iovec vectors[kMaxDatagramsPerCall];
+		memset(headers, 0, sizeof(headers));
+		for(unsigned int j = 0;j<n;j++)
+		{
+			Batch & batch = ready[i+j];
+			vectors[j].iov_base = batch.buffer.data();
+			vectors[j].iov_len = batch.buffer.size();
+			headers[j].msg_hdr.msg_name = &batch.address;
+			headers[j].msg_hdr.msg_namelen = sizeof(batch.address);
+			headers[j].msg_hdr.msg_iov = &vectors[j];
+			headers[j].msg_hdr.msg_iovlen = 1;
+		}
+
+		unsigned int sent = 0;
+		while(sent<n)
+		{
+			int r = sendmmsg(socket_fd, headers+sent, n-sent, 0);
+			system_calls_++;
+			if(r<0)
+			{
+				ready.clear();
+				throw std::runtime_error("failed \"sendmmsg\"");
+			}
+			sent+=r;
+		}
+		datagrams_sent_+=n;
+	}
+#else
+	for(unsigned int i = 0;i<ready.size();i++)
+	{
+		Batch & batch = ready[i];
+		system_calls_++;
+		if (sendto(socket_fd, batch.buffer.data(), batch.buffer.size(), 0,
+				(struct sockaddr*) (&batch.address),
+				sizeof(batch.address)) < 0)
+		{
+			ready.clear();
+			throw std::runtime_error("failed \"sendto\"");
+		}
+		datagrams_sent_++;
+	}
+#endif
+	ready.clear();
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Sender.h
+ *
+ *  Outgoing udp traffic. Serialised messages can be sent one per datagram
+ *  (the classic pShare wire format) or packed into batches of up to
+ *  max_bytes per destination which are flushed when full or when the
+ *  oldest message in them is max_delay seconds old.
+ */
+
+#ifndef SENDER_H_
+#define SENDER_H_
+
+#include <netinet/in.h>
+#include <map>
+#include <vector>
+
+namespace MOOS {
+
+class Sender {
+public:
+	Sender();
+
+	/** enable batching. max_bytes is the largest datagram made,
+	max_delay the longest a message may wait (0 flushes on every call
+	to Flush) */
+	void SetBatching(bool enable, unsigned int max_bytes, double max_delay);
+	bool batching() const {return batching_;};
+	double max_delay() const {return max_delay_;};
+
+	/** send (or queue) a serialised message to the destination served by
+	socket_fd */
+	void Send(int socket_fd,
+			const struct sockaddr_in & address,
+			const unsigned char * data,
+			unsigned int size,
+			double now);
+
+	/** transmit batches which are due (or all of them if force is true) */
+	void Flush(double now, bool force = false);
+
+	/** true if a datagram starts with the batch marker */
+	static bool IsBatch(const unsigned char * data, unsigned int size);
+
+	/** size of the batch marker which precedes the messages in a batch */
+	static unsigned int HeaderSize();
+
+	unsigned long messages_sent() const {return messages_sent_;};
+	unsigned long datagrams_sent() const {return datagrams_sent_;};
+	unsigned long system_calls() const {return system_calls_;};
+
+protected:
+	struct Batch
+	{
+		struct sockaddr_in address;
+		std::vector<unsigned char> buffer;
+		unsigned int count;
+		double opened;
+	};
+
+	/** move the contents of a batch to the list of datagrams ready to go */
+	void Close(int socket_fd, Batch & batch);
+
+	/** hand every ready datagram to the kernel */
+	void Transmit();
+
+	/** hand the ready datagrams of one socket to the kernel */
+	void Transmit(int socket_fd, std::vector<Batch> & ready);
+
+	bool batching_;
+	unsigned int max_bytes_;
+	double max_delay_;
+
+	//open batches keyed by socket
+	std::map<int, Batch> open_;
+
+	//complete datagrams waiting to be written keyed by socket
+	std::map<int, std::vector<Batch> > ready_;
+
+	unsigned long messages_sent_;
+	unsigned long datagrams_sent_;
+	unsigned long system_calls_;
+};
+
+}
+
+#endif /* SENDER_H_ */
@@ -9,6 +9,7 @@
 #include <netdb.h>
 
 #include <map>
+#include <unordered_map>
 #include <stdexcept>
 #include <string>
 #include <iomanip>
@@ -27,12 +28,15 @@
 #include "Listener.h"
 #include "Share.h"
 #include "Route.h"
+#include "Sender.h"
+#include "WildcardPattern.h"
 #include "ShareHelp.h"
 
 #define DEFAULT_MULTICAST_GROUP_ADDRESS "224.1.1.11"
 #define DEFAULT_MULTICAST_GROUP_PORT 24460
 #define MAX_MULTICAST_CHANNELS 256
 #define MAX_UDP_SIZE 48*1024
+#define DEFAULT_BATCH_SIZE 1472
 
 #define RED MOOS::ConsoleColours::Red()
 #define GREEN MOOS::ConsoleColours::Green()
@@ -59,11 +63,14 @@ public:
 	void OnPrintHelpAndExit();
 	void OnPrintInterfaceAndExit();
 
+	//send everything still waiting in a batch
+	void FlushAll();
+
 
 
 protected:
 
-	bool ApplyRoutes(CMOOSMsg & msg);
+	bool ApplyRoutes(CMOOSMsg & msg, std::list<Route> & route_list);
 
 	bool ApplyWildcardRoutes( CMOOSMsg& msg);
 
@@ -102,6 +109,8 @@ protected:
 
 	bool DoRegistrations();
 
+	std::list<Route> & RoutesFor(const std::string & src_name);
+
 private:
 	typedef CMOOSApp BASE;
 
@@ -113,9 +122,27 @@ private:
 	typedef std::map<std::string, std::list<Route> > RouteMap;
 	RouteMap routing_table_;
 
+	//hashed view of routing_table_ used when forwarding mail
+	std::unordered_map<std::string, std::list<Route>* > route_index_;
+
 	typedef std::map<std::pair< std::string,std::string>, std::list<Route> > WildcardRouteMap;
 	WildcardRouteMap wildcard_routing_table_;
 
+	//wildcard_routing_table_ with its patterns compiled
+	struct CompiledWildcardRoute
+	{
+		WildcardPattern var_pattern;
+		WildcardPattern app_pattern;
+		std::list<Route> * routes;
+	};
+	std::vector<CompiledWildcardRoute> compiled_wildcards_;
+
+	//all outgoing udp goes through here
+	Sender sender_;
+
+	//reused serialisation space
+	std::vector<unsigned char> serialisation_buffer_;
+
 	//this maps channel number to a listener (with its own thread)
 	SafeList<CMOOSMsg > incoming_queue_;
 	std::map<MOOS::IPV4Address, Listener*> listeners_;
@@ -223,6 +250,17 @@ bool Share::Impl::OnProcessCommandLine()
 
 	verbose_ = GetFlagFromCommandLineOrConfigurationFile("verbose");
 
+	//optional batching of outgoing messages (receivers need to be
+	//running a pShare which understands batches)
+	bool batch = GetFlagFromCommandLineOrConfigurationFile("batch");
+	int batch_size = DEFAULT_BATCH_SIZE;
+	GetParameterFromCommandLineOrConfigurationFile("batch_size",batch_size);
+	if(batch_size<=0 || batch_size>MAX_UDP_SIZE)
+		return MOOSFail("batch_size must be between 1 and %d bytes",MAX_UDP_SIZE);
+	double batch_delay = 0.0;
+	GetParameterFromCommandLineOrConfigurationFile("batch_delay",batch_delay);
+	sender_.SetBatching(batch,batch_size,batch_delay);
+
 	std::string sVar;
 	if(m_CommandLineParser.GetVariable("-o",sVar))
 	{
@@ -262,6 +300,10 @@ bool Share::Impl::OnStartUp()
 	SetIterateMode(REGULAR_ITERATE_AND_COMMS_DRIVEN_MAIL);
 	SetAppFreq(40,0);
 
+	//iterate often enough to honour the batching deadline
+	if(sender_.batching() && sender_.max_delay()>0.0)
+		SetAppFreq(std::min(std::max(40.0,2.0/sender_.max_delay()),1000.0),0);
+
 	try
 	{
 /*
@@ -585,6 +627,15 @@ bool Share::Impl::Iterate()
 		}
 	}
 
+	try
+	{
+		sender_.Flush(MOOS::Time());
+	}
+	catch(const std::exception & e)
+	{
+		std::cerr <<RED<< "Exception thrown: " << e.what() <<NORMAL<< std::endl;
+	}
+
 	PublishSharingStatus();
 	return true;
 }
@@ -659,13 +710,13 @@ bool Share::Impl::OnNewMail(MOOSMSG_LIST & new_mail)
 	for(q = new_mail.begin();q != new_mail.end();q++)
 	{
 		//do we need to forward it
-		RouteMap::iterator g = routing_table_.find(q->GetKey());
+		std::unordered_map<std::string, std::list<Route>* >::iterator g = route_index_.find(q->GetKey());
 		try
 		{
-			if(g != routing_table_.end())
+			if(g != route_index_.end())
 			{
 				//yes OK - try to do so
-				ApplyRoutes(*q);
+				ApplyRoutes(*q,*g->second);
 			}
 			else
 			{
@@ -679,9 +730,27 @@ bool Share::Impl::OnNewMail(MOOSMSG_LIST & new_mail)
 		}
 	}
 
+	//anything batched which is now due goes out
+	try
+	{
+		sender_.Flush(MOOS::Time());
+	}
+	catch(const std::exception & e)
+	{
+		std::cerr <<RED<< "Exception thrown: " << e.what() <<NORMAL<< std::endl;
+	}
+
 	return true;
 }
 
+std::list<Route> & Share::Impl::RoutesFor(const std::string & src_name)
+{
+	//std::map never moves its elements so the index can point into it
+	std::list<Route> & rlist = routing_table_[src_name];
+	route_index_[src_name] = &rlist;
+	return rlist;
+}
+
 
 bool  Share::Impl::AddMulticastAliasRoute(const std::string & src_name,
 				const std::string & dest_name,
@@ -722,7 +791,7 @@ bool  Share::Impl::AddRoute(const std::string & src_name,
 		route.multicast = multicast;
 		route.frequency = frequency;
 
-		std::list<Route> & rlist = routing_table_[trimed_src_name];
+		std::list<Route> & rlist = RoutesFor(trimed_src_name);
 
 		//check we have not already got this exact same route....
 		if(find(rlist.begin(), rlist.end(),route)==rlist.end())
@@ -746,6 +815,7 @@ bool  Share::Impl::AddRoute(const std::string & src_name,
 		route.dest_name = trimed_dest_name;
 		route.dest_address = address;
 		route.multicast = multicast;
+		route.frequency = frequency;
 
 		//this looks like a wildcard share
 		std::string var_pattern = MOOS::Chomp(trimed_src_name,":");
@@ -756,6 +826,15 @@ bool  Share::Impl::AddRoute(const std::string & src_name,
 
 		std::list<Route> & rlist = wildcard_routing_table_[std::make_pair(var_pattern,app_pattern)];
 
+		if(rlist.empty())
+		{
+			CompiledWildcardRoute compiled;
+			compiled.var_pattern = WildcardPattern(var_pattern);
+			compiled.app_pattern = WildcardPattern(app_pattern);
+			compiled.routes = &rlist;
+			compiled_wildcards_.push_back(compiled);
+		}
+
 		//check we have not already got this exact same route....
 		if(find(rlist.begin(), rlist.end(),route)==rlist.end())
 		{
@@ -816,6 +895,9 @@ bool Share::Impl::OnCommandMsg(CMOOSMsg  Msg)
 	std::string cmd;
 	MOOSValFromString(cmd,Msg.GetString(),"cmd");
 
+	//nothing batched under the old routing may be held back by a change
+	FlushAll();
+
 	try
 	{
 
@@ -846,6 +928,18 @@ bool Share::Impl::OnCommandMsg(CMOOSMsg  Msg)
 	return true;
 }
 
+void Share::Impl::FlushAll()
+{
+	try
+	{
+		sender_.Flush(MOOS::Time(),true);
+	}
+	catch(const std::exception & e)
+	{
+		std::cerr <<RED<< "Exception thrown: " << e.what() <<NORMAL<< std::endl;
+	}
+}
+
 bool Share::Impl::PrintSocketMap()
 {
 	SocketMap::iterator q;
@@ -956,101 +1050,94 @@ void Share::Impl::PrintRoutes()
 
 }
 
-bool WildcardMatch(const std::string & var_pattern,
-		const std::string & src_app_pattern,
-		const std::string & var,
-		const std::string & src_app)
-{
-	return MOOSWildCmp(src_app_pattern,src_app) && MOOSWildCmp(var_pattern,var);
-}
-
 bool Share::Impl::ApplyWildcardRoutes( CMOOSMsg& msg)
 {
 	//maybe it is in our wildcard routing?
+	std::list<Route> new_routes;
 
-	WildcardRouteMap::iterator g;
-	for(g=wildcard_routing_table_.begin();g!=wildcard_routing_table_.end();g++)
+	std::vector<CompiledWildcardRoute>::iterator g;
+	for(g=compiled_wildcards_.begin();g!=compiled_wildcards_.end();g++)
 	{
-		std::string var_pattern = g->first.first;
-		std::string app_pattern = g->first.second;
-		std::list<MOOS::Route> & routes = g->second;
+		if(!g->var_pattern.Matches(msg.GetKey()) ||
+				!g->app_pattern.Matches(msg.GetSource()))
+			continue;
+
+		const std::string & var_pattern = g->var_pattern.pattern();
+		std::list<MOOS::Route> & routes = *g->routes;
 
 		std::list<MOOS::Route>::iterator h;
 		for(h = routes.begin();h!=routes.end();h++)
 		{
 			Route & route = *h;
-			if(WildcardMatch(var_pattern,
-					app_pattern,
-					msg.GetKey(),
-					msg.GetSource()))
-			{
 
-				Route new_route = route;
-				new_route.src_name = msg.GetKey();
+			Route new_route = route;
+			new_route.src_name = msg.GetKey();
 
-				if(std::count(var_pattern.begin(), var_pattern.end(), '*')==1 &&
-						route.dest_name=="^")
-				{
-					//here we check for a special case if we are presented with a pattern
-					//like *_X->^ we will simply forward as the bit that matched * in *_X
-					//so concretely A_X will be forwarded as X
-
-					std::string t = msg.m_sKey;
-					std::string bit_that_matches;
-					if(*var_pattern.begin()=='*')
-					{
-						//we have *X
-						std::string tok = var_pattern.substr(1);
-						//we want everything before tok as that matched the wild card...
-						bit_that_matches = MOOS::Chomp(t,tok);
-					}
-					else if(*var_pattern.rbegin()=='*')
-					{
-						//we have X*
-						std::string tok = var_pattern.substr(0,var_pattern.length()-1);
-						//we want everything after tok as that matches the wild card...
-						MOOS::Chomp(t,tok);
-						bit_that_matches = t;
-					}
-					new_route.dest_name = bit_that_matches;
-				}
-				else
-				{
-					//standard thing to do is simply use message name as a suffix
-					new_route.dest_name+=msg.GetKey();
-				}
+			if(std::count(var_pattern.begin(), var_pattern.end(), '*')==1 &&
+					route.dest_name=="^")
+			{
+				//here we check for a special case if we are presented with a pattern
+				//like *_X->^ we will simply forward as the bit that matched * in *_X
+				//so concretely A_X will be forwarded as X
 
-				std::cout<<"dynamically creating outgoing route : "<<msg.GetKey()<<"->"<<new_route.dest_name <<" on ";
-				if(new_route.multicast)
+				std::string t = msg.m_sKey;
+				std::string bit_that_matches;
+				if(*var_pattern.begin()=='*')
 				{
-					std::cout<< GetChannelAliasFromMutlicastAddress(new_route.dest_address)<<"\n";
+					//we have *X
+					std::string tok = var_pattern.substr(1);
+					//we want everything before tok as that matched the wild card...
+					bit_that_matches = MOOS::Chomp(t,tok);
 				}
-				else
+				else if(*var_pattern.rbegin()=='*')
 				{
-					std::cout<<new_route.dest_address.to_string()<<"\n";
+					//we have X*
+					std::string tok = var_pattern.substr(0,var_pattern.length()-1);
+					//we want everything after tok as that matches the wild card...
+					MOOS::Chomp(t,tok);
+					bit_that_matches = t;
 				}
+				new_route.dest_name = bit_that_matches;
+			}
+			else
+			{
+				//standard thing to do is simply use message name as a suffix
+				new_route.dest_name+=msg.GetKey();
+			}
 
-				routing_table_[msg.GetKey()].push_back(new_route);
-				ApplyRoutes(msg);
+			std::cout<<"dynamically creating outgoing route : "<<msg.GetKey()<<"->"<<new_route.dest_name <<" on ";
+			if(new_route.multicast)
+			{
+				std::cout<< GetChannelAliasFromMutlicastAddress(new_route.dest_address)<<"\n";
 			}
+			else
+			{
+				std::cout<<new_route.dest_address.to_string()<<"\n";
+			}
+
+			new_routes.push_back(new_route);
 		}
 	}
-	return true;
-}
 
+	if(new_routes.empty())
+		return true;
 
-bool Share::Impl::ApplyRoutes(CMOOSMsg & msg)
-{
-	//do we know how to route this? double check
-	RouteMap::iterator g = routing_table_.find(msg.GetKey());
-	if(g == routing_table_.end())
-		throw std::runtime_error("no specified route");
+	//all the new routes are in place before anything is sent
+	std::list<Route> & route_list = RoutesFor(msg.GetKey());
+	route_list.splice(route_list.end(),new_routes);
+
+	return ApplyRoutes(msg,route_list);
+}
 
-	//we need to find the socket to send via
-	std::list<Route> & route_list = g->second;
 
+bool Share::Impl::ApplyRoutes(CMOOSMsg & msg, std::list<Route> & route_list)
+{
 	double now = MOOS::Time();
 
+	//the name msg was last serialised with (routes often share one)
+	std::string serialised_as;
+	unsigned int msg_buffer_size = 0;
+
 	std::list<Route>::iterator q;
 	for(q = route_list.begin();q!=route_list.end();q++)
 	{
@@ -1081,32 +1168,36 @@ bool Share::Impl::ApplyRoutes(CMOOSMsg & msg)
             std::cout<<"sending \""<<msg.m_sKey<<"\" as \""<<route.dest_name<<"\" to "<<route.dest_address.to_string()<<"\n";
         }
 
-		//rename here...
-		msg.m_sKey = route.dest_name;
+		//rename and serialise here (unless we already have this name)
+		if(msg_buffer_size==0 || serialised_as!=route.dest_name)
+		{
+			msg.m_sKey = route.dest_name;
+			serialised_as = route.dest_name;
 
-		//serialise here
-		unsigned int msg_buffer_size = msg.GetSizeInBytesWhenSerialised();
+			msg_buffer_size = msg.GetSizeInBytesWhenSerialised();
 
-		if(msg_buffer_size>MAX_UDP_SIZE)
-		{
-			std::cerr<<"Message size exceeded payload size of "<<MAX_UDP_SIZE/1024<<" kB - not forwarding\n";
-			return false;
-		}
+			if(msg_buffer_size>MAX_UDP_SIZE)
+			{
+				std::cerr<<"Message size exceeded payload size of "<<MAX_UDP_SIZE/1024<<" kB - not forwarding\n";
+				return false;
+			}
 
-		std::vector<unsigned char> buffer(msg_buffer_size);
-		if (!msg.Serialize(buffer.data(), msg_buffer_size))
-		{
-			throw std::runtime_error("failed msg serialisation");
-		}
+			if(serialisation_buffer_.size()<msg_buffer_size)
+				serialisation_buffer_.resize(msg_buffer_size);
 
-		//send here
-		if (sendto(relevant_socket.socket_fd, buffer.data(), buffer.size(), 0,
-				(struct sockaddr*) (&relevant_socket.sock_addr),
-				sizeof(relevant_socket.sock_addr)) < 0)
-		{
-			throw std::runtime_error("failed \"sendto\"");
+			if (!msg.Serialize(serialisation_buffer_.data(), msg_buffer_size))
+			{
+				throw std::runtime_error("failed msg serialisation");
+			}
 		}
 
+		//send (or batch) here
+		sender_.Send(relevant_socket.socket_fd,
+				relevant_socket.sock_addr,
+				serialisation_buffer_.data(),
+				msg_buffer_size,
+				now);
+
 
 		route.last_time_sent = now;
 	}
@@ -1220,6 +1311,9 @@ int Share::Run(int argc,char * argv[])
 	{
 		std::cerr<<"oops: "<<e.what();
 	}
+
+	//batches still open when the app stops would otherwise be lost
+	_Impl->FlushAll();
 	return 0;
 }
 
@@ -54,7 +54,14 @@ void ShareHelp::PrintConfigurationExample()
 
            <<YELLOW<<"  //setting up other config options (optional)\n"<<NORMAL<<
             "  multicast_base_port = 9061\n"
-            "  multicast_address = 224.1.1.12\n"
+            "  multicast_address = 224.1.1.12\n\n"
+
+           <<YELLOW<<"  //pack outgoing messages into batches of up to 1472 bytes\n"
+                     "  //sent at most 5ms after the first message in them\n"
+                     "  //(receivers must also be running a batch aware pShare)\n"<<NORMAL<<
+            "  batch = true\n"
+            "  batch_size = 1472\n"
+            "  batch_delay = 0.005\n"
 
 
 			"}\n"<<std::endl;
@@ -74,7 +81,10 @@ void ShareHelp::PrintHelp()
 			"  -i=<inputs> : specify inputs from command line\n"
             "  --verbose   : verbose operation\n"
             "  --multicast_base_port=<uint_16> multicast base port\n"
-            "  --multicast_address=<ip-address> multicast address\n";
+            "  --multicast_address=<ip-address> multicast address\n"
+            "  --batch       : batch outgoing messages per destination\n"
+            "  --batch_size=<bytes> largest batch (default 1472)\n"
+            "  --batch_delay=<seconds> longest a message waits in a batch (default 0)\n";
 
 
 	std::cout<<YELLOW<<"\nExamples:\n\n"<<NORMAL;
@@ -0,0 +1,72 @@
+/*
+ * WildcardPattern.cpp
+ *
+ *  A * and ? pattern which is examined once when made.
+ */
+
+#include "WildcardPattern.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+namespace MOOS {
+
+WildcardPattern::WildcardPattern()
+{
+	shape_ = ANYTHING;
+	pattern_ = "*";
+}
+
+WildcardPattern::WildcardPattern(const std::string & pattern)
+{
+	pattern_ = pattern;
+	shape_ = GENERAL;
+
+	std::string::size_type first = pattern.find_first_of("*?");
+	if(first==std::string::npos)
+	{
+		shape_ = LITERAL;
+		literal_ = pattern;
+	}
+	else if(pattern.find('?')==std::string::npos)
+	{
+		std::string::size_type last = pattern.find_last_of('*');
+		std::string::size_type stars = 0;
+		for(std::string::size_type i = first;i<=last;i++)
+			if(pattern[i]=='*')
+				stars++;
+
+		if(stars==pattern.size())
+		{
+			shape_ = ANYTHING;
+		}
+		else if(stars==1 && first==pattern.size()-1)
+		{
+			shape_ = PREFIX;
+			literal_ = pattern.substr(0, first);
+		}
+		else if(stars==1 && first==0)
+		{
+			shape_ = SUFFIX;
+			literal_ = pattern.substr(1);
+		}
+	}
+}
+
+bool WildcardPattern::Matches(const std::string & s) const
+{
+	switch(shape_)
+	{
+	case ANYTHING:
+		return true;
+	case LITERAL:
+		return s==literal_;
+	case PREFIX:
+		return s.compare(0, literal_.size(), literal_)==0;
+	case SUFFIX:
+		return s.size()>=literal_.size() &&
+				s.compare(s.size()-literal_.size(), literal_.size(), literal_)==0;
+	default:
+		return MOOSWildCmp(pattern_, s);
+	}
+}
+
+}
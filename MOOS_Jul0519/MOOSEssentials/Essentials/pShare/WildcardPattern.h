@@ -0,0 +1,41 @@
+/*
+ * WildcardPattern.h
+ *
+ *  A * and ? pattern which is examined once when made so that the common
+ *  shapes ("*", "X", "X*", "*X") are matched without MOOSWildCmp.
+ */
+
+#ifndef WILDCARDPATTERN_H_
+#define WILDCARDPATTERN_H_
+
+#include <string>
+
+namespace MOOS {
+
+class WildcardPattern {
+public:
+	WildcardPattern();
+	explicit WildcardPattern(const std::string & pattern);
+
+	bool Matches(const std::string & s) const;
+
+	const std::string & pattern() const {return pattern_;};
+
+protected:
+	enum Shape
+	{
+		ANYTHING,	// *
+		LITERAL,	// X
+		PREFIX,		// X*
+		SUFFIX,		// *X
+		GENERAL		// anything else
+	};
+
+	std::string pattern_;
+	std::string literal_;
+	Shape shape_;
+};
+
+}
+
+#endif /* WILDCARDPATTERN_H_ */
@@ -0,0 +1,264 @@
+/*****************************************************************/
+/*    FILE: AppCastDelta.cpp                                     */
+/*                                                               */
+/* This program is free software; you can redistribute it and/or */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation; either version  */
+/* 2 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* This program is distributed in the hope that it will be       */
+/* useful, but WITHOUT ANY WARRANTY; without even the implied    */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the GNU General Public License for more details. */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with this program; if not, write to the Free    */
+/* Software Foundation, Inc., 59 Temple Place - Suite 330,       */
+/* Boston, MA 02111-1307, USA.                                   */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <sstream>
+#include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastDelta.h"
+
+using namespace std;
+
+static const string s_isep = "!@";
+static const string s_osep = "!@#";
+
+//----------------------------------------------------------------
+// Procedure: splitLines()
+//      Note: Lines are the pieces between inner separators. The
+//            outer separator begins with an inner separator, so a
+//            line following an outer separator begins with '#'.
+//            Joining the lines with "!@" gives back the original.
+
+static void splitLines(const string& str, vector<string>& lines)
+{
+  lines.clear();
+  string::size_type start = 0;
+  while(true) {
+    string::size_type pos = str.find(s_isep, start);
+    if(pos == string::npos) {
+      lines.push_back(str.substr(start));
+      return;
+    }
+    lines.push_back(str.substr(start, pos-start));
+    start = pos + s_isep.length();
+  }
+}
+
+//----------------------------------------------------------------
+// Procedure: fieldValue()
+//      Note: Finds the value of a leading outer field, e.g., proc=
+//            Only the first few fields are examined since the
+//            proc, node and sequence fields always lead.
+
+static string fieldValue(const string& str, const string& param)
+{
+  string::size_type start = 0;
+  for(unsigned int i=0; (i<6) && (start < str.length()); i++) {
+    string::size_type end = str.find(s_osep, start);
+    if(end == string::npos)
+      end = str.length();
+    if(str.compare(start, param.length(), param) == 0) {
+      string::size_type vstart = start + param.length();
+      return(str.substr(vstart, end-vstart));
+    }
+    start = end + s_osep.length();
+  }
+  return("");
+}
+
+//----------------------------------------------------------------
+// Procedure: appCastKeyFrame()
+
+string appCastKeyFrame(const string& full, unsigned int seq)
+{
+  stringstream ss;
+  ss << "acseq=" << seq << s_osep << full;
+  return(ss.str());
+}
+
+//----------------------------------------------------------------
+// Procedure: appCastDelta()
+//      Note: Lines common to the front and back of the two appcasts
+//            are copied. Lines in between are compared position by
+//            position, which suits the usual case of a report whose
+//            layout is fixed and whose values change.
+
+string appCastDelta(const string& base, const string& full,
+		    unsigned int seq, unsigned int base_seq)
+{
+  vector<string> blines, flines;
+  splitLines(base, blines);
+  splitLines(full, flines);
+
+  unsigned int bsize = blines.size();
+  unsigned int fsize = flines.size();
+  unsigned int min_size = (bsize < fsize) ? bsize : fsize;
+
+  unsigned int prefix = 0;
+  while((prefix < min_size) && (blines[prefix] == flines[prefix]))
+    prefix++;
+
+  unsigned int suffix = 0;
+  while((suffix < (min_size - prefix)) &&
+	(blines[bsize-1-suffix] == flines[fsize-1-suffix]))
+    suffix++;
+
+  stringstream ss;
+  ss << "acdelta=" << seq << s_osep << "acbase=" << base_seq << s_osep;
+  ss << "proc=" << fieldValue(full, "proc=") << s_osep;
+  ss << "node=" << fieldValue(full, "node=") << s_osep;
+  ss << "ops=";
+
+  bool first = true;
+  unsigned int pend_copy = prefix;
+  unsigned int pend_skip = 0;
+  vector<const string*> pend_lines;
+
+  // Pending copies are emitted before pending skips and inserts.
+  // Skips and inserts are grouped until the next run of copies.
+  unsigned int bmid = bsize - prefix - suffix;
+  unsigned int fmid = fsize - prefix - suffix;
+  unsigned int imax = (bmid > fmid) ? bmid : fmid;
+  for(unsigned int i=0; i<=imax; i++) {
+    bool same = false;
+    if(i == imax)
+      pend_copy += suffix;
+    else if((i < bmid) && (i < fmid))
+      same = (blines[prefix+i] == flines[prefix+i]);
+
+    if(same || (i == imax)) {
+      if((pend_skip > 0) || (pend_lines.size() > 0)) {
+	if(pend_skip > 0) {
+	  ss << (first ? "" : s_isep) << "-" << pend_skip;
+	  first = false;
+	}
+	for(unsigned int j=0; j<pend_lines.size(); j++) {
+	  ss << (first ? "" : s_isep) << "+" << *(pend_lines[j]);
+	  first = false;
+	}
+	pend_skip = 0;
+	pend_lines.clear();
+      }
+      if(same)
+	pend_copy++;
+      continue;
+    }
+
+    if(pend_copy > 0) {
+      ss << (first ? "" : s_isep) << "=" << pend_copy;
+      first = false;
+      pend_copy = 0;
+    }
+    if(i < bmid)
+      pend_skip++;
+    if(i < fmid)
+      pend_lines.push_back(&flines[prefix+i]);
+  }
+
+  if(pend_copy > 0)
+    ss << (first ? "" : s_isep) << "=" << pend_copy;
+
+  return(ss.str());
+}
+
+//----------------------------------------------------------------
+// Procedure: isAppCastDelta()
+
+bool isAppCastDelta(const string& str)
+{
+  return(str.compare(0, 8, "acdelta=") == 0);
+}
+
+//----------------------------------------------------------------
+// Procedure: resolve()
+
+bool AppCastDeltaCache::resolve(const string& str, string& full)
+{
+  // Part 1: Plain appcasts are passed through untouched
+  bool is_keyframe = (str.compare(0, 6, "acseq=") == 0);
+  bool is_delta    = isAppCastDelta(str);
+  if(!is_keyframe && !is_delta) {
+    full = str;
+    return(true);
+  }
+
+  // Part 2: Keyframes are stripped of the sequence field and held
+  if(is_keyframe) {
+    string::size_type pos = str.find(s_osep);
+    if(pos == string::npos) {
+      full = "";
+      return(true);
+    }
+    unsigned int seq = (unsigned int)(atoi(str.c_str() + 6));
+    full = str.substr(pos + s_osep.length());
+
+    string key = fieldValue(full, "node=") + "/" + fieldValue(full, "proc=");
+    m_seq[key]  = seq;
+    m_full[key] = full;
+    return(true);
+  }
+
+  // Part 3: Deltas are applied to the held base, if it matches
+  string key = fieldValue(str, "node=") + "/" + fieldValue(str, "proc=");
+  unsigned int seq = (unsigned int)(atoi(fieldValue(str, "acdelta=").c_str()));
+  unsigned int base_seq = (unsigned int)(atoi(fieldValue(str, "acbase=").c_str()));
+
+  string::size_type ops_pos = str.find(s_osep + "ops=");
+  map<string, unsigned int>::iterator p = m_seq.find(key);
+  if((ops_pos == string::npos) || (p == m_seq.end()) || (p->second != base_seq)) {
+    m_dropped++;
+    return(false);
+  }
+
+  vector<string> blines, ops;
+  splitLines(m_full[key], blines);
+  splitLines(str.substr(ops_pos + s_osep.length() + 4), ops);
+
+  string result;
+  result.reserve(m_full[key].length() + 256);
+
+  bool first = true;
+  unsigned int cursor = 0;
+  for(unsigned int i=0; i<ops.size(); i++) {
+    const string& op = ops[i];
+    if(op.empty()) {
+      m_dropped++;
+      return(false);
+    }
+    if(op[0] == '+') {
+      if(!first)
+	result += s_isep;
+      result.append(op, 1, string::npos);
+      first = false;
+      continue;
+    }
+
+    unsigned int count = (unsigned int)(atoi(op.c_str()+1));
+    if((cursor + count) > blines.size()) {
+      m_dropped++;
+      return(false);
+    }
+    if(op[0] == '=') {
+      for(unsigned int j=0; j<count; j++) {
+	if(!first)
+	  result += s_isep;
+	result += blines[cursor+j];
+	first = false;
+      }
+    }
+    else if(op[0] != '-') {
+      m_dropped++;
+      return(false);
+    }
+    cursor += count;
+  }
+
+  p->second   = seq;
+  m_full[key] = result;
+  full = result;
+  return(true);
+}
@@ -36,6 +36,7 @@
 #include <string>
 #include "MOOS/libMOOS/App/MOOSApp.h"
 #include "AppCast.h"
+#include "AppCastDelta.h"
 
 class AppCastingMOOSApp : public CMOOSApp
 {
@@ -62,11 +63,20 @@ public:
   bool 	       OnStartUpDirectives(std::string directives="");
   void         setAppLoggingInfo(std::string s) {m_app_logging_info=s;}
   std::string  commsPolicy() const {return(m_comms_policy);}
+
+  // Report sections may be reused between reports when their inputs
+  // are unchanged. If reuse fails, the caller builds the section and
+  // posts it with postReportSection. Both write to m_msgs.
+  bool         reuseReportSection(const std::string& name,
+				  const std::string& inputs);
+  void         postReportSection(const std::string& name,
+				 const std::string& text);
   
  private:
   void         handleMailAppCastRequest(const std::string&);
   bool         handleMailCommsPolicy(const std::string&);
   bool         appcastRequested();
+  std::string  appcastPostString();
 
 protected:
   unsigned int m_iteration;
@@ -103,5 +113,17 @@ protected:
   std::map<std::string, double>       m_map_bcast_duration;
   std::map<std::string, double>       m_map_bcast_tstart;
   std::map<std::string, std::string>  m_map_bcast_thresh;  
+
+  // Delta appcasting state. Deltas are relative to the last post.
+  bool         m_appcast_deltas;
+  unsigned int m_appcast_keyframe_interval;
+  unsigned int m_appcast_seq;
+  unsigned int m_appcast_since_keyframe;
+  bool         m_appcast_keyframe_due;
+  std::string  m_appcast_last;
+
+  // Map from report section name to inputs and text of last build
+  std::map<std::string, std::string>  m_map_section_inputs;
+  std::map<std::string, std::string>  m_map_section_text;
 };
 #endif
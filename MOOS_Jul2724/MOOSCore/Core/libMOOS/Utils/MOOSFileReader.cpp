@@ -45,6 +45,8 @@
 #include "MOOS/libMOOS/Utils/MOOSFileReader.h"
 #include "assert.h"
 #include "MOOS/libMOOS/Utils/MOOSLock.h"
+#include <sstream>
+#include <cctype>
 
 #define MAXLINESIZE 2000
 using namespace std;
@@ -58,6 +60,7 @@ CMOOSFileReader::CMOOSFileReader()
 	//by default we want to use quotes to allow verbatim
 	//strings
 	EnableVerbatimQuoting(true);
+    m_bLinesIndexed = false;
     m_pLock = new CMOOSLock();
 }
 
@@ -100,6 +103,10 @@ bool CMOOSFileReader::SetFile(const std::string  & sFile)
     }
     
 	ClearFileMap();
+
+    m_bLinesIndexed = false;
+    m_IndexedLines.clear();
+    m_IndexedBlocks.clear();
     
     BuildLocalShellVars();
 
@@ -135,6 +142,18 @@ std::string CMOOSFileReader::GetNextValidLine(bool bDoSubstitution)
         sLine = std::string(Tmp);
     }
 
+    RemoveTrailingComment(sLine);
+    
+    if(bDoSubstitution)
+        DoVariableExpansion(sLine);
+    
+    
+    
+    return sLine;
+}
+
+void CMOOSFileReader::RemoveTrailingComment(std::string & sLine)
+{
     // jckerken 8-12-2004 (MIT)
     // remove comments made in line not at beginning
     size_t nC = sLine.find("//");
@@ -168,14 +187,116 @@ std::string CMOOSFileReader::GetNextValidLine(bool bDoSubstitution)
         else
             sLine = "";
     } // end jckerken
+}
 
-    
-    if(bDoSubstitution)
-        DoVariableExpansion(sLine);
-    
-    
-    
-    return sLine;
+//reads from nPos as ">>std::ws" followed by getline() would, returning
+//true if the end of the buffer was reached (the stream would be at eof)
+static bool ReadBufferedLine(const std::string & sBuffer, size_t & nPos, std::string & sLine)
+{
+    while(nPos<sBuffer.size() && isspace((unsigned char)sBuffer[nPos]))
+        nPos++;
+
+    if(nPos>=sBuffer.size())
+    {
+        sLine.clear();
+        return true;
+    }
+
+    size_t nEnd = sBuffer.find('\n',nPos);
+    if(nEnd==std::string::npos)
+    {
+        sLine = sBuffer.substr(nPos);
+        nPos = sBuffer.size();
+        return true;
+    }
+
+    sLine = sBuffer.substr(nPos,nEnd-nPos);
+    nPos = nEnd+1;
+    return false;
+}
+
+bool CMOOSFileReader::IndexLines()
+{
+    m_pLock->Lock();
+
+    if(m_bLinesIndexed)
+    {
+        m_pLock->UnLock();
+        return true;
+    }
+
+    //one read of the whole file
+    std::ifstream File(m_sFileName.c_str());
+    if(!File.is_open())
+    {
+        m_pLock->UnLock();
+        return false;
+    }
+    std::ostringstream ss;
+    ss<<File.rdbuf();
+    std::string sBuffer = ss.str();
+
+    //the same lines as successive calls to GetNextValidLine() from the
+    //start of the file, until it is at eof
+    m_IndexedLines.clear();
+    m_IndexedBlocks.clear();
+    m_IndexedValues.clear();
+    size_t nPos = 0;
+    bool bEOF = false;
+    while(!bEOF)
+    {
+        std::string sLine;
+        bEOF = ReadBufferedLine(sBuffer,nPos,sLine);
+        while(sLine.length()!=0 && IsComment(sLine))
+        {
+            bEOF = ReadBufferedLine(sBuffer,nPos,sLine);
+        }
+
+        RemoveTrailingComment(sLine);
+        if(sLine.find("${")!=std::string::npos)
+            DoVariableExpansion(sLine);
+        m_IndexedLines.push_back(sLine);
+
+        //note the first value given for each token
+        std::string sTok,sVal;
+        if(GetTokenValPair(sLine,sTok,sVal))
+        {
+            MOOSToUpper(sTok);
+            if(m_IndexedValues.find(sTok)==m_IndexedValues.end())
+                m_IndexedValues[sTok] = sVal;
+        }
+
+        //note the first line of each process config block
+        if(!sLine.empty() && toupper((unsigned char)sLine[0])=='P')
+        {
+            MOOSRemoveChars(sLine," \t\r");
+            MOOSToUpper(sLine);
+            if(sLine.find("PROCESSCONFIG=")==0 && m_IndexedBlocks.find(sLine)==m_IndexedBlocks.end())
+            {
+                m_IndexedBlocks[sLine] = (int)m_IndexedLines.size();
+            }
+        }
+    }
+
+    m_bLinesIndexed = true;
+    m_pLock->UnLock();
+    return true;
+}
+
+int CMOOSFileReader::FindIndexedBlock(const std::string & sAppName)
+{
+    if(!IndexLines())
+        return -1;
+
+    std::string sKey = "PROCESSCONFIG="+sAppName;
+    MOOSRemoveChars(sKey," \t\r");
+    MOOSToUpper(sKey);
+
+    std::map<std::string, int>::iterator p = m_IndexedBlocks.find(sKey);
+    if(p==m_IndexedBlocks.end())
+        return -1;
+
+    return p->second;
 }
 
 bool CMOOSFileReader::IsComment(std::string &sLine)
@@ -248,25 +369,15 @@ bool CMOOSFileReader::GetValue(std::string sName,std::string & sResult)
 {
 
     
-    if(IsOpen())
+    if(IndexLines())
     {
-        Reset();
-     
-        GetFile()->seekg(std::ios::beg);
-
-        std::string sLine,sVal,sTok;
-        while(!GetFile()->eof())
+        MOOSToUpper(sName);
+        std::map<std::string,std::string>::iterator p;
+        p = m_IndexedValues.find(sName);
+        if(p!=m_IndexedValues.end())
         {
-            sLine = GetNextValidLine();
-
-            if(GetTokenValPair(sLine, sTok, sVal))
-            {
-                if(MOOSStrCmp(sTok,sName))
-                {
-                    sResult = sVal;
-                    return true;
-                }
-            }       
+            sResult = p->second;
+            return true;
         }
     }
  
@@ -8,6 +8,49 @@ using namespace std;
 #include <iterator>
 #include <algorithm>
 
+#ifndef _WIN32
+#include <cstring>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/select.h>
+
+//written to by the SIGCHLD handler so that the wait loop can sleep until
+//a child quits rather than polling each child in turn
+static int gChildPipe[2] = {-1,-1};
+
+static void OnChildSignal(int)
+{
+    int nErrno = errno;
+    char c = 0;
+    if(write(gChildPipe[1],&c,1)<0)
+    {
+        //pipe full - a wake up is already pending
+    }
+    errno = nErrno;
+}
+
+static bool InstallChildSignalHandler()
+{
+    if(gChildPipe[0]>=0)
+        return true;
+    
+    if(pipe(gChildPipe)!=0)
+        return MOOSFail("   warning: could not make pipe for SIGCHLD\n");
+    
+    for(int i = 0;i<2;i++)
+    {
+        fcntl(gChildPipe[i],F_SETFL,fcntl(gChildPipe[i],F_GETFL)|O_NONBLOCK);
+        fcntl(gChildPipe[i],F_SETFD,FD_CLOEXEC);
+    }
+    
+    struct sigaction Action;
+    memset(&Action,0,sizeof(Action));
+    Action.sa_handler = OnChildSignal;
+    sigemptyset(&Action.sa_mask);
+    Action.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    return sigaction(SIGCHLD,&Action,NULL)==0;
+}
+#endif
 
 
 
@@ -23,6 +66,8 @@ CAntler::CAntler()
     m_nDBPort = 9000;
     m_bQuitCurrentJob = false;
 	m_eVerbosity=CHATTY;
+    m_pLaunchComms = NULL;
+    m_dfLaunchTimeout = DEFAULTLAUNCHTIMEOUT;
 }
 
 //this is the vanilla version of Run - called to run from a single mission file
@@ -422,7 +467,21 @@ bool CAntler::Spawn(const std::string &  sMissionFile, bool bHeadless)
 	
 	
 	
+    //how are we to launch? one by one with a pause between, or all at once?
+    std::string sLaunchMode = "sequential";
+    m_MissionReader.GetConfigurationParam("LaunchMode",sLaunchMode);
+    bool bParallel = MOOSStrCmp(sLaunchMode,"parallel");
+    
+    m_dfLaunchTimeout = DEFAULTLAUNCHTIMEOUT;
+    m_MissionReader.GetConfigurationParam("LaunchTimeout",m_dfLaunchTimeout);
+    
+#ifndef _WIN32
+    //do this before any launch so no child can quit unnoticed
+    InstallChildSignalHandler();
+#endif
+	
 	//no cycle through each line in the configuration block. If it begins with run then it means launch
+    STRING_LIST RunLines;
     for(p = sParams.begin();p!=sParams.end();p++)
     {
         std::string sLine = *p;
@@ -431,34 +490,24 @@ bool CAntler::Spawn(const std::string &  sMissionFile, bool bHeadless)
         
         if(MOOSStrCmp(sWhat,"RUN"))
         {
-            //OK we are being asked to run a process
-            
-            //try to create a process
-            MOOSProc* pNew  = CreateMOOSProcess(sLine);
-            
-            if(pNew!=NULL)
+            if(bParallel)
             {
-				//this a really important bit of text most folk will want to see it...
-				InhibitMOOSTraceInThisThread(m_eVerbosity==QUIET);
-				{
-					MOOSTrace("   [%.3d] Process: %-15s ~ %-15s launched successfully\n",
-							  m_nCurrentLaunch,
-							  pNew->m_sApp.c_str(),
-							  pNew->m_sMOOSName.c_str());
-				}
-				InhibitMOOSTraceInThisThread(m_eVerbosity!=CHATTY);
-				
-                m_ProcList.push_front(pNew);
-				m_nCurrentLaunch++;
-                PublishProcessLaunch(pNew->m_sApp);
+                RunLines.push_back(sLine);
+                continue;
             }
             
+            //OK we are being asked to run a process
+            LaunchProcess(sLine);
+            
 	        //wait a while
             MOOSPause(nTimeMSBetweenSpawn);
             
         }
     }
     
+    if(bParallel)
+        LaunchParallel(RunLines);
+    
     
     
     if(bHeadless==false)
@@ -486,15 +535,253 @@ bool CAntler::Spawn(const std::string &  sMissionFile, bool bHeadless)
 
     
     //now wait on all our processes to close....
+    WaitOnProcesses();
+    
+    return 0;
+    
+}
+
+
+bool CAntler::LaunchProcess(const std::string & sConfiguration)
+{
+    //try to create a process
+    MOOSProc* pNew  = CreateMOOSProcess(sConfiguration);
+    
+    if(pNew==NULL)
+        return false;
+    
+    //this a really important bit of text most folk will want to see it...
+    InhibitMOOSTraceInThisThread(m_eVerbosity==QUIET);
+    {
+        MOOSTrace("   [%.3d] Process: %-15s ~ %-15s launched successfully\n",
+                  m_nCurrentLaunch,
+                  pNew->m_sApp.c_str(),
+                  pNew->m_sMOOSName.c_str());
+    }
+    InhibitMOOSTraceInThisThread(m_eVerbosity!=CHATTY);
+    
+    m_ProcList.push_front(pNew);
+    m_nCurrentLaunch++;
+    PublishProcessLaunch(pNew->m_sApp);
+    
+    return true;
+}
+
+std::string CAntler::ImpliedMOOSName(std::string sConfiguration)
+{
+    //same rules as CreateMOOSProcess: name after "~" else the binary name
+    std::string sProcName = MOOSChomp(sConfiguration,"@");
+    MOOSChomp(sConfiguration,"~");
+    std::string sMOOSName = MOOSChomp(sConfiguration);
+    if(sMOOSName.empty())
+    {
+        sMOOSName = sProcName;
+        if(sMOOSName.rfind('/') != string::npos)
+            sMOOSName = sMOOSName.substr(sMOOSName.rfind('/')+1);
+    }
+    MOOSTrimWhiteSpace(sMOOSName);
+    return sMOOSName;
+}
+
+bool CAntler::IsRemoteProcess(const std::string & sOption)
+{
+    bool bDistributed=false;
+    m_MissionReader.GetConfigurationParam("EnableDistributed",bDistributed);
+
+    if(!bDistributed)
+        return false; //we run everything
+    
+    std::string sAntlerRequired;
+    bool bForDrone = MOOSValFromString(sAntlerRequired, sOption, "AntlerID", true);
+    
+    if(m_bHeadless)
+    {
+        //we are a drone - lines without an AntlerID are for the primary
+        //Antler and others are for us only if they name us
+        return !bForDrone || !MOOSStrCmp(sAntlerRequired, m_sAntlerName);
+    }
+    
+    //we are a TopMOOS - lines with an AntlerID are for a drone
+    return bForDrone;
+}
+
+bool CAntler::LaunchParallel(const STRING_LIST & RunLines)
+{
+    //figure out who waits on whom. A RUN line may carry After=A:B meaning
+    //do not launch until processes A and B are connected to the DB
+    std::vector<PendingLaunch> Pending;
+    std::set<std::string> Known;
+    std::set<std::string> DBNames;
+    bool bAnyAfter = false;
+    
+    STRING_LIST::const_iterator p;
+    for(p = RunLines.begin();p!=RunLines.end();p++)
+    {
+        PendingLaunch L;
+        L.m_sConfiguration = *p;
+        L.m_sMOOSName = ImpliedMOOSName(*p);
+        
+        std::string sTmp = *p;
+        std::string sProcName = MOOSChomp(sTmp,"@");
+        MOOSTrimWhiteSpace(sProcName);
+        std::string sOption = MOOSChomp(sTmp,"~");
+        if(MOOSStrCmp(ImpliedMOOSName(sProcName),"MOOSDB"))
+            DBNames.insert(L.m_sMOOSName);
+        
+        std::string sAfter;
+        if(MOOSValFromString(sAfter, sOption, "After", true))
+        {
+            while(!sAfter.empty())
+            {
+                std::string sName = MOOSChomp(sAfter,":");
+                MOOSTrimWhiteSpace(sName);
+                if(!sName.empty())
+                    L.m_After.insert(sName);
+            }
+        }
+        bAnyAfter = bAnyAfter || !L.m_After.empty();
+        
+        //another Antler launches it, but we can still wait on it
+        //connecting to the DB
+        L.m_bRemote = IsRemoteProcess(sOption);
+        
+        Known.insert(L.m_sMOOSName);
+        Pending.push_back(L);
+    }
+    
+    //warn about dependencies on processes that will never be launched
+    for(unsigned int i = 0;i<Pending.size();i++)
+    {
+        std::set<std::string>::iterator q;
+        for(q = Pending[i].m_After.begin();q!=Pending[i].m_After.end();q++)
+        {
+            if(Known.find(*q)==Known.end())
+                MOOSTrace("   warning: %s waits on unknown process %s (ignored)\n",
+                          Pending[i].m_sMOOSName.c_str(),q->c_str());
+        }
+    }
+    
+    //we only need to watch the DB if someone is waiting on something
+    if(bAnyAfter)
+    {
+        std::string sHost = m_sDBHost;
+        int nPort = m_nDBPort;
+        m_MissionReader.GetValue("ServerHost",sHost);
+        m_MissionReader.GetValue("ServerPort",nPort);
+        
+        m_pLaunchComms = new CMOOSCommClient;
+        m_pLaunchComms->SetQuiet(true);
+        std::string sMe = MOOSFormat("AntlerLaunch{%s}",m_sAntlerName.c_str());
+        if(!m_pLaunchComms->Run(sHost, nPort, sMe, 20))
+        {
+            MOOSTrace("   warning: cannot watch DB, dependencies will time out\n");
+            delete m_pLaunchComms;
+            m_pLaunchComms = NULL;
+        }
+    }
+    
+    std::set<std::string> Ready;
+    bool bRegistered = false;
+    double dfStart = MOOSTime();
+    bool bTimeoutReported = false;
+    
+    while(!Pending.empty() && !m_bQuitCurrentJob)
+    {
+        //has the DB come up? if so who has connected to it?
+        if(m_pLaunchComms!=NULL && m_pLaunchComms->IsConnected())
+        {
+            if(!bRegistered)
+                bRegistered = m_pLaunchComms->Register("DB_CLIENTS",0);
+            
+            //the DB is ready if it accepts our connection
+            Ready.insert("MOOSDB");
+            Ready.insert(DBNames.begin(),DBNames.end());
+            UpdateLaunchReadiness(Ready);
+        }
+        
+        bool bTimedOut = MOOSTime()-dfStart > m_dfLaunchTimeout;
+        if(bTimedOut && !bTimeoutReported)
+        {
+            MOOSTrace("   warning: launch dependencies not met after %.1fs - launching anyway\n",
+                      m_dfLaunchTimeout);
+            bTimeoutReported = true;
+        }
+        
+        std::vector<PendingLaunch>::iterator q = Pending.begin();
+        while(q!=Pending.end())
+        {
+            bool bGo = bTimedOut;
+            if(!bGo)
+            {
+                bGo = true;
+                std::set<std::string>::iterator r;
+                for(r = q->m_After.begin();r!=q->m_After.end() && bGo;r++)
+                {
+                    if(Known.find(*r)!=Known.end() && Ready.find(*r)==Ready.end())
+                        bGo = false;
+                }
+            }
+            
+            if(!bGo)
+            {
+                q++;
+                continue;
+            }
+            
+            //nobody should wait on a process that failed to launch
+            if(!q->m_bRemote && !LaunchProcess(q->m_sConfiguration))
+                Known.erase(q->m_sMOOSName);
+            
+            q = Pending.erase(q);
+        }
+        
+        if(!Pending.empty())
+            MOOSPause(50);
+    }
+    
+    if(m_pLaunchComms!=NULL)
+    {
+        m_pLaunchComms->Close(true);
+        delete m_pLaunchComms;
+        m_pLaunchComms = NULL;
+    }
+    
+    return true;
+}
+
+bool CAntler::UpdateLaunchReadiness(std::set<std::string> & Ready)
+{
+    MOOSMSG_LIST NewMail;
+    if(!m_pLaunchComms->Fetch(NewMail))
+        return false;
+    
+    CMOOSMsg Msg;
+    if(!m_pLaunchComms->PeekMail(NewMail,"DB_CLIENTS",Msg,false,true))
+        return false;
+    
+    //DB_CLIENTS is a comma separated list of connected client names
+    std::string sClients = Msg.GetString();
+    while(!sClients.empty())
+    {
+        std::string sClient = MOOSChomp(sClients,",");
+        MOOSTrimWhiteSpace(sClient);
+        if(!sClient.empty())
+            Ready.insert(sClient);
+    }
+    return true;
+}
+
+bool CAntler::WaitOnProcesses()
+{
     while(m_ProcList.size()!=0)
     {
         MOOSPROC_LIST::iterator q;
         
+#ifdef _WIN32
         for(q = m_ProcList.begin();q!=m_ProcList.end();q++)
         {
             MOOSProc * pMOOSProc = *q;
             
-#ifdef _WIN32
             if(m_bQuitCurrentJob)
             {
 				KillNicely(pMOOSProc);
@@ -523,16 +810,21 @@ bool CAntler::Spawn(const std::string &  sMissionFile, bool bHeadless)
                 m_ProcList.erase(q);
                 break;
             }
+        }
 #else
-            if(m_bQuitCurrentJob)
+        //reap every child that has quit since we last looked
+        q = m_ProcList.begin();
+        while(q!=m_ProcList.end())
+        {
+            MOOSProc * pMOOSProc = *q;
+            
+            if(m_bQuitCurrentJob && !pMOOSProc->m_bKillSent)
             {
                 MOOSTrace("   actively killing running child %s\n",pMOOSProc->m_sApp.c_str());
 				KillNicely(pMOOSProc);
-                //just give it a little time - for pities sake - no need for this pause
-                MOOSPause(300);
+                pMOOSProc->m_bKillSent = true;
             }
             
-            
             int nStatus = 0;
             if(waitpid(pMOOSProc->m_ChildPID,&nStatus,WNOHANG)>0)
             {
@@ -548,25 +840,45 @@ bool CAntler::Spawn(const std::string &  sMissionFile, bool bHeadless)
                 
                 PublishProcessQuit(pMOOSProc->m_sApp);
                 
-                m_ProcList.erase(q);
-                break;
+                delete pMOOSProc;
+                q = m_ProcList.erase(q);
+                continue;
             }
-            MOOSPause(100);
-#endif
-            
+            q++;
         }
-              
+        
+        if(m_ProcList.empty())
+            break;
+        
+        //sleep until SIGCHLD says a child has quit. Wake now and then to see
+        //if we have been asked to quit the current job
+        fd_set ReadSet;
+        FD_ZERO(&ReadSet);
+        int nFDs = 0;
+        if(gChildPipe[0]>=0)
+        {
+            FD_SET(gChildPipe[0],&ReadSet);
+            nFDs = gChildPipe[0]+1;
+        }
+        struct timeval Timeout;
+        Timeout.tv_sec = 0;
+        Timeout.tv_usec = 200000;
+        if(select(nFDs,&ReadSet,NULL,NULL,&Timeout)>0)
+        {
+            char Buf[64];
+            while(read(gChildPipe[0],Buf,sizeof(Buf))>0)
+            {
+                //drain
+            }
+        }
+#endif
     }
     
-
-    
-    return 0;
-    
+    return true;
 }
 
 
 
-
 bool CAntler::MakeExtraExecutableParameters(std::string sParam,STRING_LIST & ExtraCommandLineParameters,std::string sProcName,std::string sMOOSName)
 {
     
@@ -683,40 +995,8 @@ CAntler::MOOSProc* CAntler::CreateMOOSProcess(string sConfiguration)
     
     
     
-    bool bDistributed=false;
-    m_MissionReader.GetConfigurationParam("EnableDistributed",bDistributed);
-
-    if(bDistributed)
-    {
-               
-        
-        if(m_bHeadless)
-        {
-            //we are a drone
-            std::string sAntlerRequired;
-            if(!MOOSValFromString(sAntlerRequired, sOption, "AntlerID", true))
-                return NULL; //this is for primary Antler
-            
-                        
-            if(!MOOSStrCmp(sAntlerRequired, m_sAntlerName))
-                return NULL; //for some other Antler
-            
-            //OK it is for us...
-            //MOOSTrace("Headless Antler found a RUN directive...\n");
-        }
-        else
-        {
-            //we are a TopMOOS
-            std::string sAntlerRequired;
-            if(MOOSValFromString(sAntlerRequired, sOption, "AntlerID", true))
-                return NULL; //this is for a drone
-            
-        }
-    }
-    else
-    {
-        //we run everything
-    }
+    if(IsRemoteProcess(sOption))
+        return NULL;
     
     //do we want a new console?
     bool bNewConsole = false;
@@ -802,6 +1082,7 @@ CAntler::MOOSProc* CAntler::CreateMOOSProcess(string sConfiguration)
     pNewProc->m_bInhibitMOOSParams = bInhibitMOOSParams;
 	pNewProc->m_sMOOSName = sMOOSName;
     pNewProc->m_bNewConsole = bNewConsole;
+    pNewProc->m_bKillSent = false;
     pNewProc->m_sMissionFile = m_MissionReader.GetFileName();
     
     //finally spawn each according to his own
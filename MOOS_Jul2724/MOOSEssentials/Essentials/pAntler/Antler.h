@@ -19,6 +19,8 @@
 #include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
 #include <string>
 #include <iostream>
+#include <set>
+#include <vector>
 
 #ifdef _WIN32
 	#include "XPCProcess.h"
@@ -33,6 +35,7 @@
 
 #define DEFAULT_NIX_TERMINAL "xterm"
 #define DEFAULTTIMEBETWEENSPAWN 1000
+#define DEFAULTLAUNCHTIMEOUT 15.0
 
 
 class CAntler 
@@ -50,6 +53,7 @@ class CAntler
 #endif        
             std::string m_sApp;
             std::string m_sMOOSName;
+            bool m_bKillSent;
             std::string m_sMissionFile;
             bool m_bInhibitMOOSParams;
             bool m_bNewConsole;
@@ -57,6 +61,15 @@ class CAntler
             STRING_LIST m_ConsoleLaunchParameters;
             
         };
+
+        //a RUN line waiting on others (named in After=A:B) to be ready
+        struct PendingLaunch
+        {
+            std::string m_sConfiguration;
+            std::string m_sMOOSName;
+            std::set<std::string> m_After;
+            bool m_bRemote;
+        };
         
     public:
         
@@ -87,6 +100,24 @@ class CAntler
         
         //create, configure and launch a process
         MOOSProc* CreateMOOSProcess(std:: string sProcName);
+
+        //launch a process from a RUN line and report it
+        bool LaunchProcess(const std::string & sConfiguration);
+
+        //launch all RUN lines at once, subject to their After= dependencies
+        bool LaunchParallel(const STRING_LIST & RunLines);
+
+        //poll the DB for which processes are ready (connected)
+        bool UpdateLaunchReadiness(std::set<std::string> & Ready);
+
+        //the MOOSName a RUN line implies
+        std::string ImpliedMOOSName(std::string sConfiguration);
+
+        //true if a RUN line's options say another Antler launches it
+        bool IsRemoteProcess(const std::string & sOption);
+
+        //wait on spawned processes until all have quit
+        bool WaitOnProcesses();
         
         // called to figure out what xterm parameters should be used with launch (ie where should the xterm be and how should it look)
         bool MakeConsoleLaunchParams(std::string sParam,STRING_LIST & LaunchList,std::string sProcName,std::string sMOOSName);
@@ -121,6 +152,10 @@ class CAntler
         //pAntler on different machines...
         CMOOSThread m_RemoteControlThread;
         CMOOSCommClient * m_pMOOSComms;
+
+        //used during a parallel launch to learn which processes are up
+        CMOOSCommClient * m_pLaunchComms;
+        double m_dfLaunchTimeout;
         /**method to allow Listen thread to be launched with a MOOSThread.*/
         static bool _RemoteControlCB(void* pParam)
         {
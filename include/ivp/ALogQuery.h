@@ -0,0 +1,138 @@
+/*****************************************************************/
+/*    FILE: ALogQuery.h                                          */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_QUERY_HEADER
+#define ALOG_QUERY_HEADER
+
+#include <string>
+#include <vector>
+#include <set>
+#include <cstdio>
+#include "ALogTimeIndex.h"
+
+// A query over one alog file, producing one or more outputs in a
+// single pass. Each output has its own predicates (variables, sources
+// and a time window) and its own projection (the raw line, or chosen
+// columns of time, var, src and val). The part of the file read is
+// bounded by the union of the output time windows, using the sparse
+// time index of the file to seek to the start of the window and to
+// stop at its end. Lines with no timestamp are only passed to outputs
+// with no time window.
+
+class ALogQueryOutput
+{
+ public:
+  ALogQueryOutput();
+  ~ALogQueryOutput() {}
+
+  bool passVar(const char* var, size_t len) const;
+  bool passSrc(const char* src, size_t len) const;
+
+ public: // Predicates
+  std::set<std::string>    m_vars;
+  std::vector<std::string> m_var_prefixes;
+  std::vector<std::string> m_var_suffixes;
+  std::set<std::string>    m_srcs;
+  std::set<std::string>    m_keep_vars;
+
+  bool   m_tmin_set;
+  bool   m_tmax_set;
+  double m_tmin;
+  double m_tmax;
+  bool   m_comments;
+
+ public: // Projection and destination
+  std::vector<std::string> m_columns;
+  char         m_colsep;
+  std::string  m_filename;
+  FILE        *m_file;
+
+ public: // Results
+  unsigned long long m_lines_out;
+  unsigned long long m_chars_out;
+  unsigned long long m_lines_early;
+  unsigned long long m_chars_early;
+  unsigned long long m_lines_late;
+  unsigned long long m_chars_late;
+};
+
+class ALogQuery
+{
+ public:
+  ALogQuery();
+  ~ALogQuery();
+
+  bool setALogFile(const std::string&);
+  void setUseIndex(bool v)   {m_use_index=v;}
+  void setCacheIndex(bool v) {m_cache_index=v;}
+
+  // Returns the index of the new output. Output goes to stdout until
+  // a file is set for it.
+  unsigned int addOutput();
+
+  bool setOutputFile(unsigned int, const std::string&);
+  bool addVar(unsigned int, const std::string&);
+  bool addSource(unsigned int, const std::string&);
+  bool addKeepVar(unsigned int, const std::string&);
+  bool setTimeMin(unsigned int, double);
+  bool setTimeMax(unsigned int, double);
+  bool setComments(unsigned int, bool);
+  bool setColumns(unsigned int, const std::string&);
+  bool setColSep(unsigned int, char);
+
+  bool run();
+
+  unsigned int size() const {return(m_outputs.size());}
+
+  const ALogQueryOutput& getOutput(unsigned int ix) const
+  {return(m_outputs[ix]);}
+
+  unsigned long long getLinesRead() const         {return(m_lines_read);}
+  unsigned long long getLinesSkippedFront() const {return(m_lines_skip_front);}
+  unsigned long long getCharsSkippedFront() const {return(m_chars_skip_front);}
+  unsigned long long getLinesSkippedBack() const  {return(m_lines_skip_back);}
+  unsigned long long getCharsSkippedBack() const  {return(m_chars_skip_back);}
+
+ protected:
+  void handleLine(const char* line, size_t len, int region);
+  void writeLine(ALogQueryOutput&, const char* line, size_t len,
+		 const char* var, size_t var_len, const char* src,
+		 size_t src_len, const char* val, size_t val_len);
+
+  bool readRange(FILE*, unsigned long long start, unsigned long long end,
+		 int region);
+
+ protected:
+  std::string m_alogfile;
+  bool        m_use_index;
+  bool        m_cache_index;
+
+  std::vector<ALogQueryOutput> m_outputs;
+
+  bool m_any_keep_vars;
+
+  unsigned long long m_lines_read;
+  unsigned long long m_lines_skip_front;
+  unsigned long long m_chars_skip_front;
+  unsigned long long m_lines_skip_back;
+  unsigned long long m_chars_skip_back;
+};
+
+#endif
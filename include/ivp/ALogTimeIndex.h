@@ -0,0 +1,81 @@
+/*****************************************************************/
+/*    FILE: ALogTimeIndex.h                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_TIME_INDEX_HEADER
+#define ALOG_TIME_INDEX_HEADER
+
+#include <string>
+#include <vector>
+
+// A sparse index of an alog file. The file past the header is cut
+// into blocks of roughly m_block_size bytes, each starting on a line
+// boundary. For each block the min and max timestamp and the line and
+// char counts are noted. Since alog timestamps are only roughly in
+// order, the min/max of each block (not just its first line) are used
+// to find where a time window may safely begin and end. The index may
+// be cached beside the alog file (file.alog.tix), and is rebuilt if the
+// alog file size or modification time has changed.
+
+class ALogTimeIndex
+{
+ public:
+  ALogTimeIndex();
+  ~ALogTimeIndex() {}
+
+  bool build(const std::string& alogfile);
+  bool load(const std::string& alogfile);
+  bool save() const;
+  bool loadOrBuild(const std::string& alogfile, bool cache=true);
+
+  // Offset to begin reading to see all lines with time >= tmin, and
+  // the number of lines and chars (excluding newlines) passed over.
+  unsigned long long seekOffset(double tmin, unsigned long long& lines,
+				unsigned long long& chars) const;
+
+  // Offset at which to stop reading, as no line from there on has
+  // time <= tmax, and the number of lines and chars passed over.
+  unsigned long long stopOffset(double tmax, unsigned long long& lines,
+				unsigned long long& chars) const;
+
+  unsigned long long getHeaderEnd() const {return(m_header_end);}
+  unsigned long long getFileSize() const  {return(m_file_size);}
+  unsigned int       size() const         {return(m_offset.size());}
+
+  static std::string indexFileName(const std::string& alogfile);
+
+ protected:
+  bool readFileStats(const std::string& alogfile,
+		     unsigned long long& size, long long& mtime) const;
+
+ protected:
+  std::string        m_alogfile;
+  unsigned long long m_file_size;
+  long long          m_file_mtime;
+  unsigned long long m_block_size;
+  unsigned long long m_header_end;
+
+  std::vector<unsigned long long> m_offset;
+  std::vector<unsigned long long> m_lines;
+  std::vector<unsigned long long> m_chars;
+  std::vector<double>             m_tmin;
+  std::vector<double>             m_tmax;
+};
+
+#endif
@@ -0,0 +1,60 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: AOF_AvoidCollision.h                                 */
+/*    DATE: Feb 9th, 2001 (CPA logic written)                    */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef AOF_CPA_HEADER
+#define AOF_CPA_HEADER
+
+#include "AOF_Contact.h"
+#include "CPAEngine.h"
+
+class IvPDomain;
+class AOF_CPA: public AOF_Contact {
+public:
+  AOF_CPA(IvPDomain);
+  ~AOF_CPA() {}
+
+public: // virtuals defined
+  double evalBox(const IvPBox*) const;   
+  bool   setParam(const std::string&, double);
+  bool   setParam(const std::string&, const std::string&);
+  bool   initialize();
+
+ protected:
+  double metric(double) const;
+  
+ protected:
+  int    m_crs_ix;  // Index of "course" variable in IvPDomain
+  int    m_spd_ix;  // Index of "speed" variable in IvPDomain
+
+  bool   m_inextremis;
+};
+
+#endif
+
+
+
+
+
+
+
+
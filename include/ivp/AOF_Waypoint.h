@@ -0,0 +1,81 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: AOF_Waypoint.h                                       */
+/*    DATE: Sep 28th 2006                                        */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef AOF_WAYPOINT_HEADER
+#define AOF_WAYPOINT_HEADER
+
+#include "AOF.h"
+#include "IvPDomain.h"
+
+class AOF_Waypoint: public AOF {
+ public:
+  AOF_Waypoint(IvPDomain);
+  ~AOF_Waypoint() {}
+
+public: // virtuals defined
+  double evalBox(const IvPBox*) const; 
+  bool   setParam(const std::string&, double);
+  bool   initialize();
+
+protected:
+  // Initialization parameters
+  double m_osx;   // Ownship x position at time Tm.
+  double m_osy;   // Ownship y position at time Tm.
+  double m_ptx;   // x component of next the waypoint.
+  double m_pty;   // y component of next the waypoint.
+  double m_desired_spd;
+
+ // Initialization parameter set flags
+  bool   m_osx_set;  
+  bool   m_osy_set;  
+  bool   m_ptx_set;  
+  bool   m_pty_set;   
+  bool   m_desired_spd_set;
+
+  // Cached values for more efficient evalBox calls
+  double m_angle_to_wpt;
+  double m_max_speed;
+  int    m_crs_ix;     // Index of "course" var in IvPDomain
+  int    m_spd_ix;     // Index of "speed"  var in IvPDomain
+};
+
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,100 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: BHV_RStationKeep.h                                   */
+/*    DATE: Oct 8th 2007                                         */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef BHV_RELATIVE_STATION_KEEP_HEADER
+#define BHV_RELATIVE_STATION_KEEP_HEADER
+
+#include <string>
+#include <vector>
+#include "IvPBehavior.h"
+#include "XYSegList.h"
+
+class BHV_RStationKeep : public IvPBehavior {
+public:
+  BHV_RStationKeep(IvPDomain);
+  ~BHV_RStationKeep() {}
+  
+  bool         setParam(std::string, std::string);
+  void         onIdleState();
+  IvPFunction* onRunState();
+
+protected:
+  bool        updateInfoIn();  
+  bool        updateRCenter();
+  void        postStationMessage(bool);
+
+private:  // Configuration Parameters
+  std::string m_contact;
+  double      m_station_range;
+  double      m_station_angle;
+  bool        m_station_set;
+
+  double      m_outer_radius;
+  double      m_inner_radius;
+  bool        m_center_activate;
+
+  // The outer speed is the speed at the outer radius. The 
+  // desired_speed will decrease linearly until the inner
+  // ring, and will be zero inside the inner ring.
+  double      m_outer_speed;
+  
+  // The extra_speed is the desired speed should the
+  // vehicle drift outside the outer radius.
+  double      m_extra_speed;
+
+private:  // State Variables
+  bool         m_center_pending;
+  std::string  m_center_assign;
+  //double       m_angle;
+  //double       m_range;
+  double       m_station_x;
+  double       m_station_y;
+
+  double       m_cnx;
+  double       m_cny;
+  double       m_cnh;
+  double       m_cnv;
+
+};
+
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
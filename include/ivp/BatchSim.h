@@ -0,0 +1,102 @@
+/*****************************************************************/
+/*    FILE: BatchSim.h                                           */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef BATCH_SIM_HEADER
+#define BATCH_SIM_HEADER
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "BatchVehicle.h"
+#include "SimFleet.h"
+
+// Steps a set of BatchVehicles in lockstep on a fixed time step.
+// Between steps, node reports and node messages are passed between
+// vehicles (the in-memory equivalent of uFldNodeBroker/pShare and
+// uFldMessageHandler). Within a step vehicles are independent so
+// they may be stepped by a pool of worker threads. Results are the
+// same for any number of threads. In fleet mode the simulators are
+// propagated together in a SimFleet, giving the same results.
+
+class BatchSim
+{
+ public:
+  BatchSim();
+  ~BatchSim();
+
+  bool addMissionFile(std::string);
+  bool addPoke(std::string);
+
+  bool setStepSize(std::string);
+  bool setDuration(std::string);
+  bool setStartTime(std::string);
+  bool setThreads(std::string);
+  void setLogDir(std::string s) {m_log_dir=s;}
+  void setVerbose(bool v)       {m_verbose=v;}
+  void setFleetMode(bool v)     {m_fleet_mode=v;}
+
+  bool initialize();
+  void run();
+  void printReport() const;
+
+  std::vector<std::string> getWarnings() const;
+
+ protected:
+  void exchangeMail();
+  void stepFleet();
+  void stepVehicles(unsigned int worker);
+  void workerLoop(unsigned int worker);
+  void stepAll();
+
+ protected: // Configuration
+  std::vector<std::string> m_mission_files;
+  std::vector<std::string> m_pokes;
+  std::string  m_log_dir;
+  double       m_step_size;
+  double       m_duration;
+  double       m_start_time;
+  unsigned int m_threads;
+  bool         m_verbose;
+  bool         m_fleet_mode;
+
+ protected: // State
+  std::vector<BatchVehicle*> m_vehicles;
+  std::vector<std::string>   m_warnings;
+  double        m_curr_time;
+  unsigned long m_steps;
+  double        m_elapsed_wall;
+
+  // When in fleet mode, simulators of eligible vehicles are
+  // propagated together here rather than one vehicle at a time.
+  SimFleet      m_fleet;
+
+ protected: // Worker pool
+  std::vector<std::thread> m_workers;
+  std::mutex               m_mutex;
+  std::condition_variable  m_start_cv;
+  std::condition_variable  m_done_cv;
+  unsigned long            m_generation;
+  unsigned int             m_pending;
+  bool                     m_quit;
+};
+
+#endif
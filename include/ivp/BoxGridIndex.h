@@ -0,0 +1,78 @@
+/*****************************************************************/
+/*    FILE: BoxGridIndex.h                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef BOX_GRID_INDEX_HEADER
+#define BOX_GRID_INDEX_HEADER
+
+#include <vector>
+#include <map>
+
+// An index of axis-aligned boxes, e.g., shape bounding boxes, by id,
+// for finding the boxes that overlap a query box. Boxes are held in
+// the cells of a uniform grid they overlap. Boxes spanning too many
+// cells are held apart and checked on every query, as are all boxes
+// when the query itself spans too many cells.
+
+class BoxGridIndex
+{
+public:
+  BoxGridIndex(double cell_size=100);
+  ~BoxGridIndex() {}
+
+  bool setCellSize(double);
+  void clear();
+
+  void setBox(unsigned int id, double xmin, double xmax,
+	      double ymin, double ymax);
+  void removeBox(unsigned int id);
+
+  // Ids of boxes overlapping the query box, in ascending order
+  std::vector<unsigned int> query(double xmin, double xmax,
+				  double ymin, double ymax) const;
+
+  bool         hasBox(unsigned int id) const;
+  unsigned int size() const {return(m_count);}
+  double       getCellSize() const {return(m_cell_size);}
+
+ protected:
+  long long cellKey(int ix, int iy) const;
+  int       cellIX(double) const;
+  bool      overlaps(unsigned int id, double xmin, double xmax,
+		     double ymin, double ymax) const;
+  void      addToCells(unsigned int id);
+  void      removeFromCells(unsigned int id);
+
+ protected:
+  double       m_cell_size;
+  unsigned int m_max_cells;
+  unsigned int m_count;
+
+  // Per id: xmin,xmax,ymin,ymax, whether present, whether oversize
+  std::vector<double> m_boxes;
+  std::vector<char>   m_present;
+  std::vector<char>   m_oversize;
+
+  std::map<long long, std::vector<unsigned int> > m_cells;
+  std::vector<unsigned int>                       m_oversize_ids;
+};
+
+#endif
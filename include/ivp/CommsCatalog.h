@@ -0,0 +1,53 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: CommsCatalog.h                                       */
+/*    DATE: Aug 30th 2022                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef COMMS_CATALOG_HEADER
+#define COMMS_CATALOG_HEADER
+
+#include <string>
+
+class CommsCatalog
+{
+ public:
+  CommsCatalog();
+  ~CommsCatalog() {}
+
+  void addEntry(double, double, double, unsigned int);
+  
+ protected:
+
+  
+  
+};
+
+#endif 
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,40 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: FileBuffer.h                                         */
+/*    DATE: 1996                                                 */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef FILE_BUFFER_HEADER
+#define FILE_BUFFER_HEADER
+
+#include <list>
+#include <vector>
+#include <string>
+
+std::vector<std::string> fileBuffer(const std::string&, unsigned int amt=0);
+
+std::list<std::string>   fileBufferList(const std::string&, unsigned int amt=0);
+
+std::vector<std::string> fileBufferSlash(const std::string&, unsigned int amt=0);
+
+#endif
+
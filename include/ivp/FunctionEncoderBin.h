@@ -0,0 +1,52 @@
+/*****************************************************************/
+/*    FILE: FunctionEncoderBin.h                                 */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef FUNCTION_ENCODER_BIN_HEADER
+#define FUNCTION_ENCODER_BIN_HEADER
+
+#include <string>
+#include <vector>
+#include "IvPFunction.h"
+
+// A compact binary form of an IvPFunction. Box bounds are delta
+// encoded against the prior box, and weights are quantized to the
+// same four decimal places as the string form and delta encoded,
+// all as variable length integers. The string form of the binary
+// encoding is "B," followed by the base64 encoded bytes, and may
+// be posted, muxed and logged wherever the "H," string form is.
+
+// Convert an IvPFunction to/from the binary representation
+std::vector<unsigned char> IvPFunctionToBinary(IvPFunction*);
+IvPFunction *BinaryToIvPFunction(const std::vector<unsigned char>&);
+
+// Convert an IvPFunction to/from the binary string representation
+std::string  IvPFunctionToStringBin(IvPFunction*);
+IvPFunction *StringBinToIvPFunction(const std::string&);
+
+// True if the string is in the binary string representation
+bool isStringBinIPF(const std::string&);
+
+// Extract context or IvPDomain without building the function
+std::string StringBinToIvPContext(const std::string&);
+IvPDomain   StringBinToIvPDomain(const std::string&);
+
+#endif
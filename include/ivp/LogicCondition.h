@@ -0,0 +1,198 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: LogicCondition.h                                     */
+/*    DATE: October 2006                                         */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifdef _WIN32
+#pragma warning(disable : 4786)
+#pragma warning(disable : 4503)
+#endif
+
+#ifndef LOGIC_CONDITION_HEADER
+#define LOGIC_CONDITION_HEADER
+
+#include <string>
+#include <vector>
+#include "ParseNode.h"
+
+// A LogicCondition is parsed into a tree of ParseNodes and then
+// compiled into a flat postfix program. Each distinct variable in
+// the condition has one slot holding its value, and each comparison
+// refers to its operands by slot or by pre-converted literal. The
+// result of eval() is kept until a variable value changes.
+
+class LogicCondition {
+public:
+  LogicCondition();
+  
+  LogicCondition(const LogicCondition&);
+
+  ~LogicCondition();
+  
+  const LogicCondition &operator=(const LogicCondition&);
+
+  bool setCondition(const std::string&);
+  void setAllowDoubleEquals(bool v) {m_allow_dblequals=v;}
+
+  void expandMacro(std::string macro, std::string val);
+  
+  std::string getRawCondition() const {
+    if(m_node) 
+      return(m_node->getRawCondition());
+    else
+      return("");
+  }
+  
+  // Var names are in slot order, i.e., slot i holds var i
+  std::vector<std::string> getVarNames() const {return(m_var_names);}
+  
+  void clearVarVals();
+  
+  void setVarVal(const std::string& var, const std::string& val);
+  void setVarVal(const std::string& var, double val);
+
+  void setSlotVal(unsigned int slot, const std::string& val);
+  void setSlotVal(unsigned int slot, double val);
+
+  // Changes whenever the condition is (re)compiled, not on copy
+  unsigned long int getCompileID() const {return(m_compile_id);}
+
+  bool eval() const;
+  
+  void print() const;
+
+protected:
+  void compile();
+  void compileNode(const ParseNode*);
+  int  varSlot(const std::string&) const;
+
+  bool evalCompare(unsigned int ix) const;
+
+protected:
+  ParseNode *m_node;
+
+  bool  m_allow_dblequals;
+
+  unsigned long int m_compile_id;
+
+  // The program, one entry per op, in postfix order
+  std::vector<unsigned char> m_op;
+  std::vector<unsigned char> m_rel;
+  std::vector<int>           m_lslot;
+  std::vector<unsigned char> m_rtype;
+  std::vector<int>           m_rslot;
+  std::vector<std::string>   m_rstr;
+  std::vector<bool>          m_rstr_num;
+  std::vector<double>        m_rdbl;
+
+  // Variable slots. A slot once set with a string value may not be
+  // set with a double value and vice versa, until cleared.
+  // For string values, m_sunq is the value with quotes removed,
+  // and if it is numerical, m_dval holds its numerical value.
+  std::vector<std::string>   m_var_names;
+  std::vector<std::string>   m_sval;
+  std::vector<std::string>   m_sunq;
+  std::vector<bool>          m_snum;
+  std::vector<double>        m_dval;
+  std::vector<bool>          m_sset;
+  std::vector<bool>          m_dset;
+
+  mutable std::vector<bool>  m_stack;
+  mutable bool               m_result;
+  mutable bool               m_result_ok;
+};
+
+#endif
+
+#ifndef LOGIC_CONDITION_HEADER
+#define LOGIC_CONDITION_HEADER
+
+#include <string>
+#include <vector>
+#include "ParseNode.h"
+
+class LogicCondition {
+public:
+  LogicCondition();
+  
+  LogicCondition(const LogicCondition&);
+
+  ~LogicCondition();
+  
+  const LogicCondition &operator=(const LogicCondition&);
+
+  bool setCondition(const std::string&);
+  void setAllowDoubleEquals(bool v) {m_allow_dblequals=v;}
+
+  void expandMacro(std::string macro, std::string val);
+  
+  std::string getRawCondition() const {
+    if(m_node) 
+      return(m_node->getRawCondition());
+    else
+      return("");
+  }
+  
+  std::vector<std::string> getVarNames() const;
+  
+  void clearVarVals()
+    {if(m_node) m_node->recursiveClearVarVal();}
+  
+  void setVarVal(std::string var, std::string val)
+    {if(m_node) m_node->recursiveSetVarVal(var,val);}
+  
+  void setVarVal(std::string var, double val) 
+    {if(m_node) m_node->recursiveSetVarVal(var,val);}
+
+  bool eval() const;
+  
+  void print() const
+    {if(m_node) m_node->print();}
+
+protected:
+  ParseNode *m_node;
+
+  bool  m_allow_dblequals;
+};
+
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,68 @@
+/*****************************************************************/
+/*    FILE: LogicIndex.h                                         */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef LOGIC_INDEX_HEADER
+#define LOGIC_INDEX_HEADER
+
+#include <string>
+#include <vector>
+#include "InfoBuffer.h"
+#include "LogicCondition.h"
+
+// An index from the variables of a group of logic conditions to
+// the condition slots they feed. On each update, only variables
+// that changed in the InfoBuffer since the prior update are queried
+// and pushed to the conditions. Conditions whose variables did not
+// change keep their prior evaluation. The index rebuilds itself if
+// the group of conditions or the InfoBuffer changes.
+
+class LogicIndex {
+public:
+  LogicIndex() {clear();}
+  ~LogicIndex() {}
+
+  void clear();
+
+  // Returns true if any variable changed since the prior update
+  bool update(std::vector<LogicCondition>&, const InfoBuffer*);
+
+  unsigned int size() const {return(m_vars.size());}
+
+protected:
+  bool isValid(const std::vector<LogicCondition>&,
+	       const InfoBuffer*) const;
+  void build(const std::vector<LogicCondition>&, const InfoBuffer*);
+
+protected:
+  const InfoBuffer*              m_info_buffer;
+  std::vector<unsigned long int> m_compile_ids;
+
+  // One entry per unique var, each with its dependent slots
+  std::vector<std::string>                m_vars;
+  std::vector<unsigned int>               m_var_ix;
+  std::vector<std::vector<unsigned int> > m_dep_cond;
+  std::vector<std::vector<unsigned int> > m_dep_slot;
+
+  unsigned long int m_seq;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/*****************************************************************/
+/*    FILE: PagedLogPlot.h                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef PAGED_LOG_PLOT_HEADER
+#define PAGED_LOG_PLOT_HEADER
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "LogPlotPageCache.h"
+
+// A time series min/max summary over a run of points
+class LogPlotBucket
+{
+ public:
+  double m_tfirst;
+  double m_tlast;
+  double m_vmin;
+  double m_vmax;
+};
+
+// The resident part of a paged series: where each page of points
+// begins in the klog file, and a pyramid of min/max buckets for
+// drawing the series when zoomed out. Level 0 buckets each summarize
+// a fixed number of points, and each level above halves the number
+// of buckets. Built in one pass over the klog file.
+
+class LogPlotSeries
+{
+ public:
+  LogPlotSeries();
+  ~LogPlotSeries();
+
+  bool build(const std::string& klog, double skew, double tmin,
+	     double tmax, const std::shared_ptr<LogPlotPageCache>& cache);
+
+  const LogPlotPage* getPage(unsigned int page_ix) const;
+
+  unsigned int pageOfTime(double gtime) const;
+  unsigned int bucketOfTime(unsigned int level, double gtime) const;
+
+ public:
+  std::string m_klog;
+  double m_skew;
+  double m_tmin;
+  double m_tmax;
+
+  std::shared_ptr<LogPlotPageCache> m_cache;
+  unsigned int m_series_id;
+
+  std::vector<unsigned long long> m_page_offset;
+  std::vector<double>             m_page_prev_time;
+  std::vector<double>             m_page_tfirst;
+  std::vector<unsigned int>       m_page_count;
+
+  std::vector<std::vector<LogPlotBucket> > m_levels;
+
+  unsigned int m_size;
+  double m_min_time;
+  double m_max_time;
+  double m_min_val;
+  double m_max_val;
+};
+
+// A LogPlot whose points are loaded in pages on demand rather than
+// held in full. Copies share the series and the page cache.
+
+class PagedLogPlot
+{
+ public:
+  PagedLogPlot() {}
+  ~PagedLogPlot() {}
+
+  bool build(const std::string& klog, double skew, double tmin,
+	     double tmax, const std::shared_ptr<LogPlotPageCache>& cache);
+
+  void setVName(std::string s)   {m_vname = s;}
+  void setVarName(std::string s) {m_varname = s;}
+
+  std::string getVName() const   {return(m_vname);}
+  std::string getVarName() const {return(m_varname);}
+
+  unsigned int size() const;
+  bool   empty() const {return(size() == 0);}
+  double getMinTime() const;
+  double getMaxTime() const;
+  double getMinVal() const;
+  double getMaxVal() const;
+  double getValueByTime(double gtime) const;
+
+  // Points for drawing the series between tmin and tmax, plus the
+  // points just outside. If there are more than max_points, pairs
+  // of min/max points from the bucket pyramid are given instead.
+  void   getPoints(double tmin, double tmax, unsigned int max_points,
+		   std::vector<double>& times,
+		   std::vector<double>& vals) const;
+
+ protected:
+  std::string m_vname;
+  std::string m_varname;
+
+  std::shared_ptr<const LogPlotSeries> m_series;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*****************************************************************/
+/*    FILE: QuantileSketch.h                                     */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef QUANTILE_SKETCH_HEADER
+#define QUANTILE_SKETCH_HEADER
+
+#include <map>
+
+// A mergeable sketch of a stream of numbers for estimating quantiles
+// with bounded memory. Values are counted in buckets whose bounds grow
+// geometrically, so an estimate is within ~1% of the true value
+// regardless of scale. If the number of buckets exceeds the limit, the
+// buckets nearest zero are collapsed together, giving up accuracy only
+// for the smallest magnitudes. Sketches merge by adding bucket counts.
+
+class QuantileSketch
+{
+ public:
+  QuantileSketch();
+  ~QuantileSketch() {}
+
+  void   add(double);
+  void   merge(const QuantileSketch&);
+  double quantile(double q) const;
+
+  unsigned long long count() const {return(m_count);}
+
+ protected:
+  int    bucketKey(double) const;
+  double bucketValue(int) const;
+  void   collapse(std::map<int, unsigned long long>&);
+
+ protected:
+  double       m_gamma;
+  double       m_log_gamma;
+  unsigned int m_max_buckets;
+
+  std::map<int, unsigned long long> m_pos;
+  std::map<int, unsigned long long> m_neg;
+
+  unsigned long long m_zeros;
+  unsigned long long m_count;
+};
+
+#endif
@@ -31,7 +31,7 @@
 class SimEngine
 {
 public:
-  SimEngine() {}
+  SimEngine() {m_thrust_mode_reverse=false; m_verbose=false;}
   ~SimEngine() {}
 
 public:
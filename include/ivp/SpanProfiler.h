@@ -0,0 +1,154 @@
+/*****************************************************************/
+/*    FILE: SpanProfiler.h                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef SPAN_PROFILER_HEADER
+#define SPAN_PROFILER_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+
+// A profiler of nested, named spans of wall time. Spans are opened
+// and closed in strict nesting order, usually with a ScopedSpan, and
+// each closed span is noted in three ways:
+//   (1) A fixed size ring of the most recent spans, for writing a
+//       Chrome trace (chrome://tracing, Perfetto) of recent iterations.
+//   (2) A tree of call stacks with total and self times, for writing
+//       a collapsed-stack file for flamegraph.pl or speedscope.
+//   (3) A rolling window of the most recent durations per span name,
+//       for the median, 90th percentile and max.
+// No locking is done. The profiler shared by the helm libraries may
+// be reached from several threads, e.g., helms stepped in parallel by
+// the batch simulator, so it must only be enabled where it is used
+// from one thread at a time, and nothing is changed on it while it
+// is disabled. The ring and rolling windows are preallocated, so a
+// span is noted without any allocation once its call stack has been
+// seen. When disabled, a ScopedSpan costs a single flag check.
+
+class SpanRecord
+{
+ public:
+  unsigned int name_id;
+  unsigned int depth;
+  unsigned int iteration;
+  long long    start_us;
+  long long    dur_us;
+};
+
+class SpanProfiler
+{
+ public:
+  SpanProfiler();
+  ~SpanProfiler() {}
+
+  void setEnabled(bool);
+  bool isEnabled() const {return(m_enabled);}
+
+  bool setRingSize(unsigned int);
+  bool setWindowSize(unsigned int);
+  void clear();
+
+  unsigned int nameID(const std::string&);
+
+  void setIteration(unsigned int v) {m_iteration=v;}
+
+  void begin(unsigned int name_id);
+  void end();
+
+  unsigned int       getDepth() const     {return(m_stack.size());}
+  unsigned long long getSpanCount() const {return(m_span_count);}
+
+  // Rolling stats, in milliseconds, of the last N spans of a name.
+  bool getStats(const std::string& name, double& p50, double& p90,
+		double& pmax, unsigned int& count) const;
+
+  // name=p50/p90/max for each name given that has been seen, e.g.,
+  // "waypt_survey=0.12/0.31/0.88,loiter=0.05/0.06/0.10"
+  std::string getStatsSummary(const std::vector<std::string>&) const;
+
+  bool writeChromeTrace(const std::string& filename) const;
+  bool writeCollapsed(const std::string& filename) const;
+
+ protected:
+  long long    nowMicros() const;
+  unsigned int childNode(unsigned int node, unsigned int name_id);
+  std::string  stackString(unsigned int node) const;
+
+ protected:
+  class SpanNode
+  {
+  public:
+    unsigned int parent;
+    unsigned int name_id;
+    long long    total_us;
+    long long    child_us;
+    unsigned long long count;
+    std::map<unsigned int, unsigned int> children;
+  };
+
+  class OpenSpan
+  {
+  public:
+    unsigned int node;
+    long long    start_us;
+  };
+
+ protected:
+  bool         m_enabled;
+  unsigned int m_iteration;
+  long long    m_epoch_us;
+
+  std::vector<std::string>            m_names;
+  std::map<std::string, unsigned int> m_name_ids;
+
+  std::vector<OpenSpan> m_stack;
+  std::vector<SpanNode> m_nodes;
+
+  // Ring of recent spans, allocated when first enabled. m_span_count
+  // is the total recorded, so the next slot is m_span_count modulo
+  // the ring size.
+  unsigned int            m_ring_size;
+  std::vector<SpanRecord> m_ring;
+  unsigned long long      m_span_count;
+
+  // Rolling window of recent durations, per name id
+  unsigned int                         m_window_size;
+  std::vector<std::vector<long long> > m_window;
+  std::vector<unsigned long long>      m_window_count;
+};
+
+// The profiler shared by the helm and the libraries it calls upon.
+SpanProfiler& spanProfiler();
+
+class ScopedSpan
+{
+ public:
+  ScopedSpan(const char *name, SpanProfiler& prof=spanProfiler());
+  ScopedSpan(const std::string& name, SpanProfiler& prof=spanProfiler());
+  ~ScopedSpan() {if(m_active) m_prof.end();}
+
+ protected:
+  SpanProfiler& m_prof;
+  bool          m_active;
+};
+
+#endif
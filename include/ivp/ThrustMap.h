@@ -53,6 +53,11 @@ public:
   std::string getMapPos() const;
   std::string getMapNeg() const;
 
+  std::map<double, double> getPosMapping() const {return(m_pos_mapping);}
+  std::map<double, double> getNegMapping() const {return(m_neg_mapping);}
+  double getMinThrust() const {return(m_min_thrust);}
+  double getMaxThrust() const {return(m_max_thrust);}
+
  public: // Actions
   void   print() const;
   void   clear();
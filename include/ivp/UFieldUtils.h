@@ -0,0 +1,45 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: UFieldUtils.h                                        */
+/*    DATE: Sep 27th 2012                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <string>
+
+#ifndef UFIELD_UTILITIES_HEADER
+#define UFIELD_UTILITIES_HEADER
+
+bool isValidPShareRoute(const std::string&);
+
+bool isValidPShareRoute(std::string& route, std::string& err_msg);
+
+std::string resolveDomainName(const std::string&, std::string& err_msg);
+
+#endif 
+
+
+
+
+
+
+
+
+
+
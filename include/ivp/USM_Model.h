@@ -29,6 +29,7 @@
 #include "NodeRecord.h"
 #include "MBTimer.h"
 #include "SimEngine.h"
+#include "SimFleet.h"
 #include "WindModel.h"
 #include "PolarPlot.h"
 #include "TurnSpeedMap.h"
@@ -43,10 +44,17 @@ public:
 
   bool   propagate(double time);
   void   resetTime(double time);
+
+  // Propagation as one of many vehicles in a SimFleet
+  bool   fleetEligible() const;
+  unsigned int joinFleet(SimFleet&) const;
+  void   pushToFleet(SimFleet&, unsigned int ix) const;
+  void   pullFromFleet(const SimFleet&, unsigned int ix);
   
   // Setters
   bool   setParam(std::string, double);
   bool   setParam(std::string, std::string);
+  bool   handleConfigParam(std::string param, std::string value);
 
   void   informX(double);
   void   informY(double);
@@ -155,6 +163,7 @@ public:
 
  protected:
   void   propagateNodeRecord(NodeRecord&, double delta_time, bool);
+  void   updateLatLonAlt(NodeRecord&);
 
  protected:
   double     m_rudder;
@@ -0,0 +1,124 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: VPlugPlot.h                                          */
+/*    DATE: Aug 9th, 2009                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef GEO_PLOT_HEADER
+#define GEO_PLOT_HEADER
+
+#include <string>
+#include <vector>
+#include <list>
+#include "VPlug_GeoShapes.h"
+
+// The visuals of one platform over time. Rather than a full copy of
+// the visuals for each time bin, the events (VIEW_POINT etc.) are kept
+// in order, with a full copy (snapshot) every hundred events. The
+// visuals at a given time are found by a replay cursor which applies
+// events forward from where it last was. Stepping back, or jumping
+// far ahead, restarts the cursor from the nearest earlier snapshot.
+// So the cost of stepping through time is in the number of events
+// passed, not the length of the log.
+
+class VPlugPlot
+{
+public:
+  VPlugPlot();
+  ~VPlugPlot() {}
+
+  bool    addEvent(const std::string& var, 
+		   const std::string& val, double time);
+  void    setVehiName(std::string s) {m_vehi_name = s;}
+  void    setBinVal(double);
+  void    setSnapInterval(unsigned int);
+  
+  double  getMinTime() const;
+  double  getMaxTime() const;
+
+  void    applySkew(double skew);
+
+  void    print() const;
+  void    summary(std::string indent="") const;
+
+  std::string  getVehiName() const   {return(m_vehi_name);}
+  unsigned int size() const          {return(m_time.size());}
+
+  // The returned reference is to the replay cursor, valid until the
+  // next call to either of these.
+  const VPlug_GeoShapes& getVPlugByIndex(unsigned int index) const;
+  const VPlug_GeoShapes& getVPlugByTime(double gtime) const;
+
+protected:
+  bool applyEvent(VPlug_GeoShapes&, unsigned int event_ix) const;
+  void seekEvent(unsigned int event_cnt) const;
+  
+protected: // config vars
+  double       m_binval;
+  unsigned int m_snap_interval;
+  
+protected: // state vars
+  std::string  m_vehi_name;  // Name of the platform
+
+  // One entry per time bin: the bin start time and the number of
+  // events applied by the end of the bin.
+  std::vector<double>       m_time;
+  std::vector<unsigned int> m_bin_end;
+
+  // One entry per event
+  std::vector<unsigned short> m_event_type;
+  std::vector<std::string>    m_event_val;
+
+  // Visuals after m_snap_cnt[i] events, and after all events so far
+  std::vector<VPlug_GeoShapes> m_snaps;
+  std::vector<unsigned int>    m_snap_cnt;
+  VPlug_GeoShapes              m_latest;
+
+  VPlug_GeoShapes m_null_vplug;
+
+  // Replay cursor: the visuals after m_cursor_cnt events
+  mutable VPlug_GeoShapes m_cursor;
+  mutable unsigned int    m_cursor_cnt;
+  mutable unsigned int    m_time_hint;
+
+  unsigned int m_view_point_cnt;
+  unsigned int m_view_polygon_cnt;
+  unsigned int m_view_seglist_cnt;
+  unsigned int m_view_seglr_cnt;
+  unsigned int m_view_circle_cnt;
+  unsigned int m_view_arrow_cnt;
+  unsigned int m_grid_config_cnt;
+  unsigned int m_grid_delta_cnt;
+  unsigned int m_view_range_pulse_cnt;
+  unsigned int m_view_comms_pulse_cnt;
+  unsigned int m_view_marker_cnt;
+  unsigned int m_view_textbox_cnt;
+};
+#endif 
+
+
+
+
+
+
+
+
+
+
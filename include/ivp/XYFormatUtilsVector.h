@@ -0,0 +1,48 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: XYFormatUtilsVector.h                                */
+/*    DATE: Oct 18, 2010 In Waterloo                             */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef XY_FORMAT_UTILS_VECTOR_HEADER
+#define XY_FORMAT_UTILS_VECTOR_HEADER
+
+#include <string>
+#include "XYVector.h"
+
+//---------------------------------------------------------------
+// Create an XYVector instance  from a string specification. 
+// Example: x=12,y=4,mag=1.5,ang=45,vertex_size=3,label=foobar
+
+XYVector string2Vector(std::string);
+
+#endif
+
+
+
+
+
+
+
+
+
+
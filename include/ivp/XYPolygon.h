@@ -0,0 +1,145 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: XYPolygon.h                                          */
+/*    DATE: Apr 29, 2005                                         */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef XY_POLYGON_HEADER
+#define XY_POLYGON_HEADER
+
+#include <vector>
+#include <string>
+#include "XYSegList.h"
+#include "XYSquare.h"
+
+class XYPolygon : public XYSegList {
+public:
+  XYPolygon();
+  XYPolygon(double x, double y, double rad,
+	    unsigned int pts, std::string label="");
+  XYPolygon(XYSegList);
+  ~XYPolygon() {}
+
+  // Polygon create and edit functions
+  bool   add_vertex(double, double, bool=true);
+  bool   add_vertex_delta(double x, double y, double delta=0, bool=true);
+  bool   add_vertex(double, double, double, bool=true);
+  bool   add_vertex(double, double, double, std::string, bool=true);
+  bool   alter_vertex(double, double, double=0);
+  bool   delete_vertex(double, double);
+  bool   delete_vertex(unsigned int);
+  void   grow_by_pct(double pct);
+  void   grow_by_amt(double amt);
+  bool   insert_vertex(double, double, double=0);
+
+  void   clear();
+  bool   apply_snap(double snapval);
+  void   reverse();
+  void   rotate(double, double, double);
+  void   rotate(double);
+
+  void   shift_horz(double val);
+  void   shift_vert(double val);
+  void   new_center(double x, double y);
+  void   new_centroid(double x, double y);
+  void   mod_vertex(unsigned int, double, double, double=0, std::string s="");
+  void   pop_last_vertex();
+
+public:
+  bool   contains(double, double) const;
+  bool   contains(const XYPoint&) const;
+  bool   contains(const XYPolygon&) const;
+  bool   contains(const XYSegList&) const;
+  bool   intersects(const XYPolygon&) const;
+  bool   intersects(const XYSquare&) const;
+  double dist_to_poly(const XYPolygon&) const;
+  double dist_to_poly(double px, double py) const;
+  double dist_to_poly(double x1, double y1, double x2, double y2) const;
+  double dist_to_poly(double px, double py, double angle) const;
+  bool   seg_intercepts(double, double, double, double) const;
+
+  // Batch versions, same results as calling the above for each
+  std::vector<bool>   contains(const std::vector<double>& vx,
+			       const std::vector<double>& vy) const;
+  std::vector<double> dist_to_poly(const std::vector<double>& vx,
+				   const std::vector<double>& vy) const;
+  std::vector<double> dist_to_poly(double px, double py,
+				   const std::vector<double>& angles) const;
+
+  bool   line_intersects(double x1, double y1, double x2, double y2,
+			 double& ix1, double& iy1,
+			 double& ix2, double& iy2) const;
+  
+  bool   vertex_is_viewable(unsigned int, double, double) const;
+  bool   is_convex() const  {return(m_convex_state);}
+  void   determine_convexity();
+
+  double area() const;
+  double perim() const;
+  bool   simplify(double range_thresh);
+  
+  double  max_radius() const;
+  bool    closest_point_on_poly(double sx, double sy, double& rx, double& ry) const;
+  XYPoint closest_point_on_poly(XYPoint spt) const;
+
+  bool   setRadial(double x, double y, double rad, unsigned int pts,
+		   double snap=-1);
+  
+  XYSegList exportSegList(double x=0, double y=0);
+
+  XYPolygon crossProductSettle() const;
+  
+  unsigned int min_xproduct(bool&) const;
+
+protected:
+  int    side(double x1, double y1, double x2, 
+	      double y2, double x3, double y3) const;
+  int    edge_side(unsigned int ix, double x3, double y3) const;
+  double edge_dist_sq(unsigned int ix, double x, double y) const;
+  bool   edge_bearings(unsigned int ix, double px, double py,
+		       double& ang_low, double& ang_width) const;
+  void   set_side(int);
+  void   set_edges();
+  bool   outside_bbox(double x, double y) const;
+
+private:
+  std::vector<int> m_side_xy;
+
+  bool     m_convex_state;
+
+  // Edge data set by set_edges(), from determine_convexity(). Edge
+  // ix runs from vertex ix to ix+1, or to vertex 0 if ix is last.
+  // Slope and intercept are as calculated in side().
+  std::vector<double> m_edge_dx;
+  std::vector<double> m_edge_dy;
+  std::vector<double> m_edge_m;
+  std::vector<double> m_edge_b;
+
+  double   m_bbox_xmin;
+  double   m_bbox_xmax;
+  double   m_bbox_ymin;
+  double   m_bbox_ymax;
+  bool     m_edges_ok;
+};
+
+#endif
+
@@ -0,0 +1,45 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE:                                                      */
+/*    DATE:                                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+#ifndef FILEUTIL_HEADER
+#define FILEUTIL_HEADER
+
+#include <vector>
+#include <string>
+
+// Returns 0 if 'files' has been appended with all files in the specified
+// directory, otherwise returns an error code returned by the 'opendir'
+// function.
+int listdir (std::string dir, std::vector<std::string> &files);
+
+bool isDirectory(std::string filename);
+bool isRegularFile(std::string filename);
+
+#endif
+
+
+
+
+
+
+
+
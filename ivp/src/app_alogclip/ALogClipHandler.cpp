@@ -45,6 +45,9 @@ ALogClipHandler::ALogClipHandler()
   m_force_overwrite = false;
   m_verbose = false;
   m_batch   = false;
+
+  m_use_index   = false;
+  m_cache_index = false;
   
   m_suffix  = "_clipped";
 }
@@ -193,6 +196,8 @@ bool ALogClipHandler::processFile(string infile, string outfile)
 
   clipper.openALogFileRead(infile);
   clipper.openALogFileWrite(outfile);
+  clipper.setUseIndex(m_use_index);
+  clipper.setCacheIndex(m_cache_index);
 
   if(m_verbose) {
     cout << endl << "Processing input file " << infile << " ..." << endl;
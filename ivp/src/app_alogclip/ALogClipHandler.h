@@ -36,6 +36,8 @@ class ALogClipHandler
   void      setForceOverwrite()      {m_force_overwrite=true;}
   void      setVerbose()             {m_verbose=true;}
   void      setBatch()               {m_batch=true;}
+  void      setUseIndex()            {m_use_index=true;}
+  void      setCacheIndex()          {m_use_index=true; m_cache_index=true;}
   bool      setSuffix(std::string s);
   bool      setTimeStamp(double);
   bool      addALogFile(std::string s);
@@ -58,6 +60,8 @@ class ALogClipHandler
   bool        m_force_overwrite;
   bool        m_verbose;
   bool        m_batch;
+  bool        m_use_index;
+  bool        m_cache_index;
   std::string m_suffix;
 
  private:
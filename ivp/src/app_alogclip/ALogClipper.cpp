@@ -24,6 +24,7 @@
 #include <cmath>
 #include "MBUtils.h"
 #include "ALogClipper.h"
+#include "ALogQuery.h"
 #include <cstdlib>
 #include <cstdio>
 
@@ -37,6 +38,9 @@ ALogClipper::ALogClipper()
   m_infile  = 0;
   m_outfile = 0;
 
+  m_use_index   = false;
+  m_cache_index = false;
+
   m_kept_chars          = 0;
   m_clipped_chars_front = 0;
   m_clipped_chars_back  = 0;
@@ -53,6 +57,9 @@ ALogClipper::ALogClipper()
 
 unsigned int ALogClipper::clip(double min_time, double max_time)
 {
+  if(m_use_index)
+    return(clipWithIndex(min_time, max_time));
+
   while(m_infile) {
     string line = getNextLine();
 
@@ -88,6 +95,55 @@ unsigned int ALogClipper::clip(double min_time, double max_time)
   return(m_clipped_lines_front + m_clipped_lines_back);
 }
 
+//--------------------------------------------------------
+// Procedure: clipWithIndex
+//     Notes: The clipping is done by an ALogQuery which, using the
+//            time index of the file, need not read the parts of the
+//            file outside the time window. The preserve vars are
+//            kept regardless of time, which requires a cheap pass
+//            over those parts of the file. Unlike clip(), comment
+//            lines and lines with no timestamp are dropped if they
+//            fall outside the time window.
+
+unsigned int ALogClipper::clipWithIndex(double min_time, double max_time)
+{
+  if(!m_infile)
+    return(0);
+
+  // The query opens the files itself
+  fclose(m_infile);
+  m_infile = 0;
+  if(m_outfile) {
+    fclose(m_outfile);
+    m_outfile = 0;
+  }
+
+  ALogQuery query;
+  query.setCacheIndex(m_cache_index);
+  if(!query.setALogFile(m_infile_name))
+    return(0);
+
+  unsigned int ix = query.addOutput();
+  if(m_outfile_name != "")
+    query.setOutputFile(ix, m_outfile_name);
+  query.setTimeMin(ix, min_time);
+  query.setTimeMax(ix, max_time);
+  for(unsigned int i=0; i<m_preserve_vars.size(); i++)
+    query.addKeepVar(ix, m_preserve_vars[i]);
+
+  query.run();
+
+  const ALogQueryOutput& out = query.getOutput(ix);
+  m_kept_chars          = out.m_chars_out;
+  m_kept_lines          = out.m_lines_out;
+  m_clipped_chars_front = out.m_chars_early + query.getCharsSkippedFront();
+  m_clipped_lines_front = out.m_lines_early + query.getLinesSkippedFront();
+  m_clipped_chars_back  = out.m_chars_late + query.getCharsSkippedBack();
+  m_clipped_lines_back  = out.m_lines_late + query.getLinesSkippedBack();
+
+  return(m_clipped_lines_front + m_clipped_lines_back);
+}
+
 //--------------------------------------------------------
 // Procedure: getNextLine
 //     Notes: 
@@ -152,8 +208,9 @@ bool ALogClipper::openALogFileRead(string alogfile)
   m_infile = fopen(alogfile.c_str(), "r");
   if(!m_infile)
     return(false);
-  else
-    return(true);
+
+  m_infile_name = alogfile;
+  return(true);
 }
 
 //--------------------------------------------------------
@@ -167,8 +224,9 @@ bool ALogClipper::openALogFileWrite(string alogfile)
   m_outfile = fopen(alogfile.c_str(), "w");
   if(!m_outfile)
     return(false);
-  else
-    return(true);
+
+  m_outfile_name = alogfile;
+  return(true);
 }
 
 
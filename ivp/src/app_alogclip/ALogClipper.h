@@ -37,9 +37,14 @@ class ALogClipper
   bool         openALogFileWrite(std::string filename);
   unsigned int clip(double mintime, double maxtime);
 
+  void setUseIndex(bool v)   {m_use_index=v;}
+  void setCacheIndex(bool v) {m_cache_index=v;}
+
   unsigned int getDetails(const std::string& statevar);
 
  protected:
+  unsigned int clipWithIndex(double mintime, double maxtime);
+
   std::string getNextLine();
   bool        writeNextLine(const std::string& output);
 
@@ -54,6 +59,12 @@ class ALogClipper
   FILE *m_infile;
   FILE *m_outfile;
 
+  std::string m_infile_name;
+  std::string m_outfile_name;
+
+  bool m_use_index;
+  bool m_cache_index;
+
   std::vector<std::string> m_preserve_vars;
 };
 
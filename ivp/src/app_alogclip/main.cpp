@@ -89,6 +89,10 @@ int main(int argc, char *argv[])
       handler.setVerbose();
     else if((argi == "--force") || (argi == "-f") || (argi == "-force"))
       handler.setForceOverwrite();
+    else if((argi == "--index") || (argi == "-index"))
+      handler.setUseIndex();
+    else if((argi == "--cache_index") || (argi == "-cache_index"))
+      handler.setCacheIndex();
     else if(isNumber(argi)) 
       handled = handler.setTimeStamp(atof(argi.c_str()));
     else
@@ -137,6 +141,11 @@ void display_usage()
   cout << "  -b,--batch    Batch clip all given alog files.         " << endl;
   cout << "  --suffix=N    Batch clipped file in.alog to in_N.alog. " << endl;
   cout << "                The default suffix is \"_clipped\".      " << endl;
+  cout << "  --index       Use a time index of the file to skip the " << endl;
+  cout << "                parts outside the time window. Faster on " << endl;
+  cout << "                large files. See note (4).               " << endl;
+  cout << "  --cache_index As --index, and keep the index in the    " << endl;
+  cout << "                file in.alog.tix for later runs.         " << endl;
   cout << "  --web,-w   Open browser to:                            " << endl;
   cout << "             https://oceanai.mit.edu/ivpman/apps/alogclip " << endl;
   cout << "                                                         " << endl;
@@ -147,7 +156,10 @@ void display_usage()
   cout << "      numerical value is treated as the mintime.         " << endl;
   cout << "  (2) Two numerical values, in order, must be given.     " << endl;
   cout << "  (3) Use the --batch option to clip a group of files.   " << endl;
-  cout << "  (4) See also: alogscan, alogrm, aloggrep, alogview     " << endl;
+  cout << "  (4) With --index, comment lines and lines with no     " << endl;
+  cout << "      timestamp are dropped if outside the time window.  " << endl;
+  cout << "      Otherwise comment lines are always kept.           " << endl;
+  cout << "  (5) See also: alogscan, alogrm, aloggrep, alogview     " << endl;
   cout << endl;
 }
 
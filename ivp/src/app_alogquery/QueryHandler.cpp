@@ -0,0 +1,147 @@
+/*****************************************************************/
+/*    FILE: QueryHandler.cpp                                     */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include "MBUtils.h"
+#include "QueryHandler.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor()
+
+QueryHandler::QueryHandler()
+{
+  m_file_overwrite = false;
+}
+
+//--------------------------------------------------------
+// Procedure: setALogFile()
+
+bool QueryHandler::setALogFile(string alogfile)
+{
+  if(!okFileToRead(alogfile))
+    return(false);
+  return(m_query.setALogFile(alogfile));
+}
+
+//--------------------------------------------------------
+// Procedure: addOutputSpec()
+//   Example: "file=nav.alog,vars=NAV_X:NAV_Y,tmin=100,tmax=200"
+//            "vars=DEPLOY:RETURN,srcs=pHelmIvP,cols=time:val"
+//
+//   Fields: file  - output file. If none, output goes to stdout
+//           vars  - colon-separated vars. VAR* or *VAR ok
+//           srcs  - colon-separated sources
+//           keep  - colon-separated vars kept regardless of time
+//           tmin  - lines with earlier timestamps are dropped
+//           tmax  - lines with later timestamps are dropped
+//           cols  - colon-separated columns of time, var, src, val
+//           csep  - column separator, one char. Default is space
+//           nocomments - drop comment lines
+
+bool QueryHandler::addOutputSpec(string spec)
+{
+  unsigned int ix = m_query.addOutput();
+
+  vector<string> svector = parseString(spec, ',');
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string param = tolower(biteStringX(svector[i], '='));
+    string value = svector[i];
+
+    bool handled = false;
+    if((param == "file") && (value != "")) {
+      if(!m_file_overwrite && okFileToRead(value)) {
+	cout << "File " << value << " exists. Use -f to overwrite." << endl;
+	return(false);
+      }
+      handled = m_query.setOutputFile(ix, value);
+      if(handled)
+	m_outfiles.push_back(value);
+    }
+    else if((param == "vars") || (param == "srcs") || (param == "keep")) {
+      vector<string> names = parseString(value, ':');
+      handled = (names.size() > 0);
+      for(unsigned int j=0; j<names.size(); j++) {
+	string name = stripBlankEnds(names[j]);
+	if(param == "vars")
+	  handled = handled && m_query.addVar(ix, name);
+	else if(param == "srcs")
+	  handled = handled && m_query.addSource(ix, name);
+	else
+	  handled = handled && m_query.addKeepVar(ix, name);
+      }
+    }
+    else if((param == "tmin") && isNumber(value))
+      handled = m_query.setTimeMin(ix, atof(value.c_str()));
+    else if((param == "tmax") && isNumber(value))
+      handled = m_query.setTimeMax(ix, atof(value.c_str()));
+    else if(param == "cols")
+      handled = m_query.setColumns(ix, value);
+    else if((param == "csep") && (value.length() == 1))
+      handled = m_query.setColSep(ix, value[0]);
+    else if((param == "nocomments") && (value == ""))
+      handled = m_query.setComments(ix, false);
+
+    if(!handled) {
+      cout << "Bad output spec component: [" << param;
+      if(value != "")
+	cout << "=" << value;
+      cout << "]" << endl;
+      return(false);
+    }
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: handle()
+
+bool QueryHandler::handle()
+{
+  return(m_query.run());
+}
+
+//--------------------------------------------------------
+// Procedure: printReport()
+//      Note: Only outputs to files are reported on, since a
+//            report would otherwise be mixed with the output.
+
+void QueryHandler::printReport()
+{
+  if(m_outfiles.size() == 0)
+    return;
+
+  unsigned long long lines_read = m_query.getLinesRead();
+  unsigned long long lines_skip = (m_query.getLinesSkippedFront() +
+				   m_query.getLinesSkippedBack());
+
+  cout << "  Total lines read:    " << lines_read << endl;
+  cout << "  Total lines skipped: " << lines_skip << endl;
+  for(unsigned int i=0; i<m_query.size(); i++) {
+    const ALogQueryOutput& out = m_query.getOutput(i);
+    if(out.m_filename == "")
+      continue;
+    cout << "  " << out.m_filename << ": " << out.m_lines_out;
+    cout << " lines, " << out.m_chars_out << " chars" << endl;
+  }
+}
@@ -0,0 +1,51 @@
+/*****************************************************************/
+/*    FILE: QueryHandler.h                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_QUERY_HANDLER_HEADER
+#define ALOG_QUERY_HANDLER_HEADER
+
+#include <vector>
+#include <string>
+#include "ALogQuery.h"
+
+class QueryHandler
+{
+ public:
+  QueryHandler();
+  ~QueryHandler() {}
+
+  bool setALogFile(std::string);
+  bool addOutputSpec(std::string);
+  bool handle();
+  void printReport();
+
+  void setFileOverWrite(bool v) {m_file_overwrite=v;}
+  void setUseIndex(bool v)      {m_query.setUseIndex(v);}
+  void setCacheIndex(bool v)    {m_query.setCacheIndex(v);}
+
+ protected:
+  bool m_file_overwrite;
+
+  std::vector<std::string> m_outfiles;
+
+  ALogQuery m_query;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*****************************************************************/
+/*    FILE: main.cpp                                             */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "MBUtils.h"
+#include "ReleaseInfo.h"
+#include "QueryHandler.h"
+
+using namespace std;
+
+void help_message();
+
+//--------------------------------------------------------
+// Procedure: main
+
+int main(int argc, char *argv[])
+{
+  // Look for a request for help information
+  if(scanArgs(argc, argv, "-h", "--help", "-help")) {
+    help_message();
+    return(0);
+  }
+
+  // Look for a request for version information
+  if(scanArgs(argc, argv, "-v", "--version", "-version")) {
+    showReleaseInfo("alogquery", "gpl");
+    return(0);
+  }
+
+  bool verbose = true;
+  if(scanArgs(argc, argv, "-q", "--quiet", "-quiet"))
+    verbose = false;
+
+  QueryHandler handler;
+  if(scanArgs(argc, argv, "-f", "-force", "--force"))
+    handler.setFileOverWrite(true);
+  if(scanArgs(argc, argv, "--noindex", "-noindex"))
+    handler.setUseIndex(false);
+  if(scanArgs(argc, argv, "--cache_index", "-cache_index"))
+    handler.setCacheIndex(true);
+
+  string alogfile_in;
+  unsigned int outputs = 0;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "--out=")) {
+      if(!handler.addOutputSpec(argi.substr(6)))
+	exit(1);
+      outputs++;
+    }
+    else if(strEnds(argi, ".alog") && (alogfile_in == ""))
+      alogfile_in = argi;
+    else if((argi == "-q") || (argi == "--quiet") || (argi == "-quiet") ||
+	    (argi == "-f") || (argi == "--force") || (argi == "-force") ||
+	    (argi == "--noindex") || (argi == "-noindex") ||
+	    (argi == "--cache_index") || (argi == "-cache_index"))
+      continue;
+    else {
+      cout << "Bad argument [" << argi << "] - exiting" << endl;
+      exit(1);
+    }
+  }
+
+  if(alogfile_in == "") {
+    cout << "No alog file given - exiting" << endl;
+    exit(1);
+  }
+  if(outputs == 0) {
+    cout << "No outputs given - exiting" << endl;
+    exit(1);
+  }
+  if(!handler.setALogFile(alogfile_in)) {
+    cout << "Unable to read " << alogfile_in << " - exiting" << endl;
+    exit(1);
+  }
+
+  bool handled = handler.handle();
+  if(handled && verbose)
+    handler.printReport();
+
+  return(handled ? 0 : 1);
+}
+
+//-------------------------------------------------------------
+// Procedure: help_message
+
+void help_message()
+{
+  cout << "Usage: " << endl;
+  cout << "  alogquery in.alog --out=SPEC [--out=SPEC ...] [OPTIONS]   " << endl;
+  cout << "                                                            " << endl;
+  cout << "Synopsis:                                                   " << endl;
+  cout << "  Produce one or more outputs from an alog file in a single " << endl;
+  cout << "  pass. Each output selects lines by variable, source and   " << endl;
+  cout << "  time window, and writes either the whole line or chosen   " << endl;
+  cout << "  columns. Only the part of the file spanned by the output  " << endl;
+  cout << "  time windows is read, using a time index of the file.     " << endl;
+  cout << "                                                            " << endl;
+  cout << "Output SPEC (comma-separated fields, all optional):         " << endl;
+  cout << "  file=out.alog   Output file. Otherwise stdout             " << endl;
+  cout << "  vars=VAR:VAR    Variables to keep. VAR* or *VAR ok        " << endl;
+  cout << "  srcs=SRC:SRC    Sources to keep                           " << endl;
+  cout << "  keep=VAR:VAR    Variables kept regardless of time         " << endl;
+  cout << "  tmin=N          Drop lines with timestamps below N        " << endl;
+  cout << "  tmax=N          Drop lines with timestamps above N        " << endl;
+  cout << "  cols=COL:COL    Columns to write, from time,var,src,val   " << endl;
+  cout << "  csep=C          Column separator. Default is space        " << endl;
+  cout << "  nocomments      Drop comment lines                        " << endl;
+  cout << "                                                            " << endl;
+  cout << "Options:                                                    " << endl;
+  cout << "  -h,--help     Displays this help message                  " << endl;
+  cout << "  -v,--version  Displays the current release version        " << endl;
+  cout << "  -f,--force    Force overwrite of existing files           " << endl;
+  cout << "  -q,--quiet    Verbose report suppressed at conclusion     " << endl;
+  cout << "  --noindex     Read the whole file, with no time index     " << endl;
+  cout << "  --cache_index Keep the time index in in.alog.tix for      " << endl;
+  cout << "                later runs, and use it if already there     " << endl;
+  cout << "                                                            " << endl;
+  cout << "Examples:                                                   " << endl;
+  cout << "  alogquery in.alog --out=vars=NAV_X:NAV_Y,cols=time:val    " << endl;
+  cout << "  alogquery in.alog --out=file=a.alog,tmin=100,tmax=200     " << endl;
+  cout << "                    --out=file=b.alog,srcs=pHelmIvP         " << endl;
+  cout << "                                                            " << endl;
+  cout << "Further Notes:                                              " << endl;
+  cout << "  (1) Lines with no timestamp are dropped from outputs with " << endl;
+  cout << "      a time window.                                        " << endl;
+  cout << "  (2) See also: aloggrep, alogclip, alogpick, alogscan      " << endl;
+  cout << endl;
+}
@@ -24,8 +24,8 @@
 #include <iostream>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include "MBUtils.h"
-#include "ALogScanner.h"
 #include "ScanHandler.h"
 #include "ColorParse.h"
 
@@ -65,6 +65,8 @@ bool ScanHandler::setParam(const string& param, const string& value)
     handled = setBooleanOnString(m_use_colors, value);
   else if(param == "use_full_source")
     handled = setBooleanOnString(m_use_full_source, value);
+  else if((param == "threads") && isNumber(value) && (atoi(value.c_str()) >= 0))
+    m_stats.setThreads((unsigned int)(atoi(value.c_str())));
   else
     handled = false;
 
@@ -104,21 +106,49 @@ string ScanHandler::procColor(string proc_name)
 
 bool ScanHandler::handle(const string& alogfile, bool rate_only)
 {
-  ALogScanner scanner;
+  vector<string> alogfiles(1, alogfile);
+  return(handle(alogfiles, rate_only));
+}
 
-  scanner.setUseFullSource(m_use_full_source);
-  
-  bool ok = scanner.openALogFile(alogfile);
-  if(!ok) {
-    cout << "Unable to find or open " << alogfile << " - Exiting." << endl;
-    return(false);
+//--------------------------------------------------------
+// Procedure: handle()
+//      Note: Each file is scanned in parallel chunks and the stats
+//            of all files are merged, in the order given, as though
+//            they were one log.
+
+bool ScanHandler::handle(const vector<string>& alogfiles, bool rate_only)
+{
+  // The data rate has always been on chars without helm aux info
+  m_stats.setUseFullSource(m_use_full_source && !rate_only);
+
+  for(unsigned int i=0; i<alogfiles.size(); i++) {
+    cout << "Scanning " << alogfiles[i] << "... " << flush;
+    unsigned long long raw_lines = m_stats.getRawLines();
+    if(!m_stats.scanFile(alogfiles[i])) {
+      cout << "Unable to find or open " << alogfiles[i];
+      cout << " - Exiting." << endl;
+      return(false);
+    }
+    if(rate_only)
+      continue;
+
+    // The count has always included the final read at end of file
+    raw_lines = m_stats.getRawLines() - raw_lines + 1;
+    cout << endl;
+    cout << termColor("blue");
+    cout << "  Lines Read: " << uintToCommaString(raw_lines) << endl;
+    cout << termColor();
   }
 
-  cout << "Scanning " << alogfile << "... " << flush;
-  if(rate_only)
-    m_report = scanner.scanRateOnly();
-  else
-    m_report = scanner.scan();
+  m_report = ScanReport();
+  for(unsigned int i=0; i<m_stats.size(); i++) {
+    const ALogVarStats& vstats = m_stats.getVarStats(i);
+    m_report.addVarSummary(vstats.m_varname, vstats.getSources(),
+			   vstats.m_first, vstats.m_last,
+			   vstats.m_tmin, vstats.m_tmax,
+			   (unsigned int)(vstats.m_lines),
+			   (unsigned int)(vstats.m_chars));
+  }
 
   if(!rate_only && (m_report.size() == 0)) {
     cout << "Empty log file - exiting." << endl;
@@ -226,6 +256,56 @@ void ScanHandler::varStatReport()
 
 }
 
+//--------------------------------------------------------
+// Procedure: numStatReport()
+//      Note: One line per variable with numeric values, in the same
+//            order as the var stat report. Quantiles are estimates,
+//            within about 1% of the true value.
+
+void ScanHandler::numStatReport()
+{
+  unsigned int max_vlen = 13;
+  vector<unsigned int> ixs;
+  for(unsigned int i=0; i<m_report.size(); i++) {
+    string varname = m_report.getVarName(i);
+    int ix = m_stats.getVarIndex(varname);
+    if((ix < 0) || (m_stats.getVarStats(ix).m_num_count == 0))
+      continue;
+    ixs.push_back((unsigned int)(ix));
+    if(varname.length() > max_vlen)
+      max_vlen = varname.length();
+  }
+  if(ixs.size() == 0)
+    return;
+
+  string svname_digits = uintToString(max_vlen);
+  string hformat_string = "%-" + svname_digits + "s %10s %12s %12s %12s";
+  hformat_string += " %12s %12s %12s %5s\n";
+  string bformat_string = "%-" + svname_digits + "s %10llu %12s %12s %12s";
+  bformat_string += " %12s %12s %12s %5u\n";
+
+  printf("\n\n\n");
+  printf(hformat_string.c_str(), "Variable Name", "Count", "Min", "Max",
+	 "Mean", "P50", "P90", "P99", "Srcs");
+  printf(hformat_string.c_str(), "-------------", "-----", "---", "---",
+	 "----", "---", "---", "---", "----");
+
+  for(unsigned int i=0; i<ixs.size(); i++) {
+    const ALogVarStats& vstats = m_stats.getVarStats(ixs[i]);
+    double mean = vstats.m_num_sum / (double)(vstats.m_num_count);
+
+    printf(bformat_string.c_str(), vstats.m_varname.c_str(),
+	   vstats.m_num_count,
+	   doubleToStringX(vstats.m_num_min, 4).c_str(),
+	   doubleToStringX(vstats.m_num_max, 4).c_str(),
+	   doubleToStringX(mean, 4).c_str(),
+	   doubleToStringX(vstats.m_num_sketch.quantile(0.5), 4).c_str(),
+	   doubleToStringX(vstats.m_num_sketch.quantile(0.9), 4).c_str(),
+	   doubleToStringX(vstats.m_num_sketch.quantile(0.99), 4).c_str(),
+	   vstats.getSourceCount());
+  }
+}
+
 //--------------------------------------------------------
 // Procedure: dataRateReport
 
@@ -24,7 +24,9 @@
 #ifndef SCAN_HANDLER_HEADER
 #define SCAN_HANDLER_HEADER
 
+#include <vector>
 #include "ScanReport.h"
+#include "ALogStats.h"
 
 class ScanHandler
 {
@@ -34,8 +36,11 @@ class ScanHandler
 
   bool setParam(const std::string&, const std::string&);
   bool handle(const std::string& alogfile, bool rate_only=false);
+  bool handle(const std::vector<std::string>& alogfiles,
+	      bool rate_only=false);
 
   void varStatReport();
+  void numStatReport();
   void appStatReport();
   void dataRateReport();
   void loglistReport();
@@ -47,6 +52,7 @@ class ScanHandler
   std::string m_sort_style;
 
   ScanReport  m_report;
+  ALogStats   m_stats;
   bool        m_use_colors;
   bool        m_use_full_source;
   
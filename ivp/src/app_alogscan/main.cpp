@@ -48,14 +48,15 @@ int main(int argc, char *argv[])
   // Look for a request for usage information
   if(scanArgs(argc, argv, "-h", "--help", "-help")) {
     cout << "Usage:                                               " << endl;
-    cout << "  alogscan file.alog [OPTIONS]                       " << endl;
+    cout << "  alogscan file.alog [file.alog ...] [OPTIONS]       " << endl;
     cout << "                                                     " << endl;
     cout << "Synopsis:                                            " << endl;
     cout << "  Generate a summary report on contents of a given   " << endl;
     cout << "  .alog file. The report lists each logged MOOS      " << endl;
     cout << "  variable, which app(s) publish it, min/max publish " << endl;
     cout << "  time and total number of character and lines for   " << endl;
-    cout << "  the variable.                                      " << endl;
+    cout << "  the variable. Stats of several files are merged as " << endl;
+    cout << "  though the files were one log.                     " << endl;
     cout << "                                                     " << endl;
     cout << "Options:                                             " << endl;
     cout << "  --sort=type   Sort by one of SIX criteria:         " << endl;
@@ -67,6 +68,10 @@ int main(int argc, char *argv[])
     cout << "                lines: sort by total lines for a var " << endl;
     cout << "                                                     " << endl;
     cout << "  --appstat     Output application statistics        " << endl;
+    cout << "  --numstats    Output min/max/mean/quantiles of     " << endl;
+    cout << "                variables with numerical values      " << endl;
+    cout << "  --threads=N   Scan with N threads. Default is one  " << endl;
+    cout << "                per core, for large enough files     " << endl;
     cout << "  -l,--loglist  Output list of all logged vars       " << endl;
     cout << "  -r,--reverse  Reverse the sorting output           " << endl;
     cout << "  -n,--nocolors Turn off process/source color coding " << endl;
@@ -87,10 +92,12 @@ int main(int argc, char *argv[])
   bool   reverse_requested  = false;
   bool   app_stat_requested = false;
   bool   loglist_requested  = false;
+  bool   num_stat_requested = false;
   string proc_colors        = "true";
   string sort_style         = "bysrc_ascending";
+  string threads            = "0";
 
-  string alogfile = "";
+  vector<string> alogfiles;
   for(int i=1; i<argc; i++) {
     string orig = argv[i];
     string sarg = tolower(argv[i]);
@@ -103,7 +110,7 @@ int main(int argc, char *argv[])
     //cout << "sarg:[" << sarg << "]" << endl;
 
     if(strContains(sarg, ".alog"))
-      alogfile = orig;
+      alogfiles.push_back(orig);
     else if((sarg == "-c") || (sarg == "--chars") || (sort == "chars"))
       sort_style = "bychars_ascending";
     else if((sarg == "-l") || (sarg == "--lines") || (sort == "lines"))
@@ -118,6 +125,10 @@ int main(int argc, char *argv[])
       sort_style = "bysrc_ascending";
     else if(sarg == "--appstat")
       app_stat_requested = true;
+    else if(sarg == "--numstats")
+      num_stat_requested = true;
+    else if(strBegins(sarg, "--threads="))
+      threads = sarg.substr(10);
     else if(sarg == "--rate_only")
       data_rate_only = true;
     else if(sarg == "--noaux")
@@ -145,7 +156,7 @@ int main(int argc, char *argv[])
       sort_style = "bysrc_descending";
   }
 
-  if(alogfile == "") {
+  if(alogfiles.size() == 0) {
     cout << "No alog file given - exiting" << endl;
     exit(1);
   }
@@ -156,8 +167,12 @@ int main(int argc, char *argv[])
   ok = ok && handler.setParam("proc_colors", proc_colors);
   ok = ok && handler.setParam("use_full_source",
 			      boolToString(use_full_source));
+  if(!handler.setParam("threads", threads)) {
+    cout << "Bad --threads value [" << threads << "] - exiting" << endl;
+    exit(1);
+  }
 
-  ok = ok && handler.handle(alogfile, data_rate_only);
+  ok = ok && handler.handle(alogfiles, data_rate_only);
 
   if(!ok)
     return(1);
@@ -166,6 +181,8 @@ int main(int argc, char *argv[])
     handler.varStatReport();  
   if(app_stat_requested && !data_rate_only)
     handler.appStatReport();
+  if(num_stat_requested && !data_rate_only)
+    handler.numStatReport();
   handler.dataRateReport();
   if(loglist_requested) 
     handler.loglistReport();
@@ -148,7 +148,7 @@ void LogPlotViewer::setLeftPlot(unsigned int mix)
     return;
   }
 
-  m_logplot1 = m_dbroker.getLogPlot(mix); 
+  m_logplot1 = m_dbroker.getPagedLogPlot(mix); 
 
   string vname = m_dbroker.getVNameFromMix(mix);
   string varname = m_dbroker.getVarNameFromMix(mix);
@@ -176,7 +176,7 @@ void LogPlotViewer::setRightPlot(unsigned int mix)
   if((mix == m_right_mix) || (mix >= m_dbroker.sizeMix()))
     return;
 
-  m_logplot2 = m_dbroker.getLogPlot(mix);
+  m_logplot2 = m_dbroker.getPagedLogPlot(mix);
   string vname = m_dbroker.getVNameFromMix(mix);
   string varname = m_dbroker.getVarNameFromMix(mix);
   m_fullvar2 = vname + "/" + varname;
@@ -400,73 +400,42 @@ bool LogPlotViewer::fillCache()
   double max_val2 = getMaxVal2();
 
   // Part 2: Handle the Left LogPlot (LogPlot1)
-  unsigned int vpsize1 = m_logplot1.size();
-  double h_step1  = (h()-m_margin-m_bot_marg) / (max_val1  - min_val1);
-
-  bool excepted_right = false;
-  for(unsigned int i=0; i<vpsize1; i++) {
-    double rawt = m_logplot1.getTimeByIndex(i);
-    bool add_to_cache = false;
-    if((rawt >= m_display_min_time) && (rawt <= m_display_max_time))
-      add_to_cache = true;
-    else if(rawt <= m_display_min_time) {
-      cache_x1.clear();
-      cache_y1.clear();
-      add_to_cache = true;
-    }
-    else if(!excepted_right) {
-      add_to_cache = true;
-      excepted_right = true;
-    }
+  fillCache(m_logplot1, min_val1, max_val1, cache_x1, cache_y1);
 
-    if(add_to_cache) {
-      double rawv = m_logplot1.getValueByIndex(i);
-      double scalet = ((rawt - m_display_min_time)  * m_step) + (m_margin/2.0); 
-      scalet += m_lft_marg;
-      double scalev = ((rawv - min_val1 ) * h_step1) + (m_margin/2.0);
-      scalev += m_bot_marg;
-      if((scalet >= m_lft_marg) && (scalet <= w()-m_rgt_marg)) {
-	cache_x1.push_back(scalet);
-	cache_y1.push_back(scalev);
-      }
-    }
-  }
+  // Part 3: Handle the Right LogPlot (LogPlot2)
+  fillCache(m_logplot2, min_val2, max_val2, cache_x2, cache_y2);
 
+  return(true);
+}
 
-  // Part 3: Handle the Right LogPlot (LogPlot2)
-  unsigned int vpsize2 = m_logplot2.size();
-  double h_step2 = (h()-m_margin-m_bot_marg) / (max_val2  - min_val2);
-  
-  excepted_right = false;
-  for(unsigned int j=0; j<vpsize2; j++) {      
-    double rawt = m_logplot2.getTimeByIndex(j);
-    bool add_to_cache = false;
-    if((rawt >= m_display_min_time) && (rawt <= m_display_max_time))
-      add_to_cache = true;
-    else if(rawt <= m_display_min_time) {
-      cache_x2.clear();
-      cache_y2.clear();
-      add_to_cache = true;
-    }
-    else if(!excepted_right) {
-      add_to_cache = true;
-      excepted_right = true;
-    }
-    
-    if(add_to_cache) {
-      double rawv = m_logplot2.getValueByIndex(j);
-      double scalet = ((rawt - m_display_min_time)  * m_step) + (m_margin/2.0); 
-      scalet += m_lft_marg;
-      double scalev = ((rawv - min_val2 ) * h_step2) + (m_margin/2.0);
-      scalev += m_bot_marg;
-      if((scalet >= m_lft_marg) && (scalet <= w()-m_rgt_marg)) {
-	cache_x2.push_back(scalet);
-	cache_y2.push_back(scalev);
-      }
+//-------------------------------------------------------------
+// Procedure: fillCache
+//      Note: Only points within the display window are fetched from
+//            the plot. When zoomed out so far that there are more
+//            points than pixels, the plot gives a min/max pair per
+//            group of points instead.
+
+void LogPlotViewer::fillCache(const PagedLogPlot& logplot, double min_val,
+			      double max_val, vector<double>& cache_x,
+			      vector<double>& cache_y)
+{
+  double h_step = (h()-m_margin-m_bot_marg) / (max_val - min_val);
+
+  unsigned int max_points = 2 * w();
+  vector<double> times, vals;
+  logplot.getPoints(m_display_min_time, m_display_max_time, max_points,
+		    times, vals);
+
+  for(unsigned int i=0; i<times.size(); i++) {
+    double scalet = ((times[i] - m_display_min_time) * m_step) + (m_margin/2.0);
+    scalet += m_lft_marg;
+    double scalev = ((vals[i] - min_val) * h_step) + (m_margin/2.0);
+    scalev += m_bot_marg;
+    if((scalet >= m_lft_marg) && (scalet <= w()-m_rgt_marg)) {
+      cache_x.push_back(scalet);
+      cache_y.push_back(scalev);
     }
   }
-
-  return(true);
 }
 
 //-------------------------------------------------------------
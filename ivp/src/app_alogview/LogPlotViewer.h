@@ -28,7 +28,7 @@
 #include <string>
 #include "FL/Fl_Gl_Window.H"
 #include "ALogDataBroker.h"
-#include "LogPlot.h"
+#include "PagedLogPlot.h"
 
 class LogPlotViewer : public Fl_Gl_Window
 {
@@ -75,6 +75,8 @@ class LogPlotViewer : public Fl_Gl_Window
  protected:
   void  handleLeftMouse(int, int);
   bool  fillCache();
+  void  fillCache(const PagedLogPlot&, double min_val, double max_val,
+		  std::vector<double>& cache_x, std::vector<double>& cache_y);
   void  adjustTimeBounds();
   void  drawLogPlot();
   void  drawTimeText();
@@ -86,8 +88,8 @@ class LogPlotViewer : public Fl_Gl_Window
  protected:
   ALogDataBroker m_dbroker;
 
-  LogPlot m_logplot1;
-  LogPlot m_logplot2;
+  PagedLogPlot m_logplot1;
+  PagedLogPlot m_logplot2;
   
   bool m_show_left_logplot;
   bool m_show_right_logplot;
@@ -169,6 +169,8 @@ bool LogViewLauncher::handleConfigParam(string argi)
     handled = true; // handled separately
   else if(strBegins(argi, "--max_fptrs=")) 
     handled = handleMaxFilePtrs(argi.substr(12));
+  else if(strBegins(argi, "--plot_mem=")) 
+    handled = handlePlotMemory(argi.substr(11));
   else if(strBegins(argi, "--vqual=")) 
     handled = handleVQual(argi.substr(8));
   else if(strBegins(argi, "--bg="))
@@ -673,6 +675,28 @@ bool LogViewLauncher::handleMaxFilePtrs(string val)
   return(true);
 }
  
+//-------------------------------------------------------------
+// Procedure: handlePlotMemory()    --plot_mem=64
+// 
+// Note: This sets the memory budget, in megabytes, for the points of
+//       log plots. Points are read from the split klog files in pages
+//       as needed, and the least recently used pages are dropped when
+//       over budget.
+
+bool LogViewLauncher::handlePlotMemory(string val)
+{
+  if(!isNumber(val))
+    return(false);
+
+  int megabytes = atoi(val.c_str());
+  if(megabytes < 1)
+    megabytes = 1;
+
+  m_dbroker.setPlotMemory((unsigned int)(megabytes));
+  
+  return(true);
+}
+ 
 //-------------------------------------------------------------
 // Procedure: handleVQual()    --vqual=MED/low/high/max
 // 
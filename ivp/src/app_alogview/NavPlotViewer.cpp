@@ -603,13 +603,12 @@ void NavPlotViewer::drawVPlugPlot(unsigned int index)
   if(index >= m_vplug_plot.size())
     return;
   
-  VPlug_GeoShapes geo_shapes;
-  geo_shapes = m_vplug_plot[index].getVPlugByTime(m_curr_time);
+  const VPlug_GeoShapes& geo_shapes =
+    m_vplug_plot[index].getVPlugByTime(m_curr_time);
 
-  vector<XYPolygon>    polys   = geo_shapes.getPolygons();
-  vector<XYGrid>       grids   = geo_shapes.getGrids();
-  vector<XYRangePulse> rpulses = geo_shapes.getRangePulses();
-  vector<XYCommsPulse> cpulses = geo_shapes.getCommsPulses();
+  const vector<XYGrid>&       grids   = geo_shapes.getGrids();
+  const vector<XYRangePulse>& rpulses = geo_shapes.getRangePulses();
+  const vector<XYCommsPulse>& cpulses = geo_shapes.getCommsPulses();
   const map<string, XYSegList>&  segls = geo_shapes.getSegLists();
   const map<string, XYSeglr>&  seglrs = geo_shapes.getSeglrs();
   const map<string, XYPoint>&  points  = geo_shapes.getPoints();
@@ -620,7 +619,7 @@ void NavPlotViewer::drawVPlugPlot(unsigned int index)
   double global_logstart = m_dbroker.getGlobalLogStart();
   double utc_timestamp = global_logstart + m_curr_time;
 
-  drawPolygons(polys,  utc_timestamp);
+  drawPolygons(geo_shapes, "vplug_" + uintToString(index), utc_timestamp);
   drawSegLists(segls,  utc_timestamp);
   drawCircles(circles, utc_timestamp);
   drawPoints(points,   utc_timestamp);
@@ -150,6 +150,8 @@ void help_message()
   cout << "  --geometry=large   Open GUI with dimensions 1400x1100       " << endl;
   cout << "  --geometry=WxH     Open GUI with dimensions WxH             " << endl;
   cout << "                                                              " << endl;
+  cout << "  --plot_mem=MB   Memory budget for log plot data (default 64)" << endl;
+  cout << "                                                              " << endl;
   cout << "  --detached=var          Detached var for plotting           " << endl;
   cout << "  --detached=var:key      Detached var for plotting           " << endl;
   cout << "                                                              " << endl;
@@ -0,0 +1,149 @@
+/*****************************************************************/
+/*    FILE: main.cpp (batchsim)                                  */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "MBUtils.h"
+#include "ReleaseInfo.h"
+#include "BatchSim.h"
+
+using namespace std;
+
+void showHelpAndExit();
+
+//--------------------------------------------------------
+// Procedure: main
+
+int main(int argc, char *argv[])
+{
+  BatchSim batch_sim;
+  bool quiet = false;
+
+  bool handled = true;
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if((argi=="-h") || (argi == "--help") || (argi=="-help"))
+      showHelpAndExit();
+    else if((argi=="-v") || (argi=="--version") || (argi=="-version")) {
+      showReleaseInfo("batchsim", "gpl");
+      return(0);
+    }
+    else if(strEnds(argi, ".moos"))
+      handled = batch_sim.addMissionFile(argi);
+    else if(strBegins(argi, "--dt="))
+      handled = batch_sim.setStepSize(argi.substr(5));
+    else if(strBegins(argi, "--duration="))
+      handled = batch_sim.setDuration(argi.substr(11));
+    else if(strBegins(argi, "--start_time="))
+      handled = batch_sim.setStartTime(argi.substr(13));
+    else if(strBegins(argi, "--threads=") || strBegins(argi, "-j=")) {
+      string str = argi;
+      handled = batch_sim.setThreads(rbiteString(str, '='));
+    }
+    else if(strBegins(argi, "--path="))
+      batch_sim.setLogDir(argi.substr(7));
+    else if(strBegins(argi, "--poke="))
+      handled = batch_sim.addPoke(argi.substr(7));
+    else if(argi == "--deploy") {
+      batch_sim.addPoke("DEPLOY=true");
+      batch_sim.addPoke("MOOS_MANUAL_OVERRIDE=false");
+    }
+    else if(argi == "--fleet")
+      batch_sim.setFleetMode(true);
+    else if(argi == "--verbose")
+      batch_sim.setVerbose(true);
+    else if(argi == "--quiet")
+      quiet = true;
+    else
+      handled = false;
+
+    if(!handled) {
+      cout << "Unhandled command line argument: " << argi << endl;
+      cout << "Use --help for usage. Exiting.   " << endl;
+      exit(1);
+    }
+  }
+
+  bool ok = batch_sim.initialize();
+  vector<string> warnings = batch_sim.getWarnings();
+  for(unsigned int i=0; i<warnings.size(); i++)
+    cout << "Warning: " << warnings[i] << endl;
+  if(!ok) {
+    cout << "Unable to initialize. Exiting." << endl;
+    exit(1);
+  }
+
+  batch_sim.run();
+  if(!quiet)
+    batch_sim.printReport();
+  return(0);
+}
+
+
+//------------------------------------------------------------
+// Procedure: showHelpAndExit()
+
+void showHelpAndExit()
+{
+  cout << "Usage: " << endl;
+  cout << "  batchsim file.moos [file.moos ...] [OPTIONS]           " << endl;
+  cout << "                                                         " << endl;
+  cout << "Synopsis:                                                " << endl;
+  cout << "  Run one or more vehicles in a single process with no   " << endl;
+  cout << "  MOOSDB. Each .moos file is a vehicle mission file, as  " << endl;
+  cout << "  produced by nsplug for a normal launch. The pHelmIvP,  " << endl;
+  cout << "  uSimMarine, pMarinePID and pNodeReporter blocks are    " << endl;
+  cout << "  read and the helm, PID and simulator of each vehicle   " << endl;
+  cout << "  are stepped in lockstep, faster than real time. Node   " << endl;
+  cout << "  reports and node messages are passed between vehicles  " << endl;
+  cout << "  in memory. An alog file is written for each vehicle.   " << endl;
+  cout << "  Run from the mission directory so behavior files are   " << endl;
+  cout << "  found as they would be by pHelmIvP.                    " << endl;
+  cout << "                                                         " << endl;
+  cout << "Options:                                                 " << endl;
+  cout << "  -h,--help         Displays this help message           " << endl;
+  cout << "  -v,--version      Display current release version      " << endl;
+  cout << "  --dt=<secs>       Base time step (default 0.05)        " << endl;
+  cout << "  --duration=<secs> Simulated duration (default 600)     " << endl;
+  cout << "  --start_time=<t>  UTC start time. Set for repeatable   " << endl;
+  cout << "                    runs (default is the wall clock)     " << endl;
+  cout << "  --threads=<N>     Step vehicles on N threads (def 1)   " << endl;
+  cout << "  --path=<dir>      Directory for alog files (default .) " << endl;
+  cout << "  --poke=VAR=VAL    Post VAR=VAL to all vehicles at start" << endl;
+  cout << "  --deploy          Same as --poke=DEPLOY=true           " << endl;
+  cout << "                    --poke=MOOS_MANUAL_OVERRIDE=false    " << endl;
+  cout << "  --fleet           Propagate all simulators together as " << endl;
+  cout << "                    one fleet. Same results, scales to   " << endl;
+  cout << "                    hundreds of vehicles                 " << endl;
+  cout << "  --verbose         Show progress                        " << endl;
+  cout << "  --quiet           No summary at the end                " << endl;
+  cout << "                                                         " << endl;
+  cout << "Examples:                                                " << endl;
+  cout << "  batchsim targ_abe.moos targ_ben.moos --deploy          " << endl;
+  cout << "           --duration=1200 --start_time=1000000          " << endl;
+  cout << "                                                         " << endl;
+  cout << "Further Notes:                                           " << endl;
+  cout << "  (1) Component rates come from the AppTick of each app  " << endl;
+  cout << "      block, rounded to a multiple of the base step.     " << endl;
+  cout << "  (2) Output is the same for any number of threads.      " << endl;
+  cout << endl;
+  exit(0);
+}
@@ -47,10 +47,14 @@ AppCastRepo::AppCastRepo(bool strip_color)
 
 bool AppCastRepo::addAppCast(const string& appcast_str)
 {
-  string str = appcast_str;
+  // Deltas are expanded against the prior appcast of the same app.
+  // A delta that cannot be expanded is dropped.
+  string str;
+  if(!m_delta_cache.resolve(appcast_str, str))
+    return(false);
 
   if(m_strip_color) {
-    str = findReplace(appcast_str, "\33[7;32m", "");
+    str = findReplace(str, "\33[7;32m", "");
     str = findReplace(str, "\33[7;31m", "");
     str = findReplace(str, "\33[0m", "");
   }
@@ -27,6 +27,7 @@
 #include <string>
 #include <map>
 #include "AppCastTree.h"
+#include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastDelta.h"
 
 class AppCastRepo
 {
@@ -68,6 +69,8 @@ class AppCastRepo
 
   std::map<std::string, std::string> m_map_node_proc;
 
+  AppCastDeltaCache m_delta_cache;
+
   bool m_strip_color;
 };
 
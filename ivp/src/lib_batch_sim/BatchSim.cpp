@@ -0,0 +1,385 @@
+/*****************************************************************/
+/*    FILE: BatchSim.cpp                                         */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include "BatchSim.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+using namespace std;
+
+//--------------------------------------------------------------------
+// Procedure: Constructor
+
+BatchSim::BatchSim()
+{
+  m_step_size  = 0.05;
+  m_duration   = 600;
+  m_start_time = 0;
+  m_threads    = 1;
+  m_verbose    = false;
+  m_fleet_mode = false;
+
+  m_curr_time    = 0;
+  m_steps        = 0;
+  m_elapsed_wall = 0;
+
+  m_generation = 0;
+  m_pending    = 0;
+  m_quit       = false;
+}
+
+//--------------------------------------------------------------------
+// Procedure: Destructor
+
+BatchSim::~BatchSim()
+{
+  if(m_workers.size() > 0) {
+    {
+      lock_guard<mutex> lock(m_mutex);
+      m_quit = true;
+    }
+    m_start_cv.notify_all();
+    for(unsigned int i=0; i<m_workers.size(); i++)
+      m_workers[i].join();
+  }
+
+  for(unsigned int i=0; i<m_vehicles.size(); i++)
+    delete(m_vehicles[i]);
+}
+
+//--------------------------------------------------------------------
+// Procedure: addMissionFile()
+
+bool BatchSim::addMissionFile(string filename)
+{
+  if(vectorContains(m_mission_files, filename))
+    return(false);
+  m_mission_files.push_back(filename);
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: addPoke()
+//   Example: DEPLOY=true
+
+bool BatchSim::addPoke(string str)
+{
+  if(!strContains(str, '='))
+    return(false);
+  m_pokes.push_back(str);
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: setStepSize()
+
+bool BatchSim::setStepSize(string str)
+{
+  return(setPosDoubleOnString(m_step_size, str));
+}
+
+//--------------------------------------------------------------------
+// Procedure: setDuration()
+
+bool BatchSim::setDuration(string str)
+{
+  return(setPosDoubleOnString(m_duration, str));
+}
+
+//--------------------------------------------------------------------
+// Procedure: setStartTime()
+//      Note: A fixed start time makes runs repeatable. Otherwise the
+//            current wall time is used.
+
+bool BatchSim::setStartTime(string str)
+{
+  return(setPosDoubleOnString(m_start_time, str));
+}
+
+//--------------------------------------------------------------------
+// Procedure: setThreads()
+
+bool BatchSim::setThreads(string str)
+{
+  int ival = atoi(str.c_str());
+  if(!isNumber(str) || (ival < 1))
+    return(false);
+  m_threads = (unsigned int)(ival);
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: initialize()
+
+bool BatchSim::initialize()
+{
+  if(m_mission_files.size() == 0) {
+    m_warnings.push_back("No mission files given");
+    return(false);
+  }
+
+  if(m_start_time == 0)
+    m_start_time = floor(MOOSTime());
+  m_curr_time = m_start_time;
+
+  if((m_log_dir != "") && (m_log_dir != ".")) {
+    string cmd = "mkdir -p " + m_log_dir;
+    int result = system(cmd.c_str());
+    if(result != 0)
+      m_warnings.push_back("Possible err creating dir: " + m_log_dir);
+  }
+
+  bool all_ok = true;
+  for(unsigned int i=0; i<m_mission_files.size(); i++) {
+    BatchVehicle *vehicle = new BatchVehicle;
+    m_vehicles.push_back(vehicle);
+
+    bool ok = vehicle->configure(m_mission_files[i]);
+    for(unsigned int j=0; j<m_pokes.size(); j++) {
+      string val = m_pokes[j];
+      string var = biteStringX(val, '=');
+      vehicle->addPoke(var, val);
+    }
+    ok = ok && vehicle->initialize(m_start_time, m_step_size, m_log_dir);
+
+    vector<string> warnings = vehicle->getWarnings();
+    m_warnings.insert(m_warnings.end(), warnings.begin(), warnings.end());
+    all_ok = all_ok && ok;
+  }
+
+  for(unsigned int i=0; i<m_vehicles.size(); i++) {
+    for(unsigned int j=i+1; j<m_vehicles.size(); j++) {
+      if(m_vehicles[i]->getName() == m_vehicles[j]->getName()) {
+	m_warnings.push_back("Duplicate vehicle: " + m_vehicles[i]->getName());
+	all_ok = false;
+      }
+    }
+  }
+
+  if(all_ok && m_fleet_mode) {
+    for(unsigned int i=0; i<m_vehicles.size(); i++) {
+      if(!m_vehicles[i]->joinFleet(m_fleet))
+	m_warnings.push_back(m_vehicles[i]->getName() +
+			     ": sim mode not supported by fleet, stepped alone");
+    }
+  }
+
+  if(m_threads > m_vehicles.size())
+    m_threads = m_vehicles.size();
+  if(all_ok && (m_threads > 1)) {
+    for(unsigned int i=0; i<m_threads; i++)
+      m_workers.push_back(thread(&BatchSim::workerLoop, this, i));
+  }
+
+  return(all_ok);
+}
+
+//--------------------------------------------------------------------
+// Procedure: run()
+
+void BatchSim::run()
+{
+  MBTimer timer;
+  timer.start();
+
+  unsigned long total_steps = (unsigned long)(ceil(m_duration / m_step_size));
+  unsigned long progress_steps = (unsigned long)(ceil(60 / m_step_size));
+
+  for(m_steps=0; m_steps<total_steps; m_steps++) {
+    // Computed rather than accumulated so long runs don't drift
+    m_curr_time = m_start_time + (m_steps * m_step_size);
+
+    exchangeMail();
+    stepFleet();
+    stepAll();
+
+    if(m_verbose && ((m_steps % progress_steps) == 0)) {
+      double sim_elapsed = m_curr_time - m_start_time;
+      cout << "  sim time: " << doubleToString(sim_elapsed, 0) << endl;
+    }
+  }
+
+  for(unsigned int i=0; i<m_vehicles.size(); i++)
+    m_vehicles[i]->closeLog();
+
+  timer.stop();
+  m_elapsed_wall = timer.get_float_wall_time();
+}
+
+//--------------------------------------------------------------------
+// Procedure: exchangeMail()
+//   Purpose: Pass node reports and node messages posted on the last
+//            step to the other vehicles. Done between steps, by one
+//            thread, in a fixed order.
+
+void BatchSim::exchangeMail()
+{
+  unsigned int i, j, vsize = m_vehicles.size();
+  for(i=0; i<vsize; i++) {
+    string report = m_vehicles[i]->getNodeReport();
+    if(report != "") {
+      VarDataPair pair("NODE_REPORT", report);
+      for(j=0; j<vsize; j++) {
+	if(j != i)
+	  m_vehicles[j]->deliverMail(pair);
+      }
+      m_vehicles[i]->clearNodeReport();
+    }
+
+    vector<NodeMessage> messages = m_vehicles[i]->getNodeMessages();
+    for(unsigned int k=0; k<messages.size(); k++) {
+      string dest_node  = tolower(messages[k].getDestNode());
+      string dest_group = tolower(messages[k].getDestGroup());
+      string var        = messages[k].getVarName();
+      string sval       = messages[k].getStringVal();
+
+      VarDataPair pair(var, sval);
+      if(sval == "")
+	pair = VarDataPair(var, messages[k].getDoubleVal());
+
+      for(j=0; j<vsize; j++) {
+	if(j == i)
+	  continue;
+	string vname = tolower(m_vehicles[j]->getName());
+	string group = tolower(m_vehicles[j]->getGroup());
+	bool node_ok  = ((dest_node == "all") || (dest_node == vname));
+	bool group_ok = ((dest_group == "all") || (dest_group == group));
+	if(((dest_node != "") && node_ok) || ((dest_group != "") && group_ok))
+	  m_vehicles[j]->deliverMail(pair);
+      }
+    }
+    m_vehicles[i]->clearNodeMessages();
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: stepFleet()
+//   Purpose: Propagate the simulators of all fleet vehicles due on
+//            this step in one pass. Each vehicle then picks up its
+//            new state in its own step.
+
+void BatchSim::stepFleet()
+{
+  if(m_fleet.size() == 0)
+    return;
+
+  for(unsigned int i=0; i<m_vehicles.size(); i++)
+    m_vehicles[i]->prepFleetStep();
+  m_fleet.propagate(m_curr_time);
+}
+
+//--------------------------------------------------------------------
+// Procedure: stepAll()
+
+void BatchSim::stepAll()
+{
+  if(m_workers.size() == 0) {
+    for(unsigned int i=0; i<m_vehicles.size(); i++)
+      m_vehicles[i]->step(m_curr_time);
+    return;
+  }
+
+  unique_lock<mutex> lock(m_mutex);
+  m_pending = m_workers.size();
+  m_generation++;
+  m_start_cv.notify_all();
+  while(m_pending > 0)
+    m_done_cv.wait(lock);
+}
+
+//--------------------------------------------------------------------
+// Procedure: stepVehicles()
+//      Note: Vehicles are dealt to workers round-robin
+
+void BatchSim::stepVehicles(unsigned int worker)
+{
+  unsigned int stride = m_workers.size();
+  for(unsigned int i=worker; i<m_vehicles.size(); i+=stride)
+    m_vehicles[i]->step(m_curr_time);
+}
+
+//--------------------------------------------------------------------
+// Procedure: workerLoop()
+
+void BatchSim::workerLoop(unsigned int worker)
+{
+  unsigned long generation = 0;
+  while(true) {
+    {
+      unique_lock<mutex> lock(m_mutex);
+      while(!m_quit && (m_generation == generation))
+	m_start_cv.wait(lock);
+      if(m_quit)
+	return;
+      generation = m_generation;
+    }
+
+    stepVehicles(worker);
+
+    {
+      lock_guard<mutex> lock(m_mutex);
+      m_pending--;
+      if(m_pending == 0)
+	m_done_cv.notify_one();
+    }
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: printReport()
+
+void BatchSim::printReport() const
+{
+  double sim_elapsed = m_steps * m_step_size;
+
+  cout << "Vehicles: " << m_vehicles.size() << endl;
+  for(unsigned int i=0; i<m_vehicles.size(); i++) {
+    BatchVehicle *vehicle = m_vehicles[i];
+    cout << "  " << vehicle->getName() << ": helm ";
+    cout << vehicle->getHelmStatus() << ", iterations: ";
+    cout << vehicle->getHelmIterations() << ", helm cpu: ";
+    cout << doubleToString(vehicle->getHelmLoopTime(), 2) << "s" << endl;
+  }
+  cout << "Steps:      " << m_steps << " of ";
+  cout << doubleToStringX(m_step_size, 4) << "s" << endl;
+  cout << "Sim time:   " << doubleToString(sim_elapsed, 1) << "s" << endl;
+  cout << "Wall time:  " << doubleToString(m_elapsed_wall, 2) << "s" << endl;
+  if(m_elapsed_wall > 0) {
+    double warp = sim_elapsed / m_elapsed_wall;
+    cout << "Speedup:    " << doubleToString(warp, 1) << "x" << endl;
+  }
+  cout << "Threads:    " << (m_workers.size() ? m_workers.size() : 1) << endl;
+  if(m_fleet_mode) {
+    cout << "Fleet sim:  " << m_fleet.size() << " of " << m_vehicles.size();
+    cout << " vehicles, " << m_fleet.tableCount() << " thrust table(s)" << endl;
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: getWarnings()
+
+vector<string> BatchSim::getWarnings() const
+{
+  return(m_warnings);
+}
@@ -0,0 +1,1013 @@
+/*****************************************************************/
+/*    FILE: BatchVehicle.cpp                                     */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include "MOOS/libMOOS/Utils/ProcessConfigReader.h"
+#include "BatchVehicle.h"
+#include "HelmEngine.h"
+#include "BehaviorSet.h"
+#include "Populator_BehaviorSet.h"
+#include "NodeRecord.h"
+#include "NodeMessageUtils.h"
+#include "BuildUtils.h"
+#include "MBUtils.h"
+#include "AngleUtils.h"
+
+using namespace std;
+
+//--------------------------------------------------------------------
+// Procedure: Constructor
+
+BatchVehicle::BatchVehicle()
+{
+  m_platform_type   = "kayak";
+  m_platform_length = 0;
+  m_configured      = false;
+
+  m_start_engaged   = false;
+  m_goals_mandatory = false;
+
+  // Defaults match the AppTick defaults of the stand-alone apps
+  m_helm_period   = 0.25;
+  m_pid_period    = 0.05;
+  m_sim_period    = 0.05;
+  m_report_period = 0.25;
+
+  m_geo_ok = false;
+
+  m_curr_time  = 0;
+  m_start_time = 0;
+  m_base_dt    = 0.05;
+
+  m_helm_steps   = 1;
+  m_pid_steps    = 1;
+  m_sim_steps    = 1;
+  m_report_steps = 1;
+  m_step_count   = 0;
+
+  m_info_buffer = 0;
+  m_ledger_snap = 0;
+  m_hengine     = 0;
+  m_bhv_set     = 0;
+
+  m_helm_iteration    = 0;
+  m_helm_loop_time    = 0;
+  m_has_control       = false;
+  m_init_vars_done    = false;
+  m_no_decisions      = 0;
+  m_no_goal_decisions = 0;
+
+  m_des_heading = 0;
+  m_des_speed   = 0;
+  m_des_depth   = 0;
+
+  m_fleet    = 0;
+  m_fleet_ix = 0;
+
+  m_alog = 0;
+}
+
+//--------------------------------------------------------------------
+// Procedure: Destructor
+
+BatchVehicle::~BatchVehicle()
+{
+  closeLog();
+  if(m_bhv_set)     delete(m_bhv_set);
+  if(m_hengine)     delete(m_hengine);
+  if(m_info_buffer) delete(m_info_buffer);
+  if(m_ledger_snap) delete(m_ledger_snap);
+}
+
+//--------------------------------------------------------------------
+// Procedure: configure()
+//   Purpose: Read the vehicle configuration from a (plugged) .moos
+//            file, from the same blocks the stand-alone apps use.
+
+bool BatchVehicle::configure(string moos_file)
+{
+  m_moos_file = moos_file;
+
+  CProcessConfigReader reader;
+  if(!reader.SetFile(moos_file)) {
+    m_warnings.push_back("Unable to open mission file: " + moos_file);
+    return(false);
+  }
+  reader.EnableVerbatimQuoting(false);
+
+  if(!reader.GetValue("Community", m_vname) || (m_vname == "")) {
+    m_warnings.push_back("No Community name in " + moos_file);
+    return(false);
+  }
+
+  double lat_origin, lon_origin;
+  if(reader.GetValue("LatOrigin", lat_origin) &&
+     reader.GetValue("LongOrigin", lon_origin))
+    m_geo_ok = m_geodesy.Initialise(lat_origin, lon_origin);
+
+  // Find the helm, sim and pid blocks. Older missions may use the
+  // earlier app names.
+  STRING_LIST helm_params, pid_params, sim_params, rep_params;
+  if(reader.GetConfiguration("pHelmIvP", helm_params))
+    m_helm_app = "pHelmIvP";
+
+  const char *sim_apps[] = {"uSimMarineV23", "uSimMarineV22", "uSimMarine"};
+  for(unsigned int i=0; (i<3) && (m_sim_app==""); i++) {
+    if(reader.GetConfiguration(sim_apps[i], sim_params))
+      m_sim_app = sim_apps[i];
+  }
+
+  const char *pid_apps[] = {"pMarinePIDV22", "pMarinePID"};
+  for(unsigned int i=0; (i<2) && (m_pid_app==""); i++) {
+    if(reader.GetConfiguration(pid_apps[i], pid_params))
+      m_pid_app = pid_apps[i];
+  }
+
+  reader.GetConfiguration("pNodeReporter", rep_params);
+
+  if(m_helm_app == "")
+    m_warnings.push_back("No pHelmIvP block in " + moos_file);
+  if(m_sim_app == "")
+    m_warnings.push_back("No uSimMarine block in " + moos_file);
+  if((m_helm_app == "") || (m_sim_app == ""))
+    return(false);
+
+  // A sim block with PID settings means the PID is embedded in the
+  // simulator, otherwise the settings come from the PID app block.
+  sim_params = m_pengine.setConfigParams(sim_params);
+  if(m_pengine.hasConfigSettingsForPID())
+    m_pid_app = m_sim_app;
+  else if(m_pid_app == "") {
+    m_warnings.push_back("No PID settings found in " + moos_file);
+    return(false);
+  }
+  else
+    pid_params = m_pengine.setConfigParams(pid_params);
+
+  bool ok = true;
+  ok = configureHelm(helm_params) && ok;
+  ok = configurePID(pid_params) && ok;
+  ok = configureSim(sim_params) && ok;
+  ok = configureNodeReporter(rep_params) && ok;
+
+  m_configured = ok;
+  return(ok);
+}
+
+//--------------------------------------------------------------------
+// Procedure: configureHelm()
+
+bool BatchVehicle::configureHelm(list<string> params)
+{
+  bool all_ok = true;
+  list<string>::iterator p;
+  for(p=params.begin(); p!=params.end(); p++) {
+    string orig  = *p;
+    string line  = *p;
+    string param = toupper(biteStringX(line, '='));
+    string value = line;
+
+    bool handled = true;
+    if(param == "BEHAVIORS")
+      m_bhv_files.insert(value);
+    else if(param == "DOMAIN")
+      handled = handleConfigDomain(value);
+    else if(param == "GOALS_MANDATORY")
+      handled = setBooleanOnString(m_goals_mandatory, value);
+    else if((param == "START_ENGAGED") || (param == "ACTIVE_START") ||
+	    (param == "START_INDRIVE") || (param == "START_IN_DRIVE"))
+      handled = setBooleanOnString(m_start_engaged, value);
+    else if((param == "IVP_BEHAVIOR_DIR") || (param == "IVP_BEHAVIOR_DIRS"))
+      m_bhv_dirs.push_back(value);
+    else if(param == "PMGEN")
+      handled = m_plat_model_generator.setParams(value);
+    else if(param == "APPTICK")
+      handled = handleConfigAppTick(value, m_helm_period);
+
+    // All other helm params concern its life as a MOOS app
+    // (skews, standby, hold_on_apps etc) and are ignored here.
+    if(!handled) {
+      m_warnings.push_back(m_vname + ": bad pHelmIvP config: " + orig);
+      all_ok = false;
+    }
+  }
+
+  if(m_bhv_files.size() == 0) {
+    m_warnings.push_back(m_vname + ": no behavior files given");
+    all_ok = false;
+  }
+  if(m_ivp_domain.size() == 0) {
+    m_warnings.push_back(m_vname + ": no helm decision domain given");
+    all_ok = false;
+  }
+  return(all_ok);
+}
+
+//--------------------------------------------------------------------
+// Procedure: configurePID()
+//      Note: The PID params proper were already consumed in configure()
+
+bool BatchVehicle::configurePID(list<string> params)
+{
+  list<string>::iterator p;
+  for(p=params.begin(); p!=params.end(); p++) {
+    string line  = *p;
+    string param = toupper(biteStringX(line, '='));
+    string value = line;
+    if((param == "APPTICK") && (m_pid_app != m_sim_app))
+      handleConfigAppTick(value, m_pid_period);
+  }
+
+  bool ok_yaw = m_pengine.handleYawSettings();
+  bool ok_spd = m_pengine.handleSpeedSettings();
+  bool ok_dep = m_pengine.handleDepthSettings();
+  if(!ok_yaw || !ok_spd || !ok_dep) {
+    m_warnings.push_back(m_vname + ": improper PID settings");
+    return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: configureSim()
+
+bool BatchVehicle::configureSim(list<string> params)
+{
+  list<string>::iterator p;
+  for(p=params.begin(); p!=params.end(); p++) {
+    string orig  = *p;
+    string line  = *p;
+    string param = tolower(biteStringX(line, '='));
+    string value = line;
+
+    if(param == "apptick") {
+      handleConfigAppTick(value, m_sim_period);
+      if(m_pid_app == m_sim_app)
+	m_pid_period = m_sim_period;
+    }
+    else if(!m_model.handleConfigParam(param, value)) {
+      // Params like wormholes and prefixes belong to the sim app.
+      if((param != "prefix") && (param != "wormhole") &&
+	 (param != "commstick") && (param != "maxapptick") &&
+	 (param != "trim_tolerance") && (param != "max_trim_delay") &&
+	 (param != "post_des_thrust") && (param != "post_des_rudder") &&
+	 (param != "depth_info_acast"))
+	m_warnings.push_back(m_vname + ": unhandled sim config: " + orig);
+    }
+  }
+
+  if(m_geo_ok)
+    m_model.setGeodesy(m_geodesy);
+  m_model.cacheStartingInfo();
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: configureNodeReporter()
+
+bool BatchVehicle::configureNodeReporter(list<string> params)
+{
+  list<string>::iterator p;
+  for(p=params.begin(); p!=params.end(); p++) {
+    string line  = *p;
+    string param = tolower(biteStringX(line, '='));
+    string value = line;
+
+    if(param == "platform_type")
+      m_platform_type = value;
+    else if(param == "platform_length")
+      setNonNegDoubleOnString(m_platform_length, value);
+    else if(param == "platform_group")
+      m_group = value;
+    else if(param == "apptick")
+      handleConfigAppTick(value, m_report_period);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: handleConfigDomain()
+//   Example: DOMAIN = course:0:359:360
+//            DOMAIN = speed:0:4:delta=0.1
+//            DOMAIN = depth:0:100:101:optional
+
+bool BatchVehicle::handleConfigDomain(string entry)
+{
+  entry = findReplace(stripBlankEnds(entry), ',', ':');
+
+  vector<string> svector = parseString(entry, ':');
+  unsigned int vsize = svector.size();
+  if((vsize < 4) || (vsize > 5))
+    return(false);
+
+  string dname = svector[0];
+  double dlow  = atof(svector[1].c_str());
+  double dhgh  = atof(svector[2].c_str());
+  int    dcnt  = atoi(svector[3].c_str());
+
+  double dom_range = dhgh - dlow;
+  if((dhgh < dlow) || ((dom_range == 0) && (dcnt != 1)))
+    return(false);
+
+  if(strBegins(svector[3], "delta=") && (dom_range > 0)) {
+    string delta = rbiteString(svector[3], '=');
+    if(isNumber(delta)) {
+      double dbl_delta = atof(delta.c_str());
+      if((dbl_delta > 0) && (dbl_delta <= dom_range))
+	dcnt = (int)((dom_range / dbl_delta) + 1);
+    }
+  }
+
+  if(vsize == 5)
+    m_optional_var[dname] = (tolower(svector[4]) == "optional");
+
+  return(m_ivp_domain.addDomain(dname.c_str(), dlow, dhgh, dcnt));
+}
+
+//--------------------------------------------------------------------
+// Procedure: handleConfigAppTick()
+
+bool BatchVehicle::handleConfigAppTick(string value, double& period)
+{
+  double apptick = atof(value.c_str());
+  if(!isNumber(value) || (apptick <= 0))
+    return(false);
+  period = 1.0 / apptick;
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: addPoke()
+//   Purpose: Queue a posting as if made by another app at startup,
+//            e.g., DEPLOY=true or MOOS_MANUAL_OVERRIDE=false
+
+void BatchVehicle::addPoke(string var, string val)
+{
+  var = stripBlankEnds(var);
+  val = stripBlankEnds(val);
+  if(isNumber(val))
+    m_mail.push_back(VarDataPair(var, atof(val.c_str())));
+  else
+    m_mail.push_back(VarDataPair(var, stripQuotes(val)));
+}
+
+//--------------------------------------------------------------------
+// Procedure: initialize()
+//   Purpose: Build the behavior set and prepare for the first step.
+//            Each component runs every N base steps, where N is its
+//            configured period rounded to the base step.
+
+bool BatchVehicle::initialize(double start_utc, double base_dt,
+			      string log_dir)
+{
+  if(!m_configured)
+    return(false);
+
+  m_start_time = start_utc;
+  m_curr_time  = start_utc;
+  m_base_dt    = base_dt;
+
+  m_helm_steps   = (unsigned int)(round(m_helm_period / base_dt));
+  m_pid_steps    = (unsigned int)(round(m_pid_period / base_dt));
+  m_sim_steps    = (unsigned int)(round(m_sim_period / base_dt));
+  m_report_steps = (unsigned int)(round(m_report_period / base_dt));
+  if(m_helm_steps == 0)   m_helm_steps = 1;
+  if(m_pid_steps == 0)    m_pid_steps = 1;
+  if(m_sim_steps == 0)    m_sim_steps = 1;
+  if(m_report_steps == 0) m_report_steps = 1;
+
+  m_info_buffer = new InfoBuffer;
+  m_info_buffer->setCurrTime(start_utc);
+  m_info_buffer->setStartTime(start_utc);
+  m_ledger_snap = new LedgerSnap;
+  m_poster.setInfoBuffer(m_info_buffer);
+  m_poster.setStartTime(start_utc);
+
+  m_ledger.setCurrTimeUTC(start_utc);
+  if(m_geo_ok)
+    m_ledger.setGeodesy(m_geodesy);
+  m_ledger.setStaleThresh(10);
+
+  m_hengine = new HelmEngine(m_ivp_domain, m_info_buffer, m_ledger_snap);
+
+  Populator_BehaviorSet populator(m_ivp_domain, m_info_buffer,
+				  m_ledger_snap);
+  populator.setOwnship(m_vname);
+  for(unsigned int k=0; k<m_bhv_dirs.size(); k++)
+    populator.addBehaviorDir(m_bhv_dirs[k]);
+
+  m_bhv_set = populator.populate(m_bhv_files);
+  vector<string> config_warnings = populator.getConfigWarnings();
+  for(unsigned int k=0; k<config_warnings.size(); k++)
+    m_warnings.push_back(m_vname + ": " + config_warnings[k]);
+
+  if(!m_bhv_set || (config_warnings.size() > 0))
+    return(false);
+  m_hengine->setBehaviorSet(m_bhv_set);
+
+  for(unsigned int i=0; i<m_bhv_set->size(); i++) {
+    m_bhv_set->getBehavior(i)->IvPBehavior::setParam("us", m_vname);
+    m_bhv_set->getBehavior(i)->onSetParamComplete();
+  }
+
+  // The variables the helm would register for. Helm postings to these
+  // are delivered back to the helm, as the MOOSDB would.
+  vector<string> info_vars = m_bhv_set->getInfoVars();
+  vector<string> update_vars = m_bhv_set->getSpecUpdateVars();
+  m_registered.insert(info_vars.begin(), info_vars.end());
+  m_registered.insert(update_vars.begin(), update_vars.end());
+
+  m_has_control = m_start_engaged;
+  m_pengine.setStartTime(start_utc);
+  m_pengine.updateTime(start_utc);
+  m_pengine.setPIDOverride(!m_has_control);
+  m_model.resetTime(start_utc);
+
+  string alog_file = m_vname + ".alog";
+  if(log_dir != "")
+    alog_file = log_dir + "/" + alog_file;
+  m_alog = fopen(alog_file.c_str(), "w");
+  if(!m_alog) {
+    m_warnings.push_back("Unable to open " + alog_file);
+    return(false);
+  }
+  fprintf(m_alog, "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\n");
+  fprintf(m_alog, "%%%% LOG FILE:       %s\n", alog_file.c_str());
+  fprintf(m_alog, "%%%% FILE OPENED ON  batchsim %s\n", m_moos_file.c_str());
+  fprintf(m_alog, "%%%% LOGSTART        %.16g\n", start_utc);
+  fprintf(m_alog, "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\n");
+
+  logEntry("IVPHELM_DOMAIN", m_helm_app, domainToString(m_ivp_domain));
+  logEntry("IVPHELM_MODESET", m_helm_app, m_bhv_set->getModeSetDefinition());
+
+  handleInitialVars(false);
+
+  vector<VarDataPair> start_msgs = m_bhv_set->getHelmStartMessages();
+  for(unsigned int j=0; j<start_msgs.size(); j++) {
+    string var = stripBlankEnds(start_msgs[j].get_var());
+    if(strContainsWhite(var))
+      continue;
+    if(start_msgs[j].get_sdata() != "")
+      postHelmVar(var, stripBlankEnds(start_msgs[j].get_sdata()),
+		  "HELM_STARTUP_MSG");
+    else
+      postHelmVar(var, start_msgs[j].get_ddata(), "HELM_STARTUP_MSG");
+  }
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: step()
+//   Purpose: Advance this vehicle to the given time. The sim moves
+//            first using the actuator values from the previous PID
+//            iteration, then the helm and PID run if due.
+
+void BatchVehicle::step(double utc)
+{
+  m_curr_time = utc;
+
+  if((m_step_count % m_sim_steps) == 0)
+    iterateSim();
+  if((m_step_count % m_helm_steps) == 0)
+    iterateHelm();
+  if((m_step_count % m_pid_steps) == 0)
+    iteratePID();
+  if((m_step_count % m_report_steps) == 0)
+    postNodeReport();
+
+  m_step_count++;
+}
+
+//--------------------------------------------------------------------
+// Procedure: joinFleet()
+//   Purpose: Hand propagation of this vehicle's simulator over to a
+//            fleet shared with other vehicles. The fleet is advanced
+//            by the owner between prepFleetStep() and step().
+
+bool BatchVehicle::joinFleet(SimFleet& fleet)
+{
+  if(!m_model.fleetEligible())
+    return(false);
+
+  m_fleet_ix = m_model.joinFleet(fleet);
+  m_fleet = &fleet;
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: prepFleetStep()
+//   Purpose: If the simulator is due on the coming step, give the
+//            fleet the latest actuator values.
+
+void BatchVehicle::prepFleetStep()
+{
+  if(m_fleet && ((m_step_count % m_sim_steps) == 0))
+    m_model.pushToFleet(*m_fleet, m_fleet_ix);
+}
+
+//--------------------------------------------------------------------
+// Procedure: iterateSim()
+
+void BatchVehicle::iterateSim()
+{
+  if(m_fleet)
+    m_model.pullFromFleet(*m_fleet, m_fleet_ix);
+  else
+    m_model.propagate(m_curr_time);
+  NodeRecord record = m_model.getNodeRecord();
+
+  double nav_spd = snapToStep(record.getSpeed(), 0.01);
+
+  m_mail.push_back(VarDataPair("NAV_X", record.getX()));
+  m_mail.push_back(VarDataPair("NAV_Y", record.getY()));
+  m_mail.push_back(VarDataPair("NAV_HEADING", record.getHeading()));
+  m_mail.push_back(VarDataPair("NAV_SPEED", nav_spd));
+  m_mail.push_back(VarDataPair("NAV_DEPTH", record.getDepth()));
+
+  logEntry("NAV_X", m_sim_app, record.getX());
+  logEntry("NAV_Y", m_sim_app, record.getY());
+  if(m_model.geoOK()) {
+    logEntry("NAV_LAT", m_sim_app, record.getLat());
+    logEntry("NAV_LONG", m_sim_app, record.getLon());
+  }
+  logEntry("NAV_HEADING", m_sim_app, record.getHeading());
+  logEntry("NAV_SPEED", m_sim_app, nav_spd);
+  logEntry("NAV_DEPTH", m_sim_app, record.getDepth());
+}
+
+//--------------------------------------------------------------------
+// Procedure: iteratePID()
+//      Note: Nav comes straight from the model, as with a PID
+//            embedded in the simulator.
+
+void BatchVehicle::iteratePID()
+{
+  NodeRecord record = m_model.getNodeRecord();
+
+  m_pengine.updateTime(m_curr_time);
+  m_pengine.setCurrHeading(angle360(record.getHeading()));
+  m_pengine.setCurrSpeed(record.getSpeed());
+  if(m_pengine.hasDepthControl()) {
+    m_pengine.setCurrDepth(record.getDepth());
+    m_pengine.setCurrPitch(record.getPitch());
+  }
+  m_pengine.setDesiredValues();
+
+  double rudder   = 0;
+  double thrust   = 0;
+  double elevator = 0;
+  if(m_pengine.hasControl()) {
+    rudder   = m_pengine.getDesiredRudder();
+    thrust   = m_pengine.getDesiredThrust();
+    elevator = m_pengine.getDesiredElevator();
+  }
+  m_model.setRudder(rudder, m_curr_time);
+  m_model.setThrust(thrust);
+  m_model.setElevator(elevator);
+
+  logEntry("DESIRED_RUDDER", m_pid_app, rudder);
+  logEntry("DESIRED_THRUST", m_pid_app, thrust);
+  if(m_pengine.hasDepthControl())
+    logEntry("DESIRED_ELEVATOR", m_pid_app, elevator);
+
+  vector<VarDataPair> postings = m_pengine.getPostings();
+  for(unsigned int i=0; i<postings.size(); i++) {
+    if(postings[i].is_string())
+      logEntry(postings[i].get_var(), m_pid_app, postings[i].get_sdata());
+    else
+      logEntry(postings[i].get_var(), m_pid_app, postings[i].get_ddata());
+  }
+  m_pengine.clearPostings();
+}
+
+//--------------------------------------------------------------------
+// Procedure: postNodeReport()
+
+void BatchVehicle::postNodeReport()
+{
+  NodeRecord record = m_model.getNodeRecord();
+  record.setName(m_vname);
+  record.setType(m_platform_type);
+  record.setGroup(m_group);
+  record.setTimeStamp(m_curr_time);
+  if(m_platform_length > 0)
+    record.setLength(m_platform_length);
+
+  m_node_report = record.getSpec();
+  logEntry("NODE_REPORT_LOCAL", "pNodeReporter", m_node_report);
+}
+
+//--------------------------------------------------------------------
+// Procedure: deliverMail()
+//   Purpose: Accept mail from the bus, i.e., another vehicle
+
+void BatchVehicle::deliverMail(const VarDataPair& pair)
+{
+  m_mail.push_back(pair);
+
+  if(pair.is_string())
+    logEntry(pair.get_var(), "batchsim", pair.get_sdata());
+  else
+    logEntry(pair.get_var(), "batchsim", pair.get_ddata());
+}
+
+//--------------------------------------------------------------------
+// Procedure: handleMail()
+//   Purpose: Apply all mail received since the last helm iteration,
+//            in the manner of HelmIvP::OnNewMail()
+
+void BatchVehicle::handleMail()
+{
+  m_ledger.setCurrTimeUTC(m_curr_time);
+  m_info_buffer->setCurrTime(m_curr_time);
+
+  list<VarDataPair>::iterator p;
+  for(p=m_mail.begin(); p!=m_mail.end(); p++) {
+    string var  = p->get_var();
+    string sval = p->get_sdata();
+
+    if((var == "MOOS_MANUAL_OVERRIDE") || (var == "MOOS_MANUAL_OVERIDE")) {
+      if(toupper(sval) == "FALSE")
+	m_has_control = true;
+      else if(toupper(sval) == "TRUE")
+	m_has_control = false;
+      m_pengine.setPIDOverride(sval);
+    }
+    else if(var == "NODE_REPORT") {
+      string whynot;
+      string vname = m_ledger.processNodeReport(sval, whynot);
+      if(vname != "") {
+	string uvname = toupper(vname);
+	m_info_buffer->setValue(uvname+"_NAV_GROUP", m_ledger.getGroup(vname));
+	m_info_buffer->setValue(uvname+"_NAV_TYPE", m_ledger.getType(vname));
+      }
+    }
+
+    if(p->is_string())
+      m_info_buffer->setValue(var, sval);
+    else
+      m_info_buffer->setValue(var, p->get_ddata());
+  }
+  m_mail.clear();
+}
+
+//--------------------------------------------------------------------
+// Procedure: iterateHelm()
+//   Purpose: One helm iteration, following HelmIvP::Iterate()
+
+void BatchVehicle::iterateHelm()
+{
+  handleMail();
+
+  if(!m_init_vars_done)
+    handleInitialVars(true);
+
+  vector<string> keep_vnames = m_bhv_set->getContactNames();
+  m_ledger.clearStaleNodes(keep_vnames);
+  m_ledger.extrapolate();
+  updateLedgerSnap();
+
+  if(!m_has_control) {
+    postAllStop("ManualOverride");
+    m_info_buffer->clearDeltaVectors();
+    return;
+  }
+
+  // As the helm, no decision in the first second
+  if((m_curr_time - m_start_time) < 1)
+    return;
+
+  updatePlatModel();
+  m_helm_report = m_hengine->determineNextDecision(m_bhv_set, m_curr_time);
+  m_helm_iteration = m_helm_report.getIteration();
+  m_helm_loop_time += m_helm_report.getLoopTime();
+
+  vector<string> new_vars = m_bhv_set->getNewInfoVars();
+  m_registered.insert(new_vars.begin(), new_vars.end());
+
+  m_poster.setCurrTime(m_curr_time);
+  m_poster.setIteration(m_helm_iteration);
+  m_poster.handleModeMessages(m_bhv_set);
+  m_poster.handleBehaviorMessages(m_bhv_set);
+  m_poster.handleLifeEvents(m_bhv_set);
+  m_poster.handleDefaultVariables(m_bhv_set);
+  deliverPostings();
+
+  logEntry("IVPHELM_SUMMARY", m_helm_app,
+	   m_helm_report.getReportAsString(m_prev_helm_report));
+  m_prev_helm_report = m_helm_report;
+
+  string allstop_msg = "clear";
+  if(m_helm_report.getHalted())
+    allstop_msg = "BehaviorError";
+  else if(m_helm_report.getOFNUM() == 0)
+    allstop_msg = "NothingToDo";
+  else if(m_goals_mandatory && !m_helm_report.getActiveGoal())
+    allstop_msg = "NoGoalBehavior";
+
+  if(allstop_msg == "clear") {
+    string missing;
+    for(unsigned int i=0; i<m_ivp_domain.size(); i++) {
+      string domain_var = m_ivp_domain.getVarName(i);
+      if(!m_helm_report.hasDecision(domain_var) &&
+	 !m_optional_var[domain_var]) {
+	if(missing != "")
+	  missing += ",";
+	missing += domain_var;
+      }
+    }
+    if(missing != "") {
+      allstop_msg = "MissingDecVars:" + missing;
+      logEntry("BHV_ERROR", m_helm_app, allstop_msg);
+    }
+  }
+
+  postAllStop(allstop_msg);
+  if(allstop_msg == "clear") {
+    m_pengine.updateTime(m_curr_time);
+    for(unsigned int j=0; j<m_ivp_domain.size(); j++) {
+      string domain_var = m_ivp_domain.getVarName(j);
+      if(!m_helm_report.hasDecision(domain_var))
+	continue;
+      double dval = m_helm_report.getDecision(domain_var);
+      string post_alias = "DESIRED_" + toupper(domain_var);
+      if(post_alias == "DESIRED_COURSE")
+	post_alias = "DESIRED_HEADING";
+
+      if(post_alias == "DESIRED_HEADING") {
+	m_des_heading = dval;
+	m_pengine.setDesHeading(dval);
+      }
+      else if(post_alias == "DESIRED_SPEED") {
+	m_des_speed = dval;
+	m_pengine.setDesSpeed(dval);
+      }
+      else if(post_alias == "DESIRED_DEPTH") {
+	m_des_depth = dval;
+	m_pengine.setDesDepth(dval);
+      }
+      logEntry(post_alias, m_helm_app, dval);
+    }
+  }
+
+  m_info_buffer->clearDeltaVectors();
+}
+
+//--------------------------------------------------------------------
+// Procedure: handleInitialVars()
+//   Purpose: Post the initialize lines of the behavior files. On
+//            the first pass the non-deferred ones, on the second
+//            the deferred ones not already set by other means.
+
+void BatchVehicle::handleInitialVars(bool deferred)
+{
+  if(deferred)
+    m_init_vars_done = true;
+
+  vector<VarDataPair> mvector = m_bhv_set->getInitialVariables();
+  for(unsigned int j=0; j<mvector.size(); j++) {
+    string var   = stripBlankEnds(mvector[j].get_var());
+    string sdata = stripBlankEnds(mvector[j].get_sdata());
+    double ddata = mvector[j].get_ddata();
+    string key   = tolower(mvector[j].get_key());
+
+    if(strContainsWhite(var))
+      continue;
+    if(!deferred && (key == "defer"))
+      m_registered.insert(var);
+    if(!deferred && (key != "post"))
+      continue;
+    if(deferred && ((key != "defer") || m_info_buffer->isKnown(var)))
+      continue;
+
+    if(sdata != "") {
+      m_info_buffer->setValue(var, sdata);
+      logEntry(var, m_helm_app + ":HELM_VAR_INIT", sdata);
+    }
+    else {
+      m_info_buffer->setValue(var, ddata);
+      logEntry(var, m_helm_app + ":HELM_VAR_INIT", ddata);
+    }
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: deliverPostings()
+//   Purpose: As HelmIvP::deliverPostings(). The postings collected by
+//            the HelmPoster go out through postHelmVar(). Behavior
+//            warnings are kept, once each, with the vehicle warnings.
+
+void BatchVehicle::deliverPostings()
+{
+  vector<string> warnings = m_poster.getRunWarnings();
+  for(unsigned int i=0; i<warnings.size(); i++) {
+    string warning = m_vname + ": " + warnings[i];
+    if(!vectorContains(m_warnings, warning))
+      m_warnings.push_back(warning);
+  }
+
+  vector<string> retractions = m_poster.getRetractions();
+  for(unsigned int i=0; i<retractions.size(); i++) {
+    string warning = m_vname + ": " + retractions[i];
+    vector<string>::iterator p;
+    p = find(m_warnings.begin(), m_warnings.end(), warning);
+    if(p != m_warnings.end())
+      m_warnings.erase(p);
+  }
+
+  vector<HelmPosting> postings = m_poster.getPostings();
+  for(unsigned int i=0; i<postings.size(); i++) {
+    const HelmPosting& posting = postings[i];
+    if(posting.isString())
+      postHelmVar(posting.getVar(), posting.getSVal(), posting.getSrc());
+    else
+      postHelmVar(posting.getVar(), posting.getDVal(), posting.getSrc());
+  }
+
+  m_poster.clearPostings();
+}
+
+//--------------------------------------------------------------------
+// Procedure: postAllStop()
+//   Purpose: As HelmIvP::postAllStop(). Zero the decision variables
+//            unless the helm is simply between modes.
+
+void BatchVehicle::postAllStop(string msg)
+{
+  if(msg == m_allstop_msg)
+    return;
+  m_allstop_msg = msg;
+
+  if((msg == "NothingToDo") || strBegins(msg, "MissingDecVars"))
+    m_no_decisions++;
+  else
+    m_no_decisions = 0;
+  if(msg == "NoGoalBehavior")
+    m_no_goal_decisions++;
+  else
+    m_no_goal_decisions = 0;
+
+  logEntry("IVPHELM_ALLSTOP", m_helm_app, m_allstop_msg);
+  if(tolower(m_allstop_msg) == "clear")
+    return;
+
+  if(m_no_decisions == 1) {
+    m_allstop_msg = "IncompleteOrEmptyDecision";
+    return;
+  }
+  if(m_no_goal_decisions == 1) {
+    m_allstop_msg = "NoActiveGoalBehavior";
+    return;
+  }
+
+  m_pengine.updateTime(m_curr_time);
+  for(unsigned int j=0; j<m_ivp_domain.size(); j++) {
+    string post_alias = "DESIRED_" + toupper(m_ivp_domain.getVarName(j));
+    if(post_alias == "DESIRED_COURSE")
+      post_alias = "DESIRED_HEADING";
+    if(post_alias == "DESIRED_HEADING")
+      m_pengine.setDesHeading(0);
+    else if(post_alias == "DESIRED_SPEED")
+      m_pengine.setDesSpeed(0);
+    else if(post_alias == "DESIRED_DEPTH")
+      m_pengine.setDesDepth(0);
+    logEntry(post_alias, m_helm_app, 0.0);
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: updateLedgerSnap()
+
+void BatchVehicle::updateLedgerSnap()
+{
+  m_ledger_snap->clear();
+
+  vector<string> vnames = m_ledger.getVNames();
+  for(unsigned int i=0; i<vnames.size(); i++) {
+    string v = vnames[i];
+    m_ledger_snap->setX(v, m_ledger.getX(v));
+    m_ledger_snap->setY(v, m_ledger.getY(v));
+    m_ledger_snap->setHdg(v, m_ledger.getHeading(v));
+    m_ledger_snap->setSpd(v, m_ledger.getSpeed(v));
+    m_ledger_snap->setDep(v, m_ledger.getDepth(v));
+    m_ledger_snap->setLat(v, m_ledger.getLat(v));
+    m_ledger_snap->setLon(v, m_ledger.getLon(v));
+    m_ledger_snap->setUTC(v, m_ledger.getUTC(v));
+    m_ledger_snap->setUTCAge(v, m_ledger.getUTCAge(v));
+    m_ledger_snap->setUTCReceived(v, m_ledger.getUTCReceived(v));
+    m_ledger_snap->setUTCAgeReceived(v, m_ledger.getUTCAgeReceived(v));
+  }
+  m_ledger_snap->setCurrTimeUTC(m_curr_time);
+}
+
+//--------------------------------------------------------------------
+// Procedure: updatePlatModel()
+
+void BatchVehicle::updatePlatModel()
+{
+  bool ok1, ok2, ok3, ok4;
+  double osx = m_info_buffer->dQuery("NAV_X", ok1);
+  double osy = m_info_buffer->dQuery("NAV_Y", ok2);
+  double osh = m_info_buffer->dQuery("NAV_HEADING", ok3);
+  double osv = m_info_buffer->dQuery("NAV_SPEED", ok4);
+  if(!ok1 || !ok2 || !ok3 || !ok4)
+    return;
+
+  m_plat_model_generator.setCurrTime(m_curr_time);
+  m_hengine->setPlatModel(m_plat_model_generator.generate(osx, osy, osh, osv));
+}
+
+//--------------------------------------------------------------------
+// Procedure: postHelmVar()
+//   Purpose: The equivalent of a helm Notify(). The posting is logged,
+//            returned to the helm if it is a registered variable, and
+//            node messages are handed to the bus.
+
+void BatchVehicle::postHelmVar(string var, string sval, string src)
+{
+  string source = m_helm_app;
+  if(src != "")
+    source += ":" + src;
+  logEntry(var, source, sval);
+
+  if(m_registered.count(var))
+    m_mail.push_back(VarDataPair(var, sval));
+
+  if(var == "NODE_MESSAGE_LOCAL") {
+    NodeMessage message = string2NodeMessage(sval);
+    if(message.valid())
+      m_node_messages.push_back(message);
+  }
+}
+
+void BatchVehicle::postHelmVar(string var, double dval, string src)
+{
+  string source = m_helm_app;
+  if(src != "")
+    source += ":" + src;
+  logEntry(var, source, dval);
+
+  if(m_registered.count(var))
+    m_mail.push_back(VarDataPair(var, dval));
+}
+
+//--------------------------------------------------------------------
+// Procedure: getHelmStatus()
+
+string BatchVehicle::getHelmStatus() const
+{
+  if(!m_has_control)
+    return("PARK");
+  return("DRIVE");
+}
+
+//--------------------------------------------------------------------
+// Procedure: logEntry()
+//      Note: Same layout as the pLogger asynchronous log
+
+void BatchVehicle::logEntry(const string& var, const string& src,
+			    const string& val)
+{
+  if(!m_alog)
+    return;
+  fprintf(m_alog, "%-15.5f %-20s %-15s %s\n", m_curr_time - m_start_time,
+	  var.c_str(), src.c_str(), val.c_str());
+}
+
+void BatchVehicle::logEntry(const string& var, const string& src,
+			    double val)
+{
+  if(!m_alog)
+    return;
+  fprintf(m_alog, "%-15.5f %-20s %-15s %.12g\n", m_curr_time - m_start_time,
+	  var.c_str(), src.c_str(), val);
+}
+
+//--------------------------------------------------------------------
+// Procedure: closeLog()
+
+void BatchVehicle::closeLog()
+{
+  if(m_alog)
+    fclose(m_alog);
+  m_alog = 0;
+}
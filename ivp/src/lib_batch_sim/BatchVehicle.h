@@ -0,0 +1,203 @@
+/*****************************************************************/
+/*    FILE: BatchVehicle.h                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef BATCH_VEHICLE_HEADER
+#define BATCH_VEHICLE_HEADER
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <list>
+#include <set>
+#include <map>
+#include "IvPDomain.h"
+#include "InfoBuffer.h"
+#include "LedgerSnap.h"
+#include "ContactLedger.h"
+#include "PlatModelGenerator.h"
+#include "HelmReport.h"
+#include "HelmPoster.h"
+#include "PIDEngine.h"
+#include "USM_Model.h"
+#include "VarDataPair.h"
+#include "NodeMessage.h"
+
+class HelmEngine;
+class BehaviorSet;
+
+// A BatchVehicle is one vehicle of a batch simulation: the helm, PID
+// and simulator that normally run as pHelmIvP, pMarinePIDV22 and
+// uSimMarineV23 under a MOOSDB, bundled into one object and stepped
+// directly. Mail between the three is replaced by direct calls, and
+// mail from other vehicles arrives via deliverMail(). Everything a
+// vehicle touches is owned by it, so different vehicles may be
+// stepped concurrently.
+
+class BatchVehicle
+{
+ public:
+  BatchVehicle();
+  ~BatchVehicle();
+
+ public: // Configuration
+  bool configure(std::string moos_file);
+  bool initialize(double start_utc, double base_dt, std::string log_dir);
+  void addPoke(std::string var, std::string val);
+
+ public: // Stepping
+  void step(double utc);
+
+ public: // Optional shared propagation of the simulator
+  bool joinFleet(SimFleet&);
+  void prepFleetStep();
+
+ public: // The in-memory bus
+  void deliverMail(const VarDataPair&);
+
+  std::string getNodeReport() {return(m_node_report);}
+  void        clearNodeReport() {m_node_report="";}
+
+  std::vector<NodeMessage> getNodeMessages() {return(m_node_messages);}
+  void        clearNodeMessages() {m_node_messages.clear();}
+
+ public: // Getters
+  std::string  getName() const          {return(m_vname);}
+  std::string  getGroup() const         {return(m_group);}
+  std::string  getMOOSFile() const      {return(m_moos_file);}
+  unsigned int getHelmIterations() const {return(m_helm_iteration);}
+  double       getHelmLoopTime() const  {return(m_helm_loop_time);}
+  std::string  getHelmStatus() const;
+
+  std::vector<std::string> getWarnings() const {return(m_warnings);}
+
+  void closeLog();
+
+ protected: // Configuration
+  bool configureHelm(std::list<std::string>);
+  bool configurePID(std::list<std::string>);
+  bool configureSim(std::list<std::string>);
+  bool configureNodeReporter(std::list<std::string>);
+  bool handleConfigDomain(std::string);
+  bool handleConfigAppTick(std::string, double&);
+
+ protected: // Per-step work
+  void handleMail();
+  void iterateHelm();
+  void iteratePID();
+  void iterateSim();
+  void postNodeReport();
+
+ protected: // Helm support, mirroring pHelmIvP
+  void handleInitialVars(bool deferred);
+  void deliverPostings();
+  void postAllStop(std::string msg);
+  void updateLedgerSnap();
+  void updatePlatModel();
+  void postHelmVar(std::string var, std::string sval, std::string src);
+  void postHelmVar(std::string var, double dval, std::string src);
+
+ protected: // Logging in alog format
+  void logEntry(const std::string& var, const std::string& src,
+		const std::string& val);
+  void logEntry(const std::string& var, const std::string& src,
+		double val);
+
+ protected: // Configuration state
+  std::string  m_moos_file;
+  std::string  m_vname;
+  std::string  m_group;
+  std::string  m_platform_type;
+  double       m_platform_length;
+  bool         m_configured;
+
+  std::set<std::string>    m_bhv_files;
+  std::vector<std::string> m_bhv_dirs;
+  std::map<std::string, bool> m_optional_var;
+  bool         m_start_engaged;
+  bool         m_goals_mandatory;
+
+  std::string  m_helm_app;
+  std::string  m_pid_app;
+  std::string  m_sim_app;
+
+  double       m_helm_period;
+  double       m_pid_period;
+  double       m_sim_period;
+  double       m_report_period;
+
+  CMOOSGeodesy m_geodesy;
+  bool         m_geo_ok;
+
+  std::vector<std::string> m_warnings;
+
+ protected: // Run state
+  double       m_curr_time;
+  double       m_start_time;
+  double       m_base_dt;
+
+  unsigned int m_helm_steps;
+  unsigned int m_pid_steps;
+  unsigned int m_sim_steps;
+  unsigned int m_report_steps;
+  unsigned long int m_step_count;
+
+  std::list<VarDataPair> m_mail;
+  std::set<std::string>  m_registered;
+
+  std::string              m_node_report;
+  std::vector<NodeMessage> m_node_messages;
+
+ protected: // Helm state
+  IvPDomain     m_ivp_domain;
+  InfoBuffer   *m_info_buffer;
+  LedgerSnap   *m_ledger_snap;
+  HelmEngine   *m_hengine;
+  BehaviorSet  *m_bhv_set;
+  ContactLedger m_ledger;
+  PlatModelGenerator m_plat_model_generator;
+
+  HelmReport    m_helm_report;
+  HelmReport    m_prev_helm_report;
+  unsigned int  m_helm_iteration;
+  double        m_helm_loop_time;
+  bool          m_has_control;
+  bool          m_init_vars_done;
+  std::string   m_allstop_msg;
+  unsigned int  m_no_decisions;
+  unsigned int  m_no_goal_decisions;
+
+  HelmPoster    m_poster;
+
+  double m_des_heading;
+  double m_des_speed;
+  double m_des_depth;
+
+ protected: // PID and simulator state
+  PIDEngine  m_pengine;
+  USM_Model  m_model;
+
+  SimFleet    *m_fleet;
+  unsigned int m_fleet_ix;
+
+ protected: // Logging
+  FILE *m_alog;
+};
+
+#endif
@@ -623,12 +623,9 @@ void BHV_OpRegionV24::updateRangeCache()
 
   // Step 4. Fill in the heading and range caches by calculating the 
   // distance to the containent polygon for each possible heading.
-  for(unsigned int i=0; i<hdg_pts; i++) {
-    double heading = m_domain.getVal(hdg_ix, i);
-    double dist_to_region = m_save_poly.dist_to_poly(m_osx, m_osy, heading);
-    m_heading_cache[i] = heading;
-    m_range_cache[i]   = dist_to_region;
-  }
+  for(unsigned int i=0; i<hdg_pts; i++)
+    m_heading_cache[i] = m_domain.getVal(hdg_ix, i);
+  m_range_cache = m_save_poly.dist_to_poly(m_osx, m_osy, m_heading_cache);
 
   // Step 5. Normalize the values for all headings that reach the poly.
   // Longest distance will be zero, closest distance will be 100.
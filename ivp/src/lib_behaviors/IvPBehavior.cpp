@@ -40,6 +40,7 @@
 #include "NodeMessage.h"
 #include "VarDataPairUtils.h"
 #include "LogicBuffer.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -53,6 +54,7 @@ IvPBehavior::IvPBehavior(IvPDomain g_domain)
   m_ledger_snap  = 0;
   m_priority_wt  = 100.0;  // Default Priority Weight
   m_descriptor   = "???";  // Default descriptor
+  m_span_id      = -1;
   m_bhv_state_ok = true;
   m_completed    = false;
   m_good_updates = 0;
@@ -140,11 +142,24 @@ bool IvPBehavior::setBehaviorName(string bhv_name)
     return(false);
   
   m_descriptor = bhv_name;
+  m_span_id    = -1;
   m_status_info = "name=" + m_descriptor;
   return(true);
 }
 
 
+//-----------------------------------------------------------
+// Procedure: getSpanID()
+//   Purpose: The profiler span id of the behavior name, interned
+//            once rather than on each helm iteration.
+
+unsigned int IvPBehavior::getSpanID()
+{
+  if(m_span_id < 0)
+    m_span_id = (int)(spanNameID(m_descriptor));
+  return((unsigned int)(m_span_id));
+}
+
 //-----------------------------------------------------------
 // Procedure: augBehaviorName(string)
 
@@ -157,6 +172,7 @@ bool IvPBehavior::augBehaviorName(string aug_name)
     m_descriptor = aug_name;
   else
     m_descriptor += aug_name;
+  m_span_id = -1;
 
   m_status_info = "name=" + m_descriptor;
   return(true);
@@ -955,34 +971,14 @@ bool IvPBehavior::checkConditions()
   if(!m_info_buffer) 
     return(false);
 
-  unsigned int i, j, vsize, csize;
-
-  // Phase 1: get all the variable names from all present conditions.
-  vector<string> all_vars;
-  csize = m_logic_conditions.size();
-  for(i=0; i<csize; i++) {
-    vector<string> svector = m_logic_conditions[i].getVarNames();
-    all_vars = mergeVectors(all_vars, svector);
-  }
-  all_vars = removeDuplicates(all_vars);
-
-  // Phase 2: get values of all variables from the info_buffer and 
-  // propogate these values down to all the logic conditions.
-  vsize = all_vars.size();
-  for(i=0; i<vsize; i++) {
-    string varname = all_vars[i];
-    bool   ok_s, ok_d;
-    string s_result = m_info_buffer->sQuery(varname, ok_s);
-    double d_result = m_info_buffer->dQuery(varname, ok_d);
-
-    for(j=0; (j<csize)&&(ok_s); j++)
-      m_logic_conditions[j].setVarVal(varname, s_result);
-    for(j=0; (j<csize)&&(ok_d); j++)
-      m_logic_conditions[j].setVarVal(varname, d_result);
-  }
+  // Phase 1: get values of changed variables from the info_buffer
+  // and propogate these values down to the dependent conditions.
+  m_logic_index.update(m_logic_conditions, m_info_buffer);
 
-  // Phase 3: evaluate all logic conditions. Return true only if all
-  // conditions evaluate to be true.
+  // Phase 2: evaluate all logic conditions. Return true only if all
+  // conditions evaluate to be true. Conditions with no changed
+  // variables return their prior evaluation.
+  unsigned int i, csize = m_logic_conditions.size();
   for(i=0; i<csize; i++) {
     bool satisfied = m_logic_conditions[i].eval();
     if(!satisfied) {
@@ -1175,6 +1171,9 @@ bool IvPBehavior::checkUpdates()
     return(false);
   }
 
+  static const unsigned int s_check_updates_id = spanNameID("checkUpdates");
+  ScopedSpan span(s_check_updates_id);
+
   m_update_results.clear();
   
   bool ok;
@@ -1440,6 +1439,11 @@ void IvPBehavior::postFlags(const string& str, bool repeatable)
 void IvPBehavior::postFlags(const vector<VarDataPair>& flags,
 			    bool repeatable)
 {
+  if(flags.size() == 0)
+    return;
+
+  static const unsigned int s_post_flags_id = spanNameID("postFlags");
+  ScopedSpan span(s_post_flags_id);
   for(unsigned int i=0; i<flags.size(); i++) 
     postFlag(flags[i], repeatable);
 }
@@ -35,6 +35,7 @@
 #include "CPAEngine.h"
 #include "VarDataPair.h"
 #include "LogicCondition.h"
+#include "LogicIndex.h"
 #include "BehaviorReport.h"
 #include "PlatModel.h"
 
@@ -86,6 +87,7 @@ public:
   void   statusInfoPost();
 
   std::string getDescriptor()            {return(m_descriptor);}
+  unsigned int getSpanID();
   std::string getUpdateVar() const       {return(m_update_var);}
   std::string getBehaviorType()          {return(m_behavior_type);}
   std::string getUpdateSummary()         {return(m_update_summary);}
@@ -226,6 +228,7 @@ protected:
 
   std::string m_us_name;       
   std::string m_descriptor;    
+  int         m_span_id;       // Profiler id of the descriptor, or -1
 
   double m_osx;   // Current ownship x position (meters) 
   double m_osy;   // Current ownship y position (meters) 
@@ -249,6 +252,7 @@ protected:
   std::vector<VarDataPair>       m_messages;
   std::vector<VarDataPair>       m_event_messages;
   std::vector<LogicCondition>    m_logic_conditions;
+  LogicIndex                     m_logic_index;
   std::vector<LogicCondition>    m_flag_conditions;
   std::vector<VarDataPair>       m_spawn_flags;
   std::vector<VarDataPair>       m_spawnx_flags;
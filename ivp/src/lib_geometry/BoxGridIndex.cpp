@@ -0,0 +1,260 @@
+/*****************************************************************/
+/*    FILE: BoxGridIndex.cpp                                     */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <algorithm>
+#include "BoxGridIndex.h"
+
+using namespace std;
+
+//---------------------------------------------------------------
+// Constructor()
+
+BoxGridIndex::BoxGridIndex(double cell_size)
+{
+  m_cell_size = 100;
+  m_max_cells = 64;
+  m_count     = 0;
+  setCellSize(cell_size);
+}
+
+//---------------------------------------------------------------
+// Procedure: setCellSize()
+//      Note: Only allowed while the index is empty
+
+bool BoxGridIndex::setCellSize(double cell_size)
+{
+  if((cell_size <= 0) || (m_count > 0))
+    return(false);
+  m_cell_size = cell_size;
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: clear()
+
+void BoxGridIndex::clear()
+{
+  m_boxes.clear();
+  m_present.clear();
+  m_oversize.clear();
+  m_cells.clear();
+  m_oversize_ids.clear();
+  m_count = 0;
+}
+
+//---------------------------------------------------------------
+// Procedure: setBox()
+//   Purpose: Add the box with the given id, or move it if present.
+
+void BoxGridIndex::setBox(unsigned int id, double xmin, double xmax,
+			  double ymin, double ymax)
+{
+  if(id < m_present.size()) {
+    if(m_present[id])
+      removeFromCells(id);
+  }
+  else {
+    m_boxes.resize(4*(id+1), 0);
+    m_present.resize(id+1, 0);
+    m_oversize.resize(id+1, 0);
+  }
+
+  if(!m_present[id])
+    m_count++;
+  m_present[id] = 1;
+
+  m_boxes[4*id]   = xmin;
+  m_boxes[4*id+1] = xmax;
+  m_boxes[4*id+2] = ymin;
+  m_boxes[4*id+3] = ymax;
+  addToCells(id);
+}
+
+//---------------------------------------------------------------
+// Procedure: removeBox()
+
+void BoxGridIndex::removeBox(unsigned int id)
+{
+  if(!hasBox(id))
+    return;
+  removeFromCells(id);
+  m_present[id] = 0;
+  m_count--;
+}
+
+//---------------------------------------------------------------
+// Procedure: hasBox()
+
+bool BoxGridIndex::hasBox(unsigned int id) const
+{
+  return((id < m_present.size()) && m_present[id]);
+}
+
+//---------------------------------------------------------------
+// Procedure: query()
+
+vector<unsigned int> BoxGridIndex::query(double xmin, double xmax,
+					 double ymin, double ymax) const
+{
+  vector<unsigned int> ids;
+  if(m_count == 0)
+    return(ids);
+
+  int ix_lo = cellIX(xmin);
+  int ix_hi = cellIX(xmax);
+  int iy_lo = cellIX(ymin);
+  int iy_hi = cellIX(ymax);
+
+  double cells = ((double)(ix_hi - ix_lo) + 1) * ((double)(iy_hi - iy_lo) + 1);
+
+  // A query over more cells than there are boxes or occupied cells
+  // is faster as a check of every box.
+  if((cells > (double)(m_count)) || (cells > (double)(m_cells.size()))) {
+    for(unsigned int id=0; id<m_present.size(); id++) {
+      if(m_present[id] && overlaps(id, xmin, xmax, ymin, ymax))
+	ids.push_back(id);
+    }
+    return(ids);
+  }
+  
+  for(int ix=ix_lo; ix<=ix_hi; ix++) {
+    for(int iy=iy_lo; iy<=iy_hi; iy++) {
+      map<long long, vector<unsigned int> >::const_iterator p;
+      p = m_cells.find(cellKey(ix, iy));
+      if(p == m_cells.end())
+	continue;
+      const vector<unsigned int>& cell_ids = p->second;
+      for(unsigned int i=0; i<cell_ids.size(); i++) {
+	if(overlaps(cell_ids[i], xmin, xmax, ymin, ymax))
+	  ids.push_back(cell_ids[i]);
+      }
+    }
+  }
+  for(unsigned int i=0; i<m_oversize_ids.size(); i++) {
+    if(overlaps(m_oversize_ids[i], xmin, xmax, ymin, ymax))
+      ids.push_back(m_oversize_ids[i]);
+  }
+
+  // A box in several cells is found once per cell
+  sort(ids.begin(), ids.end());
+  ids.erase(unique(ids.begin(), ids.end()), ids.end());
+  return(ids);
+}
+
+//---------------------------------------------------------------
+// Procedure: cellKey()
+
+long long BoxGridIndex::cellKey(int ix, int iy) const
+{
+  return(((long long)(ix) << 32) | (unsigned int)(iy));
+}
+
+//---------------------------------------------------------------
+// Procedure: cellIX()
+//   Purpose: Cell index of a coordinate, clipped so that huge values
+//            do not overflow the index.
+
+int BoxGridIndex::cellIX(double val) const
+{
+  if(val != val)   // NaN
+    return(0);
+  double ix = floor(val / m_cell_size);
+  if(ix > 1e9)
+    return(1000000000);
+  if(ix < -1e9)
+    return(-1000000000);
+  return((int)(ix));
+}
+
+//---------------------------------------------------------------
+// Procedure: overlaps()
+
+bool BoxGridIndex::overlaps(unsigned int id, double xmin, double xmax,
+			    double ymin, double ymax) const
+{
+  if((m_boxes[4*id+1] < xmin) || (m_boxes[4*id] > xmax))
+    return(false);
+  if((m_boxes[4*id+3] < ymin) || (m_boxes[4*id+2] > ymax))
+    return(false);
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: addToCells()
+
+void BoxGridIndex::addToCells(unsigned int id)
+{
+  int ix_lo = cellIX(m_boxes[4*id]);
+  int ix_hi = cellIX(m_boxes[4*id+1]);
+  int iy_lo = cellIX(m_boxes[4*id+2]);
+  int iy_hi = cellIX(m_boxes[4*id+3]);
+
+  double cells = ((double)(ix_hi - ix_lo) + 1) * ((double)(iy_hi - iy_lo) + 1);
+  if(cells > m_max_cells) {
+    m_oversize[id] = 1;
+    m_oversize_ids.push_back(id);
+    return;
+  }
+
+  m_oversize[id] = 0;
+  for(int ix=ix_lo; ix<=ix_hi; ix++) 
+    for(int iy=iy_lo; iy<=iy_hi; iy++)
+      m_cells[cellKey(ix, iy)].push_back(id);
+}
+
+//---------------------------------------------------------------
+// Procedure: removeFromCells()
+
+void BoxGridIndex::removeFromCells(unsigned int id)
+{
+  if(m_oversize[id]) {
+    vector<unsigned int>::iterator p;
+    p = find(m_oversize_ids.begin(), m_oversize_ids.end(), id);
+    if(p != m_oversize_ids.end())
+      m_oversize_ids.erase(p);
+    return;
+  }
+
+  int ix_lo = cellIX(m_boxes[4*id]);
+  int ix_hi = cellIX(m_boxes[4*id+1]);
+  int iy_lo = cellIX(m_boxes[4*id+2]);
+  int iy_hi = cellIX(m_boxes[4*id+3]);
+
+  for(int ix=ix_lo; ix<=ix_hi; ix++) {
+    for(int iy=iy_lo; iy<=iy_hi; iy++) {
+      map<long long, vector<unsigned int> >::iterator p;
+      p = m_cells.find(cellKey(ix, iy));
+      if(p == m_cells.end())
+	continue;
+      vector<unsigned int>& cell_ids = p->second;
+      vector<unsigned int>::iterator q;
+      q = find(cell_ids.begin(), cell_ids.end(), id);
+      if(q != cell_ids.end()) {
+	*q = cell_ids.back();
+	cell_ids.pop_back();
+      }
+      if(cell_ids.empty())
+	m_cells.erase(p);
+    }
+  }
+}
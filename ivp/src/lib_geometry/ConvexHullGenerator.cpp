@@ -25,12 +25,27 @@
 
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 #include "ConvexHullGenerator.h"
 #include "GeomUtils.h"
 #include "AngleUtils.h"
 
 using namespace std;
 
+//---------------------------------------------------------
+// Comparator for sorting point indices by radial angle, highest
+// angle first.
+
+class RadialAngleGreater
+{
+public:
+  RadialAngleGreater(const vector<double>& angles) : m_angles(angles) {}
+  bool operator()(unsigned int a, unsigned int b) const
+  {return(m_angles[a] > m_angles[b]);}
+private:
+  const vector<double>& m_angles;
+};
+
 //---------------------------------------------------------
 // Procedure: addPoint
 
@@ -318,27 +333,19 @@ void ConvexHullGenerator::sortPoints()
   }
 
   // Part 3: Sort based on radial angle, but keep the radial angle 
-  //         associated with each point for detecting ties.
+  //         associated with each point for detecting ties. Highest
+  //         angle first. The sort is stable so points with equal
+  //         angles keep their original relative order.
+  vector<unsigned int> order;
+  for(unsigned int i=0; i<m_points.size(); i++) 
+    order.push_back(i);
+  stable_sort(order.begin(), order.end(), RadialAngleGreater(radial_angles));
+
   vector<XYPoint> new_points;
-  vector<double>  new_angles;
-  bool done = false;
-  while(!done) {
-    double highest_angle_sofar = -181;
-    unsigned int index = m_points.size();
-    for(unsigned int i=0; i<m_points.size(); i++) {
-      if((radial_angles[i] != -999) && (radial_angles[i] > highest_angle_sofar)) {
-	index = i;
-	highest_angle_sofar = radial_angles[i];
-      }
-    }
-    if(index == m_points.size())
-      done = true;
-    else {
-      m_points[index].set_vz(radial_angles[index]);
-      radial_angles[index] = -999;
-      new_points.push_back(m_points[index]);
-      new_angles.push_back(radial_angles[index]);
-    }
+  for(unsigned int i=0; i<order.size(); i++) {
+    unsigned int index = order[i];
+    m_points[index].set_vz(radial_angles[index]);
+    new_points.push_back(m_points[index]);
   }
 
   // Part 4: Go through the sorted points and detect sets of points
@@ -358,7 +365,7 @@ void ConvexHullGenerator::sortPoints()
   double delta_angle_thresh = 0.1;
 
   new_points.clear();
-  done = false;
+  bool done = false;
   while(!done) {
     XYPoint pta = ptlist.front();
     ptlist.pop_front();
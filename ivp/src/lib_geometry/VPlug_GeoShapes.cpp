@@ -25,6 +25,7 @@
 #include <iostream>
 #include <iostream>
 #include <cstdlib>
+#include <atomic>
 #include "VPlug_GeoShapes.h"
 #include "MBUtils.h"
 #include "XYFormatUtilsSegl.h"
@@ -51,6 +52,9 @@ VPlug_GeoShapes::VPlug_GeoShapes()
   m_xmax = 0;
   m_ymin = 0;
   m_ymax = 0;
+
+  m_polygon_boxes_ok = true;
+  m_polygon_revision = 0;
 }
 
 //-----------------------------------------------------------
@@ -60,6 +64,7 @@ void VPlug_GeoShapes::clear(string shape, string stype)
 {
   if((shape == "") && (stype == "")) {
     m_polygons.clear();
+    rebuildPolygonIndex();
     m_seglists.clear();
     m_seglrs.clear();
     m_hexagons.clear();
@@ -115,8 +120,10 @@ bool VPlug_GeoShapes::setParam(const string& param, string value)
   else if(param ==  "convex_grid")
     return(addConvexGrid(value));
   else if(param == "clear") {
-    if(value == "seglists")
+    if(value == "seglists") {
       m_polygons.clear();
+      rebuildPolygonIndex();
+    }
     else if(value == "polygons")
       m_seglists.clear();
     else if(value == "grids") {
@@ -202,12 +209,23 @@ void VPlug_GeoShapes::manageMemory(double curr_time)
   }
 
   //-------------------------------------------------- Polygons
-  vector<XYPolygon> save_polys;
+  unsigned int first_expired = m_polygons.size();
   for(unsigned int i=0; i<m_polygons.size(); i++) {
-    if(!m_polygons[i].expired(curr_time))
-      save_polys.push_back(m_polygons[i]);
+    if(m_polygons[i].expired(curr_time)) {
+      first_expired = i;
+      break;
+    }
+  }
+  if(first_expired < m_polygons.size()) {
+    vector<XYPolygon> save_polys(m_polygons.begin(),
+				 m_polygons.begin() + first_expired);
+    for(unsigned int i=first_expired; i<m_polygons.size(); i++) {
+      if(!m_polygons[i].expired(curr_time))
+	save_polys.push_back(m_polygons[i]);
+    }
+    m_polygons = save_polys;
+    rebuildPolygonIndex(first_expired);
   }
-  m_polygons = save_polys;
 
   //-------------------------------------------------- SegLists
   vector<XYSegList> save_segls;
@@ -224,12 +242,21 @@ void VPlug_GeoShapes::manageMemory(double curr_time)
 
 void VPlug_GeoShapes::forgetPolygon(string label)
 {
+  if((label != "") && (m_polygon_labels.count(label) == 0))
+    return;
+
+  unsigned int first_removed = m_polygons.size();
   vector<XYPolygon> new_polys;
   for(unsigned int i=0; i<m_polygons.size(); i++) {
     if(m_polygons[i].get_label() != label) 
       new_polys.push_back(m_polygons[i]);
+    else if(first_removed == m_polygons.size())
+      first_removed = i;
+  }
+  if(new_polys.size() != m_polygons.size()) {
+    m_polygons = new_polys;
+    rebuildPolygonIndex(first_removed);
   }
-  m_polygons = new_polys;
 }
 
 
@@ -251,17 +278,19 @@ void VPlug_GeoShapes::addPolygon(const XYPolygon& new_poly)
 
   if(new_label == "") {
     m_polygons.push_back(new_poly);
+    polygonChanged(m_polygons.size()-1);
     return;
   }
 
-  unsigned int i, vsize = m_polygons.size();
-  for(i=0; i<vsize; i++) {
-    if(m_polygons[i].get_label() == new_label) {
-      m_polygons[i] = new_poly;
-      return;
-    }
+  map<string, unsigned int>::iterator p = m_polygon_labels.find(new_label);
+  if(p != m_polygon_labels.end()) {
+    m_polygons[p->second] = new_poly;
+    polygonChanged(p->second);
+    return;
   }
   m_polygons.push_back(new_poly);  
+  m_polygon_labels[new_label] = m_polygons.size()-1;
+  polygonChanged(m_polygons.size()-1);
 }
 
 //-----------------------------------------------------------
@@ -1161,6 +1190,111 @@ void VPlug_GeoShapes::updateBounds()
 }
 
 
+//-----------------------------------------------------------
+// Procedure: polygonsChanged()
+//      Note: Revisions are drawn from one counter shared by all
+//            instances, which may be updated from several threads.
+
+void VPlug_GeoShapes::polygonsChanged()
+{
+  static std::atomic<unsigned int> polygon_revisions(0);
+  m_polygon_revision = ++polygon_revisions;
+}
+
+//-----------------------------------------------------------
+// Procedure: polygonChanged()
+//   Purpose: Note the polygon at the given index was added or
+//            replaced, updating its revision and bounding box.
+
+void VPlug_GeoShapes::polygonChanged(unsigned int ix)
+{
+  if(ix >= m_polygons.size())
+    return;
+
+  polygonsChanged();
+  if(ix >= m_polygon_revs.size())
+    m_polygon_revs.resize(ix+1, 0);
+  m_polygon_revs[ix] = m_polygon_revision;
+
+  const XYPolygon& poly = m_polygons[ix];
+  if(poly.size() > 0)
+    m_polygon_boxes.setBox(ix, poly.get_min_x(), poly.get_max_x(),
+			   poly.get_min_y(), poly.get_max_y());
+  else
+    m_polygon_boxes.removeBox(ix);
+}
+
+//-----------------------------------------------------------
+// Procedure: touchPolygons()
+
+void VPlug_GeoShapes::touchPolygons()
+{
+  polygonsChanged();
+  m_polygon_revs.assign(m_polygons.size(), m_polygon_revision);
+}
+
+//-----------------------------------------------------------
+// Procedure: rebuildPolygonIndex()
+//   Purpose: Rebuild the label and box indices after polygons were
+//            removed. Polygons from the given index on have moved,
+//            so their revisions are updated too.
+
+void VPlug_GeoShapes::rebuildPolygonIndex(unsigned int from_ix)
+{
+  polygonsChanged();
+
+  m_polygon_labels.clear();
+  m_polygon_boxes.clear();
+  m_polygon_revs.resize(m_polygons.size(), 0);
+
+  for(unsigned int i=0; i<m_polygons.size(); i++) {
+    const XYPolygon& poly = m_polygons[i];
+    string label = poly.get_label();
+    if((label != "") && (m_polygon_labels.count(label) == 0))
+      m_polygon_labels[label] = i;
+    if(i >= from_ix)
+      m_polygon_revs[i] = m_polygon_revision;
+    if(poly.size() > 0)
+      m_polygon_boxes.setBox(i, poly.get_min_x(), poly.get_max_x(),
+			     poly.get_min_y(), poly.get_max_y());
+  }
+  m_polygon_boxes_ok = true;
+}
+
+//-----------------------------------------------------------
+// Procedure: getPolygonsInBox()
+
+vector<unsigned int> VPlug_GeoShapes::getPolygonsInBox(double xmin,
+						       double xmax,
+						       double ymin,
+						       double ymax) const
+{
+  if(m_polygon_boxes_ok)
+    return(m_polygon_boxes.query(xmin, xmax, ymin, ymax));
+
+  // A polygon was handed out for editing with poly(), so its box
+  // may be out of date. Return all polygons.
+  vector<unsigned int> all_ixs(m_polygons.size());
+  for(unsigned int i=0; i<m_polygons.size(); i++)
+    all_ixs[i] = i;
+  return(all_ixs);
+}
+
+//-----------------------------------------------------------
+// Procedure: poly()
+//   Purpose: Polygon by index, for editing in place. Its revision is
+//            updated, but its box is not known until the index is
+//            next rebuilt.
+
+XYPolygon& VPlug_GeoShapes::poly(unsigned int ix)
+{
+  polygonsChanged();
+  if(ix < m_polygon_revs.size())
+    m_polygon_revs[ix] = m_polygon_revision;
+  m_polygon_boxes_ok = false;
+  return(m_polygons[ix]);
+}
+
 //-----------------------------------------------------------
 // Procedure: clearPolygons()
 
@@ -1168,6 +1302,7 @@ void VPlug_GeoShapes::clearPolygons(string stype)
 {
   if(stype == "") {
     m_polygons.clear();
+    rebuildPolygonIndex();
     return;
   }
 
@@ -1177,6 +1312,7 @@ void VPlug_GeoShapes::clearPolygons(string stype)
       new_polygons.push_back(m_polygons[i]);
   } 
   m_polygons = new_polygons;
+  rebuildPolygonIndex();
 }
 
 //-----------------------------------------------------------
@@ -47,6 +47,7 @@
 #include "XYMarker.h"
 #include "XYTextBox.h"
 #include "ColorPack.h"
+#include "BoxGridIndex.h"
 
 class VPlug_GeoShapes {
 public:
@@ -132,17 +133,37 @@ public:
   unsigned int sizeTextBoxes() const   {return(m_textboxes.size());}
   unsigned int sizeTotalShapes() const;
 
-  std::vector<XYPolygon> getPolygons() const {return(m_polygons);}
-  std::vector<XYWedge>   getWedges() const   {return(m_wedges);}
+  const std::vector<XYPolygon>& getPolygons() const {return(m_polygons);}
+  const std::vector<XYWedge>&   getWedges() const   {return(m_wedges);}
   //std::vector<XYSegList> getSegLists() const {return(m_seglists);}
   //std::vector<XYSeglr  > getSeglrs() const   {return(m_seglrs);}
-  std::vector<XYArc> getArcs()         const {return(m_arcs);}
-  std::vector<XYHexagon> getHexagons() const {return(m_hexagons);}
-  std::vector<XYVector>  getVectors() const  {return(m_vectors);}
-  std::vector<XYGrid>    getGrids() const    {return(m_grids);}
-  std::vector<XYConvexGrid> getConvexGrids() const {return(m_convex_grids);}
-  std::vector<XYRangePulse> getRangePulses() const {return(m_range_pulses);}
-  std::vector<XYCommsPulse> getCommsPulses() const {return(m_comms_pulses);}
+  const std::vector<XYArc>&     getArcs() const     {return(m_arcs);}
+  const std::vector<XYHexagon>& getHexagons() const {return(m_hexagons);}
+  const std::vector<XYVector>&  getVectors() const  {return(m_vectors);}
+  const std::vector<XYGrid>&    getGrids() const    {return(m_grids);}
+  const std::vector<XYConvexGrid>& getConvexGrids() const {return(m_convex_grids);}
+  const std::vector<XYRangePulse>& getRangePulses() const {return(m_range_pulses);}
+  const std::vector<XYCommsPulse>& getCommsPulses() const {return(m_comms_pulses);}
+
+  // Changes whenever the set of polygons may have changed, so a
+  // viewer may keep drawing data built from them until it changes.
+  // Unique across all instances, so a cleared and re-created
+  // instance never repeats a prior revision.
+  unsigned int getPolygonRevision() const {return(m_polygon_revision);}
+
+  // Revision at which each polygon last changed, by polygon index
+  const std::vector<unsigned int>& getPolygonRevisions() const
+  {return(m_polygon_revs);}
+
+  // Give every polygon a new revision. Used after the instance is
+  // replaced wholesale, e.g., by assigning a saved copy, since the
+  // copy's revisions say nothing of what a viewer last drew.
+  void touchPolygons();
+
+  // Indices, ascending, of polygons with a bounding box overlapping
+  // the given box. Used by viewers to draw only what is in view.
+  std::vector<unsigned int> getPolygonsInBox(double xmin, double xmax,
+					     double ymin, double ymax) const;
 
   const std::map<std::string, XYPoint>&  getPoints() const  {return(m_points);}
   const std::map<std::string, XYSegList>&  getSegLists() const {return(m_segls);}
@@ -153,7 +174,7 @@ public:
   const std::map<std::string, XYMarker>& getMarkers() const {return(m_markers);}
   const std::map<std::string, XYTextBox>& getTextBoxes() const {return(m_textboxes);}
 
-  XYPolygon& poly(unsigned int i)   {return(m_polygons[i]);}
+  XYPolygon& poly(unsigned int i);
   //XYSeglr&   seglr(unsigned int i)  {return(m_seglrs[i]);}
 
   XYPolygon    getPolygon(unsigned int) const;
@@ -181,6 +202,10 @@ public:
 
   bool typeMatch(XYObject*, std::string stype);
 
+  void polygonsChanged();
+  void polygonChanged(unsigned int ix);
+  void rebuildPolygonIndex(unsigned int from_ix=0);
+
 protected:
   std::vector<XYPolygon>    m_polygons;
   std::vector<XYSegList>    m_seglists;
@@ -207,6 +232,14 @@ protected:
   double  m_xmax;
   double  m_ymin;
   double  m_ymax;
+
+  // Polygons indexed by label and by bounding box, and the revision
+  // at which each last changed, all by index into m_polygons.
+  std::map<std::string, unsigned int> m_polygon_labels;
+  BoxGridIndex                        m_polygon_boxes;
+  bool                                m_polygon_boxes_ok;
+  std::vector<unsigned int>           m_polygon_revs;
+  unsigned int                        m_polygon_revision;
 };
 
 #endif
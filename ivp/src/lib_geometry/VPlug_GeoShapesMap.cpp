@@ -90,11 +90,8 @@ bool VPlug_GeoShapesMap::addGeoShape(const string& param_orig,
 
   if(param == "VIEW_POINT")
     handled = m_geoshapes_map[vname].addPoint(value, timestamp);
-  else if(param == "VIEW_POLYGON") {
-    cout << "adding polygon" << endl;    
+  else if(param == "VIEW_POLYGON")
     handled = m_geoshapes_map[vname].addPolygon(value, timestamp);
-    cout << "handled:" << boolToString(handled) << endl;
-  }
   else if(param == "VIEW_SEGLIST")
     handled = m_geoshapes_map[vname].addSegList(value, timestamp);
   else if(param == "VIEW_SEGLR")
@@ -161,33 +158,33 @@ void VPlug_GeoShapesMap::manageMemory(double curr_time)
 // Procedure: getCommsPulses
 // Procedure: getMarkers
 
-vector<XYPolygon> VPlug_GeoShapesMap::getPolygons(const string& vname)
+const vector<XYPolygon>& VPlug_GeoShapesMap::getPolygons(const string& vname)
 {
   return(m_geoshapes_map[vname].getPolygons());
 }
-vector<XYWedge> VPlug_GeoShapesMap::getWedges(const string& vname)
+const vector<XYWedge>& VPlug_GeoShapesMap::getWedges(const string& vname)
 {
   return(m_geoshapes_map[vname].getWedges());
 }
-vector<XYHexagon> VPlug_GeoShapesMap::getHexagons(const string& vname)
+const vector<XYHexagon>& VPlug_GeoShapesMap::getHexagons(const string& vname)
 {
   return(m_geoshapes_map[vname].getHexagons());
 }
-vector<XYGrid> VPlug_GeoShapesMap::getGrids(const string& vname)
+const vector<XYGrid>& VPlug_GeoShapesMap::getGrids(const string& vname)
 {
   return(m_geoshapes_map[vname].getGrids());
 }
-vector<XYConvexGrid> VPlug_GeoShapesMap::getConvexGrids(const string& vname)
+const vector<XYConvexGrid>& VPlug_GeoShapesMap::getConvexGrids(const string& vname)
 {
   return(m_geoshapes_map[vname].getConvexGrids());
 }
 
-const map<string, XYSeglr> VPlug_GeoShapesMap::getSeglrs(const string& vname)
+const map<string, XYSeglr>& VPlug_GeoShapesMap::getSeglrs(const string& vname)
 {
   return(m_geoshapes_map[vname].getSeglrs());
 }
 
-const map<string, XYSegList> VPlug_GeoShapesMap::getSegLists(const string& vname)
+const map<string, XYSegList>& VPlug_GeoShapesMap::getSegLists(const string& vname)
 {
   return(m_geoshapes_map[vname].getSegLists());
 }
@@ -207,15 +204,15 @@ const map<string, XYPoint>& VPlug_GeoShapesMap::getPoints(const string& vname)
 {
   return(m_geoshapes_map[vname].getPoints());
 }
-vector<XYVector> VPlug_GeoShapesMap::getVectors(const string& vname)
+const vector<XYVector>& VPlug_GeoShapesMap::getVectors(const string& vname)
 {
   return(m_geoshapes_map[vname].getVectors());
 }
-vector<XYRangePulse> VPlug_GeoShapesMap::getRangePulses(const string& vname)
+const vector<XYRangePulse>& VPlug_GeoShapesMap::getRangePulses(const string& vname)
 {
   return(m_geoshapes_map[vname].getRangePulses());
 }
-vector<XYCommsPulse> VPlug_GeoShapesMap::getCommsPulses(const string& vname)
+const vector<XYCommsPulse>& VPlug_GeoShapesMap::getCommsPulses(const string& vname)
 {
   return(m_geoshapes_map[vname].getCommsPulses());
 }
@@ -228,6 +225,14 @@ const map<string, XYTextBox>& VPlug_GeoShapesMap::getTextBoxes(const string& vna
   return(m_geoshapes_map[vname].getTextBoxes());
 }
 
+//----------------------------------------------------------------
+// Procedure: getGeoShapes()
+
+const VPlug_GeoShapes& VPlug_GeoShapesMap::getGeoShapes(const string& vname)
+{
+  return(m_geoshapes_map[vname]);
+}
+
 
 //----------------------------------------------------------------
 // Procedure: size()
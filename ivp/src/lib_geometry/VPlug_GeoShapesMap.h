@@ -70,12 +70,12 @@ public:
   unsigned int sizeTextBoxes() const   {return(size("textboxes"));}
   unsigned int sizeTotalShapes() const {return(size("total_shapes"));}
 
-  std::vector<XYPolygon> getPolygons(const std::string&);
-  std::vector<XYWedge>   getWedges(const std::string&);
-  std::vector<XYHexagon> getHexagons(const std::string&);
+  const std::vector<XYPolygon>& getPolygons(const std::string&);
+  const std::vector<XYWedge>&   getWedges(const std::string&);
+  const std::vector<XYHexagon>& getHexagons(const std::string&);
 
-  const std::map<std::string, XYSeglr>    getSeglrs(const std::string&);
-  const std::map<std::string, XYSegList>  getSegLists(const std::string&);
+  const std::map<std::string, XYSeglr>&   getSeglrs(const std::string&);
+  const std::map<std::string, XYSegList>& getSegLists(const std::string&);
   const std::map<std::string, XYCircle>&  getCircles(const std::string&);
   const std::map<std::string, XYOval>&    getOvals(const std::string&);
   const std::map<std::string, XYArrow>&   getArrows(const std::string&);
@@ -83,11 +83,13 @@ public:
   const std::map<std::string, XYTextBox>& getTextBoxes(const std::string&);
   const std::map<std::string, XYPoint>&   getPoints(const std::string&);
 
-  std::vector<XYVector>     getVectors(const std::string&);
-  std::vector<XYGrid>       getGrids(const std::string&);
-  std::vector<XYConvexGrid> getConvexGrids(const std::string&);
-  std::vector<XYRangePulse> getRangePulses(const std::string&);
-  std::vector<XYCommsPulse> getCommsPulses(const std::string&);
+  const std::vector<XYVector>&     getVectors(const std::string&);
+  const std::vector<XYGrid>&       getGrids(const std::string&);
+  const std::vector<XYConvexGrid>& getConvexGrids(const std::string&);
+  const std::vector<XYRangePulse>& getRangePulses(const std::string&);
+  const std::vector<XYCommsPulse>& getCommsPulses(const std::string&);
+
+  const VPlug_GeoShapes& getGeoShapes(const std::string&);
 
   std::vector<std::string> getVehiNames() const {return(m_vnames);}
 
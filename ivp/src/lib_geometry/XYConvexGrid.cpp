@@ -26,6 +26,7 @@
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <algorithm>
 #include "XYConvexGrid.h"
 #include "XYGridUpdate.h"
 #include "MBUtils.h"
@@ -40,6 +41,13 @@ XYConvexGrid::XYConvexGrid()
 {
   m_pix_per_mtr_x = -1;
   m_pix_per_mtr_y = -1;
+
+  m_lattice_x0   = 0;
+  m_lattice_y0   = 0;
+  m_lattice_dx   = 0;
+  m_lattice_dy   = 0;
+  m_lattice_cols = 0;
+  m_lattice_rows = 0;
 }
 
 
@@ -111,8 +119,11 @@ bool XYConvexGrid::initialize(const XYPolygon& poly,
     return(false);
 
   unsigned int esize = m_elements.size();
+  bool lattice_ok = (m_lattice.size() == esize);
 
   for(i=0; i<esize; i++) {
+    if(lattice_ok)
+      m_lattice[i] = -1;
     xlow  = m_elements[i].getVal(0,0);
     xhigh = m_elements[i].getVal(0,1);
     ylow  = m_elements[i].getVal(1,0);
@@ -122,8 +133,11 @@ bool XYConvexGrid::initialize(const XYPolygon& poly,
     spoly.add_vertex(xhigh, ylow);
     spoly.add_vertex(xhigh, yhigh);
     spoly.add_vertex(xlow,  yhigh);
-    if(spoly.intersects(poly))
+    if(spoly.intersects(poly)) {
+      if(lattice_ok)
+	m_lattice[i] = (int)(int_elements.size());
       int_elements.push_back(m_elements[i]);
+    }
   }
 
   m_elements  = int_elements;
@@ -416,6 +430,9 @@ void XYConvexGrid::setMaxLimit(double max_limit, unsigned int cix)
 
 bool XYConvexGrid::ptIntersect(double x, double y) const
 {
+  if(latticeOK())
+    return(getCellsAt(x, y).size() > 0);
+
   unsigned int i, vsize = m_elements.size();
   for(i=0; i<vsize; i++) 
     if(m_elements[i].containsPoint(x, y))
@@ -423,6 +440,198 @@ bool XYConvexGrid::ptIntersect(double x, double y) const
   return(false);
 }
 
+//-------------------------------------------------------------
+// Procedure: getCellsAt()
+//   Purpose: Return the indices, in ascending order, of all cells
+//            containing the given point. Cell bounds are inclusive
+//            so a point on a shared edge or corner is in each of
+//            the cells sharing it, as with ptIntersect(ix,x,y).
+//      Note: The lattice position is found directly. Neighboring
+//            lattice positions are also checked to guard against
+//            rounding in the division, and for shared edges.
+
+vector<unsigned int> XYConvexGrid::getCellsAt(double x, double y) const
+{
+  vector<unsigned int> cells;
+  
+  if(!latticeOK()) {
+    for(unsigned int i=0; i<m_elements.size(); i++) 
+      if(m_elements[i].containsPoint(x, y))
+	cells.push_back(i);
+    return(cells);
+  }
+
+  // Written so that NaN values also fail the check
+  double fcol = (x - m_lattice_x0) / m_lattice_dx;
+  double frow = (y - m_lattice_y0) / m_lattice_dy;
+  if(!((fcol >= -1) && (fcol <= m_lattice_cols + 1)))
+    return(cells);
+  if(!((frow >= -1) && (frow <= m_lattice_rows + 1)))
+    return(cells);
+
+  int col = (int)(floor(fcol));
+  int row = (int)(floor(frow));
+
+  // Iterate in lattice order so element indices are ascending
+  for(int i=col-1; i<=col+1; i++) {
+    for(int j=row-1; j<=row+1; j++) {
+      if((i < 0) || (j < 0) || (i >= m_lattice_cols) || (j >= m_lattice_rows))
+	continue;
+      int ix = m_lattice[(i * m_lattice_rows) + j];
+      if((ix >= 0) && m_elements[ix].containsPoint(x, y))
+	cells.push_back((unsigned int)(ix));
+    }
+  }
+  return(cells);
+}
+
+//-------------------------------------------------------------
+// Procedure: getCellsOnSeg()
+//   Purpose: Return the indices, in ascending order, of all cells
+//            touched by the given line segment, including the cells
+//            containing either end point.
+//      Note: The segment is clipped to the lattice and the cells it
+//            passes through are walked one at a time in the order
+//            they are crossed. The cost is proportional to the
+//            number of cells crossed, not the size of the grid.
+
+vector<unsigned int> XYConvexGrid::getCellsOnSeg(double x1, double y1,
+						 double x2, double y2) const
+{
+  vector<unsigned int> cells;
+  
+  if(!latticeOK()) {
+    for(unsigned int i=0; i<m_elements.size(); i++) {
+      if(m_elements[i].containsPoint(x1, y1) ||
+	 m_elements[i].containsPoint(x2, y2) ||
+	 (m_elements[i].segIntersectLength(x1, y1, x2, y2) > 0))
+	cells.push_back(i);
+    }
+    return(cells);
+  }
+
+  // Part 1: The end points, which may lie on shared cell edges
+  cells = getCellsAt(x1, y1);
+  vector<unsigned int> end_cells = getCellsAt(x2, y2);
+  cells.insert(cells.end(), end_cells.begin(), end_cells.end());
+
+  // Part 2: Convert to lattice units and clip the segment to the
+  //         lattice bounds (Liang-Barsky)
+  double gx1 = (x1 - m_lattice_x0) / m_lattice_dx;
+  double gy1 = (y1 - m_lattice_y0) / m_lattice_dy;
+  double gx2 = (x2 - m_lattice_x0) / m_lattice_dx;
+  double gy2 = (y2 - m_lattice_y0) / m_lattice_dy;
+  double ddx = gx2 - gx1;
+  double ddy = gy2 - gy1;
+
+  double p[4] = {-ddx, ddx, -ddy, ddy};
+  double q[4] = {gx1, m_lattice_cols - gx1, gy1, m_lattice_rows - gy1};
+  double t0 = 0;
+  double t1 = 1;
+  bool   clipped_out = false;
+  for(unsigned int k=0; (k<4) && !clipped_out; k++) {
+    if(p[k] == 0) {
+      if(!(q[k] >= 0))
+	clipped_out = true;
+    }
+    else {
+      double t = q[k] / p[k];
+      if(p[k] < 0) {
+	if(t > t1)       clipped_out = true;
+	else if(t > t0)  t0 = t;
+      }
+      else {
+	if(t < t0)       clipped_out = true;
+	else if(t < t1)  t1 = t;
+      }
+    }
+  }
+
+  // Part 3: Walk the cells crossed by the clipped segment
+  if(!clipped_out) {
+    double cx1 = gx1 + (t0 * ddx);
+    double cy1 = gy1 + (t0 * ddy);
+    double cx2 = gx1 + (t1 * ddx);
+    double cy2 = gy1 + (t1 * ddy);
+
+    // Clipped points are within the lattice, but a point on the
+    // upper bound would otherwise map one past the last cell.
+    int col = min(max((int)(floor(cx1)), 0), m_lattice_cols-1);
+    int row = min(max((int)(floor(cy1)), 0), m_lattice_rows-1);
+    int col_end = min(max((int)(floor(cx2)), 0), m_lattice_cols-1);
+    int row_end = min(max((int)(floor(cy2)), 0), m_lattice_rows-1);
+
+    int step_col = (col_end >= col) ? 1 : -1;
+    int step_row = (row_end >= row) ? 1 : -1;
+    
+    // Parametric distance along the clipped segment to the next
+    // column and row boundaries, and between boundaries.
+    double sdx = cx2 - cx1;
+    double sdy = cy2 - cy1;
+    double tmax_col = 2;
+    double tmax_row = 2;
+    double tdelta_col = 0;
+    double tdelta_row = 0;
+    if(sdx != 0) {
+      double bound = (step_col > 0) ? (col + 1) : col;
+      tmax_col   = (bound - cx1) / sdx;
+      tdelta_col = 1 / fabs(sdx);
+    }
+    if(sdy != 0) {
+      double bound = (step_row > 0) ? (row + 1) : row;
+      tmax_row   = (bound - cy1) / sdy;
+      tdelta_row = 1 / fabs(sdy);
+    }
+
+    addLatticeCell(col, row, cells);
+    int steps = abs(col_end - col) + abs(row_end - row);
+    for(int k=0; k<steps; k++) {
+      if(((tmax_col < tmax_row) && (col != col_end)) || (row == row_end)) {
+	col += step_col;
+	tmax_col += tdelta_col;
+      }
+      else {
+	row += step_row;
+	tmax_row += tdelta_row;
+      }
+      addLatticeCell(col, row, cells);
+    }
+  }
+
+  sort(cells.begin(), cells.end());
+  cells.erase(unique(cells.begin(), cells.end()), cells.end());
+  return(cells);
+}
+
+//-------------------------------------------------------------
+// Procedure: latticeOK()
+//   Purpose: True if the index from lattice positions to elements
+//            is available. Otherwise lookups fall back to a search
+//            of all elements.
+
+bool XYConvexGrid::latticeOK() const
+{
+  if((m_lattice_cols <= 0) || (m_lattice_rows <= 0))
+    return(false);
+  if((m_lattice_dx <= 0) || (m_lattice_dy <= 0))
+    return(false);
+  return(m_lattice.size() == (unsigned int)(m_lattice_cols * m_lattice_rows));
+}
+
+//-------------------------------------------------------------
+// Procedure: addLatticeCell()
+
+void XYConvexGrid::addLatticeCell(int col, int row,
+				  vector<unsigned int>& cells) const
+{
+  if((col < 0) || (row < 0) || (col >= m_lattice_cols) || 
+     (row >= m_lattice_rows))
+    return;
+  int ix = m_lattice[(col * m_lattice_rows) + row];
+  if(ix >= 0)
+    cells.push_back((unsigned int)(ix));
+}
+
 //-------------------------------------------------------------
 // Procedure: ptIntersectBound
 //   Purpose: Determine is a given point is contained within the
@@ -472,6 +681,9 @@ bool XYConvexGrid::initialize(const XYSquare& outer_square,
   if(y_extra > 0)
     y_count++;
 
+  // The lattice index is only valid if these are the only elements
+  bool index_lattice = (m_elements.size() == 0);
+
   XYSquare new_square;
   for(int i=0; i<x_count; i++) {
     for(int j=0; j<y_count; j++) {
@@ -484,6 +696,20 @@ bool XYConvexGrid::initialize(const XYSquare& outer_square,
     }
   }
 
+  m_lattice.clear();
+  m_lattice_cols = 0;
+  m_lattice_rows = 0;
+  if(index_lattice) {
+    m_lattice_x0   = outer_square.getVal(0,0);
+    m_lattice_y0   = outer_square.getVal(1,0);
+    m_lattice_dx   = unit_x_len;
+    m_lattice_dy   = unit_y_len;
+    m_lattice_cols = x_count;
+    m_lattice_rows = y_count;
+    for(unsigned int k=0; k<m_elements.size(); k++)
+      m_lattice.push_back((int)(k));
+  }
+
   m_bounding_square = outer_square;
   return(true);
 }
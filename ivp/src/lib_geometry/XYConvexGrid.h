@@ -56,6 +56,11 @@ public:
   bool         ptIntersectBound(double, double) const;
   bool         segIntersectBound(double, double, double, double) const;
 
+  // Lookups by direct index into the regular cell layout
+  std::vector<unsigned int> getCellsAt(double x, double y) const;
+  std::vector<unsigned int> getCellsOnSeg(double x1, double y1,
+					  double x2, double y2) const;
+
   bool         hasCellVar(const std::string&) const;
   unsigned int getCellVarIX(const std::string&) const;
   unsigned int getCellVarCnt() const {return(m_cell_vars.size());}
@@ -96,6 +101,8 @@ public:
   
 protected:
   bool    initialize(const XYSquare&, const XYSquare&);
+  bool    latticeOK() const;
+  void    addLatticeCell(int col, int row, std::vector<unsigned int>&) const;
     
  protected: // Config variables
   XYPolygon m_config_poly;
@@ -124,6 +131,18 @@ protected:
   std::vector<double>                m_cell_min_sofar;
   std::vector<bool>                  m_cell_minmax_noted;
 
+ protected: // Index from the regular layout of cells to elements
+  double m_lattice_x0;
+  double m_lattice_y0;
+  double m_lattice_dx;
+  double m_lattice_dy;
+  int    m_lattice_cols;
+  int    m_lattice_rows;
+
+  // Index is (col * rows) + row. Value is the element index, or -1
+  // if that cell was dropped for lying outside the polygon.
+  std::vector<int> m_lattice;
+
  protected: // Support for caching for drawing
   std::vector<std::vector<double> > m_edge_cache;
   double m_pix_per_mtr_x;
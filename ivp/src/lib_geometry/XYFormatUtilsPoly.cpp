@@ -35,6 +35,7 @@
 #include "AngleUtils.h"
 #include "GeomUtils.h"
 #include "XYOval.h"
+#include "XYSpecScan.h"
 
 using namespace std;
 
@@ -134,7 +135,20 @@ XYPolygon stringStandard2Poly(string str)
   XYPolygon null_poly;
   XYPolygon new_poly;
 
-  string rest = stripBlankEnds(str);
+  // Most specs are in the common form produced by get_spec() and are
+  // handled in one pass. Anything else goes through the loop below.
+  string rest;
+  XYSpecFields fields;
+  if(scanStandardSpec(str, fields)) {
+    unsigned int i, vsize = fields.xs.size();
+    for(i=0; i<vsize; i++)
+      new_poly.add_vertex(fields.xs[i], fields.ys[i], fields.zs[i], "", false);
+    new_poly.determine_convexity();
+    for(i=0; i<fields.params.size(); i++)
+      new_poly.set_param(fields.params[i], fields.values[i]);
+  }
+  else
+    rest = stripBlankEnds(str);
 
   while(rest != "") {
     string left = stripBlankEnds(biteString(rest, '='));
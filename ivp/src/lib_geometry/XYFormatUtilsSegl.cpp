@@ -33,6 +33,7 @@
 #include "MBUtils.h"
 #include "AngleUtils.h"
 #include "GeomUtils.h"
+#include "XYSpecScan.h"
 
 using namespace std;
 
@@ -90,7 +91,19 @@ XYSegList stringStandard2SegList(string str)
   XYSegList null_segl;
   XYSegList new_seglist;
 
-  string rest = str;
+  // Most specs are in the common form produced by get_spec() and are
+  // handled in one pass. Anything else goes through the loop below.
+  string rest;
+  XYSpecFields fields;
+  if(scanStandardSpec(str, fields)) {
+    unsigned int i, vsize = fields.xs.size();
+    for(i=0; i<vsize; i++)
+      new_seglist.add_vertex(fields.xs[i], fields.ys[i], fields.zs[i]);
+    for(i=0; i<fields.params.size(); i++)
+      new_seglist.set_param(fields.params[i], fields.values[i]);
+  }
+  else
+    rest = str;
 
   while(rest != "") {
     string left = biteStringX(rest, '=');
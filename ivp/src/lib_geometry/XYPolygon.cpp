@@ -43,6 +43,12 @@ XYPolygon::XYPolygon()
 {
   m_convex_state = false;
   m_transparency = 0.5;
+  m_edges_ok     = false;
+
+  m_bbox_xmin = 0;
+  m_bbox_xmax = 0;
+  m_bbox_ymin = 0;
+  m_bbox_ymax = 0;
 }
 
 //---------------------------------------------------------------
@@ -51,6 +57,14 @@ XYPolygon::XYPolygon()
 XYPolygon::XYPolygon(double x, double y, double rad,
 		     unsigned int pts, string label)
 {
+  m_convex_state = false;
+  m_edges_ok     = false;
+
+  m_bbox_xmin = 0;
+  m_bbox_xmax = 0;
+  m_bbox_ymin = 0;
+  m_bbox_ymax = 0;
+
   setRadial(x, y, rad, pts);
   m_label = label;
 }
@@ -71,6 +85,7 @@ XYPolygon::XYPolygon(XYSegList segl)
   m_edge_tags = segl.m_edge_tags;
   m_transparency = segl.m_transparency;
   m_convex_state = false;
+  m_edges_ok     = false;
   determine_convexity();
 }
 
@@ -85,6 +100,7 @@ bool XYPolygon::add_vertex(double x, double y, bool check_convexity)
 {
   XYSegList::add_vertex(x,y);
   m_side_xy.push_back(-1);
+  m_edges_ok = false;
   
   // With new vertex, we don't know if the new polygon is valid
   if(check_convexity) {
@@ -120,6 +136,7 @@ bool XYPolygon::add_vertex_delta(double x, double y, double delta,
   
   XYSegList::add_vertex(x,y);
   m_side_xy.push_back(-1);
+  m_edges_ok = false;
   
   // With new vertex, we don't know if the new polygon is valid
   if(check_convexity) {
@@ -142,6 +159,7 @@ bool XYPolygon::add_vertex(double x, double y,
 {
   XYSegList::add_vertex(x,y,z);
   m_side_xy.push_back(-1);
+  m_edges_ok = false;
   
   // With new vertex, we don't know if the new polygon is valid
   if(check_convexity) {
@@ -164,6 +182,7 @@ bool XYPolygon::add_vertex(double x, double y, double z,
 {
   XYSegList::add_vertex(x, y, z, property);
   m_side_xy.push_back(-1);
+  m_edges_ok = false;
   
   // With new vertex, we don't know if the new polygon is valid
   if(check_convexity) {
@@ -364,6 +383,12 @@ void XYPolygon::clear()
   XYSegList::clear();
   m_side_xy.clear();
   m_convex_state = false;
+
+  m_edge_dx.clear();
+  m_edge_dy.clear();
+  m_edge_m.clear();
+  m_edge_b.clear();
+  m_edges_ok = false;
 }
 
 
@@ -431,6 +456,71 @@ void XYPolygon::rotate(double val, double cx, double cy)
   determine_convexity();
 }
 
+//---------------------------------------------------------------
+// Procedure: shift_horz()
+//      Note: A shift leaves the convexity unchanged, but the edge
+//            data needs to be reset.
+
+void XYPolygon::shift_horz(double val)
+{
+  XYSegList::shift_horz(val);
+  set_edges();
+}
+
+//---------------------------------------------------------------
+// Procedure: shift_vert()
+
+void XYPolygon::shift_vert(double val)
+{
+  XYSegList::shift_vert(val);
+  set_edges();
+}
+
+//---------------------------------------------------------------
+// Procedure: new_center()
+
+void XYPolygon::new_center(double x, double y)
+{
+  XYSegList::new_center(x, y);
+  set_edges();
+}
+
+//---------------------------------------------------------------
+// Procedure: new_centroid()
+
+void XYPolygon::new_centroid(double x, double y)
+{
+  XYSegList::new_centroid(x, y);
+  set_edges();
+}
+
+//---------------------------------------------------------------
+// Procedure: mod_vertex()
+//      Note: A call to "determine_convexity()" is made since this
+//            operation may result in a change in the convexity.
+
+void XYPolygon::mod_vertex(unsigned int ix, double x, double y,
+			   double z, string s)
+{
+  XYSegList::mod_vertex(ix, x, y, z, s);
+  determine_convexity();
+}
+
+//---------------------------------------------------------------
+// Procedure: pop_last_vertex()
+//      Note: A call to "determine_convexity()" is made since this
+//            operation may result in a change in the convexity.
+
+void XYPolygon::pop_last_vertex()
+{
+  if(m_vx.size() == 0)
+    return;
+
+  XYSegList::pop_last_vertex();
+  m_side_xy.pop_back();
+  determine_convexity();
+}
+
 
 //---------------------------------------------------------------
 // Procedure: contains()
@@ -452,29 +542,41 @@ bool XYPolygon::contains(double x, double y) const
   if(vsize == 0)
     return(false);
 
-  double x1, y1, x2, y2 = 0;
-  for(ix=0; ix<vsize; ix++) {
+  if(outside_bbox(x, y))
+    return(false);
 
-    x1 = m_vx[ix];
-    y1 = m_vy[ix];
-    
-    if((x==x1)&&(y==y1))
+  for(ix=0; ix<vsize; ix++) {
+    if((x==m_vx[ix]) && (y==m_vy[ix]))
       return(true);
     
-    int ixx = ix+1;
-    if(ix == vsize-1)
-      ixx = 0;
-    
-    x2 = m_vx[ixx];
-    y2 = m_vy[ixx];
-
-    int vside = side(x1, y1, x2, y2, x, y);
+    int vside = edge_side(ix, x, y);
     if((vside != 2) && (vside != m_side_xy[ix]))
       return(false);
   }
   return(true);
 }
 
+//---------------------------------------------------------------
+// Procedure: contains()
+//   Purpose: Batch version of contains(x,y) for many points
+
+vector<bool> XYPolygon::contains(const vector<double>& vx,
+				 const vector<double>& vy) const
+{
+  unsigned int i, psize = vx.size();
+  if(vy.size() < psize)
+    psize = vy.size();
+
+  vector<bool> results(psize, false);
+  if(!m_convex_state || (m_vx.size() == 0))
+    return(results);
+
+  for(i=0; i<psize; i++)
+    results[i] = contains(vx[i], vy[i]);
+
+  return(results);
+}
+
 //---------------------------------------------------------------
 // Procedure: contains()
 //   Purpose: Returns true if the given polygon is convex and all its
@@ -663,7 +765,38 @@ double XYPolygon::dist_to_poly(double px, double py) const
   // Distance to poly is given by the shortest distance to any
   // one of the edges.
   double dist = 0;
+  if(!m_edges_ok) {
+    for(ix=0; ix<vsize; ix++) {
+      int ixx = ix+1;
+      if(ix == vsize-1)
+	ixx = 0;
+
+      double idist = distPointToSeg(m_vx[ix], m_vy[ix], 
+				    m_vx[ixx], m_vy[ixx], 
+				    px, py); 
+      if((ix==0) || (idist < dist))
+	dist = idist;
+    }
+    return(dist);
+  }
+
+  // With edge data, first find the squared distance to the closest
+  // edge cheaply, then call distPointToSeg() only for those edges
+  // that may be the closest. The pad covers the approximations made
+  // in perpSegIntPt() for nearly vertical or horizontal edges.
+  double min_dist_sq = 0;
+  for(ix=0; ix<vsize; ix++) {
+    double idist_sq = edge_dist_sq(ix, px, py);
+    if((ix==0) || (idist_sq < min_dist_sq))
+      min_dist_sq = idist_sq;
+  }
+  double thresh = sqrt(min_dist_sq) * (1 + 1e-9) + 1e-5;
+  double thresh_sq = thresh * thresh;
+
+  bool first = true;
   for(ix=0; ix<vsize; ix++) {
+    if(edge_dist_sq(ix, px, py) > thresh_sq)
+      continue;
     int ixx = ix+1;
     if(ix == vsize-1)
       ixx = 0;
@@ -671,13 +804,32 @@ double XYPolygon::dist_to_poly(double px, double py) const
     double idist = distPointToSeg(m_vx[ix], m_vy[ix], 
 				  m_vx[ixx], m_vy[ixx], 
 				  px, py); 
-    if((ix==0) || (idist < dist))
+    if(first || (idist < dist))
       dist = idist;
+    first = false;
   }
 
   return(dist);
 }
 
+//---------------------------------------------------------------
+// Procedure: dist_to_poly()
+//   Purpose: Batch version of dist_to_poly(px,py) for many points
+
+vector<double> XYPolygon::dist_to_poly(const vector<double>& vx,
+				       const vector<double>& vy) const
+{
+  unsigned int i, psize = vx.size();
+  if(vy.size() < psize)
+    psize = vy.size();
+
+  vector<double> dists(psize, -1);
+  for(i=0; i<psize; i++)
+    dists[i] = dist_to_poly(vx[i], vy[i]);
+
+  return(dists);
+}
+
 //---------------------------------------------------------------
 // Procedure: dist_to_poly
 //      Note: Determine the distance between the line segment given
@@ -721,7 +873,8 @@ double XYPolygon::dist_to_poly(double x3, double y3,
 // Procedure: dist_to_poly()
 //      Note: Determine the distance between the point given by px,py
 //            to the polygon along a given angle. An edge-by-edge check
-//            is performed and the minimum returned. 
+//            is performed and the minimum returned. Edges are skipped
+//            if the angle is outside the bearings they subtend.
 //   Returns: -1 if given ray doesn't intersect the polygon
 
 double XYPolygon::dist_to_poly(double px, double py, double angle) const 
@@ -755,6 +908,11 @@ double XYPolygon::dist_to_poly(double px, double py, double angle) const
     double x2 = m_vx[ixx];
     double y2 = m_vy[ixx];
 
+    double ang_low, ang_width;
+    if(edge_bearings(ix, px, py, ang_low, ang_width))
+      if(angle360(angle - ang_low) > ang_width)
+	continue;
+
     double idist = distPointToSeg(x1,y1,x2,y2,px,py, angle); 
     if(idist != -1)
       if(first_hit || (idist < dist)) {
@@ -766,6 +924,53 @@ double XYPolygon::dist_to_poly(double px, double py, double angle) const
   return(dist);
 }
 
+//---------------------------------------------------------------
+// Procedure: dist_to_poly()
+//   Purpose: Batch version of dist_to_poly(px,py,angle) for many
+//            angles from the same point, e.g., one per heading.
+//            The bearings subtended by each edge are found once
+//            for all angles.
+
+vector<double> XYPolygon::dist_to_poly(double px, double py,
+				       const vector<double>& angles) const
+{
+  unsigned int i, asize = angles.size();
+  vector<double> dists(asize, -1);
+
+  unsigned int ix, vsize = m_vx.size();
+  if(vsize <= 2) {
+    for(i=0; i<asize; i++)
+      dists[i] = dist_to_poly(px, py, angles[i]);
+    return(dists);
+  }
+
+  for(ix=0; ix<vsize; ix++) {
+    double x1 = m_vx[ix];
+    double y1 = m_vy[ix];
+    
+    unsigned int ixx = ix+1;
+    if(ix == vsize-1)
+      ixx = 0;
+    
+    double x2 = m_vx[ixx];
+    double y2 = m_vy[ixx];
+
+    double ang_low, ang_width;
+    bool   limited = edge_bearings(ix, px, py, ang_low, ang_width);
+
+    for(i=0; i<asize; i++) {
+      if(limited && (angle360(angles[i] - ang_low) > ang_width))
+	continue;
+      double idist = distPointToSeg(x1,y1,x2,y2,px,py, angles[i]); 
+      if(idist != -1)
+	if((dists[i] == -1) || (idist < dists[i]))
+	  dists[i] = idist;
+    }
+  }
+  
+  return(dists);
+}
+
 //---------------------------------------------------------------
 // Procedure: seg_intercepts
 //   Purpose: Return true if the given segment intercepts the 
@@ -799,6 +1004,16 @@ bool XYPolygon::seg_intercepts(double x1, double y1,
   }
 
   // Now handle the general case of more than two vertices
+  // A segment clear of the bounding box cannot intercept
+  if(m_edges_ok) {
+    double pad = 1e-6;
+    if(((x1 < m_bbox_xmin-pad) && (x2 < m_bbox_xmin-pad)) ||
+       ((x1 > m_bbox_xmax+pad) && (x2 > m_bbox_xmax+pad)) ||
+       ((y1 < m_bbox_ymin-pad) && (y2 < m_bbox_ymin-pad)) ||
+       ((y1 > m_bbox_ymax+pad) && (y2 > m_bbox_ymax+pad)))
+      return(false);
+  }
+
   // First check if one of the ends of the segment are contained
   // in the polygon
 
@@ -1055,6 +1270,168 @@ int XYPolygon::side(double x1, double y1, double x2, double y2,
     return(2);
 }
 
+//---------------------------------------------------------------
+// Procedure: edge_side()
+//   Purpose: Same as side() for the edge ix and the point x3,y3,
+//            using the edge data if set.
+
+int XYPolygon::edge_side(unsigned int ix, double x3, double y3) const
+{
+  unsigned int vsize = m_vx.size();
+  unsigned int ixx = ix+1;
+  if(ixx == vsize)
+    ixx = 0;
+
+  if(!m_edges_ok)
+    return(side(m_vx[ix], m_vy[ix], m_vx[ixx], m_vy[ixx], x3, y3));
+
+  // Handle special cases, as in side()
+  if(m_edge_dx[ix] == 0) {
+    double x1 = m_vx[ix];
+    if(m_edge_dy[ix] == 0)
+      return(2);
+    else {
+      if(x3 >  x1) return(0);
+      if(x3 <  x1) return(1);
+      if(x3 == x1) return(2);
+    }
+  }
+
+  double y = (m_edge_m[ix] * x3) + m_edge_b[ix];
+  if(y > y3)  
+    return(0);
+  else if(y < y3)  
+    return(1);
+  else
+    return(2);
+}
+
+//---------------------------------------------------------------
+// Procedure: edge_dist_sq()
+//   Purpose: Squared distance from x,y to the edge ix. Requires
+//            the edge data to be set.
+
+double XYPolygon::edge_dist_sq(unsigned int ix, double x, double y) const
+{
+  double dx = m_edge_dx[ix];
+  double dy = m_edge_dy[ix];
+  double rx = x - m_vx[ix];
+  double ry = y - m_vy[ix];
+
+  double len_sq = (dx * dx) + (dy * dy);
+  if(len_sq > 0) {
+    double t = ((rx * dx) + (ry * dy)) / len_sq;
+    if(t > 1)
+      t = 1;
+    else if(t < 0)
+      t = 0;
+    rx -= t * dx;
+    ry -= t * dy;
+  }
+  return((rx * rx) + (ry * ry));
+}
+
+//---------------------------------------------------------------
+// Procedure: edge_bearings()
+//   Purpose: Find the bearings from px,py subtended by the edge ix,
+//            widened by a small margin. A ray outside of these does
+//            not hit the edge, although rounding in segmentsCross()
+//            may say otherwise for nearly vertical edges.
+//   Returns: false if all bearings should be checked, i.e., px,py
+//            is on or very near the edge or the edge has no length
+
+bool XYPolygon::edge_bearings(unsigned int ix, double px, double py,
+			      double& ang_low, double& ang_width) const
+{
+  ang_low   = 0;
+  ang_width = 360;
+
+  unsigned int ixx = ix+1;
+  if(ixx == m_vx.size())
+    ixx = 0;
+
+  double x1 = m_vx[ix];
+  double y1 = m_vy[ix];
+  double x2 = m_vx[ixx];
+  double y2 = m_vy[ixx];
+  if((x1 == x2) && (y1 == y2))
+    return(false);
+  if(distPointToSeg(x1, y1, x2, y2, px, py) <= 0.001)
+    return(false);
+
+  double ang1 = relAng(px, py, x1, y1);
+  double ang2 = relAng(px, py, x2, y2);
+  ang_low   = ang1;
+  ang_width = angle360(ang2 - ang1);
+  if(ang_width > 180) {
+    ang_low   = ang2;
+    ang_width = 360 - ang_width;
+  }
+  if(ang_width >= 179)
+    return(false);
+
+  double margin = 0.001;
+  ang_low   -= margin;
+  ang_width += (2 * margin);
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: set_edges()
+//   Purpose: Set the edge vectors, the slope and intercept of each
+//            edge line, and the bounding box. Called whenever the
+//            vertices change.
+
+void XYPolygon::set_edges()
+{
+  unsigned int ix, vsize = m_vx.size();
+
+  m_edge_dx.resize(vsize);
+  m_edge_dy.resize(vsize);
+  m_edge_m.resize(vsize);
+  m_edge_b.resize(vsize);
+
+  for(ix=0; ix<vsize; ix++) {
+    unsigned int ixx = ix+1;
+    if(ixx == vsize)
+      ixx = 0;
+
+    double rise = m_vy[ixx] - m_vy[ix];
+    double run  = m_vx[ixx] - m_vx[ix];
+    m_edge_dx[ix] = run;
+    m_edge_dy[ix] = rise;
+    m_edge_m[ix]  = rise / run;
+    m_edge_b[ix]  = m_vy[ixx] - (m_edge_m[ix] * m_vx[ixx]);
+
+    if((ix == 0) || (m_vx[ix] < m_bbox_xmin))
+      m_bbox_xmin = m_vx[ix];
+    if((ix == 0) || (m_vx[ix] > m_bbox_xmax))
+      m_bbox_xmax = m_vx[ix];
+    if((ix == 0) || (m_vy[ix] < m_bbox_ymin))
+      m_bbox_ymin = m_vy[ix];
+    if((ix == 0) || (m_vy[ix] > m_bbox_ymax))
+      m_bbox_ymax = m_vy[ix];
+  }
+
+  m_edges_ok = true;
+}
+
+//---------------------------------------------------------------
+// Procedure: outside_bbox()
+//   Purpose: True if x,y is clearly outside the bounding box. The
+//            small pad keeps the result of contains() the same as
+//            the edge-by-edge check for points on the boundary.
+
+bool XYPolygon::outside_bbox(double x, double y) const
+{
+  if(!m_edges_ok)
+    return(false);
+
+  double pad = 1e-6;
+  return((x < m_bbox_xmin-pad) || (x > m_bbox_xmax+pad) ||
+	 (y < m_bbox_ymin-pad) || (y > m_bbox_ymax+pad));
+}
+
 //---------------------------------------------------------------
 // Procedure: set_side
 //      Note: An edge given by index ix is the edge from ix to ix+1
@@ -1082,26 +1459,16 @@ void XYPolygon::set_side(int ix)
   if(vsize <= 2)
     return;
 
-  double x1,y1,x2,y2,x3,y3;
-
-  x1 = m_vx[ix];
-  y1 = m_vy[ix];
-
   int ixx = ix+1;
   if(ix == vsize-1)
     ixx = 0;
 
-  x2 = m_vx[ixx];
-  y2 = m_vy[ixx];
-
   m_side_xy[ix] = -1;
 
   bool fresh = true;
   for(int j=0; j<vsize; j++) {
     if((j!=ix) && (j!=ixx)) {
-      x3 = m_vx[j];
-      y3 = m_vy[j];
-      int iside = side(x1,y1,x2,y2,x3,y3);
+      int iside = edge_side(ix, m_vx[j], m_vy[j]);
 
       if(iside != 2) {
 	if(fresh) {
@@ -1127,6 +1494,8 @@ void XYPolygon::set_side(int ix)
 
 void XYPolygon::determine_convexity()
 {
+  set_edges();
+
   unsigned int i;
   for(i=0; i<size(); i++)
     set_side(i);
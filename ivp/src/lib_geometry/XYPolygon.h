@@ -57,6 +57,13 @@ public:
   void   rotate(double, double, double);
   void   rotate(double);
 
+  void   shift_horz(double val);
+  void   shift_vert(double val);
+  void   new_center(double x, double y);
+  void   new_centroid(double x, double y);
+  void   mod_vertex(unsigned int, double, double, double=0, std::string s="");
+  void   pop_last_vertex();
+
 public:
   bool   contains(double, double) const;
   bool   contains(const XYPoint&) const;
@@ -69,6 +76,15 @@ public:
   double dist_to_poly(double x1, double y1, double x2, double y2) const;
   double dist_to_poly(double px, double py, double angle) const;
   bool   seg_intercepts(double, double, double, double) const;
+
+  // Batch versions, same results as calling the above for each
+  std::vector<bool>   contains(const std::vector<double>& vx,
+			       const std::vector<double>& vy) const;
+  std::vector<double> dist_to_poly(const std::vector<double>& vx,
+				   const std::vector<double>& vy) const;
+  std::vector<double> dist_to_poly(double px, double py,
+				   const std::vector<double>& angles) const;
+
   bool   line_intersects(double x1, double y1, double x2, double y2,
 			 double& ix1, double& iy1,
 			 double& ix2, double& iy2) const;
@@ -97,12 +113,33 @@ public:
 protected:
   int    side(double x1, double y1, double x2, 
 	      double y2, double x3, double y3) const;
+  int    edge_side(unsigned int ix, double x3, double y3) const;
+  double edge_dist_sq(unsigned int ix, double x, double y) const;
+  bool   edge_bearings(unsigned int ix, double px, double py,
+		       double& ang_low, double& ang_width) const;
   void   set_side(int);
+  void   set_edges();
+  bool   outside_bbox(double x, double y) const;
+  void   vertices_changed() {m_edges_ok=false;}
 
 private:
   std::vector<int> m_side_xy;
 
   bool     m_convex_state;
+
+  // Edge data set by set_edges(), from determine_convexity(). Edge
+  // ix runs from vertex ix to ix+1, or to vertex 0 if ix is last.
+  // Slope and intercept are as calculated in side().
+  std::vector<double> m_edge_dx;
+  std::vector<double> m_edge_dy;
+  std::vector<double> m_edge_m;
+  std::vector<double> m_edge_b;
+
+  double   m_bbox_xmin;
+  double   m_bbox_xmax;
+  double   m_bbox_ymin;
+  double   m_bbox_ymax;
+  bool     m_edges_ok;
 };
 
 #endif
@@ -61,6 +61,7 @@ XYSegList::XYSegList(double x1, double y1, double x2, double y2)
 
 void XYSegList::add_vertex(double x, double y, double z, string vprop)
 {
+  vertices_changed();
   m_vx.push_back(x);
   m_vy.push_back(y);
   m_vz.push_back(z);
@@ -73,6 +74,7 @@ void XYSegList::add_vertex(double x, double y, double z, string vprop)
 void XYSegList::mod_vertex(unsigned int ix, double x, double y,
 			   double z, string vprop)
 {
+  vertices_changed();
   if(ix < size()) {
     m_vx[ix] = x;
     m_vy[ix] = y;
@@ -87,6 +89,7 @@ void XYSegList::mod_vertex(unsigned int ix, double x, double y,
 
 void XYSegList::add_vertex(const XYPoint &pt, string vprop)
 {
+  vertices_changed();
   m_vx.push_back(pt.x());
   m_vy.push_back(pt.y());
   m_vz.push_back(pt.z());
@@ -100,6 +103,7 @@ void XYSegList::add_vertex(const XYPoint &pt, string vprop)
 
 void XYSegList::alter_vertex(double x, double y, double z, string vprop)
 {
+  vertices_changed();
   unsigned int vsize = m_vx.size();
   if(vsize == 0)
     return;
@@ -118,6 +122,7 @@ void XYSegList::alter_vertex(double x, double y, double z, string vprop)
 
 void XYSegList::delete_vertex(double x, double y)
 {
+  vertices_changed();
   unsigned int vsize = m_vx.size();
   if(vsize == 0)
     return;
@@ -134,6 +139,7 @@ void XYSegList::delete_vertex(double x, double y)
 
 void XYSegList::delete_vertex(unsigned int ix)
 {
+  vertices_changed();
   unsigned int vsize = m_vx.size();
   if(ix >= vsize)
     return;
@@ -168,6 +174,7 @@ void XYSegList::delete_vertex(unsigned int ix)
 
 void XYSegList::pop_last_vertex()
 {
+  vertices_changed();
   unsigned int vsize = m_vx.size();
   if(vsize == 0)
     return;
@@ -185,6 +192,7 @@ void XYSegList::pop_last_vertex()
 
 void XYSegList::insert_vertex(double x, double y, double z, string vprop)
 {
+  vertices_changed();
   unsigned int vsize = m_vx.size();
   if(vsize <= 1)
     return(add_vertex(x,y,z,vprop));
@@ -226,6 +234,7 @@ void XYSegList::insert_vertex(double x, double y, double z, string vprop)
 
 void XYSegList::clear()
 {
+  vertices_changed();
   XYObject::clear();
   m_vx.clear();
   m_vy.clear();
@@ -239,6 +248,7 @@ void XYSegList::clear()
 
 void XYSegList::shift_horz(double shift_val)
 {
+  vertices_changed();
   unsigned int i, vsize = m_vx.size();
   for(i=0; i<vsize; i++)
     m_vx[i] += shift_val;
@@ -249,6 +259,7 @@ void XYSegList::shift_horz(double shift_val)
 
 void XYSegList::shift_vert(double shift_val)
 {
+  vertices_changed();
   unsigned int i, vsize = m_vy.size();
   for(i=0; i<vsize; i++)
     m_vy[i] += shift_val;
@@ -259,6 +270,7 @@ void XYSegList::shift_vert(double shift_val)
 
 void XYSegList::grow_by_pct(double pct)
 {
+  vertices_changed();
   double cx = get_centroid_x();
   double cy = get_centroid_y();
 
@@ -272,6 +284,7 @@ void XYSegList::grow_by_pct(double pct)
 
 void XYSegList::grow_by_amt(double amt)
 {
+  vertices_changed();
   double cx = get_centroid_x();
   double cy = get_centroid_y();
 
@@ -285,6 +298,7 @@ void XYSegList::grow_by_amt(double amt)
 
 void XYSegList::rotate(double degval, double cx, double cy)
 {
+  vertices_changed();
   unsigned int i, vsize = m_vy.size();
   for(i=0; i<vsize; i++)
     rotate_pt(degval, cx, cy, m_vx[i], m_vy[i]);
@@ -295,6 +309,7 @@ void XYSegList::rotate(double degval, double cx, double cy)
 
 void XYSegList::rotate(double degval)
 {
+  vertices_changed();
   double cx = get_centroid_x();
   double cy = get_centroid_y();
 
@@ -306,6 +321,7 @@ void XYSegList::rotate(double degval)
 
 void XYSegList::apply_snap(double snapval)
 {
+  vertices_changed();
   unsigned int i, vsize = m_vy.size();
   for(i=0; i<vsize; i++) {
     m_vx[i] = snapToStep(m_vx[i], snapval);
@@ -318,6 +334,7 @@ void XYSegList::apply_snap(double snapval)
 
 void XYSegList::reverse()
 {
+  vertices_changed();
   vector<double> new_x;
   vector<double> new_y;
   vector<double> new_z;
@@ -341,6 +358,7 @@ void XYSegList::reverse()
 
 void XYSegList::new_center(double new_cx, double new_cy)
 {
+  vertices_changed();
   double diff_x = new_cx - get_center_x();
   double diff_y = new_cy - get_center_y();
   
@@ -353,6 +371,7 @@ void XYSegList::new_center(double new_cx, double new_cy)
 
 void XYSegList::new_centroid(double new_cx, double new_cy)
 {
+  vertices_changed();
   double diff_x = new_cx - get_centroid_x();
   double diff_y = new_cy - get_centroid_y();
   
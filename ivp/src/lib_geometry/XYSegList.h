@@ -116,6 +116,10 @@ public:
   EdgeTagSet get_edge_tags() const {return(m_edge_tags);}
   
 protected:
+  // Called on any edit of the vertices, for subclasses that keep
+  // data derived from them
+  virtual void vertices_changed() {}
+
   void   grow_pt_by_pct(double, double, double, double&, double&);
   void   grow_pt_by_amt(double, double, double, double&, double&);
   void   rotate_pt(double, double, double, double&, double&);
@@ -0,0 +1,218 @@
+/*****************************************************************/
+/*    FILE: XYSpecScan.cpp                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include "XYSpecScan.h"
+
+using namespace std;
+
+//---------------------------------------------------------------
+// Procedure: isBlank()
+//      Note: Only blanks and tabs, as with stripBlankEnds()
+
+static bool isBlank(char c)
+{
+  return((c == ' ') || (c == '\t'));
+}
+
+//---------------------------------------------------------------
+// Procedure: stripRange()
+//   Purpose: Narrow the range [b,e) of str to exclude blank ends
+
+static void stripRange(const string& str, size_t& b, size_t& e)
+{
+  while((b < e) && isBlank(str[b]))
+    b++;
+  while((e > b) && isBlank(str[e-1]))
+    e--;
+}
+
+//---------------------------------------------------------------
+// Procedure: biteRange()
+//   Purpose: As with biteStringX(), on the range [b,e) of str. The
+//            front range is [fb,fe), and [b,e) becomes the rest.
+
+static void biteRange(const string& str, size_t& b, size_t& e,
+		      char c, size_t& fb, size_t& fe)
+{
+  fb = b;
+  fe = e;
+  const char *p = (const char*)memchr(str.data()+b, c, e-b);
+  if(p) {
+    fe = p - str.data();
+    b  = fe + 1;
+  }
+  else
+    b = e;
+  stripRange(str, fb, fe);
+  stripRange(str, b, e);
+}
+
+//---------------------------------------------------------------
+// Procedure: isNumberRange()
+//      Note: As with isNumber() on an already stripped range
+
+static bool isNumberRange(const string& str, size_t b, size_t e)
+{
+  if(b == e)
+    return(false);
+  if(((e-b) > 1) && (str[b] == '+'))
+    b++;
+
+  int digi_cnt = 0;
+  int deci_cnt = 0;
+  for(size_t i=b; i<e; i++) {
+    char c = str[i];
+    if((c >= '0') && (c <= '9'))
+      digi_cnt++;
+    else if(c == '.') {
+      deci_cnt++;
+      if(deci_cnt > 1)
+	return(false);
+    }
+    else if(c == '-') {
+      if((digi_cnt > 0) || (deci_cnt > 0))
+	return(false);
+    }
+    else
+      return(false);
+  }
+  return(digi_cnt > 0);
+}
+
+//---------------------------------------------------------------
+// Procedure: scanVertices()
+//   Purpose: Scan the vertices in [b,e), the contents of pts={...}
+//            without the braces. False if any vertex has a property
+//            or is malformed.
+//      Note: A number is converted in place. A valid number is
+//            always followed by a blank, comma, colon, brace or the
+//            end of the string, so strtod() stops just where atof()
+//            would on a copy of the number.
+
+static bool scanVertices(const string& str, size_t b, size_t e,
+			 XYSpecFields& fields)
+{
+  const char *data = str.c_str();
+  while(b < e) {
+    // One vertex, as with parseString(pstr, ':')
+    size_t vb = b;
+    size_t ve = e;
+    const char *p = (const char*)memchr(data+b, ':', e-b);
+    if(p) {
+      ve = p - data;
+      b  = ve + 1;
+    }
+    else
+      b = e;
+    stripRange(str, vb, ve);
+
+    size_t xb, xe, yb, ye, zb, ze, pb, pe;
+    biteRange(str, vb, ve, ',', xb, xe);
+    biteRange(str, vb, ve, ',', yb, ye);
+    biteRange(str, vb, ve, ',', zb, ze);
+    biteRange(str, vb, ve, ',', pb, pe);
+
+    if(!isNumberRange(str, xb, xe) || !isNumberRange(str, yb, ye))
+      return(false);
+    if(pb != pe)
+      return(false);
+
+    double zval = 0;
+    if(isNumberRange(str, zb, ze))
+      zval = strtod(data+zb, 0);
+    else if(zb != ze)
+      return(false);
+
+    fields.xs.push_back(strtod(data+xb, 0));
+    fields.ys.push_back(strtod(data+yb, 0));
+    fields.zs.push_back(zval);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: clear()
+
+void XYSpecFields::clear()
+{
+  xs.clear();
+  ys.clear();
+  zs.clear();
+  params.clear();
+  values.clear();
+}
+
+//---------------------------------------------------------------
+// Procedure: scanStandardSpec()
+//      Note: Mirrors the loop of stringStandard2Poly(), bailing out
+//            wherever that loop would fail or take a rarer branch.
+
+bool scanStandardSpec(const string& str, XYSpecFields& fields)
+{
+  fields.clear();
+
+  // stripBlankEnds() and friends stop at an embedded null
+  if(memchr(str.data(), '\0', str.size()))
+    return(false);
+
+  size_t b = 0;
+  size_t e = str.size();
+  stripRange(str, b, e);
+
+  bool pts_found = false;
+  while(b < e) {
+    size_t lb, le;
+    biteRange(str, b, e, '=', lb, le);
+
+    if(((le-lb) == 4) && !str.compare(lb, 4, "tags"))
+      return(false);
+
+    if(((le-lb) == 3) && !str.compare(lb, 3, "pts")) {
+      if(pts_found)
+	return(false);
+      pts_found = true;
+
+      size_t pb, pe;
+      biteRange(str, b, e, '}', pb, pe);
+      if((pb == pe) || (str[pb] != '{'))
+	return(false);
+      pb++;
+
+      if(b < e) {
+	if(str[b] != ',')
+	  return(false);
+	b++;
+      }
+      if(!scanVertices(str, pb, pe, fields))
+	return(false);
+    }
+    else {
+      size_t rb, re;
+      biteRange(str, b, e, ',', rb, re);
+      fields.params.push_back(str.substr(lb, le-lb));
+      fields.values.push_back(str.substr(rb, re-rb));
+    }
+  }
+  return(true);
+}
@@ -0,0 +1,53 @@
+/*****************************************************************/
+/*    FILE: XYSpecScan.h                                         */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef XY_SPEC_SCAN_HEADER
+#define XY_SPEC_SCAN_HEADER
+
+#include <string>
+#include <vector>
+
+// Single-pass scan of the standard spec format shared by polygons
+// and seglists, e.g., "pts={0,0:10,0:10,10},label=abe,active=true".
+// Only the common case is accepted: one pts field, vertices given
+// as x,y or x,y,z without properties, and no edge tags. For anything
+// else false is returned and the caller should fall back to its
+// general parser. When true is returned the fields are exactly those
+// the general parser would have found.
+
+class XYSpecFields
+{
+public:
+  void clear();
+
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::vector<double> zs;
+
+  // Non-pts fields in the order given
+  std::vector<std::string> params;
+  std::vector<std::string> values;
+};
+
+bool scanStandardSpec(const std::string& spec, XYSpecFields& fields);
+
+#endif
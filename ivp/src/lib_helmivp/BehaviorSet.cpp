@@ -27,7 +27,9 @@
 #include "MBUtils.h"
 #include "IvPFunction.h"
 #include "FunctionEncoder.h"
+#include "FunctionEncoderBin.h"
 #include "ColorParse.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -37,6 +39,7 @@ using namespace std;
 BehaviorSet::BehaviorSet()
 {
   m_report_ipf = true;
+  m_ipf_binary = false;
   m_curr_time  = -1;
   m_bfactory_dynamic.loadEnvVarDirectories("IVP_BEHAVIOR_DIRS");
 
@@ -639,7 +642,11 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
   new_activity_state = bhv->isRunnable();
   
   // Invoke the onEveryState() function applicable in all situations
-  bhv->onEveryState(new_activity_state);
+  {
+    static const unsigned int s_on_every_state_id = spanNameID("onEveryState");
+    ScopedSpan span(s_on_every_state_id);
+    bhv->onEveryState(new_activity_state);
+  }
   
   // ===================================================================
   // Part 2: With new_activity_state set, act appropriately for
@@ -677,6 +684,8 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
     }
     if((old_activity_state == "running") || (old_activity_state == "active"))
       bhv->onRunToIdleState();
+    static const unsigned int s_on_idle_state_id = spanNameID("onIdleState");
+    ScopedSpan span(s_on_idle_state_id);
     bhv->onIdleState();
     bhv->updateStateDurations("idle");
   }
@@ -702,8 +711,11 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
     ipf_reuse = !need_to_run;
     bhv->noteLastRunCheck(need_to_run, getCurrTime());
 
-    if(need_to_run)
+    if(need_to_run) {
+      static const unsigned int s_on_run_state_id = spanNameID("onRunState");
+      ScopedSpan span(s_on_run_state_id);
       ipf = bhv->onRunState();
+    }
 
     // Step 2: If IvP function contains NaN components, report and abort
     if(ipf && !ipf->freeOfNan()) {
@@ -723,11 +735,17 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
     }
     // Step 4: If we're serializing and posting IvP functions, do here
     if(ipf && m_report_ipf) {
+      static const unsigned int s_ipf_encode_id = spanNameID("ipf_encode");
+      ScopedSpan span(s_ipf_encode_id);
       string desc_str = bhv->getDescriptor();
       string iter_str = uintToString(iteration);
       string ctxt_str = iter_str + ":" + desc_str;
       ipf->setContextStr(ctxt_str);
-      string ipf_str = IvPFunctionToString(ipf);
+      string ipf_str;
+      if(m_ipf_binary)
+	ipf_str = IvPFunctionToStringBin(ipf);
+      else
+	ipf_str = IvPFunctionToString(ipf);
       bhv->postMessage("BHV_IPF", ipf_str);
     }
     // Step 5: Handle normal case of healthy IvP function returned
@@ -962,6 +980,17 @@ string BehaviorSet::getDescriptor(unsigned int ix)
   return("");
 }
 
+//------------------------------------------------------------
+// Procedure: getSpanID
+
+unsigned int BehaviorSet::getSpanID(unsigned int ix)
+{
+  IvPBehavior* bhv = getBehavior(ix);
+  if(!bhv)
+    return(spanNameID(""));
+  return(bhv->getSpanID());
+}
+
 //------------------------------------------------------------
 // Procedure: getStateElapsed
 
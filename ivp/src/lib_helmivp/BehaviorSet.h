@@ -73,6 +73,7 @@ public:
   unsigned int size()                   {return(m_bhv_entry.size());}
 
   void         setReportIPF(bool v)     {m_report_ipf=v;}
+  void         setIPFBinary(bool v)     {m_ipf_binary=v;}
   bool         stateOK(unsigned int);
   void         resetStateOK();
   IvPFunction* produceOF(unsigned int ix, unsigned int iter, 
@@ -85,6 +86,7 @@ public:
   IvPBehavior*   getBehavior(unsigned int);
   bool           isBehaviorAGoalBehavior(unsigned int);
   std::string    getDescriptor(unsigned int);
+  unsigned int   getSpanID(unsigned int);
   std::string    getUpdateSummary(unsigned int);
   std::string    getUpdateVarSummary();
   double         getStateElapsed(unsigned int);
@@ -168,6 +170,7 @@ protected:
   std::string m_ownship;
 
   bool    m_report_ipf;
+  bool    m_ipf_binary;
   double  m_curr_time;
   bool    m_completed_pending;
 
@@ -33,6 +33,7 @@
 #include "IO_Utilities.h"
 #include "IvPProblem.h"
 #include "BehaviorSet.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -98,6 +99,11 @@ HelmReport HelmEngine::determineNextDecision(BehaviorSet *bhv_set,
   m_helm_report.clear();
   m_map_ipfs.clear();
 
+  if(spanProfiler().isEnabled())
+    spanProfiler().setIteration(m_iteration);
+  static const unsigned int s_helm_iterate_id = spanNameID("helm_iterate");
+  ScopedSpan span(s_helm_iterate_id);
+
   vector<string> templating_summary = m_bhv_set->getTemplatingSummary();
   m_helm_report.setTemplatingSummary(templating_summary);
   
@@ -227,6 +233,8 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
   m_helm_report.addMsg(msgx);
   
   // get all the objective functions and add time info to helm report
+  static const unsigned int s_create_id = spanNameID("create");
+  ScopedSpan span(s_create_id);
   m_create_timer.start();
   for(bhv_ix=0; bhv_ix<bhv_cnt; bhv_ix++) {
     if(m_bhv_set->getFilterLevel(bhv_ix) == filter_level) {
@@ -234,8 +242,13 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
       bool   ipf_reuse = false;
       m_ipf_timer.start();
 
-      IvPFunction *newof = m_bhv_set->produceOF(bhv_ix, m_iteration,
-						bhv_state, ipf_reuse);
+      // Spans within produceOF are nested under the behavior name
+      IvPFunction *newof = 0;
+      {
+	ScopedSpan bhv_span(m_bhv_set->getSpanID(bhv_ix));
+	newof = m_bhv_set->produceOF(bhv_ix, m_iteration, bhv_state,
+				     ipf_reuse);
+      }
       
       //cout << "********************************************" << endl;
       //string bname = m_bhv_set->getDescriptor(bhv_ix);
@@ -469,6 +482,8 @@ bool HelmEngine::part4_BuildAndSolveIvPProblem(string phase)
   // Create, Prepare, and Solve the IvP problem
   m_ivp_problem = new IvPProblem;
   m_ivp_problem->setOwnerIPFs(false);
+  static const unsigned int s_solve_id = spanNameID("solve");
+  ScopedSpan span(s_solve_id);
   m_solve_timer.start();
   map<string, IvPFunction*>::iterator p;
   for(p=m_map_ipfs.begin(); p!=m_map_ipfs.end(); p++) {
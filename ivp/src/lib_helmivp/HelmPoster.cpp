@@ -0,0 +1,472 @@
+/*****************************************************************/
+/*    FILE: HelmPoster.cpp                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdlib>
+#include "HelmPoster.h"
+#include "BehaviorSet.h"
+#include "InfoBuffer.h"
+#include "LifeEvent.h"
+#include "VarDataPair.h"
+#include "FunctionEncoder.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//--------------------------------------------------------------------
+// Procedure: Constructor()
+
+HelmPosting::HelmPosting(const string& var, const string& sval,
+			 const string& src)
+{
+  m_var  = var;
+  m_sval = sval;
+  m_dval = 0;
+  m_src  = src;
+  m_is_string = true;
+}
+
+HelmPosting::HelmPosting(const string& var, double dval,
+			 const string& src)
+{
+  m_var  = var;
+  m_dval = dval;
+  m_src  = src;
+  m_is_string = false;
+}
+
+//--------------------------------------------------------------------
+// Procedure: Constructor()
+
+HelmPoster::HelmPoster()
+{
+  m_info_buffer    = 0;
+  m_curr_time      = 0;
+  m_start_time     = 0;
+  m_helm_iteration = 0;
+
+  m_bhv_count      = 0;
+  m_bhv_count_ever = 0;
+  m_prev_total_completed = 0;
+  m_outgoing_revision    = 0;
+}
+
+//--------------------------------------------------------------------
+// Procedure: setRepeatInterval()
+//   Purpose: Allow a keyed behavior posting of the given variable to
+//            be re-posted now and then even if its value is unchanged.
+//            See detectRepeatOnKey().
+
+void HelmPoster::setRepeatInterval(const string& var, double secs)
+{
+  m_outgoing_repinterval[var] = secs;
+}
+
+//--------------------------------------------------------------------
+// Procedure: clear()
+//   Purpose: Forget all prior postings, e.g., upon a helm restart.
+
+void HelmPoster::clear()
+{
+  clearKeys();
+  clearPostings();
+
+  m_outgoing_timestamp.clear();
+  m_outgoing_sval.clear();
+  m_outgoing_dval.clear();
+  m_outgoing_iter.clear();
+  m_outgoing_bhv.clear();
+  m_outgoing_repinterval.clear();
+  m_outgoing_revision++;
+}
+
+//--------------------------------------------------------------------
+// Procedure: clearKeys()
+//   Purpose: Forget the last keyed values so that all behavior
+//            postings are made again on the next iteration.
+
+void HelmPoster::clearKeys()
+{
+  m_outgoing_key_strings.clear();
+  m_outgoing_key_doubles.clear();
+}
+
+//--------------------------------------------------------------------
+// Procedure: clearPostings()
+
+void HelmPoster::clearPostings()
+{
+  m_postings.clear();
+  m_run_warnings.clear();
+  m_retractions.clear();
+  m_events.clear();
+}
+
+//------------------------------------------------------------
+// Procedure: handleModeMessages()
+//      Note: Run once after every iteration of control loop.
+
+void HelmPoster::handleModeMessages(BehaviorSet *bhv_set)
+{
+  if(!bhv_set)
+    return;
+
+  vector<VarDataPair> mvector = bhv_set->getModeVarDataPairs();
+  for(unsigned int j=0; j<mvector.size(); j++) {
+    VarDataPair msg = mvector[j];
+
+    string var  = msg.get_var();
+    string mkey = msg.get_key();
+
+    if(msg.is_string()) {
+      string sdata = msg.get_sdata();
+      if(detectChangeOnKey(mkey, sdata))
+	addPosting(var, sdata, "HELM_MODE");
+    }
+    else {
+      double ddata = msg.get_ddata();
+      if(detectChangeOnKey(mkey, ddata))
+	addPosting(var, ddata, "HELM_MODE");
+    }
+  }
+}
+
+//------------------------------------------------------------
+// Procedure: handleBehaviorMessages()
+//      Note: Run once after every iteration of control loop.
+//            Each behavior has the chance to produce their
+//            own message to be posted in both the info_buffer
+//            and to the MOOSDB.
+
+void HelmPoster::handleBehaviorMessages(BehaviorSet *bhv_set)
+{
+  if(!bhv_set)
+    return;
+
+  vector<string> config_warnings = bhv_set->getWarnings();
+  for(unsigned int i=0; i<config_warnings.size(); i++) {
+    m_run_warnings.push_back(config_warnings[i]);
+    addPosting("IVPHELM_BHVSET_WARNING",
+	       uintToString(i) + ":" + config_warnings[i]);
+  }
+  bhv_set->clearWarnings();
+
+  unsigned int bhv_count = bhv_set->size();
+  if(bhv_count != m_bhv_count) {
+    addPosting("IVPHELM_BHV_CNT", bhv_count);
+    m_bhv_count = bhv_count;
+  }
+
+  unsigned int bhv_count_ever = bhv_set->getTCount();
+  if(bhv_count_ever != m_bhv_count_ever) {
+    addPosting("IVPHELM_BHV_CNT_EVER", bhv_count_ever);
+    m_bhv_count_ever = bhv_count_ever;
+  }
+
+  addPosting("IVPHELM_ITER", m_helm_iteration);
+  for(unsigned int i=0; i<bhv_count; i++) {
+    string bhv_descriptor = bhv_set->getDescriptor(i);
+    vector<VarDataPair> mvector = bhv_set->getMessages(i);
+
+    for(unsigned int j=0; j<mvector.size(); j++) {
+      VarDataPair msg = mvector[j];
+
+      string var   = msg.get_var();
+      string sdata = msg.get_sdata();
+      double ddata = msg.get_ddata();
+      string mkey  = msg.get_key();
+
+      bool key_change = true;
+      bool key_repeat = detectRepeatOnKey(var);
+      if(sdata == "")
+	key_change = detectChangeOnKey(mkey, ddata);
+      else
+	key_change = detectChangeOnKey(mkey, sdata);
+
+      if(mkey == "repeatable")
+	key_repeat = true;
+
+      // Warnings are also included in the owner's run warnings
+      if(var == "BHV_WARNING") {
+	if(!strEnds(mkey, "retract"))
+	  m_run_warnings.push_back("BHV_WARNING: " + sdata);
+	else
+	  m_retractions.push_back("BHV_WARNING: " + sdata);
+      }
+      else if(var == "BHV_ERROR")
+	m_run_warnings.push_back("BHV_ERROR: " + sdata);
+
+      // If posting an IvP Function, mux first and post the parts.
+      if(var == "BHV_IPF") {
+	string id = bhv_descriptor + "^" + intToString(m_helm_iteration);
+	vector<string> svector = IvPFunctionToVector(sdata, id, 2000);
+	for(unsigned int k=0; k<svector.size(); k++)
+	  addPosting("BHV_IPF", svector[k], bhv_descriptor);
+	continue;
+      }
+
+      string aux = intToString(m_helm_iteration) + ":" + bhv_descriptor;
+      if(msg.is_string()) {
+	if(m_info_buffer)
+	  m_info_buffer->setValue(var, sdata);
+	if(key_change || key_repeat) {
+	  addPosting(var, sdata, aux);
+	  m_outgoing_timestamp[var] = m_curr_time;
+	  m_outgoing_iter[var] = m_helm_iteration;
+	  m_outgoing_sval[var] = sdata;
+	  m_outgoing_bhv[var]  = bhv_descriptor;
+	  m_outgoing_revision++;
+
+	  if(var == "BHV_EVENT")
+	    m_events.push_back(sdata);
+	}
+      }
+      else {
+	if(m_info_buffer)
+	  m_info_buffer->setValue(var, ddata);
+	if(key_change || key_repeat) {
+	  addPosting(var, ddata, aux);
+	  m_outgoing_timestamp[var] = m_curr_time;
+	  m_outgoing_iter[var] = m_helm_iteration;
+	  m_outgoing_dval[var] = ddata;
+	  m_outgoing_bhv[var]  = bhv_descriptor;
+	  m_outgoing_revision++;
+	}
+      }
+    }
+  }
+
+  // Determine if the list of state-space related variables for
+  // the behavior-set has changed and post the new set if so.
+  bool changed = bhv_set->updateStateSpaceVars();
+  if(changed)
+    addPosting("IVPHELM_STATEVARS", bhv_set->getStateSpaceVars());
+
+  string helm_iter = uintToString(m_helm_iteration);
+
+  string compl_pending = boolToString(bhv_set->getCompletedPending());
+  if(compl_pending != m_prev_compl_pending)
+    addPosting("IVPHELM_COMPLETED_PENDING", compl_pending, helm_iter);
+  m_prev_compl_pending = compl_pending;
+
+  unsigned int total_completed = bhv_set->removeCompletedBehaviors();
+  if(total_completed != m_prev_total_completed)
+    addPosting("IVPHELM_COMPLETED_COUNT", total_completed, helm_iter);
+  m_prev_total_completed = total_completed;
+}
+
+//------------------------------------------------------------
+// Procedure: handleLifeEvents()
+//      Note: Run once after every iteration of control loop.
+
+void HelmPoster::handleLifeEvents(BehaviorSet *bhv_set)
+{
+  if(!bhv_set)
+    return;
+
+  vector<LifeEvent> events = bhv_set->getLifeEvents();
+  for(unsigned int i=0; i<events.size(); i++) {
+    double htime = m_curr_time - m_start_time;
+    string str = "time=" + doubleToString(htime, 2);
+    str += ", iter="  + intToString(m_helm_iteration);
+    str += ", bname=" + events[i].getBehaviorName();
+    str += ", btype=" + events[i].getBehaviorType();
+    str += ", event=" + events[i].getEventType();
+    str += ", seed="  + events[i].getSpawnString();
+    str += ", posting_index=" + uintToString(i);
+    addPosting("IVPHELM_LIFE_EVENT", str);
+  }
+  if(events.size() > 0)
+    bhv_set->clearLifeEvents();
+}
+
+//------------------------------------------------------------
+// Procedure: handleDefaultVariables()
+//
+//   Post the "default variables". These variable/value pairs are
+//   provided in the behavior file. The post is made on each helm
+//   iteration if the variable involved was not written to by any
+//   of the behaviors on this iteration. Thus all the behavior
+//   messages must be collected first (phase1) and the default
+//   values posted once compared against the list (phase 2).
+
+void HelmPoster::handleDefaultVariables(BehaviorSet *bhv_set)
+{
+  if(!bhv_set)
+    return;
+
+  // Phase 1 - determine what variables were written to by the
+  // behaviors during the last iteration.
+  vector<string> message_vars;
+  for(unsigned int i=0; i<bhv_set->size(); i++) {
+    vector<VarDataPair> mvector = bhv_set->getMessages(i);
+    for(unsigned int j=0; j<mvector.size(); j++)
+      message_vars.push_back(mvector[j].get_var());
+  }
+
+  // Phase 2 - Examine each of the default_messages and determine
+  // for each, if the variable was contained in one of the behavior
+  // messages for this iteration. If not, then post the default.
+  vector<VarDataPair> dvector = bhv_set->getDefaultVariables();
+  for(unsigned int j=0; j<dvector.size(); j++) {
+    VarDataPair msg = dvector[j];
+    string var = msg.get_var();
+    if(vectorContains(message_vars, var))
+      continue;
+    if(msg.is_string()) {
+      string sdata = msg.get_sdata();
+      if(m_info_buffer)
+	m_info_buffer->setValue(var, sdata);
+      addPosting(var, sdata);
+    }
+    else {
+      double ddata = msg.get_ddata();
+      if(m_info_buffer)
+	m_info_buffer->setValue(var, ddata);
+      addPosting(var, ddata);
+    }
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: detectRepeatOnKey()
+// Notes: When the helm posts a VarDataPair it may be posted with the
+//        understanding that subsequent posts are disallowed if the
+//        value has not changed. To indicate this, the VarDataPair sets
+//        its KEY field.
+//        The helm may be configured to allow subsequent posts be made
+//        even if the value has not changed, even if the VarDataPair has
+//        set its key field.
+//        This process determines if a given variable should be allowed
+//        to re-post, given the values in m_outgoing_timestamp, and
+//        m_outgoing_repinterval.
+
+bool HelmPoster::detectRepeatOnKey(const string& key)
+{
+  // If no interval has been declared for this variable, repeat fails.
+  map<string, double>::iterator p = m_outgoing_repinterval.find(key);
+  if(p == m_outgoing_repinterval.end())
+    return(false);
+  double interval = p->second;
+  if(interval <= 0)
+    return(false);
+
+  // If no prior posting has been made, repeat fails.
+  p = m_outgoing_timestamp.find(key);
+  if(p == m_outgoing_timestamp.end())
+    return(false);
+  double timestamp = p->second;
+
+  int    random_range = 100;
+  double elapsed_time = m_curr_time - timestamp;
+  if(elapsed_time < interval) {
+    int rand_int = rand() % random_range;
+    double threshold = (1 / interval) * random_range;
+    if(rand_int < threshold)
+      return(true);
+  }
+  return(false);
+}
+
+//--------------------------------------------------------------------
+// Procedure: detectChangeOnKey()
+//   Purpose: To determine if the given key-value pair is unique
+//            against the last key-value posting.
+//      Note: The assumption is that if a change is detected, the caller
+//            will go ahead and make the posting. This assumption is
+//            reflected in the fact that the m_outgoing_key_strings map
+//            is updated when a changed is detected.
+
+bool HelmPoster::detectChangeOnKey(const string& key, const string& value)
+{
+  if(key == "")
+    return(true);
+  map<string, string>::iterator p = m_outgoing_key_strings.find(key);
+  if((p != m_outgoing_key_strings.end()) && (p->second == value))
+    return(false);
+
+  m_outgoing_key_strings[key] = value;
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: detectChangeOnKey()
+
+bool HelmPoster::detectChangeOnKey(const string& key, double value)
+{
+  if(key == "")
+    return(true);
+  map<string, double>::iterator p = m_outgoing_key_doubles.find(key);
+  if((p != m_outgoing_key_doubles.end()) && (p->second == value))
+    return(false);
+
+  m_outgoing_key_doubles[key] = value;
+  return(true);
+}
+
+//--------------------------------------------------------------------
+// Procedure: getOutgoingValue()
+
+string HelmPoster::getOutgoingValue(const string& var) const
+{
+  map<string, string>::const_iterator p = m_outgoing_sval.find(var);
+  if(p != m_outgoing_sval.end())
+    return(p->second);
+  map<string, double>::const_iterator q = m_outgoing_dval.find(var);
+  if(q != m_outgoing_dval.end())
+    return(doubleToStringX(q->second));
+  return("???");
+}
+
+//--------------------------------------------------------------------
+// Procedure: getOutgoingBehavior()
+
+string HelmPoster::getOutgoingBehavior(const string& var) const
+{
+  map<string, string>::const_iterator p = m_outgoing_bhv.find(var);
+  if(p == m_outgoing_bhv.end())
+    return("");
+  return(p->second);
+}
+
+//--------------------------------------------------------------------
+// Procedure: getOutgoingIteration()
+
+unsigned int HelmPoster::getOutgoingIteration(const string& var) const
+{
+  map<string, unsigned int>::const_iterator p = m_outgoing_iter.find(var);
+  if(p == m_outgoing_iter.end())
+    return(0);
+  return(p->second);
+}
+
+//--------------------------------------------------------------------
+// Procedure: addPosting()
+
+void HelmPoster::addPosting(const string& var, const string& sval,
+			    const string& src)
+{
+  m_postings.push_back(HelmPosting(var, sval, src));
+}
+
+void HelmPoster::addPosting(const string& var, double dval,
+			    const string& src)
+{
+  m_postings.push_back(HelmPosting(var, dval, src));
+}
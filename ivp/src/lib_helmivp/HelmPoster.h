@@ -0,0 +1,142 @@
+/*****************************************************************/
+/*    FILE: HelmPoster.h                                         */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef HELM_POSTER_HEADER
+#define HELM_POSTER_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+
+class BehaviorSet;
+class InfoBuffer;
+
+// A HelmPosting is one outgoing helm post. The src is the auxiliary
+// source handed to Notify(), e.g. "HELM_MODE" or "12:loiter".
+
+class HelmPosting
+{
+ public:
+  HelmPosting(const std::string& var, const std::string& sval,
+	      const std::string& src="");
+  HelmPosting(const std::string& var, double dval,
+	      const std::string& src="");
+  ~HelmPosting() {}
+
+  std::string getVar() const  {return(m_var);}
+  std::string getSVal() const {return(m_sval);}
+  double      getDVal() const {return(m_dval);}
+  std::string getSrc() const  {return(m_src);}
+  bool        isString() const {return(m_is_string);}
+
+ protected:
+  std::string m_var;
+  std::string m_sval;
+  double      m_dval;
+  std::string m_src;
+  bool        m_is_string;
+};
+
+// The HelmPoster turns the per-iteration output of a BehaviorSet into
+// the helm's outgoing postings: behavior messages filtered by key,
+// mode messages, life events, default variables and the IVPHELM_*
+// bookkeeping variables. It holds no connection to a MOOSDB. The
+// owner (pHelmIvP, or a vehicle in the batch simulator) retrieves
+// the postings after each step and delivers them itself.
+
+class HelmPoster
+{
+ public:
+  HelmPoster();
+  ~HelmPoster() {}
+
+  void setInfoBuffer(InfoBuffer *ibuffer) {m_info_buffer=ibuffer;}
+  void setCurrTime(double v)              {m_curr_time=v;}
+  void setStartTime(double v)             {m_start_time=v;}
+  void setIteration(unsigned int v)       {m_helm_iteration=v;}
+  void setRepeatInterval(const std::string& var, double secs);
+
+  void clear();
+  void clearKeys();
+
+  void handleModeMessages(BehaviorSet*);
+  void handleBehaviorMessages(BehaviorSet*);
+  void handleLifeEvents(BehaviorSet*);
+  void handleDefaultVariables(BehaviorSet*);
+
+  bool detectChangeOnKey(const std::string& key, const std::string& sval);
+  bool detectChangeOnKey(const std::string& key, double dval);
+  bool detectRepeatOnKey(const std::string& key);
+
+  std::vector<HelmPosting> getPostings() const    {return(m_postings);}
+  std::vector<std::string> getRunWarnings() const {return(m_run_warnings);}
+  std::vector<std::string> getRetractions() const {return(m_retractions);}
+  std::vector<std::string> getEvents() const      {return(m_events);}
+  void clearPostings();
+
+  std::map<std::string, double> getOutgoingTimes() const
+    {return(m_outgoing_timestamp);}
+  std::string  getOutgoingValue(const std::string& var) const;
+  std::string  getOutgoingBehavior(const std::string& var) const;
+  unsigned int getOutgoingIteration(const std::string& var) const;
+  unsigned int getOutgoingRevision() const {return(m_outgoing_revision);}
+
+ protected:
+  void addPosting(const std::string& var, const std::string& sval,
+		  const std::string& src="");
+  void addPosting(const std::string& var, double dval,
+		  const std::string& src="");
+
+ protected:
+  InfoBuffer  *m_info_buffer;
+  double       m_curr_time;
+  double       m_start_time;
+  unsigned int m_helm_iteration;
+
+  unsigned int m_bhv_count;
+  unsigned int m_bhv_count_ever;
+  unsigned int m_prev_total_completed;
+  std::string  m_prev_compl_pending;
+
+  std::vector<HelmPosting> m_postings;
+  std::vector<std::string> m_run_warnings;
+  std::vector<std::string> m_retractions;
+  std::vector<std::string> m_events;
+
+  // Maps for keeping track of the previous outgoing behavior postings
+  // for comparison on current posting. Possibly supress if they match
+  std::map<std::string, std::string> m_outgoing_key_strings;
+  std::map<std::string, double>      m_outgoing_key_doubles;
+
+  // Maps for keeping track of when the last time a post happened for
+  // a particular variable, and whether or not repeat posts are wanted.
+  std::map<std::string, double>       m_outgoing_timestamp;
+  std::map<std::string, std::string>  m_outgoing_sval;
+  std::map<std::string, double>       m_outgoing_dval;
+  std::map<std::string, unsigned int> m_outgoing_iter;
+  std::map<std::string, std::string>  m_outgoing_bhv;
+  std::map<std::string, double>       m_outgoing_repinterval;
+
+  // Bumped on any change to the outgoing maps, so that a report of
+  // them may be reused while it is unchanged
+  unsigned int m_outgoing_revision;
+};
+
+#endif
@@ -224,6 +224,7 @@ void ModeEntry::clear()
 
   m_logic_conditions.clear();
   m_modevar_conditions.clear();
+  m_logic_index.clear();
 }
 
 //------------------------------------------------------------------
@@ -234,6 +235,20 @@ void ModeEntry::clearConditionVarVals()
   unsigned int i, vsize = m_logic_conditions.size();
   for(i=0; i<vsize; i++)
     m_logic_conditions[i].clearVarVals();
+
+  // Cleared vars must be pushed again on the next consult
+  m_logic_index.clear();
+}
+
+//------------------------------------------------------------------
+// Procedure: consultInfoBuffer
+//      Note: Pushes values of vars changed in the info_buffer since
+//            the prior consult down to the dependent conditions.
+//            Returns true if any var changed.
+
+bool ModeEntry::consultInfoBuffer(const InfoBuffer *info_buffer)
+{
+  return(m_logic_index.update(m_logic_conditions, info_buffer));
 }
 
 
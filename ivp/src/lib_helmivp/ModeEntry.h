@@ -27,6 +27,8 @@
 #include <vector>
 #include <string>
 #include "LogicCondition.h"
+#include "LogicIndex.h"
+#include "InfoBuffer.h"
 
 class ModeEntry {
 public:
@@ -50,6 +52,7 @@ public:
 
   // IO for Conditions - Related to conditions evaluations.
   void clearConditionVarVals();
+  bool consultInfoBuffer(const InfoBuffer*);
   void setVarVal(const std::string&, const std::string&);
   void setVarVal(const std::string&, double);
 
@@ -76,6 +79,7 @@ protected:
   
   std::vector<LogicCondition> m_logic_conditions;
   std::vector<bool>           m_modevar_conditions;
+  LogicIndex                  m_logic_index;
 };
 
 #endif
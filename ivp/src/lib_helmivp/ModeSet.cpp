@@ -37,14 +37,23 @@ using namespace std;
 
 void ModeSet::evaluate()
 {
+  // Accommodate new information in the info_buffer and propogate it 
+  // down to each entry's vector of conditions.
+  bool changed = consultFromInfoBuffer();
+
+  // If no condition var changed since the prior call, including the
+  // mode vars posted by the prior call, the outcome is unchanged.
+  // The prior pairs are still posted to refresh the info_buffer.
+  if(!changed && m_evaluated) {
+    updateInfoBuffer();
+    return;
+  }
+  m_evaluated = true;
+
   // Each new call to evaluate wipes out whatever was determined from 
   // previous calls.
   m_mode_var_data_pairs.clear();
 
-  // Accommodate new information in the info_buffer and propogate it 
-  // down to each entry's vector of conditions.
-  consultFromInfoBuffer();
-
   // Collect results initially into a map. Mappings may be over-written
   // on later entries. We use a map as a convenient structure for this.
   map<string, string> var_val_map;
@@ -220,29 +229,21 @@ string ModeSet::getStringDescription()
 
 //------------------------------------------------------------------
 // Procedure: consultFromInfoBuffer
-//      Note: Get values of all variables from the info_buffer and 
+//      Note: Get values of variables changed in the info_buffer and 
 //            propogate these values down to all the logic conditions.
+//            Returns true if any variable changed.
 
-void ModeSet::consultFromInfoBuffer()
+bool ModeSet::consultFromInfoBuffer()
 {
+  bool changed = false;
   unsigned int j, esize = m_entries.size();
-
-  vector<string> all_vars = getConditionVars();
-  unsigned int i, vsize = all_vars.size();
-  for(i=0; i<vsize; i++) {
-    string varname = all_vars[i];
-    bool   ok_s, ok_d;
-    string s_result = m_info_buffer->sQuery(varname, ok_s);
-    double d_result = m_info_buffer->dQuery(varname, ok_d);
-
-    for(j=0; ((j<esize) && (ok_s)); j++)
-      m_entries[j].setVarVal(varname, s_result);
-
-    for(j=0; ((j<esize) && (ok_d)); j++)
-      m_entries[j].setVarVal(varname, d_result);    
+  for(j=0; j<esize; j++) {
+    if(m_entries[j].consultInfoBuffer(m_info_buffer))
+      changed = true;
   }
-
+  return(changed);
 }
+
 //------------------------------------------------------------------
 // Procedure: updateInfoBuffer
 //      Note: For each of the VarDataPairs stored locally in the member
@@ -32,10 +32,11 @@
 
 class ModeSet {
 public:
-  ModeSet() {m_info_buffer=0;}
+  ModeSet() {m_info_buffer=0; m_evaluated=false;}
   ~ModeSet() {}
 
-  void addEntry(ModeEntry entry) {m_entries.push_back(entry);}
+  void addEntry(ModeEntry entry)
+  {m_entries.push_back(entry); m_evaluated=false;}
 
   void setInfoBuffer(InfoBuffer *b) {m_info_buffer = b;}
   
@@ -55,7 +56,7 @@ public:
   std::map<std::string, std::vector<LogicCondition> > getNonModeLogicConditions();
 
  protected:
-  void consultFromInfoBuffer();
+  bool consultFromInfoBuffer();
   void updateInfoBuffer();
 
 protected:
@@ -63,6 +64,8 @@ protected:
   std::vector<VarDataPair>  m_mode_var_data_pairs;
 
   InfoBuffer *m_info_buffer;
+
+  bool m_evaluated;
 };
 
 #endif
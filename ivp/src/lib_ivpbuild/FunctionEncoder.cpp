@@ -28,6 +28,7 @@
 #include "MBUtils.h"
 #include "BuildUtils.h"
 #include "FunctionEncoder.h"
+#include "FunctionEncoderBin.h"
 #include "IvPDomain.h"
 
 using namespace std;
@@ -295,6 +296,8 @@ IvPFunction *StringToIvPFunction(const string& str)
 {
   if(str == "")
     return(0);
+  if(isStringBinIPF(str))
+    return(StringBinToIvPFunction(str));
 
   int d, i;
 
@@ -502,6 +505,9 @@ IvPFunction *StringToIvPFunction(const string& str)
 
 string StringToIvPContext(const string& str)
 {
+  if(isStringBinIPF(str))
+    return(StringBinToIvPContext(str));
+
   int cix = 2; // To account for the H, in the header
 
   // Determine the length of the context string
@@ -535,6 +541,9 @@ string StringToIvPContext(const string& str)
 
 IvPDomain IPFStringToIvPDomain(const string& str)
 {
+  if(isStringBinIPF(str))
+    return(StringBinToIvPDomain(str));
+
   int cix = 2; // To account for the H, in the header
 
   // Determine the length of the context string
@@ -0,0 +1,496 @@
+/*****************************************************************/
+/*    FILE: FunctionEncoderBin.cpp                               */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstring>
+#include <cmath>
+#include "BuildUtils.h"
+#include "FunctionEncoderBin.h"
+
+using namespace std;
+
+// Layout, all integers as unsigned LEB128 varints, signed ones
+// zigzag mapped first:
+//
+//   version, flags, context (len,chars), domain (len,chars),
+//   dim, pcs, deg, pwt (8 bytes), gelbox extents (dim),
+//   per box: [bound flags], low delta + extent per dim,
+//            weight delta per weight
+
+static const unsigned char s_bin_version  = 1;
+static const unsigned char s_flag_exclude = 1;
+
+static const char s_b64[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Quantized weights beyond this are rejected when decoding. Doubles
+// are exact up to 2^53, and the running sum of weight deltas cannot
+// overflow while both terms are kept within it.
+static const long long s_max_qwt = 1LL << 53;
+
+//--------------------------------------------------------------
+// Procedures: Byte-level writers
+
+static void putVarint(vector<unsigned char>& buff, unsigned long long v)
+{
+  while(v >= 0x80) {
+    buff.push_back((unsigned char)(v | 0x80));
+    v >>= 7;
+  }
+  buff.push_back((unsigned char)(v));
+}
+
+static inline unsigned char *writeVarint(unsigned char *p,
+					 unsigned long long v)
+{
+  while(v >= 0x80) {
+    *p++ = (unsigned char)(v | 0x80);
+    v >>= 7;
+  }
+  *p++ = (unsigned char)(v);
+  return(p);
+}
+
+static inline unsigned char *writeZigzag(unsigned char *p, long long v)
+{
+  return(writeVarint(p, ((unsigned long long)(v) << 1) ^
+		     (unsigned long long)(v >> 63)));
+}
+
+static void putString(vector<unsigned char>& buff, const string& str)
+{
+  putVarint(buff, str.length());
+  buff.insert(buff.end(), str.begin(), str.end());
+}
+
+static void putDouble(vector<unsigned char>& buff, double v)
+{
+  unsigned long long bits;
+  memcpy(&bits, &v, 8);
+  for(int i=0; i<8; i++)
+    buff.push_back((unsigned char)(bits >> (i*8)));
+}
+
+//--------------------------------------------------------------
+// Class: BinReader
+//   Note: Reads fail softly. Once a read runs past the end of the
+//         buffer all further reads return zero and ok() is false.
+
+class BinReader {
+public:
+  BinReader(const vector<unsigned char>& buff) : m_buff(buff)
+  {m_ix=0; m_ok=true;}
+
+  bool ok() const {return(m_ok);}
+
+  unsigned long long getVarint() {
+    unsigned long long v = 0;
+    for(int shift=0; shift<64; shift+=7) {
+      if(m_ix >= m_buff.size()) {
+	m_ok = false;
+	return(0);
+      }
+      unsigned char c = m_buff[m_ix++];
+      v |= ((unsigned long long)(c & 0x7f)) << shift;
+      if(!(c & 0x80))
+	return(v);
+    }
+    m_ok = false;
+    return(0);
+  }
+
+  long long getZigzag() {
+    unsigned long long v = getVarint();
+    return((long long)(v >> 1) ^ -((long long)(v & 1)));
+  }
+
+  unsigned char getByte() {
+    if(m_ix >= m_buff.size()) {
+      m_ok = false;
+      return(0);
+    }
+    return(m_buff[m_ix++]);
+  }
+
+  string getString() {
+    unsigned long long len = getVarint();
+    if(!m_ok || (len > (m_buff.size() - m_ix))) {
+      m_ok = false;
+      return("");
+    }
+    string str((const char*)(&m_buff[m_ix]), (size_t)(len));
+    m_ix += (size_t)(len);
+    return(str);
+  }
+
+  double getDouble() {
+    unsigned long long bits = 0;
+    for(int i=0; i<8; i++)
+      bits |= ((unsigned long long)(getByte())) << (i*8);
+    double v;
+    memcpy(&v, &bits, 8);
+    return(v);
+  }
+
+protected:
+  const vector<unsigned char>& m_buff;
+  size_t m_ix;
+  bool   m_ok;
+};
+
+//--------------------------------------------------------------
+// Procedure: quantizeWeight()
+//      Note: Same rounding as the string form, i.e., four decimal
+//            places with halves rounded away from zero.
+
+static long long quantizeWeight(double wt)
+{
+  if(wt < 0)
+    return(-(long long)((-wt * 10000) + 0.5));
+  return((long long)((wt * 10000) + 0.5));
+}
+
+//--------------------------------------------------------------
+// Procedure: IvPFunctionToBinary()
+
+vector<unsigned char> IvPFunctionToBinary(IvPFunction *ivp_function)
+{
+  vector<unsigned char> buff;
+  if(!ivp_function)
+    return(buff);
+
+  PDMap *pdmap = ivp_function->getPDMap();
+  if(!pdmap) 
+    return(buff);
+
+  int dim = ivp_function->getDim();
+  int pcs = pdmap->size();
+  int deg = pdmap->getDegree();
+  int wtc = (deg * dim) + 1;
+
+  // Bound flags are only stored if some bound is exclusive
+  unsigned char flags = 0;
+  for(int i=0; (i<pcs) && !flags; i++) {
+    IvPBox *ibox = pdmap->bx(i);
+    for(int d=0; d<dim; d++) {
+      if(!ibox->bd(d,0) || !ibox->bd(d,1))
+	flags |= s_flag_exclude;
+    }
+  }
+
+  buff.push_back(s_bin_version);
+  buff.push_back(flags);
+  putString(buff, ivp_function->getContextStr());
+  putString(buff, domainToString(pdmap->getDomain()));
+  putVarint(buff, dim);
+  putVarint(buff, pcs);
+  putVarint(buff, deg);
+  putDouble(buff, ivp_function->getPWT());
+
+  IvPBox gelbox = pdmap->getGelBox();
+  for(int d=0; d<dim; d++)
+    putVarint(buff, (gelbox.getDim() == dim) ? gelbox.pt(d,1) : 0);
+
+  // Boxes are written directly to a buffer sized for the worst
+  // case of ten bytes per varint, then trimmed.
+  int bd_bytes = ((dim * 2) + 7) / 8;
+  size_t hsize = buff.size();
+  buff.resize(hsize + ((size_t)(pcs) * (bd_bytes + ((dim*2)+wtc)*10)));
+  unsigned char *bp = &buff[hsize];
+
+  vector<long long> prev_low(dim, 0);
+  vector<long long> prev_wt(wtc, 0);
+  for(int i=0; i<pcs; i++) {
+    IvPBox *ibox = pdmap->bx(i);
+    if(flags & s_flag_exclude) {
+      for(int k=0; k<bd_bytes; k++) {
+	unsigned char bits = 0;
+	for(int b=0; (b<8) && ((k*8)+b < dim*2); b++) {
+	  int e = (k*8)+b;
+	  if(ibox->bd(e/2, e%2))
+	    bits |= (1 << b);
+	}
+	*bp++ = bits;
+      }
+    }
+    for(int d=0; d<dim; d++) {
+      long long low = ibox->pt(d,0);
+      long long hgh = ibox->pt(d,1);
+      bp = writeZigzag(bp, low - prev_low[d]);
+      bp = writeZigzag(bp, hgh - low);
+      prev_low[d] = low;
+    }
+    for(int j=0; j<wtc; j++) {
+      long long qwt = quantizeWeight(ibox->wt(j));
+      bp = writeZigzag(bp, qwt - prev_wt[j]);
+      prev_wt[j] = qwt;
+    }
+  }
+  buff.resize(bp - &buff[0]);
+  return(buff);
+}
+
+//--------------------------------------------------------------
+// Procedure: BinaryToIvPFunction()
+
+IvPFunction *BinaryToIvPFunction(const vector<unsigned char>& buff)
+{
+  BinReader reader(buff);
+  if(reader.getByte() != s_bin_version)
+    return(0);
+  unsigned char flags = reader.getByte();
+
+  string cstr = reader.getString();
+  string dstr = reader.getString();
+  int dim = (int)(reader.getVarint());
+  int pcs = (int)(reader.getVarint());
+  int deg = (int)(reader.getVarint());
+  double pwt = reader.getDouble();
+  if(!reader.ok() || (dim <= 0) || (pcs <= 0) || (deg < 0))
+    return(0);
+
+  // Each box takes at least one byte per bound and weight
+  int wtc = (deg * dim) + 1;
+  if((dim > 64) || (deg > 64) ||
+     ((unsigned long long)(pcs) * ((dim * 2) + wtc)) > buff.size())
+    return(0);
+
+  IvPDomain domain = stringToDomain(dstr);
+  if((int)(domain.size()) != dim)
+    return(0);
+
+  // Box bounds must lie within the domain, as with the gelbox
+  vector<long long> var_max(dim, 0);
+  for(int d=0; d<dim; d++)
+    var_max[d] = (long long)(domain.getVarPoints(d)) - 1;
+
+  IvPBox gelbox(dim,0);
+  for(int d=0; d<dim; d++) {
+    unsigned long long gel_hgh = reader.getVarint();
+    if(gel_hgh > (unsigned long long)(var_max[d]))
+      return(0);
+    gelbox.setPTS(d, 0, (int)(gel_hgh));
+  }
+  if(!reader.ok())
+    return(0);
+
+  vector<long long> prev_low(dim, 0);
+  vector<long long> prev_wt(wtc, 0);
+  int bd_bytes = ((dim * 2) + 7) / 8;
+
+  PDMap *pdmap = new PDMap(pcs, domain, deg);
+  for(int i=0; i<pcs; i++) {
+    IvPBox *newbox = new IvPBox(dim,deg);
+    pdmap->bx(i) = newbox;
+    if(flags & s_flag_exclude) {
+      for(int k=0; k<bd_bytes; k++) {
+	unsigned char bits = reader.getByte();
+	for(int b=0; (b<8) && ((k*8)+b < dim*2); b++) {
+	  int e = (k*8)+b;
+	  newbox->bd(e/2, e%2) = ((bits >> b) & 1);
+	}
+      }
+    }
+    for(int d=0; d<dim; d++) {
+      long long dlow = reader.getZigzag();
+      long long ext  = reader.getZigzag();
+      if((dlow < -var_max[d]) || (dlow > var_max[d])) {
+	delete(pdmap);
+	return(0);
+      }
+      long long low = prev_low[d] + dlow;
+      if((low < 0) || (ext < 0) || (ext > (var_max[d] - low))) {
+	delete(pdmap);
+	return(0);
+      }
+      newbox->setPTS(d, (int)(low), (int)(low + ext));
+      prev_low[d] = low;
+    }
+    for(int j=0; j<wtc; j++) {
+      long long dwt = reader.getZigzag();
+      if((dwt < -s_max_qwt) || (dwt > s_max_qwt)) {
+	delete(pdmap);
+	return(0);
+      }
+      long long qwt = prev_wt[j] + dwt;
+      if((qwt < -s_max_qwt) || (qwt > s_max_qwt)) {
+	delete(pdmap);
+	return(0);
+      }
+      newbox->wt(j) = (double)(qwt) / 10000.0;
+      prev_wt[j] = qwt;
+    }
+    if(!reader.ok()) {
+      delete(pdmap);
+      return(0);
+    }
+  }
+
+  pdmap->setGelBox(gelbox);
+  pdmap->updateGrid(1,1);
+  IvPFunction *new_of = new IvPFunction(pdmap);
+  new_of->setPWT(pwt);
+  new_of->setContextStr(cstr);
+  
+  return(new_of);
+}
+
+//--------------------------------------------------------------
+// Procedure: IvPFunctionToStringBin()
+
+string IvPFunctionToStringBin(IvPFunction *ivp_function)
+{
+  vector<unsigned char> buff = IvPFunctionToBinary(ivp_function);
+  if(buff.size() == 0)
+    return("");
+
+  size_t bsize = buff.size();
+  size_t slen  = 2 + ((bsize / 3) * 4);
+  if(bsize % 3)
+    slen += (bsize % 3) + 1;
+
+  string str(slen, 'B');
+  char *sp = &str[0];
+  sp[1] = ',';
+  sp += 2;
+
+  const unsigned char *bp = &buff[0];
+  size_t i = 0;
+  for(; i+2<bsize; i+=3) {
+    unsigned int v = (bp[i] << 16) | (bp[i+1] << 8) | bp[i+2];
+    *sp++ = s_b64[(v >> 18) & 63];
+    *sp++ = s_b64[(v >> 12) & 63];
+    *sp++ = s_b64[(v >> 6) & 63];
+    *sp++ = s_b64[v & 63];
+  }
+  if(i < bsize) {
+    unsigned int v = bp[i] << 16;
+    if(i+1 < bsize)
+      v |= bp[i+1] << 8;
+    *sp++ = s_b64[(v >> 18) & 63];
+    *sp++ = s_b64[(v >> 12) & 63];
+    if(i+1 < bsize)
+      *sp++ = s_b64[(v >> 6) & 63];
+  }
+  return(str);
+}
+
+//--------------------------------------------------------------
+// Procedure: isStringBinIPF()
+
+bool isStringBinIPF(const string& str)
+{
+  return((str.length() >= 2) && (str[0] == 'B') && (str[1] == ','));
+}
+
+//--------------------------------------------------------------
+// Procedure: b64IndexTable()
+//   Purpose: The base64 value of each byte, or -1 if not base64
+
+static vector<int> b64IndexTable()
+{
+  vector<int> table(256, -1);
+  for(int i=0; i<64; i++)
+    table[(unsigned char)(s_b64[i])] = i;
+  return(table);
+}
+
+//--------------------------------------------------------------
+// Procedure: stringBinToBinary()
+//      Note: Returns an empty vector on any non-base64 character
+
+static vector<unsigned char> stringBinToBinary(const string& str)
+{
+  vector<unsigned char> buff;
+  if(!isStringBinIPF(str))
+    return(buff);
+
+  // Built once, thread safe as a function-local static
+  static const vector<int> s_b64_ix = b64IndexTable();
+
+  size_t len = str.length();
+  buff.resize(((len-2) * 3) / 4);
+  unsigned char *bp = buff.size() ? &buff[0] : 0;
+  const char *sp = str.c_str();
+
+  unsigned int v = 0;
+  int bits = 0;
+  for(size_t i=2; i<len; i++) {
+    int ix = s_b64_ix[(unsigned char)(sp[i])];
+    if(ix < 0) {
+      buff.clear();
+      return(buff);
+    }
+    v = (v << 6) | (unsigned int)(ix);
+    bits += 6;
+    if(bits >= 8) {
+      bits -= 8;
+      *bp++ = (unsigned char)(v >> bits);
+    }
+  }
+  return(buff);
+}
+
+//--------------------------------------------------------------
+// Procedure: StringBinToIvPFunction()
+
+IvPFunction *StringBinToIvPFunction(const string& str)
+{
+  vector<unsigned char> buff = stringBinToBinary(str);
+  if(buff.size() == 0)
+    return(0);
+  return(BinaryToIvPFunction(buff));
+}
+
+//--------------------------------------------------------------
+// Procedure: StringBinToIvPContext()
+
+string StringBinToIvPContext(const string& str)
+{
+  vector<unsigned char> buff = stringBinToBinary(str);
+  BinReader reader(buff);
+  if(reader.getByte() != s_bin_version)
+    return("");
+  reader.getByte();
+  string cstr = reader.getString();
+  if(!reader.ok())
+    return("");
+  return(cstr);
+}
+
+//--------------------------------------------------------------
+// Procedure: StringBinToIvPDomain()
+
+IvPDomain StringBinToIvPDomain(const string& str)
+{
+  IvPDomain null_domain;
+
+  vector<unsigned char> buff = stringBinToBinary(str);
+  BinReader reader(buff);
+  if(reader.getByte() != s_bin_version)
+    return(null_domain);
+  reader.getByte();
+  reader.getString();
+  string dstr = reader.getString();
+  if(!reader.ok())
+    return(null_domain);
+  return(stringToDomain(dstr));
+}
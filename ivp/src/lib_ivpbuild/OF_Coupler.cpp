@@ -27,6 +27,7 @@
 #include "OF_Coupler.h"
 #include "IvPFunction.h"
 #include "BuildUtils.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -74,6 +75,9 @@ IvPFunction *OF_Coupler::couple(IvPFunction* ipf1, IvPFunction* ipf2)
 IvPFunction *OF_Coupler::couple(IvPFunction* ipf1, IvPFunction* ipf2, 
 				double wt1, double wt2)
 {
+  static const unsigned int s_coupler_id = spanNameID("coupler");
+  ScopedSpan span(s_coupler_id);
+
   bool ok = true;
   if((ipf1==0) || (ipf2==0))
     ok = false;
@@ -36,6 +36,7 @@
 #include "RT_Evaluator.h"
 #include "RT_AutoPeak.h"
 #include "MBUtils.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -517,6 +518,9 @@ bool OF_Reflector::setParam(string param, IvPBox gbox)
 
 int OF_Reflector::create(int unif_amt, int smart_amt, double smart_thresh)
 {
+  static const unsigned int s_reflector_id = spanNameID("reflector");
+  ScopedSpan span(s_reflector_id);
+
   if(m_verbose) 
     cout << "========== Begin OF_Reflector::create() ===========" << endl;
     
@@ -544,7 +548,11 @@ int OF_Reflector::create(int unif_amt, int smart_amt, double smart_thresh)
     m_rt_uniformx->setVerbose();
   m_rt_uniformx->setPlateaus(m_plateaus);
   m_rt_uniformx->setBasins(m_basins);
-  m_pdmap = m_rt_uniformx->create(m_uniform_piece, m_uniform_grid);
+  {
+    static const unsigned int s_rt_uniform_id = spanNameID("rt_uniform");
+    ScopedSpan stage_span(s_rt_uniform_id);
+    m_pdmap = m_rt_uniformx->create(m_uniform_piece, m_uniform_grid);
+  }
 
   if(!m_pdmap)  // This should never happen, but check anyway.
     return(0);
@@ -586,7 +594,11 @@ int OF_Reflector::create(int unif_amt, int smart_amt, double smart_thresh)
   PQueue pqueue(qlevels);
   m_pqueue = pqueue;
 
-  m_rt_evaluator->evaluate(m_pdmap, m_pqueue);  
+  {
+    static const unsigned int s_rt_evaluate_id = spanNameID("rt_evaluate");
+    ScopedSpan stage_span(s_rt_evaluate_id);
+    m_rt_evaluator->evaluate(m_pdmap, m_pqueue);
+  }
   
   // =============  Stage 4 - Smart Refinement ================
 
@@ -608,6 +620,8 @@ int OF_Reflector::create(int unif_amt, int smart_amt, double smart_thresh)
 	cout << "Use Amount: " << use_amt << endl;
       }
 	
+      static const unsigned int s_rt_smart_id = spanNameID("rt_smart");
+      ScopedSpan stage_span(s_rt_smart_id);
       PDMap *new_pdmap = m_rt_smart->create(m_pdmap, m_pqueue, use_amt, 
 					    m_smart_thresh);
 
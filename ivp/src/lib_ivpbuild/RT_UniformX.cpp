@@ -58,8 +58,10 @@ PDMap* RT_UniformX::create(const IvPBox& unifbox, const IvPBox& gelbox)
   int basin_pcs     = (int)(m_basins.size());
 
   int total_pdmap_pcs = remaining_pcs + plateau_pcs + basin_pcs;
-  if(total_pdmap_pcs <= 0)
+  if(total_pdmap_pcs <= 0) {
+    delete(boxset);
     return(0);
+  }
 
   PDMap *pdmap = new PDMap(total_pdmap_pcs, domain, degree);
   BoxSetNode *bsn = boxset->retBSN(FIRST);
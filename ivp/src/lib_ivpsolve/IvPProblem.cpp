@@ -29,6 +29,7 @@
 #include "IvPGrid.h"
 #include "PDMap.h"
 #include "CompactorNull.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -139,6 +140,9 @@ void IvPProblem::solvePrior(const IvPBox *isolBox)
 
 bool IvPProblem::solve(const IvPBox *isolBox)
 {
+  static const unsigned int s_ivp_solve_id = spanNameID("ivp_solve");
+  ScopedSpan span(s_ivp_solve_id);
+
   if(m_ofnum == 0) {
     cout << "IvPProblem::solve() - zero OFS!!!!!" << endl;
     return(false);
@@ -194,6 +194,54 @@ bool InfoBuffer::isKnown(string varname) const
   return(false);
 }
 
+//-----------------------------------------------------------
+// Procedure: getVarIndex()
+
+unsigned int InfoBuffer::getVarIndex(const string& var) const
+{
+  map<string, unsigned int>::iterator p = m_var_index.find(var);
+  if(p != m_var_index.end())
+    return(p->second);
+
+  unsigned int ix = m_var_seq.size();
+  m_var_index[var] = ix;
+  m_var_seq.push_back(0);
+  m_var_volatile.push_back(strEnds(var, "_DELTA") && (var.length() > 6));
+  if(isKnown(var))
+    m_var_seq[ix] = m_change_seq;
+
+  return(ix);
+}
+
+//-----------------------------------------------------------
+// Procedure: changedSince()
+//   Purpose: Check whether the var with the given index changed
+//            after the given change sequence number. Note a var
+//            that is known has a sequence number of at least one.
+
+bool InfoBuffer::changedSince(unsigned int ix, unsigned long int seq) const
+{
+  if(ix >= m_var_seq.size())
+    return(false);
+  if(m_var_volatile[ix])
+    return(true);
+  return(m_var_seq[ix] > seq);
+}
+
+//-----------------------------------------------------------
+// Procedure: noteChange()
+
+void InfoBuffer::noteChange(const string& var)
+{
+  m_change_seq++;
+  if(m_var_index.size() == 0)
+    return;
+  
+  map<string, unsigned int>::iterator p = m_var_index.find(var);
+  if(p != m_var_index.end())
+    m_var_seq[p->second] = m_change_seq;
+}
+
 //-----------------------------------------------------------
 // Procedure: size()
 //   Purpose: Get the total size of the info_buffer
@@ -253,7 +301,15 @@ unsigned long int InfoBuffer::sizeFull() const
 
 bool InfoBuffer::setValue(string var, double val, double msg_time)
 {
-  dmap[var] = val;
+  map<string, double>::iterator p = dmap.find(var);
+  if(p == dmap.end()) {
+    dmap[var] = val;
+    noteChange(var);
+  }
+  else if(p->second != val) {
+    p->second = val;
+    noteChange(var);
+  }
   tmap[var] = m_curr_time_utc;
 
   // msg_time is the timestamp perhaps embedded in the incoming message, 
@@ -274,7 +330,15 @@ bool InfoBuffer::setValue(string var, double val, double msg_time)
 
 bool InfoBuffer::setValue(string var, string val, double msg_time)
 {
-  smap[var] = val;
+  map<string, string>::iterator p = smap.find(var);
+  if(p == smap.end()) {
+    smap[var] = val;
+    noteChange(var);
+  }
+  else if(p->second != val) {
+    p->second = val;
+    noteChange(var);
+  }
   tmap[var] = m_curr_time_utc;
 
   // msg_time is the timestamp perhaps embedded in the incoming message, 
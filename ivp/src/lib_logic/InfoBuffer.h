@@ -32,7 +32,7 @@
 
 class InfoBuffer {
 public:
-  InfoBuffer()  {m_curr_time_utc=0;}
+  InfoBuffer()  {m_curr_time_utc=0; m_start_time=0; m_change_seq=0;}
   ~InfoBuffer() {}
 
 public:
@@ -47,6 +47,16 @@ public:
   std::vector<double> dQueryDeltas(std::string, bool&) const;
 
   bool   isKnown(std::string) const;
+
+  // Change tracking: a var index is a fixed handle on a var name,
+  // registered on first request, known or not. A var is changed
+  // when posted with a value differing from the prior value. Vars
+  // ending in _DELTA are derived from the current time and are
+  // always regarded as changed.
+  unsigned int      getVarIndex(const std::string&) const;
+  unsigned long int getChangeSeq() const {return(m_change_seq);}
+  bool              changedSince(unsigned int ix,
+				 unsigned long int seq) const;
   void   print(std::string s="") const;
 
   unsigned long int size() const;
@@ -76,6 +86,17 @@ protected:
 
   double m_curr_time_utc;
   double m_start_time;
+
+  unsigned long int m_change_seq;
+
+  // Registry of var indices. Mutable since registering an index
+  // does not alter the contents of the buffer.
+  mutable std::map<std::string, unsigned int> m_var_index;
+  mutable std::vector<unsigned long int>      m_var_seq;
+  mutable std::vector<bool>                   m_var_volatile;
+
+protected:
+  void   noteChange(const std::string&);
 };
 #endif
 
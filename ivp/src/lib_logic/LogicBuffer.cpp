@@ -110,30 +110,11 @@ bool LogicBuffer::checkConditions(string required)
   if(!m_info_buffer)
     return(false);
 
-  // Phase 1: get all the variable names from all present conditions.
-  vector<string> condition_vars = getUniqueVars(m_logic_conditions);
-  
-  // Phase 2: get values of all variables from the info_buffer and 
-  // propogate these values down to all the logic conditions.
-  for(unsigned int i=0; i<condition_vars.size(); i++) {
-    string varname = condition_vars[i];
-    bool   ok_s, ok_d;
-    string s_result = m_info_buffer->sQuery(varname, ok_s);
-    double d_result = m_info_buffer->dQuery(varname, ok_d);
-    
-    if(ok_s) {
-      for(unsigned int j=0; j<m_logic_conditions.size(); j++)
-	m_logic_conditions[j].setVarVal(varname, s_result);
-    }
+  // Phase 1: get values of changed variables from the info_buffer
+  // and propogate these values down to the dependent conditions.
+  m_logic_index.update(m_logic_conditions, m_info_buffer);
 
-    if(ok_d) {
-      for(unsigned int j=0; j<m_logic_conditions.size(); j++)
-      m_logic_conditions[j].setVarVal(varname, d_result);
-    }
-  }
-
-    
-  // Phase 3: evaluate all logic conditions.
+  // Phase 2: evaluate all logic conditions.
   m_notable_condition = "required=" + required;
   if(required == "any") {
     for(unsigned int i=0; i<m_logic_conditions.size(); i++) {
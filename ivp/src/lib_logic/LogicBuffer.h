@@ -31,6 +31,7 @@
 #include <set>
 #include "InfoBuffer.h"
 #include "LogicCondition.h"
+#include "LogicIndex.h"
 
 class LogicBuffer {
 public:
@@ -65,6 +66,7 @@ protected:
   InfoBuffer *m_info_buffer;
   
   std::vector<LogicCondition> m_logic_conditions;
+  LogicIndex                  m_logic_index;
 
   // notable_condition is a failed condition if required=all
   // notable_condition is a passed condition if required=any
@@ -24,10 +24,22 @@
 /*****************************************************************/
 
 #include <iostream>
+#include <cstdlib>
+#include <atomic>
 #include "LogicCondition.h"
+#include "LogicUtils.h"
+#include "MBUtils.h"
 
 using namespace std;
 
+enum {LC_FALSE, LC_CMP, LC_NOT, LC_AND, LC_OR};
+enum {LC_REL_NONE, LC_REL_EQ, LC_REL_DEQ, LC_REL_NE, LC_REL_LT,
+      LC_REL_LE, LC_REL_GT, LC_REL_GE};
+enum {LC_RT_SLOT, LC_RT_STR, LC_RT_DBL};
+
+// Compile ids are unique across all conditions in the process, and
+// conditions may be compiled on several batchsim threads at once.
+static atomic<unsigned long int> s_next_compile_id(1);
 
 //------------------------------------------------------ 
 // Procedure: Constructor
@@ -36,6 +48,9 @@ LogicCondition::LogicCondition()
 {
   m_node = 0;
   m_allow_dblequals = true;
+  m_compile_id = 0;
+  m_result     = false;
+  m_result_ok  = false;
 }
 
 //------------------------------------------------------ 
@@ -53,10 +68,8 @@ LogicCondition::~LogicCondition()
 
 LogicCondition::LogicCondition(const LogicCondition &b)
 {
-  if(b.m_node)
-    m_node = b.m_node->copy();
-  else
-    m_node = 0;
+  m_node = 0;
+  *this = b;
   m_allow_dblequals = true;
 }
 
@@ -65,8 +78,11 @@ LogicCondition::LogicCondition(const LogicCondition &b)
 
 void LogicCondition::expandMacro(string macro, string value)
 {
-  if(m_node)
-    m_node->recursiveExpandMacro(macro, value);
+  if(!m_node)
+    return;
+  
+  m_node->recursiveExpandMacro(macro, value);
+  compile();
 }
 
 //----------------------------------------------------------------
@@ -74,27 +90,40 @@ void LogicCondition::expandMacro(string macro, string value)
 
 const LogicCondition &LogicCondition::operator=(const LogicCondition &right)
 {
+  if(this == &right)
+    return(*this);
+
+  if(m_node)
+    delete(m_node);
   if(right.m_node)
     m_node = right.m_node->copy();
   else 
     m_node = 0;
 
-  return(*this);
-}
+  m_compile_id = right.m_compile_id;
 
-//----------------------------------------------------------------
-// Procedure: getVarNames()
+  m_op       = right.m_op;
+  m_rel      = right.m_rel;
+  m_lslot    = right.m_lslot;
+  m_rtype    = right.m_rtype;
+  m_rslot    = right.m_rslot;
+  m_rstr     = right.m_rstr;
+  m_rstr_num = right.m_rstr_num;
+  m_rdbl     = right.m_rdbl;
 
-vector<string> LogicCondition::getVarNames() const
-{
-  vector<string> rvector;
-  
-  if(m_node)
-    rvector = m_node->recursiveGetVarNames();
-  
-  return(rvector);
-}
+  m_var_names = right.m_var_names;
+  m_sval      = right.m_sval;
+  m_sunq      = right.m_sunq;
+  m_snum      = right.m_snum;
+  m_dval      = right.m_dval;
+  m_sset      = right.m_sset;
+  m_dset      = right.m_dset;
 
+  m_result    = right.m_result;
+  m_result_ok = right.m_result_ok;
+
+  return(*this);
+}
 
 //----------------------------------------------------------------
 // Procedure: setCondition()
@@ -112,6 +141,7 @@ bool LogicCondition::setCondition(const string& str)
   if(!ok_parse) {
     delete(m_node);
     m_node = 0;
+    compile();
     cout << "Bad Condition: " << str << endl;
     return(false);
   }
@@ -120,36 +150,345 @@ bool LogicCondition::setCondition(const string& str)
   if(!ok_syntax) {
     delete(m_node);
     m_node = 0;
+    compile();
     cout << "Bad Condition Syntax: " << str << endl;
     return(false);
   }
 
+  compile();
   return(true);
 }
 
+//----------------------------------------------------------------
+// Procedure: clearVarVals()
+
+void LogicCondition::clearVarVals()
+{
+  unsigned int vsize = m_var_names.size();
+  m_sval.assign(vsize, "");
+  m_sunq.assign(vsize, "");
+  m_snum.assign(vsize, false);
+  m_dval.assign(vsize, 0);
+  m_sset.assign(vsize, false);
+  m_dset.assign(vsize, false);
+  m_result_ok = false;
+}
+
+//----------------------------------------------------------------
+// Procedure: setVarVal()
+
+void LogicCondition::setVarVal(const string& var, const string& val)
+{
+  int slot = varSlot(var);
+  if(slot >= 0)
+    setSlotVal((unsigned int)(slot), val);
+}
 
 //----------------------------------------------------------------
-// Procedure: eval
+// Procedure: setVarVal()
 
-bool LogicCondition::eval() const
+void LogicCondition::setVarVal(const string& var, double val)
 {
-  if(m_node)
-    return(m_node->recursiveEvaluate());
+  int slot = varSlot(var);
+  if(slot >= 0)
+    setSlotVal((unsigned int)(slot), val);
+}
+
+//----------------------------------------------------------------
+// Procedure: setSlotVal()
+//      Note: Ok to overwrite a previous string-value, but cannot
+//            overwrite if previously set with a double value.
+
+void LogicCondition::setSlotVal(unsigned int slot, const string& val)
+{
+  if((slot >= m_var_names.size()) || m_dset[slot])
+    return;
+  if(m_sset[slot] && (m_sval[slot] == val))
+    return;
+
+  m_sval[slot] = val;
+  m_sset[slot] = true;
+  if(isQuoted(val))
+    m_sunq[slot] = stripQuotes(val);
   else
+    m_sunq[slot] = val;
+  m_snum[slot] = isNumber(m_sunq[slot]);
+  m_dval[slot] = 0;
+  if(m_snum[slot])
+    m_dval[slot] = atof(m_sunq[slot].c_str());
+
+  m_result_ok = false;
+}
+
+//----------------------------------------------------------------
+// Procedure: setSlotVal()
+//      Note: Ok to overwrite a previous double-value, but cannot
+//            overwrite if previously set with a string value.
+
+void LogicCondition::setSlotVal(unsigned int slot, double val)
+{
+  if((slot >= m_var_names.size()) || m_sset[slot])
+    return;
+  if(m_dset[slot] && (m_dval[slot] == val))
+    return;
+
+  m_dval[slot] = val;
+  m_dset[slot] = true;
+  m_result_ok  = false;
+}
+
+//----------------------------------------------------------------
+// Procedure: eval()
+
+bool LogicCondition::eval() const
+{
+  if(m_result_ok)
+    return(m_result);
+
+  if(m_op.size() == 0)
     return(false);
+
+  m_stack.clear();
+  unsigned int i, psize = m_op.size();
+  for(i=0; i<psize; i++) {
+    unsigned char op = m_op[i];
+    if(op == LC_CMP)
+      m_stack.push_back(evalCompare(i));
+    else if(op == LC_FALSE)
+      m_stack.push_back(false);
+    else if(op == LC_NOT)
+      m_stack.back() = !m_stack.back();
+    else {
+      bool right = m_stack.back();
+      m_stack.pop_back();
+      if(op == LC_AND)
+	m_stack.back() = m_stack.back() && right;
+      else
+	m_stack.back() = m_stack.back() || right;
+    }
+  }
+
+  m_result    = m_stack.back();
+  m_result_ok = true;
+  return(m_result);
 }
-	   
 
-	   
+//----------------------------------------------------------------
+// Procedure: print()
+//      Note: The parse tree does not hold variable values, so they
+//            are pushed down to the tree before printing.
 
+void LogicCondition::print() const
+{
+  if(!m_node)
+    return;
+
+  m_node->recursiveClearVarVal();
+  for(unsigned int i=0; i<m_var_names.size(); i++) {
+    if(m_sset[i])
+      m_node->recursiveSetVarVal(m_var_names[i], m_sval[i]);
+    if(m_dset[i])
+      m_node->recursiveSetVarVal(m_var_names[i], m_dval[i]);
+  }
+  m_node->print();
+}
+
+//----------------------------------------------------------------
+// Procedure: compile()
+//   Purpose: Build the postfix program and the variable slots from
+//            the parse tree. Values of variables already set are
+//            retained if the variable is still in the condition.
 
+void LogicCondition::compile()
+{
+  vector<string> old_names = m_var_names;
+  vector<string> old_sval  = m_sval;
+  vector<double> old_dval  = m_dval;
+  vector<bool>   old_sset  = m_sset;
+  vector<bool>   old_dset  = m_dset;
+  
+  m_op.clear();
+  m_rel.clear();
+  m_lslot.clear();
+  m_rtype.clear();
+  m_rslot.clear();
+  m_rstr.clear();
+  m_rstr_num.clear();
+  m_rdbl.clear();
+
+  m_var_names.clear();
+  if(m_node)
+    m_var_names = m_node->recursiveGetVarNames();
+  clearVarVals();
+
+  if(m_node)
+    compileNode(m_node);
+  m_compile_id = s_next_compile_id++;
+
+  for(unsigned int i=0; i<old_names.size(); i++) {
+    if(old_sset[i])
+      setVarVal(old_names[i], old_sval[i]);
+    if(old_dset[i])
+      setVarVal(old_names[i], old_dval[i]);
+  }
+}
 
+//----------------------------------------------------------------
+// Procedure: compileNode()
+//      Note: Mirrors ParseNode::recursiveEvaluate(). Any node that
+//            would evaluate to false regardless of variable values
+//            is compiled to LC_FALSE.
 
+void LogicCondition::compileNode(const ParseNode *node)
+{
+  unsigned char op  = LC_FALSE;
+  unsigned char rel = LC_REL_NONE;
+  int lslot = -1;
+  int rslot = -1;
+  unsigned char rtype = LC_RT_SLOT;
+  string rstr;
+  bool   rstr_num = false;
+  double rdbl = 0;
+
+  string relation = node->getRelation();
+  const ParseNode *lnode = node->getLeftNode();
+  const ParseNode *rnode = node->getRightNode();
+
+  if(relation == "not") {
+    if(lnode) {
+      compileNode(lnode);
+      op = LC_NOT;
+    }
+  }
+  else if(lnode && rnode) {
+    if((relation == "or") || (relation == "and")) {
+      compileNode(lnode);
+      compileNode(rnode);
+      op = (relation == "or") ? LC_OR : LC_AND;
+    }
+    else {
+      string rrel = rnode->getRelation();
+      if(lnode->getRelation() == "variable")
+	lslot = varSlot(lnode->getRawCondition());
+      
+      if(rrel == "variable")
+	rslot = varSlot(rnode->getRawCondition());
+      else if(rrel == "string") {
+	rtype = LC_RT_STR;
+	rstr  = rnode->getRawCondition();
+	if(isQuoted(rstr))
+	  rstr = stripQuotes(rstr);
+	rstr_num = isNumber(rstr);
+	if(rstr_num)
+	  rdbl = atof(rstr.c_str());
+      }
+      else if(rrel == "double") {
+	rtype = LC_RT_DBL;
+	rdbl  = atof(rnode->getRawCondition().c_str());
+      }
+
+      if((lslot >= 0) && ((rtype != LC_RT_SLOT) || (rslot >= 0)))
+	op = LC_CMP;
+      
+      if(relation == "=")        rel = LC_REL_EQ;
+      else if(relation == "==") rel = LC_REL_DEQ;
+      else if(relation == "!=") rel = LC_REL_NE;
+      else if(relation == "<")  rel = LC_REL_LT;
+      else if(relation == "<=") rel = LC_REL_LE;
+      else if(relation == ">")  rel = LC_REL_GT;
+      else if(relation == ">=") rel = LC_REL_GE;
+    }
+  }
 
+  m_op.push_back(op);
+  m_rel.push_back(rel);
+  m_lslot.push_back(lslot);
+  m_rtype.push_back(rtype);
+  m_rslot.push_back(rslot);
+  m_rstr.push_back(rstr);
+  m_rstr_num.push_back(rstr_num);
+  m_rdbl.push_back(rdbl);
+}
 
+//----------------------------------------------------------------
+// Procedure: varSlot()
 
+int LogicCondition::varSlot(const string& var) const
+{
+  for(unsigned int i=0; i<m_var_names.size(); i++) {
+    if(m_var_names[i] == var)
+      return((int)(i));
+  }
+  return(-1);
+}
 
+//----------------------------------------------------------------
+// Procedure: evalCompare()
+//      Note: Mirrors the type handling of ParseNode::evaluate(). A
+//            string compared with a double is compared numerically
+//            if the string is numerical, and otherwise is false.
 
+bool LogicCondition::evalCompare(unsigned int ix) const
+{
+  unsigned int lslot = (unsigned int)(m_lslot[ix]);
+  if(!m_sset[lslot] && !m_dset[lslot])
+    return(false);
+  
+  bool   lstr = m_sset[lslot];
+  bool   lnum = lstr ? m_snum[lslot] : true;
+  double ldbl = m_dval[lslot];
+
+  bool   rstr = false;
+  bool   rnum = true;
+  double rdbl = 0;
+  const string *rstr_val = 0;
+
+  unsigned char rtype = m_rtype[ix];
+  if(rtype == LC_RT_STR) {
+    rstr = true;
+    rnum = m_rstr_num[ix];
+    rdbl = m_rdbl[ix];
+    rstr_val = &(m_rstr[ix]);
+  }
+  else if(rtype == LC_RT_DBL)
+    rdbl = m_rdbl[ix];
+  else {
+    unsigned int rslot = (unsigned int)(m_rslot[ix]);
+    if(!m_sset[rslot] && !m_dset[rslot])
+      return(false);
+    rstr = m_sset[rslot];
+    rnum = rstr ? m_snum[rslot] : true;
+    rdbl = m_dval[rslot];
+    rstr_val = &(m_sunq[rslot]);
+  }
 
+  unsigned char rel = m_rel[ix];
+  if(lstr && rstr) {
+    const string& left  = m_sunq[lslot];
+    const string& right = *rstr_val;
+    switch(rel) {
+    case LC_REL_EQ:  return(left == right);
+    case LC_REL_DEQ: return(strFieldMatch(left, right));
+    case LC_REL_NE:  return(left != right);
+    case LC_REL_LT:  return(left <  right);
+    case LC_REL_LE:  return(left <= right);
+    case LC_REL_GT:  return(left >  right);
+    case LC_REL_GE:  return(left >= right);
+    default:         return(false);
+    }
+  }
 
+  if(!lnum || !rnum)
+    return(false);
 
+  switch(rel) {
+  case LC_REL_EQ:  
+  case LC_REL_DEQ: return(ldbl == rdbl);
+  case LC_REL_NE:  return(ldbl != rdbl);
+  case LC_REL_LT:  return(ldbl <  rdbl);
+  case LC_REL_LE:  return(ldbl <= rdbl);
+  case LC_REL_GT:  return(ldbl >  rdbl);
+  case LC_REL_GE:  return(ldbl >= rdbl);
+  default:         return(false);
+  }
+}
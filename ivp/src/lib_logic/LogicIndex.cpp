@@ -0,0 +1,129 @@
+/*****************************************************************/
+/*    FILE: LogicIndex.cpp                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <map>
+#include "LogicIndex.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Procedure: clear()
+
+void LogicIndex::clear()
+{
+  m_info_buffer = 0;
+  m_compile_ids.clear();
+
+  m_vars.clear();
+  m_var_ix.clear();
+  m_dep_cond.clear();
+  m_dep_slot.clear();
+
+  m_seq = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: update()
+//   Purpose: Push the values of all variables changed since the
+//            prior update down to the conditions. As in a full
+//            update, a string value is pushed before a double
+//            value for a variable known by both types.
+
+bool LogicIndex::update(vector<LogicCondition>& conditions,
+			const InfoBuffer *info_buffer)
+{
+  if(!info_buffer)
+    return(false);
+  if(!isValid(conditions, info_buffer))
+    build(conditions, info_buffer);
+
+  bool changed = false;
+  for(unsigned int i=0; i<m_vars.size(); i++) {
+    if(!info_buffer->changedSince(m_var_ix[i], m_seq))
+      continue;
+    changed = true;
+
+    bool   ok_s, ok_d;
+    string s_result = info_buffer->sQuery(m_vars[i], ok_s);
+    double d_result = info_buffer->dQuery(m_vars[i], ok_d);
+
+    const vector<unsigned int>& conds = m_dep_cond[i];
+    const vector<unsigned int>& slots = m_dep_slot[i];
+    for(unsigned int j=0; (j<conds.size()) && ok_s; j++)
+      conditions[conds[j]].setSlotVal(slots[j], s_result);
+    for(unsigned int j=0; (j<conds.size()) && ok_d; j++)
+      conditions[conds[j]].setSlotVal(slots[j], d_result);
+  }
+
+  m_seq = info_buffer->getChangeSeq();
+  return(changed);
+}
+
+//-----------------------------------------------------------
+// Procedure: isValid()
+
+bool LogicIndex::isValid(const vector<LogicCondition>& conditions,
+			 const InfoBuffer *info_buffer) const
+{
+  if((info_buffer != m_info_buffer) ||
+     (conditions.size() != m_compile_ids.size()))
+    return(false);
+
+  for(unsigned int i=0; i<conditions.size(); i++) {
+    if(conditions[i].getCompileID() != m_compile_ids[i])
+      return(false);
+  }
+  return(true);
+}
+
+//-----------------------------------------------------------
+// Procedure: build()
+
+void LogicIndex::build(const vector<LogicCondition>& conditions,
+		       const InfoBuffer *info_buffer)
+{
+  clear();
+  m_info_buffer = info_buffer;
+
+  map<string, unsigned int> var_map;
+  for(unsigned int i=0; i<conditions.size(); i++) {
+    m_compile_ids.push_back(conditions[i].getCompileID());
+
+    vector<string> vars = conditions[i].getVarNames();
+    for(unsigned int j=0; j<vars.size(); j++) {
+      map<string, unsigned int>::iterator p = var_map.find(vars[j]);
+      unsigned int vix = 0;
+      if(p != var_map.end())
+	vix = p->second;
+      else {
+	vix = m_vars.size();
+	var_map[vars[j]] = vix;
+	m_vars.push_back(vars[j]);
+	m_var_ix.push_back(info_buffer->getVarIndex(vars[j]));
+	m_dep_cond.push_back(vector<unsigned int>());
+	m_dep_slot.push_back(vector<unsigned int>());
+      }
+      m_dep_cond[vix].push_back(i);
+      m_dep_slot[vix].push_back(j);
+    }
+  }
+}
@@ -37,6 +37,10 @@ public:
   ParseNode* copy();
 
   std::string getRawCondition() const {return(m_raw_string);}
+  std::string getRelation() const     {return(m_relation);}
+
+  const ParseNode* getLeftNode() const  {return(m_left_node);}
+  const ParseNode* getRightNode() const {return(m_right_node);}
 
   std::vector<std::string> recursiveGetVarNames() const;
 
@@ -54,6 +54,8 @@ ALogDataBroker::ALogDataBroker()
   m_pruned_logtmin  = 0;
   m_pruned_logtmax  = 0;
   m_progress = false;
+
+  m_page_cache.reset(new LogPlotPageCache);
 }
 
 //----------------------------------------------------------------
@@ -700,6 +702,42 @@ LogPlot ALogDataBroker::getLogPlot(unsigned int mix)
   return(logplot);
 }
 
+//----------------------------------------------------------------
+// Procedure: getPagedLogPlot()
+//      Note: Same data as getLogPlot(), but only an index and a min/max
+//            summary are held. Points are read from the klog file in
+//            pages as needed, within the memory budget of the cache.
+
+PagedLogPlot ALogDataBroker::getPagedLogPlot(unsigned int mix)
+{
+  PagedLogPlot logplot;
+  if(mix >= m_mix_vname.size()) {
+    if(m_verbose)
+      cout << "Could not create PagedLogPlot for MasterIndex: " << mix << endl;
+    return(logplot);
+  }
+
+  string varname = m_mix_varname[mix];
+  unsigned int aix = m_mix_alog_ix[mix];
+
+  string klog = m_base_dirs[aix] + "/" + varname + ".klog";
+  bool ok = logplot.build(klog, m_logskew[aix], m_pruned_logtmin,
+			  m_pruned_logtmax, m_page_cache);
+  if(!ok && m_verbose)
+    cout << "Could not create PagedLogPlot from " << klog << endl;
+
+  logplot.setVarName(varname);
+  return(logplot);
+}
+
+//----------------------------------------------------------------
+// Procedure: setPlotMemory()
+
+void ALogDataBroker::setPlotMemory(unsigned int megabytes)
+{
+  m_page_cache->setMemoryBudget((unsigned long long)(megabytes) * 1048576);
+}
+
 //----------------------------------------------------------------
 // Procedure: getVarPlot()
 
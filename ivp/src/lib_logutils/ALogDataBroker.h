@@ -26,8 +26,10 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include "SplitHandler.h"
 #include "LogPlot.h"
+#include "PagedLogPlot.h"
 #include "VarPlot.h"
 #include "AppLogPlot.h"
 #include "HelmPlot.h"
@@ -55,8 +57,10 @@ class ALogDataBroker
   void setMaxFilePtrs(unsigned int v) {m_max_fileptrs=v;}
   void setVQual(std::string s) {m_vqual=s;}
   void addDetachedPair(std::string s) {m_detached_pairs.push_back(s);}
+  void setPlotMemory(unsigned int megabytes);
   
   LogPlot      getLogPlot(unsigned int mix);
+  PagedLogPlot getPagedLogPlot(unsigned int mix);
   VarPlot      getVarPlot(unsigned int mix, bool src=false);
   AppLogPlot   getAppLogPlot(unsigned int alix);
   EncounterPlot getEncounterPlot(unsigned int aix);
@@ -160,6 +164,9 @@ class ALogDataBroker
   bool m_progress;
   unsigned int m_max_fileptrs;
   std::string m_vqual;
+
+  // Pages of PagedLogPlots, shared by all copies of this broker
+  std::shared_ptr<LogPlotPageCache> m_page_cache;
 };
 
 #endif
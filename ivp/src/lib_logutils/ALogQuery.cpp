@@ -0,0 +1,553 @@
+/*****************************************************************/
+/*    FILE: ALogQuery.cpp                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include "MBUtils.h"
+#include "ALogQuery.h"
+
+using namespace std;
+
+#ifdef _WIN32
+#define alog_fseek _fseeki64
+#else
+#define alog_fseek fseeko
+#endif
+
+//--------------------------------------------------------
+// Constructor()
+
+ALogQueryOutput::ALogQueryOutput()
+{
+  m_tmin_set = false;
+  m_tmax_set = false;
+  m_tmin     = 0;
+  m_tmax     = 0;
+  m_comments = true;
+  m_colsep   = ' ';
+  m_file     = 0;
+
+  m_lines_out   = 0;
+  m_chars_out   = 0;
+  m_lines_early = 0;
+  m_chars_early = 0;
+  m_lines_late  = 0;
+  m_chars_late  = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: passVar()
+
+bool ALogQueryOutput::passVar(const char* var, size_t len) const
+{
+  if(m_vars.empty() && m_var_prefixes.empty() && m_var_suffixes.empty())
+    return(true);
+
+  if(m_vars.count(string(var, len)))
+    return(true);
+  for(unsigned int i=0; i<m_var_prefixes.size(); i++) {
+    const string& pfx = m_var_prefixes[i];
+    if((len >= pfx.length()) && (strncmp(var, pfx.c_str(), pfx.length()) == 0))
+      return(true);
+  }
+  for(unsigned int i=0; i<m_var_suffixes.size(); i++) {
+    const string& sfx = m_var_suffixes[i];
+    if((len >= sfx.length()) &&
+       (strncmp(var+len-sfx.length(), sfx.c_str(), sfx.length()) == 0))
+      return(true);
+  }
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: passSrc()
+
+bool ALogQueryOutput::passSrc(const char* src, size_t len) const
+{
+  if(m_srcs.empty())
+    return(true);
+  return(m_srcs.count(string(src, len)) > 0);
+}
+
+//--------------------------------------------------------
+// Constructor()
+
+ALogQuery::ALogQuery()
+{
+  m_use_index   = true;
+  m_cache_index = false;
+
+  m_any_keep_vars = false;
+
+  m_lines_read       = 0;
+  m_lines_skip_front = 0;
+  m_chars_skip_front = 0;
+  m_lines_skip_back  = 0;
+  m_chars_skip_back  = 0;
+}
+
+//--------------------------------------------------------
+// Destructor()
+
+ALogQuery::~ALogQuery()
+{
+  for(unsigned int i=0; i<m_outputs.size(); i++) {
+    if(m_outputs[i].m_file && (m_outputs[i].m_file != stdout))
+      fclose(m_outputs[i].m_file);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: setALogFile()
+
+bool ALogQuery::setALogFile(const string& alogfile)
+{
+  FILE *f = fopen(alogfile.c_str(), "r");
+  if(!f)
+    return(false);
+  fclose(f);
+
+  m_alogfile = alogfile;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: addOutput()
+
+unsigned int ALogQuery::addOutput()
+{
+  m_outputs.push_back(ALogQueryOutput());
+  return(m_outputs.size() - 1);
+}
+
+//--------------------------------------------------------
+// Procedure: setOutputFile()
+
+bool ALogQuery::setOutputFile(unsigned int ix, const string& filename)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+  if(filename == m_alogfile)
+    return(false);
+
+  FILE *f = fopen(filename.c_str(), "w");
+  if(!f)
+    return(false);
+
+  if(m_outputs[ix].m_file && (m_outputs[ix].m_file != stdout))
+    fclose(m_outputs[ix].m_file);
+  m_outputs[ix].m_file = f;
+  m_outputs[ix].m_filename = filename;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: addVar()
+//      Note: A leading or trailing '*' is a wildcard, e.g.,
+//            NAV_* or *_GAP
+
+bool ALogQuery::addVar(unsigned int ix, const string& var)
+{
+  if((ix >= m_outputs.size()) || (var == "") || (var == "*"))
+    return(false);
+
+  if(var[var.length()-1] == '*')
+    m_outputs[ix].m_var_prefixes.push_back(var.substr(0, var.length()-1));
+  else if(var[0] == '*')
+    m_outputs[ix].m_var_suffixes.push_back(var.substr(1));
+  else
+    m_outputs[ix].m_vars.insert(var);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: addSource()
+
+bool ALogQuery::addSource(unsigned int ix, const string& src)
+{
+  if((ix >= m_outputs.size()) || (src == ""))
+    return(false);
+  m_outputs[ix].m_srcs.insert(src);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: addKeepVar()
+//      Note: Lines of a keep var are output regardless of time
+
+bool ALogQuery::addKeepVar(unsigned int ix, const string& var)
+{
+  if((ix >= m_outputs.size()) || (var == ""))
+    return(false);
+  m_outputs[ix].m_keep_vars.insert(var);
+  m_any_keep_vars = true;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setTimeMin()
+
+bool ALogQuery::setTimeMin(unsigned int ix, double tmin)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+  m_outputs[ix].m_tmin_set = true;
+  m_outputs[ix].m_tmin = tmin;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setTimeMax()
+
+bool ALogQuery::setTimeMax(unsigned int ix, double tmax)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+  m_outputs[ix].m_tmax_set = true;
+  m_outputs[ix].m_tmax = tmax;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setComments()
+
+bool ALogQuery::setComments(unsigned int ix, bool v)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+  m_outputs[ix].m_comments = v;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setColumns()
+//   Example: "time:val" or "var,src,val". Empty is the raw line.
+
+bool ALogQuery::setColumns(unsigned int ix, const string& str)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+
+  vector<string> cols;
+  vector<string> svector = parseString(findReplace(str, ':', ','), ',');
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string col = tolower(stripBlankEnds(svector[i]));
+    if((col != "time") && (col != "var") && (col != "src") && (col != "val"))
+      return(false);
+    cols.push_back(col);
+  }
+  m_outputs[ix].m_columns = cols;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setColSep()
+
+bool ALogQuery::setColSep(unsigned int ix, char c)
+{
+  if(ix >= m_outputs.size())
+    return(false);
+  m_outputs[ix].m_colsep = c;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: run()
+//      Note: The file is read in up to three ranges. The header is
+//            always read. With a time index, the range before the
+//            earliest tmin and after the latest tmax are skipped, or
+//            if there are keep vars, are read only for those.
+
+bool ALogQuery::run()
+{
+  if(m_alogfile == "")
+    return(false);
+  if(m_outputs.size() == 0)
+    addOutput();
+  for(unsigned int i=0; i<m_outputs.size(); i++) {
+    if(!m_outputs[i].m_file)
+      m_outputs[i].m_file = stdout;
+  }
+
+  FILE *f = fopen(m_alogfile.c_str(), "rb");
+  if(!f)
+    return(false);
+
+  // Part 1: Determine the union of all time windows
+  bool   all_tmin = true;
+  bool   all_tmax = true;
+  double tmin = 0;
+  double tmax = 0;
+  for(unsigned int i=0; i<m_outputs.size(); i++) {
+    const ALogQueryOutput& out = m_outputs[i];
+    all_tmin = all_tmin && out.m_tmin_set;
+    all_tmax = all_tmax && out.m_tmax_set;
+    if((i == 0) || (out.m_tmin < tmin))
+      tmin = out.m_tmin;
+    if((i == 0) || (out.m_tmax > tmax))
+      tmax = out.m_tmax;
+  }
+
+  // Part 2: Without a window, or an index, just read the file.
+  ALogTimeIndex index;
+  if(!m_use_index || (!all_tmin && !all_tmax) ||
+     !index.loadOrBuild(m_alogfile, m_cache_index)) {
+    bool ok = readRange(f, 0, 0, 1);
+    fclose(f);
+    return(ok);
+  }
+
+  unsigned long long hdr_end  = index.getHeaderEnd();
+  unsigned long long file_end = index.getFileSize();
+
+  unsigned long long front_lines = 0, front_chars = 0;
+  unsigned long long back_lines  = 0, back_chars  = 0;
+  unsigned long long start = hdr_end;
+  unsigned long long stop  = file_end;
+  if(all_tmin)
+    start = index.seekOffset(tmin, front_lines, front_chars);
+  if(all_tmax)
+    stop = index.stopOffset(tmax, back_lines, back_chars);
+  if(stop < start) {
+    stop = file_end;
+    back_lines = 0;
+    back_chars = 0;
+  }
+
+  // Part 3: Read the header, the window, and what's outside it if
+  // needed for keep vars.
+  bool ok = readRange(f, 0, hdr_end, 1);
+  if(start > hdr_end) {
+    if(m_any_keep_vars)
+      ok = ok && readRange(f, hdr_end, start, 0);
+    else {
+      m_lines_skip_front = front_lines;
+      m_chars_skip_front = front_chars;
+    }
+  }
+  ok = ok && readRange(f, start, stop, 1);
+  if(stop < file_end) {
+    if(m_any_keep_vars)
+      ok = ok && readRange(f, stop, file_end, 2);
+    else {
+      m_lines_skip_back = back_lines;
+      m_chars_skip_back = back_chars;
+    }
+  }
+  fclose(f);
+
+  for(unsigned int i=0; i<m_outputs.size(); i++)
+    fflush(m_outputs[i].m_file);
+  return(ok);
+}
+
+//--------------------------------------------------------
+// Procedure: readRange()
+//      Note: Reads lines from start up to end. An end of zero means
+//            read to the end of the file. Offsets are line starts.
+
+bool ALogQuery::readRange(FILE* f, unsigned long long start,
+			  unsigned long long end, int region)
+{
+  if((end != 0) && (end <= start))
+    return(true);
+  if(alog_fseek(f, start, SEEK_SET) != 0)
+    return(false);
+
+  vector<char> buff(1048576);
+  string carry;
+  unsigned long long pos = start;
+
+  while(true) {
+    size_t want = buff.size();
+    if((end != 0) && ((end - pos) < want))
+      want = (size_t)(end - pos);
+
+    size_t amt = 0;
+    if(want > 0)
+      amt = fread(&buff[0], 1, want, f);
+    pos += amt;
+    bool at_end = (amt == 0);
+
+    char *p   = &buff[0];
+    char *last = p + amt;
+    while(p < last) {
+      char *nl = (char*)(memchr(p, '\n', last-p));
+      if(!nl) {
+	carry.append(p, last-p);
+	break;
+      }
+      if(carry.length() > 0) {
+	carry.append(p, nl-p);
+	handleLine(carry.c_str(), carry.length(), region);
+	carry.clear();
+      }
+      else
+	handleLine(p, nl-p, region);
+      p = nl + 1;
+    }
+
+    if(at_end) {
+      if(carry.length() > 0)
+	handleLine(carry.c_str(), carry.length(), region);
+      break;
+    }
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: handleLine()
+//      Note: Region 1 is the time window. Regions 0 and 2 are before
+//            and after it, read only for the sake of keep vars.
+
+void ALogQuery::handleLine(const char* line, size_t len, int region)
+{
+  m_lines_read++;
+
+  // Part 1: Comment lines
+  if((len > 0) && (line[0] == '%')) {
+    if(region != 1)
+      return;
+    for(unsigned int i=0; i<m_outputs.size(); i++) {
+      if(m_outputs[i].m_comments)
+	writeLine(m_outputs[i], line, len, 0, 0, 0, 0, 0, 0);
+    }
+    return;
+  }
+
+  // Part 2: Find the fields: time, var, src and val
+  const char *end = line + len;
+  const char *p = line;
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *tstr = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  const char *tstr_end = p;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *var = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  size_t var_len = p - var;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *src = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  size_t src_len = p - src;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *val = p;
+  size_t val_len = end - p;
+
+  // Part 3: Parse the timestamp
+  bool   has_time = false;
+  double t = 0;
+  if(tstr_end > tstr) {
+    char tbuff[41];
+    size_t tlen = tstr_end - tstr;
+    tlen = (tlen < 40) ? tlen : 40;
+    memcpy(tbuff, tstr, tlen);
+    tbuff[tlen] = '\0';
+    char *tend = 0;
+    t = strtod(tbuff, &tend);
+    has_time = (tend != tbuff);
+  }
+
+  // Part 4: Apply each output's predicates
+  for(unsigned int i=0; i<m_outputs.size(); i++) {
+    ALogQueryOutput& out = m_outputs[i];
+
+    if(!out.m_keep_vars.empty() && out.m_keep_vars.count(string(var, var_len))) {
+      writeLine(out, line, len, var, var_len, src, src_len, val, val_len);
+      continue;
+    }
+    if(!out.passVar(var, var_len) || !out.passSrc(src, src_len))
+      continue;
+
+    bool early = (region == 0);
+    bool late  = (region == 2);
+    if(!early && !late) {
+      if(out.m_tmin_set && (!has_time || (t < out.m_tmin)))
+	early = true;
+      else if(out.m_tmax_set && (!has_time || (t > out.m_tmax)))
+	late = true;
+    }
+
+    if(early) {
+      out.m_lines_early++;
+      out.m_chars_early += len;
+    }
+    else if(late) {
+      out.m_lines_late++;
+      out.m_chars_late += len;
+    }
+    else
+      writeLine(out, line, len, var, var_len, src, src_len, val, val_len);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: writeLine()
+
+void ALogQuery::writeLine(ALogQueryOutput& out, const char* line,
+			  size_t len, const char* var, size_t var_len,
+			  const char* src, size_t src_len,
+			  const char* val, size_t val_len)
+{
+  // Comment lines, given with no var, are not counted
+  if(var) {
+    out.m_lines_out++;
+    out.m_chars_out += len;
+  }
+
+  if(out.m_columns.empty() || (var == 0)) {
+    fwrite(line, 1, len, out.m_file);
+    fputc('\n', out.m_file);
+    return;
+  }
+
+  for(unsigned int i=0; i<out.m_columns.size(); i++) {
+    if(i > 0)
+      fputc(out.m_colsep, out.m_file);
+    const string& col = out.m_columns[i];
+    if(col == "time") {
+      const char *p = line;
+      while((p < var) && ((*p == ' ') || (*p == '\t')))
+	p++;
+      const char *q = p;
+      while((q < var) && (*q != ' ') && (*q != '\t'))
+	q++;
+      fwrite(p, 1, q-p, out.m_file);
+    }
+    else if(col == "var")
+      fwrite(var, 1, var_len, out.m_file);
+    else if(col == "src")
+      fwrite(src, 1, src_len, out.m_file);
+    else
+      fwrite(val, 1, val_len, out.m_file);
+  }
+  fputc('\n', out.m_file);
+}
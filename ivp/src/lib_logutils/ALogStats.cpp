@@ -0,0 +1,510 @@
+/*****************************************************************/
+/*    FILE: ALogStats.cpp                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <sys/stat.h>
+#include "ALogStats.h"
+
+using namespace std;
+
+#ifdef _WIN32
+#define alog_fseek _fseeki64
+#else
+#define alog_fseek fseeko
+#endif
+
+// Files smaller than this are not worth splitting across threads
+static const unsigned long long MIN_CHUNK_SIZE = 4194304;
+
+//--------------------------------------------------------
+// Procedure: isNumberChars()
+//      Note: Same rules as isNumber() in MBUtils, without making a
+//            string of each value: digits, at most one decimal
+//            point, a leading sign, and blank ends allowed.
+
+static bool isNumberChars(const char* str, size_t len)
+{
+  while((len > 0) && ((*str == ' ') || (*str == '\t'))) {
+    str++;
+    len--;
+  }
+  while((len > 0) && ((str[len-1] == ' ') || (str[len-1] == '\t')))
+    len--;
+  if((len > 1) && (str[0] == '+')) {
+    str++;
+    len--;
+  }
+
+  unsigned int digi_cnt = 0;
+  unsigned int deci_cnt = 0;
+  for(size_t i=0; i<len; i++) {
+    char c = str[i];
+    if((c >= '0') && (c <= '9'))
+      digi_cnt++;
+    else if(c == '.') {
+      if(++deci_cnt > 1)
+	return(false);
+    }
+    else if(c == '-') {
+      if((digi_cnt > 0) || (deci_cnt > 0))
+	return(false);
+    }
+    else
+      return(false);
+  }
+  return(digi_cnt > 0);
+}
+
+//--------------------------------------------------------
+// Procedure: charsToDouble()
+
+static double charsToDouble(const char* str, size_t len)
+{
+  char buff[64];
+  if(len > 63)
+    len = 63;
+  memcpy(buff, str, len);
+  buff[len] = '\0';
+  return(atof(buff));
+}
+
+//--------------------------------------------------------
+// Constructor()
+
+ALogVarStats::ALogVarStats()
+{
+  m_max_sources = 0;
+
+  m_lines = 0;
+  m_chars = 0;
+  m_first = 0;
+  m_last  = 0;
+  m_tmin  = 0;
+  m_tmax  = 0;
+
+  m_num_count = 0;
+  m_num_min   = 0;
+  m_num_max   = 0;
+  m_num_sum   = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: addSource()
+//      Note: A max of zero means every source is held by name
+
+void ALogVarStats::addSource(const char* src, size_t len)
+{
+  for(unsigned int i=0; i<m_sources.size(); i++) {
+    const string& source = m_sources[i];
+    if((source.length() == len) && (source.compare(0, len, src, len) == 0))
+      return;
+  }
+
+  if((m_max_sources == 0) || (m_sources.size() < m_max_sources)) {
+    m_sources.push_back(string(src, len));
+    return;
+  }
+
+  // Once the list is full, the estimate covers all sources
+  if(m_source_hll.empty()) {
+    for(unsigned int i=0; i<m_sources.size(); i++)
+      m_source_hll.add(m_sources[i]);
+  }
+  m_source_hll.add(src, len);
+}
+
+//--------------------------------------------------------
+// Procedure: merge()
+//      Note: The given stats are taken to be from later in the log
+
+void ALogVarStats::merge(const ALogVarStats& stats)
+{
+  if(stats.m_lines == 0)
+    return;
+
+  if(m_lines == 0) {
+    m_first = stats.m_first;
+    m_tmin  = stats.m_tmin;
+    m_tmax  = stats.m_tmax;
+  }
+  m_last = stats.m_last;
+  if(stats.m_tmin < m_tmin)
+    m_tmin = stats.m_tmin;
+  if(stats.m_tmax > m_tmax)
+    m_tmax = stats.m_tmax;
+  m_lines += stats.m_lines;
+  m_chars += stats.m_chars;
+
+  for(unsigned int i=0; i<stats.m_sources.size(); i++) {
+    const string& source = stats.m_sources[i];
+    addSource(source.c_str(), source.length());
+  }
+  if(!stats.m_source_hll.empty()) {
+    if(m_source_hll.empty()) {
+      for(unsigned int i=0; i<m_sources.size(); i++)
+	m_source_hll.add(m_sources[i]);
+    }
+    m_source_hll.merge(stats.m_source_hll);
+  }
+
+  if(stats.m_num_count > 0) {
+    if((m_num_count == 0) || (stats.m_num_min < m_num_min))
+      m_num_min = stats.m_num_min;
+    if((m_num_count == 0) || (stats.m_num_max > m_num_max))
+      m_num_max = stats.m_num_max;
+    m_num_count += stats.m_num_count;
+    m_num_sum   += stats.m_num_sum;
+    m_num_sketch.merge(stats.m_num_sketch);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: getSourceCount()
+
+unsigned int ALogVarStats::getSourceCount() const
+{
+  unsigned int count = m_sources.size();
+  if(!m_source_hll.empty()) {
+    unsigned int est = (unsigned int)(m_source_hll.estimate() + 0.5);
+    if(est > count)
+      count = est;
+  }
+  return(count);
+}
+
+//--------------------------------------------------------
+// Procedure: getSources()
+//      Note: Comma-separated, in the order first seen
+
+string ALogVarStats::getSources() const
+{
+  string sources;
+  for(unsigned int i=0; i<m_sources.size(); i++) {
+    if(i > 0)
+      sources += ",";
+    sources += m_sources[i];
+  }
+  return(sources);
+}
+
+//--------------------------------------------------------
+// Constructor()
+
+ALogStats::ALogStats()
+{
+  m_use_full_source = true;
+  m_threads     = 0;
+  m_max_sources = 0;
+
+  m_raw_lines = 0;
+  m_lines = 0;
+  m_chars = 0;
+  m_tmin  = 0;
+  m_tmax  = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: addLine()
+//      Note: Fields and validity are as in getNextRawALogEntry():
+//            the timestamp must be numeric, and the var, source
+//            and value must all be non-empty. Comment lines fail
+//            on the timestamp.
+
+void ALogStats::addLine(const char* line, size_t len)
+{
+  // Part 1: Find the fields: time, var, src and val
+  const char *end = line + len;
+  const char *p = line;
+
+  const char *tstr = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  size_t tlen = p - tstr;
+  if((tlen == 0) || (tstr[0] < '0') || (tstr[0] > '9'))
+    return;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *var = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  size_t var_len = p - var;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *src = p;
+  while((p < end) && (*p != ' ') && (*p != '\t'))
+    p++;
+  size_t rawsrc_len = p - src;
+
+  while((p < end) && ((*p == ' ') || (*p == '\t')))
+    p++;
+  const char *val = p;
+  size_t val_len = end - p;
+
+  if((var_len == 0) || (val_len == 0) || !isNumberChars(tstr, tlen))
+    return;
+
+  // Part 2: The source is the app name, up to any colon. For the
+  // helm, the behavior name in the aux info may be appended.
+  const char *colon = (const char*)(memchr(src, ':', rawsrc_len));
+  size_t src_len = colon ? (size_t)(colon - src) : rawsrc_len;
+  if(src_len == 0)
+    return;
+
+  string helm_src;
+  if(colon && m_use_full_source && (src_len == 8) &&
+     (strncmp(src, "pHelmIvP", 8) == 0)) {
+    const char *aux = colon + 1;
+    size_t aux_len = rawsrc_len - src_len - 1;
+    if(aux_len > 0) {
+      const char *acolon = (const char*)(memchr(aux, ':', aux_len));
+      if(acolon) {
+	aux_len = aux_len - (acolon - aux) - 1;
+	aux = acolon + 1;
+      }
+      if(aux_len > 0) {
+	helm_src = "pHelmIvP:" + string(aux, aux_len);
+	src = helm_src.c_str();
+	src_len = helm_src.length();
+      }
+    }
+  }
+
+  double t = charsToDouble(tstr, tlen);
+  unsigned long long chars = var_len + src_len + val_len;
+
+  // Part 3: Update the totals
+  if((m_lines == 0) || (t < m_tmin))
+    m_tmin = t;
+  if((m_lines == 0) || (t > m_tmax))
+    m_tmax = t;
+  m_lines++;
+  m_chars += chars;
+  m_source_hll.add(src, src_len);
+
+  // Part 4: Update the variable
+  string varname(var, var_len);
+  map<string, unsigned int>::iterator q = m_vmap.find(varname);
+  unsigned int ix = 0;
+  if(q != m_vmap.end())
+    ix = q->second;
+  else {
+    ix = m_vars.size();
+    m_vmap[varname] = ix;
+    m_vars.push_back(ALogVarStats());
+    m_vars[ix].m_varname = varname;
+    m_vars[ix].m_max_sources = m_max_sources;
+    m_vars[ix].m_first = t;
+    m_vars[ix].m_tmin  = t;
+    m_vars[ix].m_tmax  = t;
+  }
+
+  ALogVarStats& stats = m_vars[ix];
+  stats.m_lines++;
+  stats.m_chars += chars;
+  stats.m_last = t;
+  if(t < stats.m_tmin)
+    stats.m_tmin = t;
+  if(t > stats.m_tmax)
+    stats.m_tmax = t;
+  stats.addSource(src, src_len);
+
+  if(isNumberChars(val, val_len)) {
+    double dval = charsToDouble(val, val_len);
+    if((stats.m_num_count == 0) || (dval < stats.m_num_min))
+      stats.m_num_min = dval;
+    if((stats.m_num_count == 0) || (dval > stats.m_num_max))
+      stats.m_num_max = dval;
+    stats.m_num_count++;
+    stats.m_num_sum += dval;
+    stats.m_num_sketch.add(dval);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: merge()
+//      Note: The given stats are taken to be from later in the log
+
+void ALogStats::merge(const ALogStats& stats)
+{
+  for(unsigned int i=0; i<stats.m_vars.size(); i++) {
+    const ALogVarStats& vstats = stats.m_vars[i];
+    map<string, unsigned int>::iterator p = m_vmap.find(vstats.m_varname);
+    if(p != m_vmap.end())
+      m_vars[p->second].merge(vstats);
+    else {
+      m_vmap[vstats.m_varname] = m_vars.size();
+      m_vars.push_back(vstats);
+    }
+  }
+
+  if(stats.m_lines > 0) {
+    if((m_lines == 0) || (stats.m_tmin < m_tmin))
+      m_tmin = stats.m_tmin;
+    if((m_lines == 0) || (stats.m_tmax > m_tmax))
+      m_tmax = stats.m_tmax;
+  }
+  m_raw_lines += stats.m_raw_lines;
+  m_lines += stats.m_lines;
+  m_chars += stats.m_chars;
+  m_source_hll.merge(stats.m_source_hll);
+}
+
+//--------------------------------------------------------
+// Procedure: getVarIndex()
+
+int ALogStats::getVarIndex(const string& varname) const
+{
+  map<string, unsigned int>::const_iterator p = m_vmap.find(varname);
+  if(p == m_vmap.end())
+    return(-1);
+  return((int)(p->second));
+}
+
+//--------------------------------------------------------
+// Procedure: scanFile()
+//      Note: The file is cut into chunks at line boundaries, one
+//            per thread. Each chunk is scanned into its own stats,
+//            merged afterwards in file order.
+
+bool ALogStats::scanFile(const string& alogfile)
+{
+  struct stat info;
+  if(stat(alogfile.c_str(), &info) != 0)
+    return(false);
+  unsigned long long size = (unsigned long long)(info.st_size);
+
+  unsigned int threads = m_threads;
+  if(threads == 0)
+    threads = thread::hardware_concurrency();
+  if(threads == 0)
+    threads = 1;
+  if((size / threads) < MIN_CHUNK_SIZE)
+    threads = (unsigned int)(size / MIN_CHUNK_SIZE);
+  if(threads <= 1)
+    return(scanRange(alogfile, 0, size));
+
+  // Part 1: Find the chunk boundaries, each the start of a line
+  FILE *f = fopen(alogfile.c_str(), "rb");
+  if(!f)
+    return(false);
+
+  vector<unsigned long long> bounds(1, 0);
+  for(unsigned int i=1; i<threads; i++) {
+    unsigned long long pos = (size / threads) * i;
+    if(pos <= bounds.back())
+      continue;
+    if(alog_fseek(f, pos-1, SEEK_SET) != 0)
+      break;
+    int c = fgetc(f);
+    while((c != EOF) && (c != '\n')) {
+      pos++;
+      c = fgetc(f);
+    }
+    if(c == EOF)
+      break;
+    bounds.push_back(pos);
+  }
+  bounds.push_back(size);
+  fclose(f);
+
+  // Part 2: Scan the chunks in parallel
+  unsigned int chunks = bounds.size() - 1;
+  vector<ALogStats> chunk_stats(chunks);
+  vector<char> chunk_ok(chunks, 0);
+  vector<thread> workers;
+  for(unsigned int i=0; i<chunks; i++) {
+    chunk_stats[i].setUseFullSource(m_use_full_source);
+    chunk_stats[i].setMaxSources(m_max_sources);
+    workers.push_back(thread([&, i]() {
+	  chunk_ok[i] = chunk_stats[i].scanRange(alogfile, bounds[i],
+						 bounds[i+1]);
+	}));
+  }
+  for(unsigned int i=0; i<workers.size(); i++)
+    workers[i].join();
+
+  // Part 3: Merge in file order
+  bool ok = true;
+  for(unsigned int i=0; i<chunks; i++) {
+    ok = ok && chunk_ok[i];
+    merge(chunk_stats[i]);
+  }
+  return(ok);
+}
+
+//--------------------------------------------------------
+// Procedure: scanRange()
+
+bool ALogStats::scanRange(const string& alogfile, unsigned long long start,
+			  unsigned long long end)
+{
+  FILE *f = fopen(alogfile.c_str(), "rb");
+  if(!f)
+    return(false);
+  if((start > 0) && (alog_fseek(f, start, SEEK_SET) != 0)) {
+    fclose(f);
+    return(false);
+  }
+
+  vector<char> buff(1048576);
+  string carry;
+  unsigned long long pos = start;
+
+  while(pos < end) {
+    size_t want = buff.size();
+    if((end - pos) < want)
+      want = (size_t)(end - pos);
+    size_t amt = fread(&buff[0], 1, want, f);
+    if(amt == 0)
+      break;
+    pos += amt;
+
+    const char *p    = &buff[0];
+    const char *last = p + amt;
+    while(p < last) {
+      const char *nl = (const char*)(memchr(p, '\n', last-p));
+      if(!nl) {
+	carry.append(p, last-p);
+	break;
+      }
+      if(carry.length() > 0) {
+	carry.append(p, nl-p);
+	addLine(carry.c_str(), carry.length());
+	carry.clear();
+      }
+      else
+	addLine(p, nl-p);
+      m_raw_lines++;
+      p = nl + 1;
+    }
+  }
+  if(carry.length() > 0) {
+    addLine(carry.c_str(), carry.length());
+    m_raw_lines++;
+  }
+
+  fclose(f);
+  return(true);
+}
@@ -0,0 +1,127 @@
+/*****************************************************************/
+/*    FILE: ALogStats.h                                          */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_STATS_HEADER
+#define ALOG_STATS_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+#include "HyperLogLog.h"
+#include "QuantileSketch.h"
+
+// Streaming statistics of an alog file, per variable: line and char
+// counts, first/last and min/max times, the publishing sources, and
+// for numeric values the min, max, mean and quantiles. Memory per
+// variable is bounded regardless of the length of the log, apart
+// from the sources, which are all held by name unless a limit is
+// set with setMaxSources(). Beyond the limit only an estimate of
+// their number is kept.
+//
+// A file is scanned in chunks, one per thread, each into its own
+// ALogStats, which are then merged in file order. Stats from several
+// files merge the same way, as though the files were one log.
+
+class ALogVarStats
+{
+ public:
+  ALogVarStats();
+  ~ALogVarStats() {}
+
+  void addSource(const char* src, size_t len);
+  void merge(const ALogVarStats&);
+
+  unsigned int getSourceCount() const;
+  std::string  getSources() const;
+
+ public:
+  std::string  m_varname;
+  unsigned int m_max_sources;
+
+  unsigned long long m_lines;
+  unsigned long long m_chars;
+  double m_first;
+  double m_last;
+  double m_tmin;
+  double m_tmax;
+
+  std::vector<std::string> m_sources;
+  HyperLogLog              m_source_hll;
+
+  unsigned long long m_num_count;
+  double             m_num_min;
+  double             m_num_max;
+  double             m_num_sum;
+  QuantileSketch     m_num_sketch;
+};
+
+class ALogStats
+{
+ public:
+  ALogStats();
+  ~ALogStats() {}
+
+  void setUseFullSource(bool v) {m_use_full_source=v;}
+  void setThreads(unsigned int v) {m_threads=v;}
+  void setMaxSources(unsigned int v) {m_max_sources=v;}
+
+  // Scans the file and merges its stats into this
+  bool scanFile(const std::string& alogfile);
+
+  void addLine(const char* line, size_t len);
+  void merge(const ALogStats&);
+
+  unsigned int size() const {return(m_vars.size());}
+
+  // Variables are kept in the order first seen
+  const ALogVarStats& getVarStats(unsigned int ix) const
+  {return(m_vars[ix]);}
+
+  // Returns -1 if the variable was not seen
+  int getVarIndex(const std::string&) const;
+
+  unsigned long long getTotalLines() const {return(m_lines);}
+  unsigned long long getRawLines() const {return(m_raw_lines);}
+  unsigned long long getTotalChars() const {return(m_chars);}
+  double getTimeMin() const {return(m_tmin);}
+  double getTimeMax() const {return(m_tmax);}
+  double getSourceCount() const {return(m_source_hll.estimate());}
+
+ protected:
+  bool scanRange(const std::string& alogfile, unsigned long long start,
+		 unsigned long long end);
+
+ protected:
+  bool         m_use_full_source;
+  unsigned int m_threads;
+  unsigned int m_max_sources;
+
+  std::vector<ALogVarStats>           m_vars;
+  std::map<std::string, unsigned int> m_vmap;
+
+  unsigned long long m_raw_lines;
+  unsigned long long m_lines;
+  unsigned long long m_chars;
+  double             m_tmin;
+  double             m_tmax;
+  HyperLogLog        m_source_hll;
+};
+
+#endif
@@ -0,0 +1,333 @@
+/*****************************************************************/
+/*    FILE: ALogTimeIndex.cpp                                    */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sys/stat.h>
+#include "ALogTimeIndex.h"
+
+using namespace std;
+
+// Indices are only cached for files big enough to be worth it
+static const unsigned long long MIN_CACHED_FILE_SIZE = 1048576;
+
+//--------------------------------------------------------
+// Constructor()
+
+ALogTimeIndex::ALogTimeIndex()
+{
+  m_file_size  = 0;
+  m_file_mtime = 0;
+  m_block_size = 65536;
+  m_header_end = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: indexFileName()
+
+string ALogTimeIndex::indexFileName(const string& alogfile)
+{
+  return(alogfile + ".tix");
+}
+
+//--------------------------------------------------------
+// Procedure: readFileStats()
+
+bool ALogTimeIndex::readFileStats(const string& alogfile,
+				  unsigned long long& size,
+				  long long& mtime) const
+{
+  struct stat info;
+  if(stat(alogfile.c_str(), &info) != 0)
+    return(false);
+
+  size  = (unsigned long long)(info.st_size);
+  mtime = (long long)(info.st_mtime);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: build()
+//      Note: One pass over the file. Lines are found in large
+//            chunks read with fread, and only the leading timestamp
+//            of each line is parsed.
+
+bool ALogTimeIndex::build(const string& alogfile)
+{
+  m_offset.clear();
+  m_lines.clear();
+  m_chars.clear();
+  m_tmin.clear();
+  m_tmax.clear();
+  m_header_end = 0;
+
+  unsigned long long size = 0;
+  long long mtime = 0;
+  if(!readFileStats(alogfile, size, mtime))
+    return(false);
+
+  FILE *f = fopen(alogfile.c_str(), "rb");
+  if(!f)
+    return(false);
+
+  m_alogfile   = alogfile;
+  m_file_size  = size;
+  m_file_mtime = mtime;
+
+  const double big = numeric_limits<double>::max();
+
+  vector<char> buff(1048576);
+  string carry;
+  bool   in_header = true;
+  unsigned long long line_start = 0;
+  unsigned long long pos = 0;
+
+  while(true) {
+    size_t amt = fread(&buff[0], 1, buff.size(), f);
+    bool at_eof = (amt == 0);
+
+    const char *p   = &buff[0];
+    const char *end = p + amt;
+    while((p < end) || (at_eof && (carry.length() > 0))) {
+      const char *line = p;
+      size_t len = 0;
+      if(!at_eof) {
+	const char *nl = (const char*)(memchr(p, '\n', end-p));
+	if(!nl) {
+	  carry.append(p, end-p);
+	  pos += (end-p);
+	  break;
+	}
+	len = nl - p;
+	pos += len + 1;
+	p = nl + 1;
+	if(carry.length() > 0) {
+	  carry.append(line, len);
+	  line = carry.c_str();
+	  len  = carry.length();
+	}
+      }
+      else {
+	line = carry.c_str();
+	len  = carry.length();
+      }
+
+      // Header lines are all the leading comment lines
+      if(in_header) {
+	if((len > 0) && (line[0] == '%')) {
+	  line_start = pos;
+	  carry.clear();
+	  continue;
+	}
+	in_header = false;
+	m_header_end = line_start;
+      }
+
+      if((m_offset.size() == 0) ||
+	 ((line_start - m_offset.back()) >= m_block_size)) {
+	m_offset.push_back(line_start);
+	m_lines.push_back(0);
+	m_chars.push_back(0);
+	m_tmin.push_back(big);
+	m_tmax.push_back(-big);
+      }
+      m_lines.back()++;
+      m_chars.back() += len;
+
+      if((len > 0) && (line[0] != '%')) {
+	char tbuff[41];
+	size_t tlen = (len < 40) ? len : 40;
+	memcpy(tbuff, line, tlen);
+	tbuff[tlen] = '\0';
+	char *tend = 0;
+	double t = strtod(tbuff, &tend);
+	if(tend != tbuff) {
+	  if(t < m_tmin.back())
+	    m_tmin.back() = t;
+	  if(t > m_tmax.back())
+	    m_tmax.back() = t;
+	}
+      }
+      line_start = pos;
+      carry.clear();
+    }
+    if(at_eof)
+      break;
+  }
+  fclose(f);
+
+  if(in_header)
+    m_header_end = m_file_size;
+
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: save()
+
+bool ALogTimeIndex::save() const
+{
+  if((m_alogfile == "") || (m_file_size < MIN_CACHED_FILE_SIZE))
+    return(false);
+
+  string tixfile = indexFileName(m_alogfile);
+  FILE *f = fopen(tixfile.c_str(), "w");
+  if(!f)
+    return(false);
+
+  fprintf(f, "%%%% ALOGTIX 1\n");
+  fprintf(f, "%llu %lld %llu %llu %u\n", m_file_size, m_file_mtime,
+	  m_block_size, m_header_end, (unsigned int)(m_offset.size()));
+  for(unsigned int i=0; i<m_offset.size(); i++)
+    fprintf(f, "%llu %llu %llu %.17g %.17g\n", m_offset[i], m_lines[i],
+	    m_chars[i], m_tmin[i], m_tmax[i]);
+  fclose(f);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: load()
+//   Returns: false if no index is cached, or it is stale or bad
+
+bool ALogTimeIndex::load(const string& alogfile)
+{
+  unsigned long long size = 0;
+  long long mtime = 0;
+  if(!readFileStats(alogfile, size, mtime))
+    return(false);
+
+  string tixfile = indexFileName(alogfile);
+  FILE *f = fopen(tixfile.c_str(), "r");
+  if(!f)
+    return(false);
+
+  int version = 0;
+  unsigned long long fsize = 0, bsize = 0, hend = 0;
+  long long fmtime = 0;
+  unsigned int count = 0;
+
+  bool ok = (fscanf(f, "%%%% ALOGTIX %d", &version) == 1) && (version == 1);
+  ok = ok && (fscanf(f, "%llu %lld %llu %llu %u", &fsize, &fmtime,
+		     &bsize, &hend, &count) == 5);
+  ok = ok && (fsize == size) && (fmtime == mtime);
+
+  m_offset.clear();
+  m_lines.clear();
+  m_chars.clear();
+  m_tmin.clear();
+  m_tmax.clear();
+  for(unsigned int i=0; ok && (i<count); i++) {
+    unsigned long long offset, lines, chars;
+    double tmin, tmax;
+    ok = (fscanf(f, "%llu %llu %llu %lf %lf", &offset, &lines,
+		 &chars, &tmin, &tmax) == 5);
+    ok = ok && (offset <= fsize);
+    if(ok) {
+      m_offset.push_back(offset);
+      m_lines.push_back(lines);
+      m_chars.push_back(chars);
+      m_tmin.push_back(tmin);
+      m_tmax.push_back(tmax);
+    }
+  }
+  fclose(f);
+
+  if(!ok) {
+    m_offset.clear();
+    m_lines.clear();
+    m_chars.clear();
+    m_tmin.clear();
+    m_tmax.clear();
+    return(false);
+  }
+
+  m_alogfile   = alogfile;
+  m_file_size  = fsize;
+  m_file_mtime = fmtime;
+  m_block_size = bsize;
+  m_header_end = hend;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: loadOrBuild()
+
+bool ALogTimeIndex::loadOrBuild(const string& alogfile, bool cache)
+{
+  if(cache && load(alogfile))
+    return(true);
+  if(!build(alogfile))
+    return(false);
+  if(cache)
+    save();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: seekOffset()
+//      Note: Blocks may be skipped only while every line in them,
+//            and in all blocks before, is earlier than tmin.
+
+unsigned long long ALogTimeIndex::seekOffset(double tmin,
+					     unsigned long long& lines,
+					     unsigned long long& chars) const
+{
+  lines = 0;
+  chars = 0;
+
+  unsigned int bix = 0;
+  while((bix < m_offset.size()) && (m_tmax[bix] < tmin)) {
+    lines += m_lines[bix];
+    chars += m_chars[bix];
+    bix++;
+  }
+
+  if(bix == 0)
+    return(m_header_end);
+  if(bix == m_offset.size())
+    return(m_file_size);
+  return(m_offset[bix]);
+}
+
+//--------------------------------------------------------
+// Procedure: stopOffset()
+//      Note: Blocks may be dropped only while every line in them,
+//            and in all blocks after, is later than tmax.
+
+unsigned long long ALogTimeIndex::stopOffset(double tmax,
+					     unsigned long long& lines,
+					     unsigned long long& chars) const
+{
+  lines = 0;
+  chars = 0;
+
+  unsigned int bix = m_offset.size();
+  while((bix > 0) && (m_tmin[bix-1] > tmax)) {
+    lines += m_lines[bix-1];
+    chars += m_chars[bix-1];
+    bix--;
+  }
+
+  if(bix == m_offset.size())
+    return(m_file_size);
+  return(m_offset[bix]);
+}
@@ -38,6 +38,7 @@ HelmPlot::HelmPlot()
 {
   m_vehi_type = "unknown";
   m_vehi_length = 0;
+  m_time_hint   = 0;
 }
 
 //---------------------------------------------------------------
@@ -105,7 +106,7 @@ string HelmPlot::getValueByIndex(string query, unsigned int index) const
 
 string HelmPlot::getValueByTime(string query, double gtime) const
 {
-  unsigned int index = getIndexByTime(m_time, gtime);
+  unsigned int index = getIndexByTime(m_time, gtime, m_time_hint);
 
   string value = getValueByIndex(query, index);
   return(value);
@@ -129,7 +130,7 @@ double HelmPlot::getTimeByIndex(unsigned int index) const
 double HelmPlot::getTimeByIterAdd(double ctime, 
 				   unsigned int iter_offset) const
 {
-  unsigned int curr_index = getIndexByTime(m_time, ctime);
+  unsigned int curr_index = getIndexByTime(m_time, ctime, m_time_hint);
   unsigned int curr_iter  = m_helm_reports[curr_index].getIteration(); 
   unsigned int targ_iter  = curr_iter + iter_offset;
 
@@ -155,7 +156,7 @@ double HelmPlot::getTimeByIterAdd(double ctime,
 double HelmPlot::getTimeByIterSub(double ctime, 
 				   unsigned int iter_offset) const
 {
-  unsigned int curr_index = getIndexByTime(m_time, ctime);
+  unsigned int curr_index = getIndexByTime(m_time, ctime, m_time_hint);
   unsigned int curr_iter  = m_helm_reports[curr_index].getIteration(); 
   unsigned int targ_iter  = 0;
   if(curr_iter >= iter_offset)
@@ -182,7 +183,7 @@ double HelmPlot::getTimeByIterSub(double ctime,
 
 unsigned int HelmPlot::getIterByTime(double gtime) const
 {
-  unsigned int index = getIndexByTime(m_time, gtime);
+  unsigned int index = getIndexByTime(m_time, gtime, m_time_hint);
   return(m_helm_reports[index].getIteration());
 }
      
@@ -71,6 +71,9 @@ protected:
   // Parallel indices each index once per IVPHELM_SUMMARY
   std::vector<double>     m_time;
   std::vector<HelmReport> m_helm_reports;
+
+  // Index found by the last time query, a starting point for the next
+  mutable unsigned int m_time_hint;
 };
 #endif 
 
@@ -0,0 +1,112 @@
+/*****************************************************************/
+/*    FILE: HyperLogLog.cpp                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include "HyperLogLog.h"
+
+using namespace std;
+
+static const unsigned int HLL_BITS      = 10;
+static const unsigned int HLL_REGISTERS = 1 << HLL_BITS;
+
+//--------------------------------------------------------
+// Procedure: hashString()
+//      Note: FNV-1a, followed by a finalizing mix so that the low
+//            and high bits are both well distributed.
+
+static unsigned long long hashString(const char* str, size_t len)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  for(size_t i=0; i<len; i++) {
+    h ^= (unsigned char)(str[i]);
+    h *= 1099511628211ULL;
+  }
+  h ^= (h >> 33);
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= (h >> 33);
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= (h >> 33);
+  return(h);
+}
+
+//--------------------------------------------------------
+// Procedure: add()
+
+void HyperLogLog::add(const char* str, size_t len)
+{
+  if(m_registers.empty())
+    m_registers.resize(HLL_REGISTERS, 0);
+
+  unsigned long long h = hashString(str, len);
+  unsigned int ix = (unsigned int)(h >> (64 - HLL_BITS));
+
+  // Rank is the position of the first 1-bit in the remaining bits
+  unsigned long long rest = (h << HLL_BITS) | (1ULL << (HLL_BITS-1));
+  unsigned char rank = 1;
+  while(!(rest & (1ULL << 63))) {
+    rank++;
+    rest <<= 1;
+  }
+  if(rank > m_registers[ix])
+    m_registers[ix] = rank;
+}
+
+//--------------------------------------------------------
+// Procedure: merge()
+
+void HyperLogLog::merge(const HyperLogLog& hll)
+{
+  if(hll.m_registers.empty())
+    return;
+  if(m_registers.empty()) {
+    m_registers = hll.m_registers;
+    return;
+  }
+  for(unsigned int i=0; i<HLL_REGISTERS; i++) {
+    if(hll.m_registers[i] > m_registers[i])
+      m_registers[i] = hll.m_registers[i];
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: estimate()
+//      Note: Uses linear counting while many registers are still
+//            zero, where the raw estimate is known to be biased.
+
+double HyperLogLog::estimate() const
+{
+  if(m_registers.empty())
+    return(0);
+
+  double m = (double)(HLL_REGISTERS);
+  double sum = 0;
+  unsigned int zeros = 0;
+  for(unsigned int i=0; i<HLL_REGISTERS; i++) {
+    sum += ldexp(1.0, -(int)(m_registers[i]));
+    if(m_registers[i] == 0)
+      zeros++;
+  }
+
+  double alpha = 0.7213 / (1 + 1.079 / m);
+  double est = alpha * m * m / sum;
+  if((est <= 2.5 * m) && (zeros > 0))
+    est = m * log(m / (double)(zeros));
+  return(est);
+}
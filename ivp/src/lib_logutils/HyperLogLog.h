@@ -0,0 +1,50 @@
+/*****************************************************************/
+/*    FILE: HyperLogLog.h                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef HYPER_LOG_LOG_HEADER
+#define HYPER_LOG_LOG_HEADER
+
+#include <string>
+#include <vector>
+
+// A HyperLogLog estimate of the number of distinct strings added, in
+// a fixed 1KB of memory (2^10 registers, ~3% standard error). Two
+// estimates are merged by taking the max of each register, so counts
+// from separate chunks or files combine without double counting.
+
+class HyperLogLog
+{
+ public:
+  HyperLogLog() {}
+  ~HyperLogLog() {}
+
+  void add(const char* str, size_t len);
+  void add(const std::string& str) {add(str.c_str(), str.length());}
+  void merge(const HyperLogLog&);
+
+  double estimate() const;
+  bool   empty() const {return(m_registers.empty());}
+
+ protected:
+  // Registers are only allocated on the first add
+  std::vector<unsigned char> m_registers;
+};
+
+#endif
@@ -44,6 +44,7 @@ LogPlot::LogPlot()
   m_median_set = false;
 
   m_avg_time_gap = -1;
+  m_time_hint = 0;
 }
 
 //---------------------------------------------------------------
@@ -186,7 +187,7 @@ unsigned int LogPlot::getLPIndexByTime(double gtime) const
   if(gtime > m_time[m_time.size()-1])
     return(m_time.size()-1);
   
-  return(getIndexByTime(m_time, gtime));
+  return(getIndexByTime(m_time, gtime, m_time_hint));
 }
      
 //---------------------------------------------------------------
@@ -208,7 +209,7 @@ double LogPlot::getValueByTime(double gtime, bool interp) const
   if(gtime <= m_time[0])
     return(m_value[0]);
 
-  unsigned int index = getIndexByTime(m_time, gtime);
+  unsigned int index = getIndexByTime(m_time, gtime, m_time_hint);
   if((gtime == m_time[index]) || !interp)
     return(m_value[index]);
   
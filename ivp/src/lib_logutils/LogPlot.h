@@ -85,6 +85,9 @@ protected:
   double m_median;
 
   double m_avg_time_gap;
+
+  // Index found by the last time query, a starting point for the next
+  mutable unsigned int m_time_hint;
 };
 #endif 
 
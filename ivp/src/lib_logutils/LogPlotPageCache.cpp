@@ -0,0 +1,121 @@
+/*****************************************************************/
+/*    FILE: LogPlotPageCache.cpp                                 */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include "LogPlotPageCache.h"
+
+using namespace std;
+
+//---------------------------------------------------------------
+// Constructor
+
+LogPlotPageCache::LogPlotPageCache()
+{
+  m_budget = 64 * 1048576;
+  m_bytes  = 0;
+  m_next_series_id = 0;
+
+  m_loads     = 0;
+  m_evictions = 0;
+}
+
+//---------------------------------------------------------------
+// Procedure: setMemoryBudget()
+
+void LogPlotPageCache::setMemoryBudget(unsigned long long bytes)
+{
+  m_budget = bytes;
+  evict();
+}
+
+//---------------------------------------------------------------
+// Procedure: dropSeries()
+
+void LogPlotPageCache::dropSeries(unsigned int series_id)
+{
+  map<PageKey, pair<LogPlotPage, LRUIter> >::iterator p;
+  p = m_pages.lower_bound(PageKey(series_id, 0));
+  while((p != m_pages.end()) && (p->first.first == series_id)) {
+    m_bytes -= p->second.first.bytes();
+    m_lru.erase(p->second.second);
+    m_pages.erase(p++);
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: find()
+
+const LogPlotPage* LogPlotPageCache::find(unsigned int series_id,
+					  unsigned int page_ix)
+{
+  map<PageKey, pair<LogPlotPage, LRUIter> >::iterator p;
+  p = m_pages.find(PageKey(series_id, page_ix));
+  if(p == m_pages.end())
+    return(0);
+
+  m_lru.splice(m_lru.begin(), m_lru, p->second.second);
+  return(&(p->second.first));
+}
+
+//---------------------------------------------------------------
+// Procedure: insert()
+//      Note: The contents of the given page are taken, not copied
+
+const LogPlotPage* LogPlotPageCache::insert(unsigned int series_id,
+					    unsigned int page_ix,
+					    LogPlotPage& page)
+{
+  PageKey key(series_id, page_ix);
+  map<PageKey, pair<LogPlotPage, LRUIter> >::iterator p = m_pages.find(key);
+  if(p != m_pages.end()) {
+    m_bytes -= p->second.first.bytes();
+    m_lru.erase(p->second.second);
+    m_pages.erase(p);
+  }
+
+  m_lru.push_front(key);
+  pair<LogPlotPage, LRUIter>& entry = m_pages[key];
+  entry.first.m_time.swap(page.m_time);
+  entry.first.m_value.swap(page.m_value);
+  entry.second = m_lru.begin();
+  m_bytes += entry.first.bytes();
+  m_loads++;
+
+  evict();
+  return(&(entry.first));
+}
+
+//---------------------------------------------------------------
+// Procedure: evict()
+//      Note: The most recently used page is never evicted, so one
+//            page may always be held even if over budget.
+
+void LogPlotPageCache::evict()
+{
+  while((m_bytes > m_budget) && (m_lru.size() > 1)) {
+    PageKey key = m_lru.back();
+    m_lru.pop_back();
+    map<PageKey, pair<LogPlotPage, LRUIter> >::iterator p = m_pages.find(key);
+    if(p != m_pages.end()) {
+      m_bytes -= p->second.first.bytes();
+      m_pages.erase(p);
+    }
+    m_evictions++;
+  }
+}
@@ -0,0 +1,83 @@
+/*****************************************************************/
+/*    FILE: LogPlotPageCache.h                                   */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef LOG_PLOT_PAGE_CACHE_HEADER
+#define LOG_PLOT_PAGE_CACHE_HEADER
+
+#include <vector>
+#include <list>
+#include <map>
+#include <utility>
+
+// A page of consecutive points of one time series
+class LogPlotPage
+{
+ public:
+  std::vector<double> m_time;
+  std::vector<double> m_value;
+
+  unsigned long long bytes() const
+  {return((m_time.capacity() + m_value.capacity()) * sizeof(double));}
+};
+
+// Pages of time series loaded on demand, shared by all series, and
+// held to a memory budget. When over budget, the least recently used
+// pages are dropped. A page returned by find() or insert() is valid
+// until the next call to insert(), which may evict it.
+
+class LogPlotPageCache
+{
+ public:
+  LogPlotPageCache();
+  ~LogPlotPageCache() {}
+
+  void setMemoryBudget(unsigned long long bytes);
+
+  unsigned int newSeriesID() {return(m_next_series_id++);}
+  void         dropSeries(unsigned int series_id);
+
+  const LogPlotPage* find(unsigned int series_id, unsigned int page_ix);
+  const LogPlotPage* insert(unsigned int series_id, unsigned int page_ix,
+			    LogPlotPage& page);
+
+  unsigned long long getBytes() const     {return(m_bytes);}
+  unsigned long long getLoads() const     {return(m_loads);}
+  unsigned long long getEvictions() const {return(m_evictions);}
+
+ protected:
+  void evict();
+
+ protected:
+  typedef std::pair<unsigned int, unsigned int> PageKey;
+  typedef std::list<PageKey>::iterator          LRUIter;
+
+  // Most recently used at the front
+  std::list<PageKey> m_lru;
+  std::map<PageKey, std::pair<LogPlotPage, LRUIter> > m_pages;
+
+  unsigned long long m_budget;
+  unsigned long long m_bytes;
+  unsigned int       m_next_series_id;
+
+  unsigned long long m_loads;
+  unsigned long long m_evictions;
+};
+
+#endif
@@ -245,6 +245,58 @@ unsigned int getIndexByTime(const std::vector<double>& vtime, double gtime)
   return(index);
 }
 
+//--------------------------------------------------------
+// Procedure: getIndexByTime()
+//      Note: Same result as above, but the search begins from the
+//            index found on the previous call (the hint). Playback
+//            and scrubbing move the time by small steps, so the new
+//            index is usually at or just beyond the hint. A few steps
+//            forward or back are tried before a full binary search.
+
+unsigned int getIndexByTime(const std::vector<double>& vtime, double gtime,
+			    unsigned int& hint)
+{
+  unsigned int vsize = vtime.size();
+
+  // Handle special cases
+  if(vsize == 0)
+    return(0);
+  if(gtime <= vtime[0]) {
+    hint = 0;
+    return(0);
+  }
+  if(gtime >= vtime[vsize-1]) {
+    hint = vsize-1;
+    return(vsize-1);
+  }
+
+  // Past the special cases, vtime[0] < gtime < vtime[vsize-1], so
+  // the answer is the index with vtime[ix] <= gtime < vtime[ix+1]
+  unsigned int ix = hint;
+  if(ix >= vsize-1)
+    ix = vsize-2;
+
+  for(unsigned int i=0; i<8; i++) {
+    if(vtime[ix] > gtime) {
+      if(ix == 0)
+	break;
+      ix--;
+    }
+    else if(vtime[ix+1] <= gtime) {
+      if((ix+1) >= vsize-1)
+	break;
+      ix++;
+    }
+    else {
+      hint = ix;
+      return(ix);
+    }
+  }
+
+  hint = getIndexByTime(vtime, gtime);
+  return(hint);
+}
+
 //--------------------------------------------------------
 // Procedure: shiftTimeStamp()
 
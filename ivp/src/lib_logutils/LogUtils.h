@@ -53,6 +53,8 @@ double getEpochSecsFromDayOfYear(std::string, int format=0);
 double getEpochSecsFromDayOfYear(double day, double month, double year);
 
 unsigned int getIndexByTime(const std::vector<double>&, double);
+unsigned int getIndexByTime(const std::vector<double>&, double,
+			    unsigned int& hint);
 
 unsigned int getFileLineCount(const std::string& filename);
 
@@ -0,0 +1,480 @@
+/*****************************************************************/
+/*    FILE: PagedLogPlot.cpp                                     */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cfloat>
+#include <algorithm>
+#include "PagedLogPlot.h"
+
+using namespace std;
+
+#ifdef _WIN32
+#define alog_fseek _fseeki64
+#else
+#define alog_fseek fseeko
+#endif
+
+static const unsigned int PAGE_POINTS   = 4096;
+static const unsigned int BUCKET_POINTS = 16;
+
+//---------------------------------------------------------------
+// Procedure: parseKLogLine()
+//      Note: The time and value fields, as found by getTimeStamp()
+//            and getDataEntry() in LogUtils, without making strings.
+
+static bool parseKLogLine(const char* line, size_t len, double& t, double& v)
+{
+  if((len > 0) && (line[0] == '%'))
+    return(false);
+
+  char buff[64];
+  size_t i = 0;
+  while((i < len) && (i < 63) && (line[i] != ' ') && (line[i] != '\t')) {
+    buff[i] = line[i];
+    i++;
+  }
+  buff[i] = '\0';
+  t = atof(buff);
+
+  // States: 0 time, 1 gap, 2 var, 3 gap, 4 src, 5 gap, 6 data
+  int state = 0;
+  for(i=0; (i<len) && (state < 6); i++) {
+    bool white = ((line[i] == ' ') || (line[i] == '\t'));
+    if(white && ((state == 0) || (state == 2) || (state == 4)))
+      state++;
+    else if(!white && ((state == 1) || (state == 3) || (state == 5)))
+      state++;
+  }
+
+  v = 0;
+  if(state == 6) {
+    size_t start = i-1;
+    size_t dlen = len - start;
+    if(dlen > 63)
+      dlen = 63;
+    memcpy(buff, line + start, dlen);
+    buff[dlen] = '\0';
+    v = atof(buff);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: readKLog()
+//      Note: Reads lines from the given offset, handing each with
+//            its offset to the given function until it returns false.
+
+template<class F>
+static bool readKLog(FILE* f, unsigned long long start, F handleLine)
+{
+  if(alog_fseek(f, start, SEEK_SET) != 0)
+    return(false);
+
+  vector<char> buff(262144);
+  string carry;
+  unsigned long long pos = start;
+  unsigned long long line_start = start;
+
+  while(true) {
+    size_t amt = fread(&buff[0], 1, buff.size(), f);
+    if(amt == 0)
+      break;
+
+    const char *p    = &buff[0];
+    const char *last = p + amt;
+    while(p < last) {
+      const char *nl = (const char*)(memchr(p, '\n', last-p));
+      if(!nl) {
+	carry.append(p, last-p);
+	pos += (last-p);
+	break;
+      }
+      bool more = true;
+      pos += (nl-p) + 1;
+      if(carry.length() > 0) {
+	carry.append(p, nl-p);
+	more = handleLine(carry.c_str(), carry.length(), line_start);
+	carry.clear();
+      }
+      else
+	more = handleLine(p, nl-p, line_start);
+      if(!more)
+	return(true);
+      line_start = pos;
+      p = nl + 1;
+    }
+  }
+  if(carry.length() > 0)
+    handleLine(carry.c_str(), carry.length(), line_start);
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Constructor
+
+LogPlotSeries::LogPlotSeries()
+{
+  m_skew = 0;
+  m_tmin = 0;
+  m_tmax = 0;
+  m_series_id = 0;
+
+  m_size     = 0;
+  m_min_time = 0;
+  m_max_time = 0;
+  m_min_val  = 0;
+  m_max_val  = 0;
+}
+
+//---------------------------------------------------------------
+// Destructor
+
+LogPlotSeries::~LogPlotSeries()
+{
+  if(m_cache)
+    m_cache->dropSeries(m_series_id);
+}
+
+//---------------------------------------------------------------
+// Procedure: build()
+//      Note: Points are kept by the same rules as getLogPlot() in
+//            ALogDataBroker: skewed times outside [tmin,tmax] are
+//            dropped, and points out of time order are ignored.
+
+bool LogPlotSeries::build(const string& klog, double skew, double tmin,
+			  double tmax, const shared_ptr<LogPlotPageCache>& cache)
+{
+  FILE *f = fopen(klog.c_str(), "rb");
+  if(!f || !cache) {
+    if(f)
+      fclose(f);
+    return(false);
+  }
+
+  m_klog  = klog;
+  m_skew  = skew;
+  m_tmin  = tmin;
+  m_tmax  = tmax;
+  m_cache = cache;
+  m_series_id = cache->newSeriesID();
+
+  m_levels.clear();
+  m_levels.push_back(vector<LogPlotBucket>());
+  vector<LogPlotBucket>& level0 = m_levels[0];
+
+  readKLog(f, 0, [&](const char* line, size_t len,
+		     unsigned long long offset) -> bool {
+      double t, v;
+      if(!parseKLogLine(line, len, t, v))
+	return(true);
+      t += skew;
+      if(t < tmin)
+	return(true);
+      if(t > tmax)
+	return(false);
+      if((m_size > 0) && (t < m_max_time))
+	return(true);
+
+      if((m_size % PAGE_POINTS) == 0) {
+	m_page_offset.push_back(offset);
+	m_page_prev_time.push_back((m_size > 0) ? m_max_time : -DBL_MAX);
+	m_page_tfirst.push_back(t);
+	m_page_count.push_back(0);
+      }
+      m_page_count.back()++;
+
+      if((m_size % BUCKET_POINTS) == 0) {
+	LogPlotBucket bucket;
+	bucket.m_tfirst = t;
+	bucket.m_vmin   = v;
+	bucket.m_vmax   = v;
+	level0.push_back(bucket);
+      }
+      LogPlotBucket& bucket = level0.back();
+      bucket.m_tlast = t;
+      if(v < bucket.m_vmin)
+	bucket.m_vmin = v;
+      if(v > bucket.m_vmax)
+	bucket.m_vmax = v;
+
+      if((m_size == 0) || (v < m_min_val))
+	m_min_val = v;
+      if((m_size == 0) || (v > m_max_val))
+	m_max_val = v;
+      if(m_size == 0)
+	m_min_time = t;
+      m_max_time = t;
+      m_size++;
+      return(true);
+    });
+  fclose(f);
+
+  // Each higher level merges pairs of buckets from the one below
+  while(m_levels.back().size() > 1) {
+    const vector<LogPlotBucket>& below = m_levels.back();
+    vector<LogPlotBucket> level;
+    for(unsigned int i=0; i<below.size(); i+=2) {
+      LogPlotBucket bucket = below[i];
+      if((i+1) < below.size()) {
+	const LogPlotBucket& next = below[i+1];
+	bucket.m_tlast = next.m_tlast;
+	if(next.m_vmin < bucket.m_vmin)
+	  bucket.m_vmin = next.m_vmin;
+	if(next.m_vmax > bucket.m_vmax)
+	  bucket.m_vmax = next.m_vmax;
+      }
+      level.push_back(bucket);
+    }
+    m_levels.push_back(level);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedure: getPage()
+//      Note: Loaded from the klog file if not in the cache. Returns
+//            null if the page cannot be loaded.
+
+const LogPlotPage* LogPlotSeries::getPage(unsigned int page_ix) const
+{
+  if(page_ix >= m_page_offset.size())
+    return(0);
+
+  const LogPlotPage *cached = m_cache->find(m_series_id, page_ix);
+  if(cached)
+    return(cached);
+
+  FILE *f = fopen(m_klog.c_str(), "rb");
+  if(!f)
+    return(0);
+
+  LogPlotPage page;
+  unsigned int count = m_page_count[page_ix];
+  page.m_time.reserve(count);
+  page.m_value.reserve(count);
+
+  double prev = m_page_prev_time[page_ix];
+  readKLog(f, m_page_offset[page_ix], [&](const char* line, size_t len,
+					 unsigned long long) -> bool {
+      double t, v;
+      if(!parseKLogLine(line, len, t, v))
+	return(true);
+      t += m_skew;
+      if(t < m_tmin)
+	return(true);
+      if(t > m_tmax)
+	return(false);
+      if(t < prev)
+	return(true);
+      page.m_time.push_back(t);
+      page.m_value.push_back(v);
+      prev = t;
+      return(page.m_time.size() < count);
+    });
+  fclose(f);
+
+  return(m_cache->insert(m_series_id, page_ix, page));
+}
+
+//---------------------------------------------------------------
+// Procedure: pageOfTime()
+//   Returns: The last page starting at or before the given time
+
+unsigned int LogPlotSeries::pageOfTime(double gtime) const
+{
+  vector<double>::const_iterator p;
+  p = upper_bound(m_page_tfirst.begin(), m_page_tfirst.end(), gtime);
+  if(p == m_page_tfirst.begin())
+    return(0);
+  return((p - m_page_tfirst.begin()) - 1);
+}
+
+//---------------------------------------------------------------
+// Procedure: bucketOfTime()
+//   Returns: The last bucket at the level starting at or before
+//            the given time
+
+unsigned int LogPlotSeries::bucketOfTime(unsigned int level,
+					 double gtime) const
+{
+  const vector<LogPlotBucket>& buckets = m_levels[level];
+  unsigned int lo = 0;
+  unsigned int hi = buckets.size();
+  while(lo < hi) {
+    unsigned int mid = (lo + hi) / 2;
+    if(buckets[mid].m_tfirst <= gtime)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return((lo > 0) ? lo-1 : 0);
+}
+
+//---------------------------------------------------------------
+// Procedure: build()
+
+bool PagedLogPlot::build(const string& klog, double skew, double tmin,
+			 double tmax, const shared_ptr<LogPlotPageCache>& cache)
+{
+  shared_ptr<LogPlotSeries> series(new LogPlotSeries);
+  if(!series->build(klog, skew, tmin, tmax, cache)) {
+    m_series.reset();
+    return(false);
+  }
+  m_series = series;
+  return(true);
+}
+
+//---------------------------------------------------------------
+// Procedures: size(), getMinTime(), getMaxTime(), getMinVal(),
+//             getMaxVal()
+
+unsigned int PagedLogPlot::size() const
+{
+  return(m_series ? m_series->m_size : 0);
+}
+
+double PagedLogPlot::getMinTime() const
+{
+  return(m_series ? m_series->m_min_time : 0);
+}
+
+double PagedLogPlot::getMaxTime() const
+{
+  return(m_series ? m_series->m_max_time : 0);
+}
+
+double PagedLogPlot::getMinVal() const
+{
+  return(m_series ? m_series->m_min_val : 0);
+}
+
+double PagedLogPlot::getMaxVal() const
+{
+  return(m_series ? m_series->m_max_val : 0);
+}
+
+//---------------------------------------------------------------
+// Procedure: getValueByTime()
+//      Note: Same as LogPlot::getValueByTime() with no interpolation.
+//            The value of the latest point at or before the time.
+
+double PagedLogPlot::getValueByTime(double gtime) const
+{
+  if(size() == 0)
+    return(0);
+
+  const LogPlotSeries& series = *m_series;
+  if(gtime >= series.m_max_time) {
+    const LogPlotPage *page = series.getPage(series.m_page_offset.size()-1);
+    return((page && !page->m_value.empty()) ? page->m_value.back() : 0);
+  }
+  if(gtime <= series.m_min_time) {
+    const LogPlotPage *page = series.getPage(0);
+    return((page && !page->m_value.empty()) ? page->m_value.front() : 0);
+  }
+
+  const LogPlotPage *page = series.getPage(series.pageOfTime(gtime));
+  if(!page || page->m_time.empty())
+    return(0);
+
+  vector<double>::const_iterator p;
+  p = upper_bound(page->m_time.begin(), page->m_time.end(), gtime);
+  if(p == page->m_time.begin())
+    return(page->m_value.front());
+  return(page->m_value[(p - page->m_time.begin()) - 1]);
+}
+
+//---------------------------------------------------------------
+// Procedure: getPoints()
+//      Note: In the raw case, points are chosen as LogPlotViewer has
+//            always done: all points in the window, the last point
+//            before it and the first point after it.
+
+void PagedLogPlot::getPoints(double tmin, double tmax,
+			     unsigned int max_points,
+			     vector<double>& times,
+			     vector<double>& vals) const
+{
+  times.clear();
+  vals.clear();
+  if(size() == 0)
+    return;
+
+  const LogPlotSeries& series = *m_series;
+  unsigned int b_lo = series.bucketOfTime(0, tmin);
+  unsigned int b_hi = series.bucketOfTime(0, tmax);
+  unsigned int approx = (b_hi - b_lo + 1) * BUCKET_POINTS;
+
+  // Part 1: Few enough points to give them all
+  if((max_points == 0) || (approx <= max_points)) {
+    unsigned int ix_lo = b_lo * BUCKET_POINTS;
+    unsigned int ix_hi = (b_hi + 1) * BUCKET_POINTS;
+    if(ix_hi >= series.m_size)
+      ix_hi = series.m_size - 1;
+
+    bool excepted_right = false;
+    for(unsigned int pix=ix_lo/PAGE_POINTS; pix<=ix_hi/PAGE_POINTS; pix++) {
+      const LogPlotPage *page = series.getPage(pix);
+      if(!page)
+	return;
+      unsigned int base = pix * PAGE_POINTS;
+      unsigned int i = (ix_lo > base) ? (ix_lo - base) : 0;
+      for(; (i < page->m_time.size()) && ((base + i) <= ix_hi); i++) {
+	double t = page->m_time[i];
+	if((t >= tmin) && (t <= tmax)) {
+	  times.push_back(t);
+	  vals.push_back(page->m_value[i]);
+	}
+	else if(t <= tmin) {
+	  times.clear();
+	  vals.clear();
+	  times.push_back(t);
+	  vals.push_back(page->m_value[i]);
+	}
+	else if(!excepted_right) {
+	  times.push_back(t);
+	  vals.push_back(page->m_value[i]);
+	  excepted_right = true;
+	}
+      }
+    }
+    return;
+  }
+
+  // Part 2: Otherwise a min and max point for each bucket, from the
+  // lowest level with few enough buckets in the window
+  unsigned int level = 0;
+  while(((level + 1) < series.m_levels.size()) &&
+	((((b_hi >> level) - (b_lo >> level) + 1) * 2) > max_points))
+    level++;
+
+  const vector<LogPlotBucket>& buckets = series.m_levels[level];
+  for(unsigned int b=(b_lo >> level); b<=(b_hi >> level); b++) {
+    const LogPlotBucket& bucket = buckets[b];
+    double t = (bucket.m_tfirst + bucket.m_tlast) / 2;
+    times.push_back(t);
+    vals.push_back(bucket.m_vmin);
+    times.push_back(t);
+    vals.push_back(bucket.m_vmax);
+  }
+}
@@ -0,0 +1,153 @@
+/*****************************************************************/
+/*    FILE: QuantileSketch.cpp                                   */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include "QuantileSketch.h"
+
+using namespace std;
+
+// Magnitudes below this are counted as zero
+static const double QS_MIN_VALUE = 1e-9;
+
+//--------------------------------------------------------
+// Constructor()
+
+QuantileSketch::QuantileSketch()
+{
+  double accuracy = 0.01;
+
+  m_gamma       = (1 + accuracy) / (1 - accuracy);
+  m_log_gamma   = log(m_gamma);
+  m_max_buckets = 1024;
+  m_zeros       = 0;
+  m_count       = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: bucketKey()
+
+int QuantileSketch::bucketKey(double val) const
+{
+  return((int)(ceil(log(val) / m_log_gamma)));
+}
+
+//--------------------------------------------------------
+// Procedure: bucketValue()
+//      Note: The value for which the relative error is the same to
+//            both bounds of the bucket.
+
+double QuantileSketch::bucketValue(int key) const
+{
+  return(2 * pow(m_gamma, key) / (m_gamma + 1));
+}
+
+//--------------------------------------------------------
+// Procedure: add()
+
+void QuantileSketch::add(double val)
+{
+  m_count++;
+  if(val > QS_MIN_VALUE) {
+    m_pos[bucketKey(val)]++;
+    if(m_pos.size() > m_max_buckets)
+      collapse(m_pos);
+  }
+  else if(val < -QS_MIN_VALUE) {
+    m_neg[bucketKey(-val)]++;
+    if(m_neg.size() > m_max_buckets)
+      collapse(m_neg);
+  }
+  else
+    m_zeros++;
+}
+
+//--------------------------------------------------------
+// Procedure: collapse()
+//      Note: Merges the lowest buckets, nearest zero, into one
+
+void QuantileSketch::collapse(map<int, unsigned long long>& buckets)
+{
+  while(buckets.size() > m_max_buckets) {
+    map<int, unsigned long long>::iterator p = buckets.begin();
+    unsigned long long amt = p->second;
+    buckets.erase(p);
+    buckets.begin()->second += amt;
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: merge()
+
+void QuantileSketch::merge(const QuantileSketch& sketch)
+{
+  map<int, unsigned long long>::const_iterator p;
+  for(p=sketch.m_pos.begin(); p!=sketch.m_pos.end(); p++)
+    m_pos[p->first] += p->second;
+  for(p=sketch.m_neg.begin(); p!=sketch.m_neg.end(); p++)
+    m_neg[p->first] += p->second;
+
+  m_zeros += sketch.m_zeros;
+  m_count += sketch.m_count;
+
+  if(m_pos.size() > m_max_buckets)
+    collapse(m_pos);
+  if(m_neg.size() > m_max_buckets)
+    collapse(m_neg);
+}
+
+//--------------------------------------------------------
+// Procedure: quantile()
+//      Note: Buckets are walked from the most negative value to the
+//            most positive until the rank of q is reached.
+
+double QuantileSketch::quantile(double q) const
+{
+  if(m_count == 0)
+    return(0);
+  if(q < 0)
+    q = 0;
+  if(q > 1)
+    q = 1;
+
+  double rank = q * (double)(m_count - 1);
+  double seen = 0;
+
+  map<int, unsigned long long>::const_reverse_iterator r;
+  for(r=m_neg.rbegin(); r!=m_neg.rend(); r++) {
+    seen += (double)(r->second);
+    if(seen > rank)
+      return(-bucketValue(r->first));
+  }
+
+  seen += (double)(m_zeros);
+  if(seen > rank)
+    return(0);
+
+  map<int, unsigned long long>::const_iterator p;
+  for(p=m_pos.begin(); p!=m_pos.end(); p++) {
+    seen += (double)(p->second);
+    if(seen > rank)
+      return(bucketValue(p->first));
+  }
+
+  if(!m_pos.empty())
+    return(bucketValue(m_pos.rbegin()->first));
+  return(0);
+}
@@ -65,6 +65,30 @@ void ScanReport::addLine(double timestamp, const string& varname,
 }
 
 
+//--------------------------------------------------------
+// Procedure: addVarSummary
+
+void ScanReport::addVarSummary(const string& varname, const string& sources,
+			       double first, double last, double tmin,
+			       double tmax, unsigned int lines,
+			       unsigned int chars)
+{
+  if((tmin < m_time_min) || (m_lines == 0))
+    m_time_min = tmin;
+  if((tmax > m_time_max) || (m_lines == 0))
+    m_time_max = tmax;
+  m_total_chars += (double)(chars);
+  m_lines += lines;
+
+  m_var_names.push_back(varname);
+  m_var_sources.push_back(sources);
+  m_var_first.push_back(first);
+  m_var_last.push_back(last);
+  m_var_lines.push_back(lines);
+  m_var_chars.push_back(chars);
+  m_vmap[varname] = m_var_names.size()-1;
+}
+
 //--------------------------------------------------------
 // Procedure: addLineRateOnly
 
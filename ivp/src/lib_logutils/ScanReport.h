@@ -41,6 +41,12 @@ class ScanReport
 
   void addLineRateOnly(const ALogEntry& entry);
 
+  // Adds the totals of a variable already summarized elsewhere
+  void addVarSummary(const std::string& varname,
+		     const std::string& sources, double first,
+		     double last, double tmin, double tmax,
+		     unsigned int lines, unsigned int chars);
+
   bool         containsVar(const std::string& varname);
   int          getVarIndex(const std::string& varname);
   unsigned int size() {return(m_var_names.size());}
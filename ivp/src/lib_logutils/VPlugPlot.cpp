@@ -38,8 +38,15 @@ VPlugPlot::VPlugPlot()
 {
   // Init config vars
   m_binval = 0;
+  m_snap_interval = 100;
 
   // Init state vars
+  m_snaps.push_back(VPlug_GeoShapes());
+  m_snap_cnt.push_back(0);
+
+  m_cursor_cnt = 0;
+  m_time_hint  = 0;
+
   m_view_point_cnt   = 0;
   m_view_polygon_cnt = 0;
   m_view_seglist_cnt = 0;
@@ -50,7 +57,8 @@ VPlugPlot::VPlugPlot()
   m_grid_delta_cnt   = 0;
   m_view_range_pulse_cnt = 0;
   m_view_comms_pulse_cnt = 0;
-  m_view_marker_cnt = 0;
+  m_view_marker_cnt  = 0;
+  m_view_textbox_cnt = 0;
 }
 
 //---------------------------------------------------------------
@@ -58,6 +66,10 @@ VPlugPlot::VPlugPlot()
 //      Note: Likely called by:
 //            Populator_VPlugPlots::populateFromEntries() or
 //            Populator_VPlugPlots::populateFromEntry()
+//      Note: A new time bin is started if the event time is beyond
+//            the start of the latest bin by more than the bin value.
+//            The visuals of a bin are those of all events up to the
+//            end of the bin.
 
 bool VPlugPlot::addEvent(const string& var, const string& val,
 			 double time)
@@ -67,65 +79,140 @@ bool VPlugPlot::addEvent(const string& var, const string& val,
   if(vsize > 0)
     latest_vplug_time = m_time[vsize-1];
 
+  unsigned int event_cnt = m_event_type.size();
   if((latest_vplug_time == -1) ||
      (time > latest_vplug_time + m_binval)) {
-    VPlug_GeoShapes new_vplug;
-    if(latest_vplug_time != -1) 
-      new_vplug = m_vplugs[vsize-1];
-    m_vplugs.push_back(new_vplug);
     m_time.push_back(time);
+    m_bin_end.push_back(event_cnt);
     vsize++;
   }
 
+  unsigned short event_type = 0;
   if(var == "VIEW_POINT") {
-    m_vplugs[vsize-1].addPoint(val);
+    event_type = 1;
     m_view_point_cnt++;
   }
   else if(var == "VIEW_POLYGON") {
-    m_vplugs[vsize-1].addPolygon(val);
+    event_type = 2;
     m_view_polygon_cnt++;
   }
   else if(var == "VIEW_SEGLIST") {
-    m_vplugs[vsize-1].addSegList(val);
+    event_type = 3;
     m_view_seglist_cnt++;
   }
   else if(var == "VIEW_SEGLR") {
-    m_vplugs[vsize-1].addSeglr(val);
+    event_type = 4;
     m_view_seglr_cnt++;
   }
   else if(var == "VIEW_CIRCLE") {
-    m_vplugs[vsize-1].addCircle(val);
+    event_type = 5;
     m_view_circle_cnt++;
   }
   else if(var == "VIEW_ARROW") {
-    m_vplugs[vsize-1].addArrow(val);
+    event_type = 6;
     m_view_arrow_cnt++;
   }
   else if(var == "GRID_CONFIG") {
-    m_vplugs[vsize-1].addGrid(val);
+    event_type = 7;
     m_grid_config_cnt++;
   }
   else if(var == "GRID_DELTA") {
-    m_vplugs[vsize-1].updateGrid(val);
+    event_type = 8;
     m_grid_delta_cnt++;
   }
   else if(var == "VIEW_RANGE_PULSE") {
-    m_vplugs[vsize-1].addRangePulse(val);
+    event_type = 9;
     m_view_range_pulse_cnt++;
   }
   else if(var == "VIEW_COMMS_PULSE") {
-    m_vplugs[vsize-1].addCommsPulse(val);
+    event_type = 10;
     m_view_comms_pulse_cnt++;
   }
   else if(var == "VIEW_MARKER") {
-    m_vplugs[vsize-1].addMarker(val);
+    event_type = 11;
     m_view_marker_cnt++;
   }
   else if(var == "VIEW_TEXTBOX") {
-    m_vplugs[vsize-1].addTextBox(val);
+    event_type = 12;
     m_view_textbox_cnt++;
   }
-  return true;
+  if(event_type == 0)
+    return(true);
+
+  // Snapshots are taken of the visuals before the event, so that a
+  // snapshot is never more than the snap interval behind any event
+  if((event_cnt - m_snap_cnt.back()) >= m_snap_interval) {
+    m_snaps.push_back(m_latest);
+    m_snap_cnt.push_back(event_cnt);
+  }
+
+  m_event_type.push_back(event_type);
+  m_event_val.push_back(val);
+  applyEvent(m_latest, event_cnt);
+  m_bin_end[vsize-1] = event_cnt + 1;
+  return(true);
+}
+     
+//---------------------------------------------------------------
+// Procedure: applyEvent()
+
+bool VPlugPlot::applyEvent(VPlug_GeoShapes& vplug,
+			   unsigned int event_ix) const
+{
+  if(event_ix >= m_event_type.size())
+    return(false);
+
+  const string& val = m_event_val[event_ix];
+  switch(m_event_type[event_ix]) {
+  case 1:  return(vplug.addPoint(val));
+  case 2:  return(vplug.addPolygon(val));
+  case 3:  return(vplug.addSegList(val));
+  case 4:  return(vplug.addSeglr(val));
+  case 5:  return(vplug.addCircle(val));
+  case 6:  return(vplug.addArrow(val));
+  case 7:  return(vplug.addGrid(val));
+  case 8:  return(vplug.updateGrid(val));
+  case 9:  return(vplug.addRangePulse(val));
+  case 10: return(vplug.addCommsPulse(val));
+  case 11: return(vplug.addMarker(val));
+  case 12: return(vplug.addTextBox(val));
+  }
+  return(false);
+}
+     
+//---------------------------------------------------------------
+// Procedure: seekEvent()
+//   Purpose: Bring the replay cursor to the visuals after the given
+//            number of events. The shape updates cannot be undone
+//            (a shape replaces any earlier one of the same label), so
+//            going back means starting again from a snapshot.
+
+void VPlugPlot::seekEvent(unsigned int event_cnt) const
+{
+  if(event_cnt > m_event_type.size())
+    event_cnt = m_event_type.size();
+
+  // Find the latest snapshot at or before the target
+  unsigned int six = event_cnt / m_snap_interval;
+  if(six >= m_snap_cnt.size())
+    six = m_snap_cnt.size() - 1;
+  while((six > 0) && (m_snap_cnt[six] > event_cnt))
+    six--;
+
+  // Restart from the snapshot if behind the cursor, or if it saves
+  // applying some events. The snapshot's polygon revisions predate
+  // what the viewer last drew from the cursor, so they are renewed
+  // to have the viewer rebuild them all.
+  if((event_cnt < m_cursor_cnt) || (m_snap_cnt[six] > m_cursor_cnt)) {
+    m_cursor = m_snaps[six];
+    m_cursor.touchPolygons();
+    m_cursor_cnt = m_snap_cnt[six];
+  }
+
+  while(m_cursor_cnt < event_cnt) {
+    applyEvent(m_cursor, m_cursor_cnt);
+    m_cursor_cnt++;
+  }
 }
      
 //---------------------------------------------------------------
@@ -137,40 +224,48 @@ void VPlugPlot::setBinVal(double binval)
     m_binval = binval;
 }
 
+//---------------------------------------------------------------
+// Procedure: setSnapInterval()
+//      Note: Only has effect before events are added
+
+void VPlugPlot::setSnapInterval(unsigned int interval)
+{
+  if((interval > 0) && (m_event_type.size() == 0))
+    m_snap_interval = interval;
+}
+
 //---------------------------------------------------------------
 // Procedure: getVPlugByIndex()
 
-VPlug_GeoShapes VPlugPlot::getVPlugByIndex(unsigned int index) const
+const VPlug_GeoShapes& VPlugPlot::getVPlugByIndex(unsigned int index) const
 {
-  if(index < m_time.size())
-    return(m_vplugs[index]);
-  else {
-    VPlug_GeoShapes null_plug;
-    return(null_plug);
-  }
+  if(index >= m_time.size())
+    return(m_null_vplug);
+
+  if(m_bin_end[index] == m_event_type.size())
+    return(m_latest);
+
+  seekEvent(m_bin_end[index]);
+  return(m_cursor);
 }
 
 //---------------------------------------------------------------
 // Procedure: getVPlugByTime()
 
-VPlug_GeoShapes VPlugPlot::getVPlugByTime(double gtime) const
+const VPlug_GeoShapes& VPlugPlot::getVPlugByTime(double gtime) const
 {
   unsigned int vsize = m_time.size();
-  if(vsize == 0) {
-    VPlug_GeoShapes null_plug;
-    return(null_plug);
-  }
+  if(vsize == 0)
+    return(m_null_vplug);
 
-  if(gtime <= m_time[0]) {
-    VPlug_GeoShapes null_plug;
-    return(null_plug);
-  }
+  if(gtime <= m_time[0])
+    return(m_null_vplug);
 
   if(gtime >= m_time[vsize-1])
-    return(m_vplugs[vsize-1]);
+    return(m_latest);
 
-  unsigned int index = getIndexByTime(m_time, gtime);
-  return(m_vplugs[index]);
+  unsigned int index = getIndexByTime(m_time, gtime, m_time_hint);
+  return(getVPlugByIndex(index));
 }
      
 //---------------------------------------------------------------
@@ -131,7 +131,6 @@ void SimEngine::propagateSpeed(NodeRecord& record, const ThrustMap& tmap,
 			       double rudder, double max_accel, 
 			       double max_decel)
 {
-  m_verbose = true;
   if(delta_time <= 0)
     return;
 
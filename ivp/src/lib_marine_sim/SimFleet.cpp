@@ -0,0 +1,383 @@
+/*****************************************************************/
+/*    FILE: SimFleet.cpp                                         */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include "AngleUtils.h"
+#include "SimFleet.h"
+
+using namespace std;
+
+//--------------------------------------------------------------------
+// Procedure: addVehicle()
+//   Returns: The index of the new vehicle in the fleet
+
+unsigned int SimFleet::addVehicle(const NodeRecord& record,
+				  const ThrustMap& tmap)
+{
+  string key = ThrustTable::keyOf(tmap);
+  if(m_table_keys.count(key) == 0) {
+    m_table_keys[key] = m_tables.size();
+    m_tables.push_back(ThrustTable(tmap));
+  }
+  m_table_ix.push_back(m_table_keys[key]);
+
+  m_x.push_back(record.getX());
+  m_y.push_back(record.getY());
+  m_hdg.push_back(record.getHeading());
+  m_spd.push_back(record.getSpeed());
+  m_dep.push_back(record.getDepth());
+  m_pitch.push_back(record.getPitch());
+  m_yaw.push_back(record.getYaw());
+  m_sog.push_back(record.getSpeedOG());
+  m_hog.push_back(record.getHeadingOG());
+  m_time.push_back(record.getTimeStamp());
+  m_sin_hdg.push_back(sin(degToRadians(record.getHeading())));
+  m_cos_hdg.push_back(cos(degToRadians(record.getHeading())));
+
+  m_thrust.push_back(0);
+  m_rudder.push_back(0);
+  m_elevator.push_back(0);
+  m_drift_x.push_back(0);
+  m_drift_y.push_back(0);
+  m_rotate_spd.push_back(0);
+
+  m_max_accel.push_back(0);
+  m_max_decel.push_back(0);
+  m_buoy_rate.push_back(0);
+  m_max_dep_rate.push_back(0);
+  m_max_dep_rate_spd.push_back(0);
+
+  m_due.push_back(0);
+
+  unsigned int ix = m_x.size() - 1;
+  m_tsm_full_spd.push_back(0);
+  m_tsm_null_spd.push_back(0);
+  m_tsm_full_rate.push_back(0);
+  m_tsm_null_rate.push_back(0);
+  setTurnParams(ix, TurnSpeedMap(), 0);
+
+  m_dt.resize(ix+1);
+  m_prior_spd.resize(ix+1);
+  m_next_spd.resize(ix+1);
+  return(ix);
+}
+
+//--------------------------------------------------------------------
+// Procedure: setTurnParams()
+//      Note: SimEngine::propagateHeading() sets the full rate to the
+//            vehicle turn rate, and the full speed to 5, on each
+//            call. Do it once here with the same side effects.
+
+void SimFleet::setTurnParams(unsigned int ix, TurnSpeedMap tsmap,
+			     double turn_rate)
+{
+  if(ix >= m_x.size())
+    return;
+
+  tsmap.setFullRate(turn_rate);
+  tsmap.setFullSpeed(5);
+
+  m_tsm_full_spd[ix]  = tsmap.getFullSpeed();
+  m_tsm_null_spd[ix]  = tsmap.getNullSpeed();
+  m_tsm_full_rate[ix] = tsmap.getFullRate();
+  m_tsm_null_rate[ix] = tsmap.getNullRate();
+}
+
+//--------------------------------------------------------------------
+// Procedure: setSpeedLimits()
+
+void SimFleet::setSpeedLimits(unsigned int ix, double max_accel,
+			      double max_decel)
+{
+  if(ix >= m_x.size())
+    return;
+  m_max_accel[ix] = max_accel;
+  m_max_decel[ix] = max_decel;
+}
+
+//--------------------------------------------------------------------
+// Procedure: setDepthParams()
+
+void SimFleet::setDepthParams(unsigned int ix, double buoyancy_rate,
+			      double max_depth_rate,
+			      double max_depth_rate_spd)
+{
+  if(ix >= m_x.size())
+    return;
+  m_buoy_rate[ix]        = buoyancy_rate;
+  m_max_dep_rate[ix]     = max_depth_rate;
+  m_max_dep_rate_spd[ix] = max_depth_rate_spd;
+}
+
+//--------------------------------------------------------------------
+// Procedure: setActuators()
+
+void SimFleet::setActuators(unsigned int ix, double thrust,
+			    double rudder, double elevator)
+{
+  if(ix >= m_x.size())
+    return;
+  m_thrust[ix]   = thrust;
+  m_rudder[ix]   = rudder;
+  m_elevator[ix] = elevator;
+}
+
+//--------------------------------------------------------------------
+// Procedure: setExternal()
+
+void SimFleet::setExternal(unsigned int ix, double drift_x,
+			   double drift_y, double rotate_speed)
+{
+  if(ix >= m_x.size())
+    return;
+  m_drift_x[ix]    = drift_x;
+  m_drift_y[ix]    = drift_y;
+  m_rotate_spd[ix] = rotate_speed;
+}
+
+//--------------------------------------------------------------------
+// Procedure: propagate()
+//   Purpose: Advance all vehicles marked due to the given time. The
+//            steps are done in the same order as in
+//            USM_Model::propagateNodeRecord(), each as one pass over
+//            the whole fleet.
+
+void SimFleet::propagate(double curr_time)
+{
+  unsigned int i, vsize = m_x.size();
+  for(i=0; i<vsize; i++) {
+    m_dt[i] = m_due[i] ? (curr_time - m_time[i]) : 0;
+    m_prior_spd[i] = m_spd[i];
+  }
+
+  propagateSpeed();
+  propagateHeading();
+  propagateDepth();
+  propagatePosition();
+
+  for(i=0; i<vsize; i++)
+    m_due[i] = 0;
+}
+
+//--------------------------------------------------------------------
+// Procedure: copyToRecord()
+
+void SimFleet::copyToRecord(unsigned int ix, NodeRecord& record) const
+{
+  if(ix >= m_x.size())
+    return;
+
+  record.setX(m_x[ix]);
+  record.setY(m_y[ix]);
+  record.setHeading(m_hdg[ix]);
+  record.setSpeed(m_spd[ix]);
+  record.setDepth(m_dep[ix]);
+  record.setPitch(m_pitch[ix]);
+  record.setYaw(m_yaw[ix]);
+  record.setSpeedOG(m_sog[ix]);
+  record.setHeadingOG(m_hog[ix]);
+  record.setTimeStamp(m_time[ix]);
+}
+
+//--------------------------------------------------------------------
+// Procedure: propagateSpeed()
+//      Note: Same model as SimEngine::propagateSpeed(). The second
+//            loop has no calls or early exits, so the compiler is
+//            free to vectorize it.
+
+void SimFleet::propagateSpeed()
+{
+  unsigned int i, vsize = m_x.size();
+  for(i=0; i<vsize; i++)
+    m_next_spd[i] = m_tables[m_table_ix[i]].getSpeedValue(m_thrust[i]);
+
+  for(i=0; i<vsize; i++) {
+    double dt         = m_dt[i];
+    double prev_speed = m_spd[i];
+    double next_speed = m_next_spd[i];
+
+    // Apply a slowing penalty proportional to the rudder/turn
+    double rudder = m_rudder[i];
+    rudder = (rudder < -100) ? -100 : ((rudder > 100) ? 100 : rudder);
+    double vpct = (fabs(rudder) / 100) * 0.85;
+    next_speed *= (1.0 - vpct);
+
+    // Vehicles not due have dt=0, guard the divisions below.
+    double safe_dt = (dt > 0) ? dt : 1;
+
+    double acceleration = (next_speed - prev_speed) / safe_dt;
+    if((next_speed > prev_speed) && (m_max_accel[i] > 0) &&
+       (acceleration > m_max_accel[i]))
+      next_speed = (m_max_accel[i] * dt) + prev_speed;
+
+    double deceleration = (prev_speed - next_speed) / safe_dt;
+    if((next_speed < prev_speed) && (m_max_decel[i] > 0) &&
+       (deceleration > m_max_decel[i]))
+      next_speed = (m_max_decel[i] * dt * -1) + prev_speed;
+
+    m_spd[i] = (m_due[i] && (dt > 0)) ? next_speed : prev_speed;
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: propagateHeading()
+//      Note: Same model as SimEngine::propagateHeading() with the
+//            TurnSpeedMap::getTurnRate() step unrolled.
+
+void SimFleet::propagateHeading()
+{
+  unsigned int i, vsize = m_x.size();
+  for(i=0; i<vsize; i++) {
+    if(!m_due[i])
+      continue;
+
+    double dt     = m_dt[i];
+    double speed  = m_spd[i];
+    double rudder = (speed == 0) ? 0 : m_rudder[i];
+
+    double turn_rate = 0;
+    double full_spd  = m_tsm_full_spd[i];
+    double null_spd  = m_tsm_null_spd[i];
+    double full_rate = m_tsm_full_rate[i];
+    double null_rate = m_tsm_null_rate[i];
+    if((full_spd < 0) || (full_rate < 0))
+      turn_rate = 0;
+    else if(speed <= null_spd)
+      turn_rate = null_rate;
+    else if(speed >= full_spd)
+      turn_rate = full_rate;
+    else if((full_spd - null_spd) > 0) {
+      double pct = (speed - null_spd) / (full_spd - null_spd);
+      turn_rate = (pct * (full_rate - null_rate)) + null_rate;
+    }
+
+    rudder    = (rudder < -100) ? -100 : ((rudder > 100) ? 100 : rudder);
+    turn_rate = (turn_rate < 0) ? 0 : ((turn_rate > 100) ? 100 : turn_rate);
+
+    double delta_deg = rudder * (turn_rate/100) * dt;
+    delta_deg = (1 + ((m_thrust[i]-50)/50)) * delta_deg;
+    delta_deg += (dt * m_rotate_spd[i]);
+
+    double new_heading = angle360(delta_deg + m_hdg[i]);
+    m_hdg[i] = new_heading;
+    m_yaw[i] = -degToRadians(angle180(new_heading));
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: propagateDepth()
+//      Note: Same model as SimEngine::propagateDepth()
+
+void SimFleet::propagateDepth()
+{
+  unsigned int i, vsize = m_x.size();
+  for(i=0; i<vsize; i++) {
+    if(!m_due[i])
+      continue;
+
+    double dt         = m_dt[i];
+    double speed      = m_spd[i];
+    double prev_depth = m_dep[i];
+    double elevator   = m_elevator[i];
+    elevator = (elevator < -100) ? -100 : ((elevator > 100) ? 100 : elevator);
+
+    double new_depth = 0;
+    if(speed <= 0) {
+      new_depth  = prev_depth + (-1 * m_buoy_rate[i] * dt);
+      m_pitch[i] = 0;
+    }
+    else {
+      double pct = 1.0;
+      if(m_max_dep_rate_spd[i] > 0) {
+	pct = (speed / m_max_dep_rate_spd[i]);
+	if(pct > 1.0)
+	  pct = 1.0;
+      }
+      if(pct < 0)
+	pct = -1 * sqrt(-1 * pct);
+      else
+	pct = sqrt(pct);
+      double depth_rate = pct * m_max_dep_rate[i];
+      double pitch_depth_rate = - sin(m_pitch[i])*speed;
+      double actuator_depth_rate = (elevator/100) * depth_rate;
+      double total_depth_rate = (-m_buoy_rate[i]) + pitch_depth_rate +
+	actuator_depth_rate;
+
+      new_depth = prev_depth + (1 * total_depth_rate * dt);
+
+      double pitch = 0;
+      double rate_sum = pitch_depth_rate + actuator_depth_rate;
+      if(fabs(rate_sum) <= speed)
+	pitch = - asin(rate_sum / speed);
+      m_pitch[i] = pitch;
+    }
+
+    if(new_depth < 0)
+      new_depth = 0;
+    m_dep[i] = new_depth;
+  }
+}
+
+//--------------------------------------------------------------------
+// Procedure: propagatePosition()
+//      Note: Same model as SimEngine::propagate(). The sin/cos of
+//            the prior heading are those computed on the last step.
+
+void SimFleet::propagatePosition()
+{
+  unsigned int i, vsize = m_x.size();
+  for(i=0; i<vsize; i++) {
+    if(!m_due[i])
+      continue;
+
+    double dt = m_dt[i];
+    double speed = (m_spd[i] + m_prior_spd[i]) / 2;
+
+    double hdg_rad = degToRadians(m_hdg[i]);
+    double sin_hdg = sin(hdg_rad);
+    double cos_hdg = cos(hdg_rad);
+
+    double s = m_sin_hdg[i] + sin_hdg;
+    double c = m_cos_hdg[i] + cos_hdg;
+    m_sin_hdg[i] = sin_hdg;
+    m_cos_hdg[i] = cos_hdg;
+
+    double avg_rad = atan2(s, c);
+
+    double xdot = (sin(avg_rad) * speed);
+    double ydot = (cos(avg_rad) * speed);
+
+    double new_speed = hypot(xdot, ydot);
+    if(speed < 0)
+      new_speed = -new_speed;
+
+    double prev_x = m_x[i];
+    double prev_y = m_y[i];
+    double new_x  = prev_x + (xdot * dt) + (m_drift_x[i] * dt);
+    double new_y  = prev_y + (ydot * dt) + (m_drift_y[i] * dt);
+
+    m_spd[i]  = new_speed;
+    m_x[i]    = new_x;
+    m_y[i]    = new_y;
+    m_time[i] = m_time[i] + dt;
+    m_sog[i]  = hypot((xdot + m_drift_x[i]), (ydot + m_drift_y[i]));
+    m_hog[i]  = relAng(prev_x, prev_y, new_x, new_y);
+  }
+}
@@ -0,0 +1,119 @@
+/*****************************************************************/
+/*    FILE: SimFleet.h                                           */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef SIM_FLEET_HEADER
+#define SIM_FLEET_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+#include "NodeRecord.h"
+#include "ThrustMap.h"
+#include "ThrustTable.h"
+#include "TurnSpeedMap.h"
+
+// The state of many simulated vehicles held as parallel arrays,
+// one entry per vehicle, propagated together in one call. The
+// model is that of SimEngine for the standard (rudder/thrust)
+// thrust mode, and gives identical results. Vehicles with the
+// same thrust map share one ThrustTable.
+
+class SimFleet
+{
+public:
+  SimFleet() {}
+  ~SimFleet() {}
+
+  unsigned int addVehicle(const NodeRecord&, const ThrustMap&);
+
+  void setTurnParams(unsigned int ix, TurnSpeedMap, double turn_rate);
+  void setSpeedLimits(unsigned int ix, double max_accel, double max_decel);
+  void setDepthParams(unsigned int ix, double buoyancy_rate,
+		      double max_depth_rate, double max_depth_rate_spd);
+  void setActuators(unsigned int ix, double thrust, double rudder,
+		    double elevator);
+  void setExternal(unsigned int ix, double drift_x, double drift_y,
+		   double rotate_speed);
+
+  // Only vehicles marked due are advanced by the next propagate()
+  void setDue(unsigned int ix, bool v=true) {m_due[ix] = v ? 1 : 0;}
+
+  void propagate(double curr_time);
+
+  void copyToRecord(unsigned int ix, NodeRecord&) const;
+
+  unsigned int size() const        {return(m_x.size());}
+  unsigned int tableCount() const  {return(m_tables.size());}
+
+ protected:
+  void propagateSpeed();
+  void propagateHeading();
+  void propagateDepth();
+  void propagatePosition();
+
+ protected: // Vehicle state
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_hdg;
+  std::vector<double> m_spd;
+  std::vector<double> m_dep;
+  std::vector<double> m_pitch;
+  std::vector<double> m_yaw;
+  std::vector<double> m_sog;
+  std::vector<double> m_hog;
+  std::vector<double> m_time;
+
+  // sin/cos of the current heading, kept from the last step since
+  // propagation needs them for both the prior and new heading.
+  std::vector<double> m_sin_hdg;
+  std::vector<double> m_cos_hdg;
+
+ protected: // Actuators and external forces
+  std::vector<double> m_thrust;
+  std::vector<double> m_rudder;
+  std::vector<double> m_elevator;
+  std::vector<double> m_drift_x;
+  std::vector<double> m_drift_y;
+  std::vector<double> m_rotate_spd;
+
+ protected: // Vehicle characteristics
+  std::vector<double> m_max_accel;
+  std::vector<double> m_max_decel;
+  std::vector<double> m_tsm_full_spd;
+  std::vector<double> m_tsm_null_spd;
+  std::vector<double> m_tsm_full_rate;
+  std::vector<double> m_tsm_null_rate;
+  std::vector<double> m_buoy_rate;
+  std::vector<double> m_max_dep_rate;
+  std::vector<double> m_max_dep_rate_spd;
+
+  std::vector<unsigned int> m_table_ix;
+  std::vector<char>         m_due;
+
+ protected: // Per-step scratch
+  std::vector<double> m_dt;
+  std::vector<double> m_prior_spd;
+  std::vector<double> m_next_spd;
+
+  std::vector<ThrustTable>            m_tables;
+  std::map<std::string, unsigned int> m_table_keys;
+};
+
+#endif
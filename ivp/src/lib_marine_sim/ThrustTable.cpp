@@ -0,0 +1,194 @@
+/*****************************************************************/
+/*    FILE: ThrustTable.cpp                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <map>
+#include "ThrustTable.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Constructor
+//      Note: The segment arithmetic below mirrors the searches in
+//            ThrustMap::getSpeedValuePos/Neg() so that results are
+//            identical, not just close.
+
+ThrustTable::ThrustTable(const ThrustMap& tmap)
+{
+  m_min_thrust       = tmap.getMinThrust();
+  m_max_thrust       = tmap.getMaxThrust();
+  m_thrust_factor    = tmap.getThrustFactor();
+  m_reflect_negative = tmap.usingReflect();
+  m_key              = keyOf(tmap);
+
+  map<double, double> pos_mapping = tmap.getPosMapping();
+  map<double, double>::iterator p;
+  for(p=pos_mapping.begin(); p!=pos_mapping.end(); p++) {
+    m_pos_thrust.push_back(p->first);
+    m_pos_speed.push_back(p->second);
+  }
+
+  map<double, double> neg_mapping = tmap.getNegMapping();
+  for(p=neg_mapping.begin(); p!=neg_mapping.end(); p++) {
+    m_neg_thrust.push_back(p->first);
+    m_neg_speed.push_back(p->second);
+  }
+
+  // Positive segment i has left point i-1 (or the origin when i=0)
+  // and right point i (or max_thrust at the top speed when i=n).
+  unsigned int i, psize = m_pos_thrust.size();
+  for(i=0; (psize > 0) && (i<=psize); i++) {
+    double left_dom  = 0;
+    double left_val  = 0;
+    double right_dom = m_max_thrust;
+    double right_val = m_pos_speed[psize-1];
+    if(i > 0) {
+      left_dom = m_pos_thrust[i-1];
+      left_val = m_pos_speed[i-1];
+    }
+    if(i < psize) {
+      right_dom = m_pos_thrust[i];
+      right_val = m_pos_speed[i];
+    }
+    double run = (right_dom - left_dom);
+    m_pos_valid.push_back(run > 0);
+    m_pos_slope.push_back((run > 0) ? ((right_val - left_val) / run) : 0);
+  }
+
+  // Negative segment i has left point i-1 (or min_thrust at the
+  // lowest speed when i=0) and right point i (or the origin when
+  // i=n).
+  unsigned int nsize = m_neg_thrust.size();
+  for(i=0; (nsize > 0) && (i<=nsize); i++) {
+    double left_dom  = m_min_thrust;
+    double left_val  = m_neg_speed[0];
+    double right_dom = 0;
+    double right_val = 0;
+    if(i > 0) {
+      left_dom = m_neg_thrust[i-1];
+      left_val = m_neg_speed[i-1];
+    }
+    if(i < nsize) {
+      right_dom = m_neg_thrust[i];
+      right_val = m_neg_speed[i];
+    }
+    double run = (right_dom - left_dom);
+    m_neg_valid.push_back(run > 0);
+    m_neg_slope.push_back((run > 0) ? ((right_val - left_val) / run) : 0);
+  }
+}
+
+//----------------------------------------------------------------
+// Procedure: keyOf()
+//   Purpose: A string unique to the mapping, so vehicles configured
+//            with the same thrust map may share one table.
+
+string ThrustTable::keyOf(const ThrustMap& tmap)
+{
+  string key = tmap.getMapPos() + "#" + tmap.getMapNeg();
+  key += "#" + doubleToString(tmap.getThrustFactor(), 12);
+  key += "#" + doubleToString(tmap.getMinThrust(), 12);
+  key += "#" + doubleToString(tmap.getMaxThrust(), 12);
+  key += "#" + boolToString(tmap.usingReflect());
+  return(key);
+}
+
+//----------------------------------------------------------------
+// Procedure: getSpeedValue()
+
+double ThrustTable::getSpeedValue(double thrust) const
+{
+  if(thrust < 0)
+    return(getSpeedValueNeg(thrust));
+  else if(thrust > 0)
+    return(getSpeedValuePos(thrust));
+  else
+    return(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: getSpeedValuePos()
+
+double ThrustTable::getSpeedValuePos(double thrust) const
+{
+  unsigned int psize = m_pos_thrust.size();
+  if(psize == 0) {
+    if(m_thrust_factor == 0)
+      return(0);
+    else
+      return(thrust / m_thrust_factor);
+  }
+
+  if(thrust >= m_max_thrust)
+    return(m_pos_speed[psize-1]);
+
+  // Find the segment: the number of breakpoints at or below thrust
+  unsigned int ix = 0;
+  while((ix < psize) && (thrust >= m_pos_thrust[ix]))
+    ix++;
+
+  if(!m_pos_valid[ix])
+    return(0);
+
+  double left_dom = 0;
+  double left_val = 0;
+  if(ix > 0) {
+    left_dom = m_pos_thrust[ix-1];
+    left_val = m_pos_speed[ix-1];
+  }
+  return(((thrust-left_dom) * m_pos_slope[ix]) + left_val);
+}
+
+//----------------------------------------------------------------
+// Procedure: getSpeedValueNeg()
+
+double ThrustTable::getSpeedValueNeg(double thrust) const
+{
+  unsigned int nsize = m_neg_thrust.size();
+  if(nsize == 0) {
+    if(m_reflect_negative) {
+      double pos_thrust = -1 * thrust;
+      double pos_speed  = getSpeedValuePos(pos_thrust);
+      double ret_speed  = -1 * pos_speed;
+      return(ret_speed);
+    }
+    else
+      return(0);
+  }
+
+  if(thrust <= m_min_thrust)
+    return(m_neg_speed[0]);
+
+  // Find the segment: the first breakpoint at or above thrust
+  unsigned int ix = 0;
+  while((ix < nsize) && (thrust > m_neg_thrust[ix]))
+    ix++;
+
+  if(!m_neg_valid[ix])
+    return(0);
+
+  double left_dom = m_min_thrust;
+  double left_val = m_neg_speed[0];
+  if(ix > 0) {
+    left_dom = m_neg_thrust[ix-1];
+    left_val = m_neg_speed[ix-1];
+  }
+  return(((thrust-left_dom) * m_neg_slope[ix]) + left_val);
+}
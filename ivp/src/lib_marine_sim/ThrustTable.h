@@ -0,0 +1,69 @@
+/*****************************************************************/
+/*    FILE: ThrustTable.h                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef THRUST_TABLE_HEADER
+#define THRUST_TABLE_HEADER
+
+#include <string>
+#include <vector>
+#include "ThrustMap.h"
+
+// A flattened, read-only copy of a ThrustMap for fast thrust to
+// speed lookups. Breakpoints are held in sorted arrays and the
+// slope of each segment is computed once, so getSpeedValue()
+// returns exactly what ThrustMap::getSpeedValue() would, without
+// walking a std::map on each call.
+
+class ThrustTable
+{
+public:
+  ThrustTable(const ThrustMap&);
+  ~ThrustTable() {}
+
+  double getSpeedValue(double thrust) const;
+
+  std::string getKey() const {return(m_key);}
+
+  static std::string keyOf(const ThrustMap&);
+
+ protected:
+  double getSpeedValuePos(double thrust) const;
+  double getSpeedValueNeg(double thrust) const;
+
+ protected:
+  std::vector<double> m_pos_thrust;
+  std::vector<double> m_pos_speed;
+  std::vector<double> m_pos_slope;  // size is pos breakpoints + 1
+  std::vector<bool>   m_pos_valid;
+
+  std::vector<double> m_neg_thrust;
+  std::vector<double> m_neg_speed;
+  std::vector<double> m_neg_slope;  // size is neg breakpoints + 1
+  std::vector<bool>   m_neg_valid;
+
+  double m_min_thrust;
+  double m_max_thrust;
+  double m_thrust_factor;
+  bool   m_reflect_negative;
+
+  std::string m_key;
+};
+
+#endif
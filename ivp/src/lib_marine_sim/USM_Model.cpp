@@ -320,6 +320,93 @@ bool USM_Model::setParam(string param, string value)
   return(true);
 }
 
+//------------------------------------------------------------------------
+// Procedure: handleConfigParam()
+//   Purpose: Handle a single line of simulator configuration, as given
+//            in the uSimMarine block of a mission file. Params that
+//            belong to the hosting app (prefix, wormholes etc) are
+//            not handled here and false is returned for them.
+
+bool USM_Model::handleConfigParam(string param, string value)
+{
+  param = tolower(stripBlankEnds(param));
+  value = stripBlankEnds(value);
+  double dval = atof(value.c_str());
+
+  bool handled = false;
+  if((param == "start_x") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "start_y") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "start_heading") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "start_speed") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "start_depth") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "buoyancy_rate") && isNumber(value))
+    handled = setParam(param, dval);
+  else if((param == "drift_x") && isNumber(value))
+    handled = setDriftX(dval, "");
+  else if((param == "drift_y") && isNumber(value))
+    handled = setDriftY(dval, "");
+
+  else if(param == "wind_conditions")
+    handled = setParam("wind_conditions", value);
+  else if(param == "polar_plot")
+    handled = setParam("polar_plot", value);
+
+  else if(param == "turn_spd_map_full_speed")
+    handled = setTSMapFullSpeed(value);
+  else if(param == "turn_spd_map_null_speed")
+    handled = setTSMapNullSpeed(value);
+  else if(param == "turn_spd_map_full_rate")
+    handled = setTSMapFullRate(value);
+  else if(param == "turn_spd_map_null_rate")
+    handled = setTSMapNullRate(value);
+
+  else if((param == "rotate_speed") && isNumber(value))
+    handled = setParam("rotate_speed", dval);
+  else if((param == "max_acceleration") && isNumber(value))
+    handled = setParam("max_acceleration", dval);
+  else if((param == "max_deceleration") && isNumber(value))
+    handled = setParam("max_deceleration", dval);
+  else if((param == "max_depth_rate") && isNumber(value))
+    handled = setParam("max_depth_rate", dval);
+  else if((param == "max_depth_rate_speed") && isNumber(value))
+    handled = setParam("max_depth_rate_speed", dval);
+  else if((param == "max_rudder_degs_per_sec") && isNumber(value))
+    handled = setMaxRudderDegreesPerSec(dval);
+  else if(param == "drift_vector")
+    handled = setDriftVector(value, "");
+  else if(param == "sim_pause")
+    handled = setPaused(value);
+  else if(param == "dual_state")
+    handled = setDualState(value);
+  else if(param == "start_pos")
+    handled = initPosition(value);
+  else if(param == "thrust_reflect")
+    handled = setThrustReflect(value);
+  else if(param == "thrust_mode_diff") 
+    handled = setThrustModeDiff(value);
+  else if(param == "thrust_mode_reverse")
+    handled = setThrustModeReverse(value);	
+  else if((param == "thrust_factor") && isNumber(value)) {
+    setThrustFactor(dval);
+    handled = true;
+  }
+  else if(param == "thrust_map")
+    handled = handleFullThrustMapping(value);
+  else if(param == "thrust_map_fan")
+    handled = handleFullThrustMapFan(value);
+  else if((param == "turn_rate") && isNumber(value))
+    handled = setParam("turn_rate", dval);
+  else if((param == "default_water_depth") && isNumber(value))
+    handled = setParam("water_depth", dval);
+
+  return(handled);
+}
+
 //------------------------------------------------------------------------
 // Procedure: informX()
 
@@ -496,6 +583,61 @@ bool USM_Model::propagate(double g_curr_time)
   return(true);
 }
 
+//------------------------------------------------------------------------
+// Procedure: fleetEligible()
+//   Purpose: True if this model may be propagated as part of a
+//            SimFleet. The fleet handles the standard thrust mode on
+//            a single node record only.
+
+bool USM_Model::fleetEligible() const
+{
+  if((m_thrust_mode == "sailing") || (m_thrust_mode == "differential"))
+    return(false);
+  if(m_thrust_mode_reverse || m_dual_state || m_paused)
+    return(false);
+  return(true);
+}
+
+//------------------------------------------------------------------------
+// Procedure: joinFleet()
+//   Returns: The index of this vehicle in the fleet. From here on
+//            the fleet holds the state between steps. Propagate with
+//            pushToFleet(), SimFleet::propagate(), pullFromFleet().
+
+unsigned int USM_Model::joinFleet(SimFleet& fleet) const
+{
+  unsigned int ix = fleet.addVehicle(m_record, m_thrust_map);
+  fleet.setTurnParams(ix, m_turn_speed_map, m_turn_rate);
+  fleet.setSpeedLimits(ix, m_max_acceleration, m_max_deceleration);
+  fleet.setDepthParams(ix, m_buoyancy_rate, m_max_depth_rate,
+		       m_max_depth_rate_speed);
+  return(ix);
+}
+
+//------------------------------------------------------------------------
+// Procedure: pushToFleet()
+//   Purpose: Hand the current actuator values and external forces to
+//            the fleet and mark this vehicle due for propagation.
+
+void USM_Model::pushToFleet(SimFleet& fleet, unsigned int ix) const
+{
+  if(m_paused || m_obstacle_hit)
+    return;
+
+  fleet.setActuators(ix, m_thrust, m_rudder, m_elevator);
+  fleet.setExternal(ix, m_drift_x, m_drift_y, m_rotate_speed);
+  fleet.setDue(ix);
+}
+
+//------------------------------------------------------------------------
+// Procedure: pullFromFleet()
+
+void USM_Model::pullFromFleet(const SimFleet& fleet, unsigned int ix)
+{
+  fleet.copyToRecord(ix, m_record);
+  updateLatLonAlt(m_record);
+}
+
 //--------------------------------------------------------------------
 // Procedure: setDriftX()
 //      Note: A null string source indicates a startup condition
@@ -817,6 +959,14 @@ void USM_Model::propagateNodeRecord(NodeRecord& record,
 			 total_drift_x, total_drift_y);
 
 
+  updateLatLonAlt(record);
+}
+
+//------------------------------------------------------------------------
+// Procedure: updateLatLonAlt()
+
+void USM_Model::updateLatLonAlt(NodeRecord& record)
+{
   // If Geodesy is properly configured, update Lat/Lon based on x/y
   if(m_geo_ok) {
     double lat, lon;
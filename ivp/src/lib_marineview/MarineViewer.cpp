@@ -88,6 +88,12 @@ MarineViewer::MarineViewer(int x, int y, int w, int h, const char *l)
 
   m_main_window  = 0;
 
+  m_view_xmin = 0;
+  m_view_xmax = 0;
+  m_view_ymin = 0;
+  m_view_ymax = 0;
+  m_view_bounds_set = false;
+
   m_textures_init = false;
   
   m_verbose = false;
@@ -575,6 +581,11 @@ void MarineViewer::clearBackground()
 
 void MarineViewer::draw()
 {
+  // A new GL context, e.g., after the window is re-shown, does not
+  // have the display lists made in the prior context.
+  if(!context_valid())
+    m_poly_cache.clear();
+
   if(!m_textures_init)
     applyTiffFiles();
   
@@ -604,6 +615,8 @@ void MarineViewer::draw()
   m_x_origin = -shape_width/2  + m_xx;
   m_y_origin = -shape_height/2 + m_yy;
 
+  setViewBounds();
+
   // Draw the background image if the tiff flag is set
   if(m_geo_settings.viewable("tiff_viewable"))
     drawTiff();
@@ -827,6 +840,93 @@ bool MarineViewer::coordInViewX(double x, double y)
 }
 
 
+//-------------------------------------------------------------
+// Procedure: setViewBounds()
+//   Purpose: Set the bounds of the view in meters, used for culling
+//            shapes that are out of view. Shapes are drawn scaled
+//            by pix_per_mtr and m_zoom and translated to the view
+//            position of the datum, so this is the inverse.
+
+void MarineViewer::setViewBounds()
+{
+  m_view_bounds_set = false;
+
+  double scale_x = m_zoom * m_back_img.get_pix_per_mtr_x();
+  double scale_y = m_zoom * m_back_img.get_pix_per_mtr_y();
+  if((scale_x <= 0) || (scale_y <= 0))
+    return;
+
+  double qx = img2view('x', meters2img('x', 0));
+  double qy = img2view('y', meters2img('y', 0));
+
+  // Allow a margin so vertices and edges drawn a few pixels wide
+  // are not clipped at the edge of the view.
+  double margin = 20;
+
+  m_view_xmin = (-margin - qx) / scale_x;
+  m_view_xmax = (w() + margin - qx) / scale_x;
+  m_view_ymin = (-margin - qy) / scale_y;
+  m_view_ymax = (h() + margin - qy) / scale_y;
+  m_view_bounds_set = true;
+}
+
+//-------------------------------------------------------------
+// Procedure: boxInView()
+//   Purpose: True if the given box in meters overlaps the view, or
+//            if the view bounds are not yet known.
+
+bool MarineViewer::boxInView(double xmin, double xmax,
+			     double ymin, double ymax) const
+{
+  if(!m_view_bounds_set)
+    return(true);
+
+  if((xmax < m_view_xmin) || (xmin > m_view_xmax))
+    return(false);
+  if((ymax < m_view_ymin) || (ymin > m_view_ymax))
+    return(false);
+  return(true);
+}
+
+//-------------------------------------------------------------
+// Procedure: segListInView()
+
+bool MarineViewer::segListInView(const XYSegList& segl) const
+{
+  if(!m_view_bounds_set || (segl.size() == 0))
+    return(true);
+  return(boxInView(segl.get_min_x(), segl.get_max_x(),
+		   segl.get_min_y(), segl.get_max_y()));
+}
+
+//-------------------------------------------------------------
+// Procedure: metersPerPixel()
+//   Purpose: Size in meters of one screen pixel at the current zoom,
+//            or zero if not known.
+
+double MarineViewer::metersPerPixel() const
+{
+  double scale = m_zoom * m_back_img.get_pix_per_mtr_x();
+  if(scale <= 0)
+    return(0);
+  return(1.0 / scale);
+}
+
+//-------------------------------------------------------------
+// Procedure: clearPolyCache()
+//   Purpose: Release all polygon display lists. Must be called with
+//            the GL context current, e.g., from within draw().
+
+void MarineViewer::clearPolyCache()
+{
+  map<string, PolyListCache>::iterator p;
+  for(p=m_poly_cache.begin(); p!=m_poly_cache.end(); p++) {
+    if(p->second.count > 0)
+      glDeleteLists(p->second.base, p->second.count);
+  }
+  m_poly_cache.clear();
+}
+
 //-------------------------------------------------------------
 // Procedure: drawCommonVehicle()
 
@@ -1663,170 +1763,298 @@ void MarineViewer::drawPolygons(const vector<XYPolygon>& polys,
   glTranslatef(qx, qy, 0);
   glScalef(m_zoom, m_zoom, m_zoom);
 
-  ColorPack default_edge_c("aqua");      // default if no drawing hint
-  ColorPack default_fill_c("invisible"); // default if no drawing hint
-  ColorPack default_vert_c("red");       // default if no drawing hint
-  ColorPack default_labl_c("white");     // default if no drawing hint
-  double default_transparency = 0.2;     // default if no drawing hint
-  double default_line_width   = 1;       // default if no drawing hint
-  double default_vertex_size  = 2;       // default if no drawing hint
-
   double pix_per_mtr_x = m_back_img.get_pix_per_mtr_x();
   double pix_per_mtr_y = m_back_img.get_pix_per_mtr_y();
 
   for(unsigned int k=0; k<polys.size(); k++) {
-    //cout << "drawing poly with label: " << polys[k].get_label() << endl;
-    bool expired = polys[k].expired(timestamp);
-      
-    if(!expired && polys[k].active() && (polys[k].size() > 0)) {
-      XYPolygon poly = polys[k];
-      //cout << "active poly with label: " << poly.get_label() << endl;
-      unsigned int vsize = poly.size();
+    const XYPolygon& poly = polys[k];
+    if(poly.expired(timestamp) || !poly.active() || (poly.size() == 0))
+      continue;
+    if(!boxInView(poly.get_min_x(), poly.get_max_x(),
+		  poly.get_min_y(), poly.get_max_y()))
+      continue;
+    
+    drawPolygonBody(poly, pix_per_mtr_x, pix_per_mtr_y);
+    drawPolygonExtras(poly, (k<100), pix_per_mtr_x, pix_per_mtr_y);
+  }
+  
+  glFlush();
+  glPopMatrix();  
+}
 
-      vector<double> points((2*vsize), 2);
-      
-      int pindex = 0;
-      for(unsigned int i=0; i<vsize; i++) {
-	points[pindex]   = poly.get_vx(i) * pix_per_mtr_x;
-	points[pindex+1] = poly.get_vy(i) * pix_per_mtr_y;
-	pindex += 2;
+//-------------------------------------------------------------
+// Procedure: drawPolygons()
+//      Note: Same as above but the interior, edges and vertices of
+//            each polygon are compiled once into a display list,
+//            kept under the given key (e.g., vehicle name). Lists
+//            are rebuilt only for polygons changed since the last
+//            draw, and only polygons in view are drawn.
+
+void MarineViewer::drawPolygons(const VPlug_GeoShapes& shapes,
+				const string& key, double timestamp)
+{
+  if(!m_geo_settings.viewable("polygon_viewable_all", true))
+    return;
+
+  const vector<XYPolygon>&    polys = shapes.getPolygons();
+  const vector<unsigned int>& revs  = shapes.getPolygonRevisions();
+  unsigned int revision = shapes.getPolygonRevision();
+
+  double pix_per_mtr_x = m_back_img.get_pix_per_mtr_x();
+  double pix_per_mtr_y = m_back_img.get_pix_per_mtr_y();
+  unsigned int psize = polys.size();
+
+  // Polygons are only added or replaced in place as long as the count
+  // is the same. Removals and older revisions, e.g., stepping back
+  // in a log, mean a full rebuild.
+  PolyListCache& cache = m_poly_cache[key];
+  bool rebuild_all = ((cache.count != psize) || (revision < cache.revision) ||
+		      (cache.ppm_x != pix_per_mtr_x) ||
+		      (cache.ppm_y != pix_per_mtr_y));
+
+  if(rebuild_all) {
+    if(cache.count > 0)
+      glDeleteLists(cache.base, cache.count);
+    cache = PolyListCache();
+    if(psize > 0) {
+      cache.base = glGenLists(psize);
+      if(cache.base == 0) {
+	m_poly_cache.erase(key);
+	drawPolygons(polys, timestamp);
+	return;
       }
+    }
+    cache.count = psize;
+    cache.ppm_x = pix_per_mtr_x;
+    cache.ppm_y = pix_per_mtr_y;
+  }
+
+  if(rebuild_all || (revision != cache.revision)) {
+    for(unsigned int k=0; k<psize; k++) {
+      unsigned int rev_k = (k < revs.size()) ? revs[k] : revision;
+      if(!rebuild_all && (rev_k <= cache.revision))
+	continue;
+      glNewList(cache.base + k, GL_COMPILE);
+      if(polys[k].size() > 0)
+	drawPolygonBody(polys[k], pix_per_mtr_x, pix_per_mtr_y);
+      glEndList();
+    }
+    cache.revision = revision;
+  }
+
+  vector<unsigned int> ixs;
+  if(m_view_bounds_set)
+    ixs = shapes.getPolygonsInBox(m_view_xmin, m_view_xmax,
+				  m_view_ymin, m_view_ymax);
+  else {
+    for(unsigned int k=0; k<psize; k++)
+      ixs.push_back(k);
+  }
+
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  glOrtho(0, w(), 0, h(), -1 ,1);
+  
+  double qx = img2view('x', meters2img('x', 0));
+  double qy = img2view('y', meters2img('y', 0));
+  
+  glMatrixMode(GL_MODELVIEW);
+  glPushMatrix();
+  glLoadIdentity();
+
+  glTranslatef(qx, qy, 0);
+  glScalef(m_zoom, m_zoom, m_zoom);
+
+  for(unsigned int i=0; i<ixs.size(); i++) {
+    unsigned int k = ixs[i];
+    const XYPolygon& poly = polys[k];
+    if(poly.expired(timestamp) || !poly.active() || (poly.size() == 0))
+      continue;
+    
+    glCallList(cache.base + k);
+    drawPolygonExtras(poly, (k<100), pix_per_mtr_x, pix_per_mtr_y);
+  }
+  
+  glFlush();
+  glPopMatrix();  
+}
+
+//-------------------------------------------------------------
+// Procedure: drawPolygonBody()
+//   Purpose: Draw the interior, edges and vertices of a polygon,
+//            none of which depend on the zoom or pan of the view.
+
+void MarineViewer::drawPolygonBody(const XYPolygon& poly,
+				   double pix_per_mtr_x,
+				   double pix_per_mtr_y)
+{
+  ColorPack default_edge_c("aqua");      // default if no drawing hint
+  ColorPack default_fill_c("invisible"); // default if no drawing hint
+  ColorPack default_vert_c("red");       // default if no drawing hint
+  double default_transparency = 0.2;     // default if no drawing hint
+  double default_line_width   = 1;       // default if no drawing hint
+  double default_vertex_size  = 2;       // default if no drawing hint
 
-      // ========================================================
-      // Part 1: Draw the Interior of the polygon
-      // ========================================================
-      // Fill in the interior of polygon if it is a valid polygon
-      // with greater than two vertices. (Two vertex polygons are
-      // "valid" too, but we decide here not to draw the interior
-      // ========================================================
-      if(vsize > 2) {
-	ColorPack fill_c = default_fill_c;
-	if(poly.color_set("fill"))             // fill_color
-	  fill_c = poly.get_color("fill");
+  unsigned int vsize = poly.size();
+
+  // ========================================================
+  // Part 1: Draw the Interior of the polygon
+  // ========================================================
+  // Fill in the interior of polygon if it is a valid polygon
+  // with greater than two vertices. (Two vertex polygons are
+  // "valid" too, but we decide here not to draw the interior
+  // ========================================================
+  if(vsize > 2) {
+    ColorPack fill_c = default_fill_c;
+    if(poly.color_set("fill"))             // fill_color
+      fill_c = poly.get_color("fill");
+    
+    if(fill_c.visible() && poly.is_convex()) {
+      double transparency = default_transparency; 
+      if(poly.transparency_set())            // transparency
+	transparency = poly.get_transparency(); 
       
-	if(fill_c.visible() && poly.is_convex()) {
-	  double transparency = default_transparency; 
-	  if(poly.transparency_set())            // transparency
-	    transparency = poly.get_transparency(); 
-	  
-	  glEnable(GL_BLEND);
-	  glColor4f(fill_c.red(), fill_c.grn(), fill_c.blu(), transparency);
-	  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	  glBegin(GL_POLYGON);
-	  for(unsigned int i=0; i<vsize*2; i=i+2) {
-	    glVertex2f(points[i], points[i+1]);
-	  }
-	  glEnd();
-	  glDisable(GL_BLEND);
-	}
-      }
+      glEnable(GL_BLEND);
+      glColor4f(fill_c.red(), fill_c.grn(), fill_c.blu(), transparency);
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      glBegin(GL_POLYGON);
+      for(unsigned int i=0; i<vsize; i++)
+	glVertex2f(poly.get_vx(i) * pix_per_mtr_x,
+		   poly.get_vy(i) * pix_per_mtr_y);
+      glEnd();
+      glDisable(GL_BLEND);
+    }
+  }
 
-      // ========================================================
-      // Part 2: Draw the Edges of the polygon
-      // ========================================================
-      // If polygon is invalid (non-convex), don't draw last edge.
-      if(vsize > 1) {
-	double line_width = default_line_width;
-	if(poly.edge_size_set())               // edge_size
-	  line_width = poly.get_edge_size();
-	if(line_width > 0) {
-	  ColorPack edge_c = default_edge_c;
-	  if(poly.color_set("edge"))             // edge_color
-	    edge_c = poly.get_color("edge");
-	  if(edge_c.visible()) {
-	    glLineWidth(line_width);
-	    glColor3f(edge_c.red(), edge_c.grn(), edge_c.blu());
-	    
-	    if(poly.is_convex())
-	      glBegin(GL_LINE_LOOP);
-	    else
-	      glBegin(GL_LINE_STRIP);
-	    for(unsigned int i=0; i<vsize*2; i=i+2) {
-	      glVertex2f(points[i], points[i+1]);
-	    }
-	    glEnd();
-	    glLineWidth(1.0);
-	  }
-	}
-      }
-     
-      // ========================================================
-      // Part 3: Special Case Handle a Single Point Polygon
-      // ========================================================
-      // If the polygon is just a single point, draw it big!
-      if(vsize==1) {
-	glPointSize(1.2 * m_zoom);
-	// Draw the vertices with color coding for the first and last
+  // ========================================================
+  // Part 2: Draw the Edges of the polygon
+  // ========================================================
+  // If polygon is invalid (non-convex), don't draw last edge.
+  if(vsize > 1) {
+    double line_width = default_line_width;
+    if(poly.edge_size_set())               // edge_size
+      line_width = poly.get_edge_size();
+    if(line_width > 0) {
+      ColorPack edge_c = default_edge_c;
+      if(poly.color_set("edge"))             // edge_color
+	edge_c = poly.get_color("edge");
+      if(edge_c.visible()) {
+	glLineWidth(line_width);
+	glColor3f(edge_c.red(), edge_c.grn(), edge_c.blu());
 	
-	//glColor3f(0.7,0.13,0.13);  // Firebrick red b2 22 22
-	glColor3f(0.13, 0.13, 0.7);  // Blueish
-	glEnable(GL_POINT_SMOOTH);
-	glBegin(GL_POINTS);
-	glVertex2f(points[0], points[1]);
+	if(poly.is_convex())
+	  glBegin(GL_LINE_LOOP);
+	else
+	  glBegin(GL_LINE_STRIP);
+	for(unsigned int i=0; i<vsize; i++)
+	  glVertex2f(poly.get_vx(i) * pix_per_mtr_x,
+		     poly.get_vy(i) * pix_per_mtr_y);
 	glEnd();
-	glDisable(GL_POINT_SMOOTH);
-      }
-      
-      // ========================================================
-      // Part 4: Draw the Vertices
-      // ========================================================
-      double vertex_size  = default_vertex_size;
-      if(poly.vertex_size_set())             // vertex_size
-	vertex_size = poly.get_vertex_size();
-      if(vertex_size > 0) {
-	ColorPack vert_c = default_vert_c;
-	if(poly.color_set("vertex"))           // vertex_color
-	  vert_c = poly.get_color("vertex");
-	if(vert_c.visible()) {	
-	  glEnable(GL_POINT_SMOOTH);
-	  glPointSize(vertex_size);
-	  
-	  glColor3f(vert_c.red(), vert_c.grn(), vert_c.blu());
-	  glBegin(GL_POINTS);
-	  for(unsigned int j=0; j<vsize; j++) 
-	    glVertex2f(points[(j*2)], points[(j*2)+1]);
-	  glEnd();
-	  glDisable(GL_POINT_SMOOTH);
-	}
-      }
-      
-      // ========================================================
-      // Part 5: Draw the Labels
-      // ========================================================
-      // Draw the labels unless either the viewer has it shut off OR
-      // if the publisher of the polygon requested it not to be
-      // viewed, by setting the color to be "invisible".
-      bool draw_labels = m_geo_settings.viewable("polygon_viewable_labels");
-      if(draw_labels && (k<100)) {
-	ColorPack labl_c = default_labl_c;
-	if(poly.color_set("label"))            // label_color
-	  labl_c = poly.get_color("label");
-
-	if(labl_c.visible()) {
-	  double vx = poly.get_avg_x();
-	  double vy = poly.get_avg_y();
-	  double cx = vx * pix_per_mtr_x;
-	  double cy = vy * pix_per_mtr_y;
-
-	  if(coordInView(vx,vy)) {
-	    glColor3f(labl_c.red(), labl_c.grn(), labl_c.blu());
-	    gl_font(1, 10);
-	    string plabel = poly.get_msg();
-	    if(plabel == "")
-	      plabel = poly.get_label();
-	    
-	    if((plabel != "") && (plabel != "_null_")) {
-	      glRasterPos3f(cx, cy, 0);
-	      gl_draw_aux(plabel);
-	    }
-	  }
-	}
+	glLineWidth(1.0);
       }
     }
   }
   
-  glFlush();
-  glPopMatrix();  
+  // ========================================================
+  // Part 3: Draw the Vertices
+  // ========================================================
+  // A single point polygon is drawn by drawPolygonExtras() 
+  if(vsize == 1)
+    return;
+  double vertex_size  = default_vertex_size;
+  if(poly.vertex_size_set())             // vertex_size
+    vertex_size = poly.get_vertex_size();
+  if(vertex_size > 0) {
+    ColorPack vert_c = default_vert_c;
+    if(poly.color_set("vertex"))           // vertex_color
+      vert_c = poly.get_color("vertex");
+    if(vert_c.visible()) {	
+      glEnable(GL_POINT_SMOOTH);
+      glPointSize(vertex_size);
+      
+      glColor3f(vert_c.red(), vert_c.grn(), vert_c.blu());
+      glBegin(GL_POINTS);
+      for(unsigned int j=0; j<vsize; j++) 
+	glVertex2f(poly.get_vx(j) * pix_per_mtr_x,
+		   poly.get_vy(j) * pix_per_mtr_y);
+      glEnd();
+      glDisable(GL_POINT_SMOOTH);
+    }
+  }
+}
+
+//-------------------------------------------------------------
+// Procedure: drawPolygonExtras()
+//   Purpose: Draw the parts of a polygon that depend on the zoom or
+//            the view: a single point polygon and the label.
+
+void MarineViewer::drawPolygonExtras(const XYPolygon& poly, bool label_ok,
+				     double pix_per_mtr_x,
+				     double pix_per_mtr_y)
+{
+  // ========================================================
+  // Part 1: Special Case Handle a Single Point Polygon
+  // ========================================================
+  // If the polygon is just a single point, draw it big! Then draw
+  // the vertex over it as for any other polygon.
+  if(poly.size()==1) {
+    double px = poly.get_vx(0) * pix_per_mtr_x;
+    double py = poly.get_vy(0) * pix_per_mtr_y;
+
+    glPointSize(1.2 * m_zoom);
+    //glColor3f(0.7,0.13,0.13);  // Firebrick red b2 22 22
+    glColor3f(0.13, 0.13, 0.7);  // Blueish
+    glEnable(GL_POINT_SMOOTH);
+    glBegin(GL_POINTS);
+    glVertex2f(px, py);
+    glEnd();
+
+    double vertex_size = 2;                // default if no drawing hint
+    if(poly.vertex_size_set())             // vertex_size
+      vertex_size = poly.get_vertex_size();
+    ColorPack vert_c("red");               // default if no drawing hint
+    if(poly.color_set("vertex"))           // vertex_color
+      vert_c = poly.get_color("vertex");
+    if((vertex_size > 0) && vert_c.visible()) {
+      glPointSize(vertex_size);
+      glColor3f(vert_c.red(), vert_c.grn(), vert_c.blu());
+      glBegin(GL_POINTS);
+      glVertex2f(px, py);
+      glEnd();
+    }
+    glDisable(GL_POINT_SMOOTH);
+  }
+      
+  // ========================================================
+  // Part 2: Draw the Labels
+  // ========================================================
+  // Draw the labels unless either the viewer has it shut off OR
+  // if the publisher of the polygon requested it not to be
+  // viewed, by setting the color to be "invisible".
+  if(!label_ok || !m_geo_settings.viewable("polygon_viewable_labels"))
+    return;
+
+  ColorPack labl_c("white");             // default if no drawing hint
+  if(poly.color_set("label"))            // label_color
+    labl_c = poly.get_color("label");
+  if(!labl_c.visible())
+    return;
+
+  double vx = poly.get_avg_x();
+  double vy = poly.get_avg_y();
+  if(!coordInView(vx,vy))
+    return;
+
+  string plabel = poly.get_msg();
+  if(plabel == "")
+    plabel = poly.get_label();
+  if((plabel == "") || (plabel == "_null_"))
+    return;
+
+  glColor3f(labl_c.red(), labl_c.grn(), labl_c.blu());
+  gl_font(1, 10);
+  glRasterPos3f(vx * pix_per_mtr_x, vy * pix_per_mtr_y, 0);
+  gl_draw_aux(plabel);
 }
 
 //-------------------------------------------------------------
@@ -2045,19 +2273,35 @@ void MarineViewer::drawSegList(const XYSegList& segl)
   if(segl.vertex_size_set())           // vertex_size
     vertex_size = segl.get_vertex_size();
 
-  unsigned int vsize = segl.size();
+  if((segl.size() == 0) || !segListInView(segl))
+    return;
 
-  unsigned int i, j;
-  double *points = new double[2*vsize];
+  // Level of detail: skip vertices within a pixel of the last vertex
+  // kept. Dense seglists, e.g., long trails, when zoomed out would
+  // otherwise draw many vertices on the same pixel. The first and
+  // last vertices are always kept.
+  double min_gap = metersPerPixel();
 
   double pix_per_mtr_x = m_back_img.get_pix_per_mtr_x();
   double pix_per_mtr_y = m_back_img.get_pix_per_mtr_y();
-  unsigned int pindex = 0;
-  for(i=0; i<vsize; i++) {
-    points[pindex]   = segl.get_vx(i) * pix_per_mtr_x;
-    points[pindex+1] = segl.get_vy(i) * pix_per_mtr_y;
-    pindex += 2;
-  }
+
+  unsigned int i, j, segl_size = segl.size();
+  double last_x = 0;
+  double last_y = 0;
+  m_draw_pts.clear();
+  for(i=0; i<segl_size; i++) {
+    double vx = segl.get_vx(i);
+    double vy = segl.get_vy(i);
+    if((i > 0) && ((i+1) < segl_size) &&
+       (fabs(vx - last_x) < min_gap) && (fabs(vy - last_y) < min_gap))
+      continue;
+    m_draw_pts.push_back(vx * pix_per_mtr_x);
+    m_draw_pts.push_back(vy * pix_per_mtr_y);
+    last_x = vx;
+    last_y = vy;
+  }
+  const vector<double>& points = m_draw_pts;
+  unsigned int vsize = points.size() / 2;
 
   glMatrixMode(GL_PROJECTION);
   glLoadIdentity();
@@ -2145,7 +2389,6 @@ void MarineViewer::drawSegList(const XYSegList& segl)
   }
   //-------------------------------- perhaps draw seglist label
 
-  delete [] points;
   glFlush();
   glPopMatrix();
 }
@@ -2198,6 +2441,12 @@ void MarineViewer::drawSeglr(const XYSeglr& seglr)
   
   unsigned int vsize = seglr.size();
 
+  // The ray is not in the seglr min/max, so pad the box by its length
+  double rlen = seglr.getRayLen();
+  if(!boxInView(seglr.getMinX()-rlen, seglr.getMaxX()+rlen,
+		seglr.getMinY()-rlen, seglr.getMaxY()+rlen))
+    return;
+
   unsigned int i, j;
   double *points = new double[2*vsize];
 
@@ -2611,7 +2860,7 @@ void MarineViewer::drawGrid(const XYGrid& grid)
 //-------------------------------------------------------------
 // Procedure: drawConvexGrids()
 
-void MarineViewer::drawConvexGrids(vector<XYConvexGrid> grids)
+void MarineViewer::drawConvexGrids(const vector<XYConvexGrid>& grids)
 {
   if(m_geo_settings.viewable("grid_viewable_all", true) == false)
     return;
@@ -2626,7 +2875,7 @@ void MarineViewer::drawConvexGrids(vector<XYConvexGrid> grids)
 //-------------------------------------------------------------
 // Procedure: drawConvexGrid()
 
-void MarineViewer::drawConvexGrid(XYConvexGrid grid)
+void MarineViewer::drawConvexGrid(const XYConvexGrid& grid)
 {
   FColorMap cmap;
 
@@ -2634,6 +2883,11 @@ void MarineViewer::drawConvexGrid(XYConvexGrid grid)
   if(gsize == 0)
     return;
 
+  XYSquare sbound = grid.getSBound();
+  if(!boxInView(sbound.get_min_x(), sbound.get_max_x(),
+		sbound.get_min_y(), sbound.get_max_y()))
+    return;
+
   glMatrixMode(GL_PROJECTION);
   glLoadIdentity();
 
@@ -2671,41 +2925,68 @@ void MarineViewer::drawConvexGrid(XYConvexGrid grid)
   double pix_per_mtr_x = m_back_img.get_pix_per_mtr_x();
   double pix_per_mtr_y = m_back_img.get_pix_per_mtr_y();
 
-  grid.setEdgeCache(pix_per_mtr_x, pix_per_mtr_y);
-  vector<vector<double> > edge_cache = grid.getEdgeCache();
-  unsigned int esize = edge_cache.size();
+  // Level of detail: when cells are only a few pixels wide the edges
+  // would cover the cells, so they are not drawn.
+  bool draw_edges = true;
+  double mpp = metersPerPixel();
+  if((mpp > 0) && ((grid.getCellSize() / mpp) < 3))
+    draw_edges = false;
+
+  // Corners of each cell in view, as x0,y0,...,x3,y3 in pixels.
+  m_draw_pts.clear();
+  vector<unsigned int> cell_ixs;
+  for(unsigned int i=0; i<gsize; i++) {
+    XYSquare cell = grid.getElement(i);
+    double xl = cell.getVal(0,0);
+    double xh = cell.getVal(0,1);
+    double yl = cell.getVal(1,0);
+    double yh = cell.getVal(1,1);
+    if(!boxInView(xl, xh, yl, yh))
+      continue;
+    cell_ixs.push_back(i);
+    xl *= pix_per_mtr_x;
+    xh *= pix_per_mtr_x;
+    yl *= pix_per_mtr_y;
+    yh *= pix_per_mtr_y;
+    m_draw_pts.push_back(xl); m_draw_pts.push_back(yl);
+    m_draw_pts.push_back(xh); m_draw_pts.push_back(yl);
+    m_draw_pts.push_back(xh); m_draw_pts.push_back(yh);
+    m_draw_pts.push_back(xl); m_draw_pts.push_back(yh);
+  }
+  unsigned int csize = cell_ixs.size();
   
   // Part 1 Draw Interiors
   if(range > 0) {
-    for(unsigned int i=0; i<esize; i++) {
-      double   eval = grid.getVal(i);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBegin(GL_QUADS);
+    for(unsigned int i=0; i<csize; i++) {
+      double   eval = grid.getVal(cell_ixs[i]);
       double   pct  = (eval-min_eval)/(range);
       double   r    = cmap.getIRVal(pct);
       double   g    = cmap.getIGVal(pct);
       double   b    = cmap.getIBVal(pct);
       
-      glEnable(GL_BLEND);
       glColor4f(r,g,b,cell_opaqueness);
-      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-      glBegin(GL_POLYGON);
       for(int j=0; j<4; j++)
-	glVertex2f(edge_cache[i][j*2], edge_cache[i][j*2+1]); 
-      glEnd();
-      glDisable(GL_BLEND);
+	glVertex2f(m_draw_pts[i*8+j*2], m_draw_pts[i*8+j*2+1]); 
     }
+    glEnd();
+    glDisable(GL_BLEND);
   }
 
   // Part 2 Draw edges
-  glEnable(GL_BLEND);
-  glColor4f(0.6,0.6,0.6,edge_opaqueness);
-  for(unsigned int i=0; i<esize; i++) {
-
-    glBegin(GL_LINE_LOOP);
-    for(int k=0; k<4; k++)
-      glVertex2f(edge_cache[i][k*2], edge_cache[i][k*2+1]); 
-    glEnd();
+  if(draw_edges) {
+    glEnable(GL_BLEND);
+    glColor4f(0.6,0.6,0.6,edge_opaqueness);
+    for(unsigned int i=0; i<csize; i++) {
+      glBegin(GL_LINE_LOOP);
+      for(int k=0; k<4; k++)
+	glVertex2f(m_draw_pts[i*8+k*2], m_draw_pts[i*8+k*2+1]); 
+      glEnd();
+    }
+    glDisable(GL_BLEND);
   }
-  glDisable(GL_BLEND);
 
   glFlush();
   glPopMatrix();
@@ -3490,7 +3771,11 @@ void MarineViewer::drawPoints(const map<string, XYPoint>& points,
 
   map<string, XYPoint>::const_iterator p;
   for(p=points.begin(); p!=points.end(); p++) {
-    XYPoint point = p->second;
+    const XYPoint& point = p->second;
+    double vx = point.get_vx();
+    double vy = point.get_vy();
+    if(!boxInView(vx, vx, vy, vy))
+      continue;
 
     if(!point.expired(timestamp) && point.active()) {
       
@@ -3506,8 +3791,6 @@ void MarineViewer::drawPoints(const map<string, XYPoint>& points,
       if(point.vertex_size_set())
 	vertex_size = point.get_vertex_size();
 
-      double vx = point.get_vx();
-      double vy = point.get_vy();
       double px = vx * pix_per_mtr_x;
       double py = vy * pix_per_mtr_y;
 
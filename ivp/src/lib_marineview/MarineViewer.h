@@ -29,6 +29,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include "MOOS/libMOOSGeodesy/MOOSGeodesy.h"
 #include "FL/Fl.H"
 #include "FL/Fl_Gl_Window.H"
@@ -148,7 +149,12 @@ protected:
   void  drawTextBox(const XYTextBox&, double tstamp=0);
 
   void  drawPolygons(const std::vector<XYPolygon>&, double timestamp=0);
+  void  drawPolygons(const VPlug_GeoShapes&, const std::string& key,
+		     double timestamp=0);
   void  drawPolygon(const XYPolygon&);
+  void  drawPolygonBody(const XYPolygon&, double ppm_x, double ppm_y);
+  void  drawPolygonExtras(const XYPolygon&, bool label_ok,
+			  double ppm_x, double ppm_y);
   
   void  drawSegLists(const std::map<std::string, XYSegList>&, double timestamp=0);
   void  drawSegList(const XYSegList&);
@@ -165,11 +171,8 @@ protected:
   void  drawGrids(const std::vector<XYGrid>&);
   void  drawGrid(const XYGrid&);
 
-  //void  drawConvexGrids(const std::vector<XYConvexGrid>&);
-  //void  drawConvexGrid(const XYConvexGrid&);
-
-  void  drawConvexGrids(std::vector<XYConvexGrid>);
-  void  drawConvexGrid(XYConvexGrid);
+  void  drawConvexGrids(const std::vector<XYConvexGrid>&);
+  void  drawConvexGrid(const XYConvexGrid&);
 
   void  drawCircles(const std::map<std::string, XYCircle>&, double timestamp=0);
   void  drawCircle(XYCircle, double timestamp=0);
@@ -209,6 +212,28 @@ protected:
   bool coordInView(double x, double y);
   bool coordInViewX(double x, double y);
 
+  void setViewBounds();
+  bool boxInView(double xmin, double xmax, double ymin, double ymax) const;
+  bool segListInView(const XYSegList&) const;
+  double metersPerPixel() const;
+
+ protected:
+  // Display lists of polygon interiors, edges and vertices for one
+  // owner (e.g., vehicle). A list is rebuilt only when its polygon
+  // changes, all are rebuilt if the image scale changes. Labels are
+  // drawn each frame.
+  class PolyListCache {
+  public:
+    PolyListCache() {base=0; count=0; revision=0; ppm_x=0; ppm_y=0;}
+    GLuint       base;
+    unsigned int count;
+    unsigned int revision;
+    double       ppm_x;
+    double       ppm_y;
+  };
+  
+  void clearPolyCache();
+
 protected:
   std::vector<BackImg>     m_back_imgs;
   std::vector<std::string> m_tif_files;
@@ -251,6 +276,18 @@ protected:
   OpAreaSpec         m_op_area;
 
   Fl_Group*          m_main_window;
+
+  // Bounds of the view in meters, set at the start of each draw
+  double    m_view_xmin;
+  double    m_view_xmax;
+  double    m_view_ymin;
+  double    m_view_ymax;
+  bool      m_view_bounds_set;
+
+  std::map<std::string, PolyListCache> m_poly_cache;
+
+  // Reused vertex buffer for seglists
+  std::vector<double> m_draw_pts;
   
   std::string m_param_warning;
 };
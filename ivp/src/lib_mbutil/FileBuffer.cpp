@@ -25,62 +25,71 @@
 
 #include "FileBuffer.h"
 #include <cstdio>
+#include <algorithm>
 
 using namespace std;
 
+//----------------------------------------------------------------
+// Procedure: readFileContents()
+//      Note: The whole file is read in large chunks, rather than a
+//            char at a time, and then split into lines in memory.
+
+static bool readFileContents(const string& filename, string& contents)
+{
+  FILE *f = fopen(filename.c_str(), "r");
+  if(f==NULL)
+    return(false);
+
+  if(fseek(f, 0, SEEK_END) == 0) {
+    long fsize = ftell(f);
+    if(fsize > 0)
+      contents.reserve(fsize);
+    rewind(f);
+  }
+
+  char buff[65536];
+  size_t amt = fread(buff, 1, sizeof(buff), f);
+  while(amt > 0) {
+    contents.append(buff, amt);
+    amt = fread(buff, 1, sizeof(buff), f);
+  }
+  fclose(f);
+
+  return(true);
+}
+
 //----------------------------------------------------------------
 // Procedure: fileBuffer()
 //      Note: "amt" by default is zero. If it is non-zero, then only
 //            that many line numbers will be read and returned into
 //            the vector.
-
+//      Note: As a line is ended by either a newline or the end of
+//            the file, a file ending with a newline results in a
+//            final empty line.
 
 vector<string> fileBuffer(const string& filename, unsigned int amt)
 {
   vector<string> fvector;
 
-  FILE *f = fopen(filename.c_str(), "r");
-  if(f==NULL)
+  string contents;
+  if(!readFileContents(filename, contents))
     return(fvector);
 
-  vector<char>  buff;
-  buff.reserve(500000);
-
-  int  myint = '\0';
-  bool EOL    = false;
-  unsigned int lines = 0;
-  bool reached_line_limit = false;
-
-  while((myint!=EOF) && !reached_line_limit) {
-    EOL = false;
-    while(!EOL) {
-      myint = fgetc(f);
-      unsigned char   mychar = myint;
-      switch(myint) {
-      case '\n':
-      case EOF:
-        EOL = true;
-        break;
-      default:
-        buff.push_back(mychar);
-      }
-    }
+  fvector.reserve(count(contents.begin(), contents.end(), '\n') + 1);
 
-    string str(buff.size(), ' ');
-    for(unsigned int i=0; i<buff.size(); i++)
-      str[i] = buff[i];
-    buff.clear();
-    lines++;
-
-    fvector.push_back(str);
-    if(amt != 0) {
-      lines++;
-      if(lines >= amt)
-        reached_line_limit = true;
+  string::size_type start = 0;
+  while(true) {
+    string::size_type pos = contents.find('\n', start);
+    if(pos == string::npos) {
+      fvector.push_back(contents.substr(start));
+      break;
     }
+    fvector.push_back(contents.substr(start, pos-start));
+    start = pos + 1;
 
+    if((amt != 0) && (fvector.size() >= amt))
+      break;
   }
-  fclose(f);
 
   return(fvector);
 }
@@ -112,73 +121,42 @@ vector<string> fileBufferSlash(const string& filename, unsigned int amt)
 {
   vector<string> fvector;
 
-  FILE *f = fopen(filename.c_str(), "r");
-  if(f==NULL)
+  string contents;
+  if(!readFileContents(filename, contents))
     return(fvector);
 
-  const int MAX_LINE_LENGTH = 5000;
-
-  int    myint = '\0';
-  int    buffix = 0;
-  bool   EOL    = false;
-  char   buff[MAX_LINE_LENGTH];
-  bool   reached_line_limit = false;
   string line_so_far = "";
 
-  unsigned int lines = 0;
-
-
-  while((myint!=EOF) && (!reached_line_limit)) {
-    EOL = false;
-    buffix = 0;
-
-    int  slash_index      = 0;
-    bool slash_terminated = false;
-    while((!EOL) && (buffix < MAX_LINE_LENGTH)) {
-      myint = fgetc(f);
-      unsigned char  mychar = myint;
-      switch(myint) {
-      case '\\':
-	slash_terminated = true;
-	slash_index = buffix;
-        buff[buffix] = mychar;
-        buffix++;
-	break;
-      case '\n':
-      case EOF:
-        buff[buffix] = '\0';  // attach terminating NULL
-        EOL = true;
-        break;
-      default:
-	if((mychar!=' ') && (mychar!='\t')) {
-	  slash_terminated = false;
-	  slash_index      = 0;
-	}
-        buff[buffix] = mychar;
-        buffix++;
-      }
+  string::size_type start = 0;
+  bool done = false;
+  while(!done) {
+    string::size_type pos = contents.find('\n', start);
+    if(pos == string::npos) {
+      pos  = contents.length();
+      done = true;
     }
 
+    // Find the last char other than a blank or tab. If it is a
+    // slash, the line is cut there and merged with the next line.
+    string::size_type end = pos;
+    while((end > start) && 
+	  ((contents[end-1] == ' ') || (contents[end-1] == '\t')))
+      end--;
+    bool slash_terminated = ((end > start) && (contents[end-1] == '\\'));
+
     if(slash_terminated)
-      buff[slash_index] = '\0';
+      line_so_far.append(contents, start, end-1-start);
+    else
+      line_so_far.append(contents, start, pos-start);
+    start = pos + 1;
 
-    line_so_far += buff;
     if(!slash_terminated) {
       fvector.push_back(line_so_far);
       line_so_far = "";
-      if(amt != 0) {
-	lines++;
-	if(lines >= amt)
-	  reached_line_limit = true;
-      }
+      if((amt != 0) && (fvector.size() >= amt))
+	done = true;
     }
   }
-  fclose(f);
  
   return(fvector);
 }
-
-
-
-
-
@@ -0,0 +1,415 @@
+/*****************************************************************/
+/*    FILE: SpanProfiler.cpp                                     */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include "SpanProfiler.h"
+
+using namespace std;
+
+// Span names, interned process wide. Names are only ever added, so
+// an id stays valid for the life of the process.
+static mutex                     s_names_mutex;
+static vector<string>            s_names;
+static map<string, unsigned int> s_name_ids;
+
+//----------------------------------------------------------------
+// Procedure: spanProfiler()
+
+SpanProfiler& spanProfiler()
+{
+  static thread_local SpanProfiler profiler;
+  return(profiler);
+}
+
+//----------------------------------------------------------------
+// Procedure: spanNameID()
+
+unsigned int spanNameID(const string& name)
+{
+  lock_guard<mutex> lock(s_names_mutex);
+  map<string, unsigned int>::iterator p = s_name_ids.find(name);
+  if(p != s_name_ids.end())
+    return(p->second);
+
+  unsigned int id = s_names.size();
+  s_names.push_back(name);
+  s_name_ids[name] = id;
+  return(id);
+}
+
+//----------------------------------------------------------------
+// Procedure: spanNameLookup()
+//   Purpose: The id of a name already interned, without adding it
+
+static bool spanNameLookup(const string& name, unsigned int& id)
+{
+  lock_guard<mutex> lock(s_names_mutex);
+  map<string, unsigned int>::iterator p = s_name_ids.find(name);
+  if(p == s_name_ids.end())
+    return(false);
+  id = p->second;
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: spanNames()
+//   Purpose: A copy of all names interned so far, indexed by id
+
+static vector<string> spanNames()
+{
+  lock_guard<mutex> lock(s_names_mutex);
+  return(s_names);
+}
+
+//----------------------------------------------------------------
+// Constructor()
+
+ScopedSpan::ScopedSpan(unsigned int name_id, SpanProfiler& prof) :
+  m_prof(prof)
+{
+  m_active = prof.isEnabled();
+  if(m_active)
+    prof.begin(name_id);
+}
+
+//----------------------------------------------------------------
+// Constructor()
+
+ScopedSpan::ScopedSpan(const string& name, SpanProfiler& prof) :
+  m_prof(prof)
+{
+  m_active = prof.isEnabled();
+  if(m_active)
+    prof.begin(spanNameID(name));
+}
+
+//----------------------------------------------------------------
+// Constructor()
+
+SpanProfiler::SpanProfiler()
+{
+  m_enabled     = false;
+  m_iteration   = 0;
+  m_span_count  = 0;
+  m_ring_size   = 65536;
+  m_window_size = 100;
+  m_epoch_us    = nowMicros();
+
+  clear();
+}
+
+//----------------------------------------------------------------
+// Procedure: nowMicros()
+
+long long SpanProfiler::nowMicros() const
+{
+  chrono::steady_clock::duration d;
+  d = chrono::steady_clock::now().time_since_epoch();
+  return((long long)(chrono::duration_cast<chrono::microseconds>(d).count()));
+}
+
+//----------------------------------------------------------------
+// Procedure: setEnabled()
+
+void SpanProfiler::setEnabled(bool v)
+{
+  m_enabled = v;
+  if(m_enabled && (m_ring.size() == 0))
+    m_ring.resize(m_ring_size);
+}
+
+//----------------------------------------------------------------
+// Procedure: setRingSize()
+//      Note: Recent spans are dropped, other stats are retained
+
+bool SpanProfiler::setRingSize(unsigned int amt)
+{
+  if(amt == 0)
+    return(false);
+  m_ring_size = amt;
+  if(m_ring.size() > 0) {
+    m_ring.clear();
+    m_ring.resize(amt);
+  }
+  m_span_count = 0;
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: setWindowSize()
+//      Note: Rolling windows are reset to the new size
+
+bool SpanProfiler::setWindowSize(unsigned int amt)
+{
+  if(amt == 0)
+    return(false);
+  m_window_size = amt;
+  for(unsigned int i=0; i<m_window.size(); i++) {
+    m_window[i].clear();
+    m_window[i].resize(amt);
+    m_window_count[i] = 0;
+  }
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: clear()
+
+void SpanProfiler::clear()
+{
+  m_stack.clear();
+  m_nodes.clear();
+
+  SpanNode root;
+  root.parent   = 0;
+  root.name_id  = 0;
+  root.total_us = 0;
+  root.child_us = 0;
+  root.count    = 0;
+  m_nodes.push_back(root);
+
+  m_span_count = 0;
+  for(unsigned int i=0; i<m_window_count.size(); i++)
+    m_window_count[i] = 0;
+}
+
+//----------------------------------------------------------------
+// Procedure: childNode()
+
+unsigned int SpanProfiler::childNode(unsigned int node, unsigned int name_id)
+{
+  map<unsigned int, unsigned int>::iterator p;
+  p = m_nodes[node].children.find(name_id);
+  if(p != m_nodes[node].children.end())
+    return(p->second);
+
+  SpanNode child;
+  child.parent   = node;
+  child.name_id  = name_id;
+  child.total_us = 0;
+  child.child_us = 0;
+  child.count    = 0;
+
+  unsigned int ix = m_nodes.size();
+  m_nodes.push_back(child);
+  m_nodes[node].children[name_id] = ix;
+  return(ix);
+}
+
+//----------------------------------------------------------------
+// Procedure: begin()
+//      Note: The rolling windows are grown the first time a name id
+//            is seen by this profiler.
+
+void SpanProfiler::begin(unsigned int name_id)
+{
+  while(m_window.size() <= name_id) {
+    m_window.push_back(vector<long long>(m_window_size));
+    m_window_count.push_back(0);
+  }
+
+  unsigned int parent = 0;
+  if(m_stack.size() > 0)
+    parent = m_stack.back().node;
+
+  OpenSpan span;
+  span.node     = childNode(parent, name_id);
+  span.start_us = nowMicros();
+  m_stack.push_back(span);
+}
+
+//----------------------------------------------------------------
+// Procedure: end()
+//      Note: The duration is added to the span's node in the stack
+//            tree, to the child time of its parent, to the ring of
+//            recent spans and to the rolling window of its name.
+
+void SpanProfiler::end()
+{
+  if(m_stack.size() == 0)
+    return;
+
+  long long now_us = nowMicros();
+  OpenSpan  span   = m_stack.back();
+  m_stack.pop_back();
+
+  long long dur_us = now_us - span.start_us;
+
+  SpanNode& node = m_nodes[span.node];
+  node.total_us += dur_us;
+  node.count++;
+  m_nodes[node.parent].child_us += dur_us;
+
+  if(m_ring.size() > 0) {
+    SpanRecord& record = m_ring[m_span_count % m_ring.size()];
+    record.name_id   = node.name_id;
+    record.depth     = m_stack.size();
+    record.iteration = m_iteration;
+    record.start_us  = span.start_us - m_epoch_us;
+    record.dur_us    = dur_us;
+    m_span_count++;
+  }
+
+  unsigned int id = node.name_id;
+  m_window[id][m_window_count[id] % m_window_size] = dur_us;
+  m_window_count[id]++;
+}
+
+//----------------------------------------------------------------
+// Procedure: getStats()
+//      Note: Percentiles are by nearest rank over the window
+
+bool SpanProfiler::getStats(const string& name, double& p50, double& p90,
+			    double& pmax, unsigned int& count) const
+{
+  unsigned int id;
+  if(!spanNameLookup(name, id) || (id >= m_window.size()))
+    return(false);
+
+  unsigned long long total = m_window_count[id];
+  if(total == 0)
+    return(false);
+
+  count = m_window_size;
+  if(total < m_window_size)
+    count = (unsigned int)(total);
+
+  vector<long long> durs(m_window[id].begin(), m_window[id].begin()+count);
+
+  unsigned int ix50 = (count * 50 + 99) / 100 - 1;
+  unsigned int ix90 = (count * 90 + 99) / 100 - 1;
+  nth_element(durs.begin(), durs.begin()+ix50, durs.end());
+  p50 = (double)(durs[ix50]) / 1000;
+  nth_element(durs.begin(), durs.begin()+ix90, durs.end());
+  p90 = (double)(durs[ix90]) / 1000;
+  pmax = (double)(*max_element(durs.begin(), durs.end())) / 1000;
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: getStatsSummary()
+
+string SpanProfiler::getStatsSummary(const vector<string>& names) const
+{
+  string summary;
+  for(unsigned int i=0; i<names.size(); i++) {
+    double p50, p90, pmax;
+    unsigned int count;
+    if(!getStats(names[i], p50, p90, pmax, count))
+      continue;
+
+    char buff[128];
+    snprintf(buff, 128, "=%.3f/%.3f/%.3f", p50, p90, pmax);
+    if(summary != "")
+      summary += ",";
+    summary += names[i] + buff;
+  }
+  return(summary);
+}
+
+//----------------------------------------------------------------
+// Procedure: stackString()
+//      Note: Frames are joined with ';' as in the collapsed-stack
+//            format, so any ';' or blank in a name is replaced.
+
+string SpanProfiler::stackString(unsigned int node,
+				 const vector<string>& names) const
+{
+  string result;
+  while(node != 0) {
+    string name = names[m_nodes[node].name_id];
+    for(unsigned int i=0; i<name.length(); i++) {
+      if((name[i] == ';') || (name[i] == ' '))
+	name[i] = '_';
+    }
+    if(result == "")
+      result = name;
+    else
+      result = name + ";" + result;
+    node = m_nodes[node].parent;
+  }
+  return(result);
+}
+
+//----------------------------------------------------------------
+// Procedure: writeCollapsed()
+//      Note: One line per distinct call stack with its self time in
+//            microseconds, e.g., "helm_iterate;create;loiter 1234"
+
+bool SpanProfiler::writeCollapsed(const string& filename) const
+{
+  FILE *f = fopen(filename.c_str(), "w");
+  if(!f)
+    return(false);
+
+  vector<string> names = spanNames();
+  for(unsigned int i=1; i<m_nodes.size(); i++) {
+    long long self_us = m_nodes[i].total_us - m_nodes[i].child_us;
+    if(self_us > 0)
+      fprintf(f, "%s %lld\n", stackString(i, names).c_str(), self_us);
+  }
+  fclose(f);
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: writeChromeTrace()
+//      Note: Spans in the ring are written, oldest first, as Chrome
+//            trace "complete" events in the JSON object format.
+
+bool SpanProfiler::writeChromeTrace(const string& filename) const
+{
+  FILE *f = fopen(filename.c_str(), "w");
+  if(!f)
+    return(false);
+
+  unsigned long long rsize = m_ring.size();
+  unsigned long long first = 0;
+  if(m_span_count > rsize)
+    first = m_span_count - rsize;
+
+  vector<string> names = spanNames();
+  fprintf(f, "{\"traceEvents\":[");
+  for(unsigned long long i=first; i<m_span_count; i++) {
+    const SpanRecord& record = m_ring[i % rsize];
+
+    string name;
+    const string& raw = names[record.name_id];
+    for(unsigned int j=0; j<raw.length(); j++) {
+      if((raw[j] == '"') || (raw[j] == '\\'))
+	name += '\\';
+      if((unsigned char)(raw[j]) >= 0x20)
+	name += raw[j];
+    }
+
+    fprintf(f, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+	    "\"ts\":%lld,\"dur\":%lld,\"args\":{\"iter\":%u,\"depth\":%u}}",
+	    (i == first) ? "" : ",", name.c_str(), record.start_us,
+	    record.dur_us, record.iteration, record.depth);
+  }
+  fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+  fclose(f);
+  return(true);
+}
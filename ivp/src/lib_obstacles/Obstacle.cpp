@@ -21,6 +21,7 @@
 /* <http://www.gnu.org/licenses/>.                               */
 /*****************************************************************/
 
+#include <algorithm>
 #include "MBUtils.h"
 #include "Obstacle.h"
 
@@ -40,6 +41,9 @@ Obstacle::Obstacle()
   m_changed    = false;
   m_updates_total = 0;
   m_min_range  = -1;
+
+  m_hull_stale   = false;
+  m_hull_changed = false;
 }
 
 
@@ -50,8 +54,13 @@ bool Obstacle::addPoint(XYPoint point)
 {
   m_points.push_front(point);
 
-  if(m_points.size() > m_max_points)
+  if(m_points.size() > m_max_points) {
+    noteDroppedPoint(m_points.back());
     m_points.pop_back();
+  }
+
+  if(!m_hull_stale)
+    extendHull(point);
 
   // Obstacle is point-based. Must have non-empty set of points
   // or it will be considered expired.
@@ -62,6 +71,24 @@ bool Obstacle::addPoint(XYPoint point)
   return(true);
 }
   
+//---------------------------------------------------------
+// Procedure: setPoints()
+//   Purpose: Replace all points, e.g., when the cluster of points
+//            forming this obstacle has been merged or split.
+//            Points are given most recent first.
+
+void Obstacle::setPoints(const vector<XYPoint>& points)
+{
+  m_points.clear();
+  for(unsigned int i=0; (i<points.size()) && (i<m_max_points); i++)
+    m_points.push_back(points[i]);
+
+  m_duration = 0;
+  m_hull_stale = true;
+  m_hull_changed = true;
+  m_changed = true;
+}
+
 //---------------------------------------------------------
 // Procedure: setPoly
 //      Note: Sometimes the poly originates as a given poly,
@@ -194,6 +221,7 @@ bool Obstacle::pruneByAge(double max_age, double curr_time)
     double age = curr_time - pt.get_time();
     if(age > max_age) {
       m_changed = true;
+      noteDroppedPoint(*p);
       p = m_points.erase(p);
     }
     else
@@ -206,3 +234,109 @@ bool Obstacle::pruneByAge(double max_age, double curr_time)
   return(false);
 }
 
+//---------------------------------------------------------
+// Procedure: getHullPoints()
+
+vector<XYPoint> Obstacle::getHullPoints()
+{
+  if(m_hull_stale) {
+    m_hull_pts = getPoints();
+    m_hull_pts = hullOfPoints(m_hull_pts);
+    m_hull_stale = false;
+  }
+  m_hull_changed = false;
+  return(m_hull_pts);
+}
+
+//---------------------------------------------------------
+// Procedure: extendHull()
+//   Purpose: Update the hull with a newly arrived point. A point
+//            inside or on the current hull leaves it unchanged.
+//            Otherwise the new hull is the hull of the old hull
+//            points plus the new point.
+
+void Obstacle::extendHull(const XYPoint& pt)
+{
+  unsigned int i, hsize = m_hull_pts.size();
+  if(hsize >= 3) {
+    bool inside = true;
+    for(i=0; (i<hsize) && inside; i++) {
+      const XYPoint& a = m_hull_pts[i];
+      const XYPoint& b = m_hull_pts[(i+1) % hsize];
+      double cross = ((b.x() - a.x()) * (pt.y() - a.y())) -
+	((b.y() - a.y()) * (pt.x() - a.x()));
+      if(cross < 0)
+	inside = false;
+    }
+    if(inside)
+      return;
+  }
+  
+  m_hull_pts.push_back(pt);
+  m_hull_pts = hullOfPoints(m_hull_pts);
+  m_hull_changed = true;
+}
+
+//---------------------------------------------------------
+// Procedure: noteDroppedPoint()
+//   Purpose: If the dropped point is on the hull, the hull must be
+//            rebuilt from the remaining points.
+
+void Obstacle::noteDroppedPoint(const XYPoint& pt)
+{
+  if(m_hull_stale)
+    return;
+  for(unsigned int i=0; i<m_hull_pts.size(); i++) {
+    if((m_hull_pts[i].x() == pt.x()) && (m_hull_pts[i].y() == pt.y())) {
+      m_hull_stale = true;
+      m_hull_changed = true;
+      return;
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: hullOfPoints()
+//   Purpose: Return the points on the convex hull, counter-clockwise.
+//            Duplicate and colinear points are dropped, so two
+//            points are returned if all points are on a line.
+//      Note: Monotone chain algorithm, O(n log n)
+
+static bool lessXY(const XYPoint& a, const XYPoint& b)
+{
+  if(a.x() != b.x())
+    return(a.x() < b.x());
+  return(a.y() < b.y());
+}
+
+static double crossXY(const XYPoint& o, const XYPoint& a, const XYPoint& b)
+{
+  return(((a.x()-o.x()) * (b.y()-o.y())) - ((a.y()-o.y()) * (b.x()-o.x())));
+}
+
+vector<XYPoint> hullOfPoints(vector<XYPoint> pts)
+{
+  unsigned int n = pts.size();
+  if(n < 3)
+    return(pts);
+
+  sort(pts.begin(), pts.end(), lessXY);
+
+  vector<XYPoint> hull(2*n);
+  unsigned int k = 0;
+  for(unsigned int i=0; i<n; i++) {
+    while((k >= 2) && (crossXY(hull[k-2], hull[k-1], pts[i]) <= 0))
+      k--;
+    hull[k++] = pts[i];
+  }
+  for(int i=(int)(n)-2, t=k+1; i>=0; i--) {
+    while(((int)(k) >= t) && (crossXY(hull[k-2], hull[k-1], pts[i]) <= 0))
+      k--;
+    hull[k++] = pts[i];
+  }
+  // Last point is the same as the first
+  hull.resize(k-1);
+  if(hull.size() == 0)
+    hull.push_back(pts[0]);
+  return(hull);
+}
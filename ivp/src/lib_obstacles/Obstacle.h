@@ -37,6 +37,7 @@ public:
 
   bool addPoint(XYPoint);
   bool setPoly(XYPolygon);
+  void setPoints(const std::vector<XYPoint>&);
 
   bool pruneByAge(double max_time, double curr_time);
   
@@ -65,6 +66,15 @@ public:
   std::string  getInfo(double curr_time=0) const;
   
   std::vector<XYPoint> getPoints() const;
+
+  // Points on the convex hull of all points. Interior points have
+  // no effect on the hull, so the hull may be generated from these.
+  std::vector<XYPoint> getHullPoints();
+  bool                 hullChanged() const {return(m_hull_changed);}
+  
+protected:
+  void extendHull(const XYPoint&);
+  void noteDroppedPoint(const XYPoint&);
   
 protected: // set externally
   std::list<XYPoint> m_points;
@@ -80,7 +90,16 @@ private:  // set internally
   unsigned int   m_updates_total;
   double         m_min_range;
   std::string    m_poly_spec;
+
+  // Hull of m_points maintained as points arrive. Rebuilt from all
+  // points only when a point on the hull is dropped (stale).
+  std::vector<XYPoint> m_hull_pts;
+  bool                 m_hull_stale;
+  bool                 m_hull_changed;
 };
 
+// Points on the convex hull of the given points, counter-clockwise
+std::vector<XYPoint> hullOfPoints(std::vector<XYPoint>);
+
 #endif 
 
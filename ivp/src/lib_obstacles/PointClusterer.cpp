@@ -0,0 +1,416 @@
+/*****************************************************************/
+/*    FILE: PointClusterer.cpp                                   */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "MBUtils.h"
+#include "PointClusterer.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor
+
+PointClusterer::PointClusterer()
+{
+  m_cluster_dist = 0;
+  m_cell_size    = 0;
+  m_base_id      = 0;
+  m_next_cid     = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setClusterDist()
+//      Note: The cell diagonal is (just under) the cluster distance
+//            so any two points in the same cell are linked.
+//      Note: Only allowed before any points are added.
+
+bool PointClusterer::setClusterDist(double dist)
+{
+  if((dist <= 0) || (m_points.size() > 0))
+    return(false);
+
+  m_cluster_dist = dist;
+  m_cell_size    = (dist / sqrt(2.0)) * 0.9999;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: addPoint()
+//   Purpose: Add a point, joining it to the cluster of any point
+//            within the cluster distance. If it links two or more
+//            clusters they are merged, with the largest keeping its
+//            key.
+//   Returns: The key of the cluster holding the new point.
+
+string PointClusterer::addPoint(double x, double y, double tstamp)
+{
+  if(m_cell_size <= 0)
+    return("");
+
+  PCPoint point;
+  point.x = x;
+  point.y = y;
+  point.t = tstamp;
+  unsigned long id = m_base_id + m_points.size();
+  m_points.push_back(point);
+
+  int ix = (int)(floor(x / m_cell_size));
+  int iy = (int)(floor(y / m_cell_size));
+  long long key = cellKey(ix, iy);
+
+  // Part 1: Find the clusters linked to the new point. All points
+  //         in its own cell are linked. Cells up to two away may
+  //         hold points within range.
+  vector<unsigned int> cids;
+  map<long long, PCCell>::iterator p = m_cells.find(key);
+  if(p != m_cells.end())
+    cids.push_back(p->second.cid);
+
+  for(int i=ix-2; i<=ix+2; i++) {
+    for(int j=iy-2; j<=iy+2; j++) {
+      if((i == ix) && (j == iy))
+	continue;
+      map<long long, PCCell>::iterator q = m_cells.find(cellKey(i,j));
+      if(q == m_cells.end())
+	continue;
+      unsigned int cid = q->second.cid;
+      if(find(cids.begin(), cids.end(), cid) != cids.end())
+	continue;
+      if(pointNearCell(x, y, q->second))
+	cids.push_back(cid);
+    }
+  }
+
+  // Part 2: Pick or create the cluster, merging as needed
+  unsigned int cid = 0;
+  if(cids.size() == 0) {
+    cid = m_next_cid++;
+    m_clusters[cid].count = 0;
+  }
+  else {
+    cid = cids[0];
+    for(unsigned int i=1; i<cids.size(); i++) {
+      unsigned int count_i = m_clusters[cids[i]].count;
+      unsigned int count_c = m_clusters[cid].count;
+      if((count_i > count_c) || ((count_i == count_c) && (cids[i] < cid)))
+	cid = cids[i];
+    }
+    for(unsigned int i=0; i<cids.size(); i++) {
+      if(cids[i] != cid)
+	absorbCluster(cids[i], cid);
+    }
+  }
+
+  // Part 3: Add the point to its cell and cluster
+  PCCell& cell = m_cells[key];
+  if(cell.ids.size() == 0) {
+    cell.cid = cid;
+    cell.ix  = ix;
+    cell.iy  = iy;
+    m_clusters[cid].cells.insert(key);
+  }
+  cell.ids.push_back(id);
+  m_clusters[cid].count++;
+
+  return(keyOf(cid));
+}
+
+//---------------------------------------------------------
+// Procedure: pruneByAge()
+//   Purpose: Drop points older than max_age. Clusters left with no
+//            points are removed. Clusters that lost points are
+//            checked for a split.
+
+void PointClusterer::pruneByAge(double max_age, double curr_time)
+{
+  // Part 1: Drop the oldest points, noting the cells involved
+  set<long long> touched_cells;
+  while((m_points.size() > 0) &&
+	((curr_time - m_points.front().t) > max_age)) {
+    touched_cells.insert(cellKeyOf(m_points.front().x, m_points.front().y));
+    m_points.pop_front();
+    m_base_id++;
+  }
+  if(touched_cells.size() == 0)
+    return;
+
+  // Part 2: Remove the dropped ids from their cells. They are the
+  //         oldest, so at the front of each cell.
+  set<unsigned int> touched_cids;
+  set<long long>::iterator p;
+  for(p=touched_cells.begin(); p!=touched_cells.end(); p++) {
+    map<long long, PCCell>::iterator q = m_cells.find(*p);
+    if(q == m_cells.end())
+      continue;
+    vector<unsigned long>& ids = q->second.ids;
+    vector<unsigned long>::iterator first_live;
+    first_live = lower_bound(ids.begin(), ids.end(), m_base_id);
+    unsigned int amt = first_live - ids.begin();
+    ids.erase(ids.begin(), first_live);
+
+    unsigned int cid = q->second.cid;
+    m_clusters[cid].count -= amt;
+    touched_cids.insert(cid);
+    if(ids.size() == 0) {
+      m_clusters[cid].cells.erase(*p);
+      m_cells.erase(q);
+    }
+  }
+
+  // Part 3: Remove empty clusters and split any that came apart
+  set<unsigned int>::iterator c;
+  for(c=touched_cids.begin(); c!=touched_cids.end(); c++) {
+    unsigned int cid = *c;
+    if(m_clusters[cid].count == 0) {
+      m_clusters.erase(cid);
+      m_reset_keys.erase(keyOf(cid));
+      m_removed_keys.insert(keyOf(cid));
+    }
+    else
+      splitCluster(cid);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: getPoints()
+
+vector<XYPoint> PointClusterer::getPoints(const string& key,
+					  unsigned int max_pts) const
+{
+  vector<XYPoint> points;
+
+  map<unsigned int, PCCluster>::const_iterator p;
+  p = m_clusters.find(cidOf(key));
+  if(p == m_clusters.end())
+    return(points);
+
+  vector<unsigned long> ids;
+  set<long long>::const_iterator q;
+  for(q=p->second.cells.begin(); q!=p->second.cells.end(); q++) {
+    map<long long, PCCell>::const_iterator r = m_cells.find(*q);
+    if(r != m_cells.end())
+      ids.insert(ids.end(), r->second.ids.begin(), r->second.ids.end());
+  }
+
+  // Most recent points have the highest ids
+  sort(ids.begin(), ids.end());
+  reverse(ids.begin(), ids.end());
+  if((max_pts > 0) && (ids.size() > max_pts))
+    ids.resize(max_pts);
+
+  for(unsigned int i=0; i<ids.size(); i++) {
+    const PCPoint& pt = getPoint(ids[i]);
+    XYPoint new_pt(pt.x, pt.y);
+    new_pt.set_time(pt.t);
+    points.push_back(new_pt);
+  }
+  return(points);
+}
+
+//---------------------------------------------------------
+// Procedure: getClusterSize()
+
+unsigned int PointClusterer::getClusterSize(const string& key) const
+{
+  map<unsigned int, PCCluster>::const_iterator p;
+  p = m_clusters.find(cidOf(key));
+  if(p == m_clusters.end())
+    return(0);
+  return(p->second.count);
+}
+
+//---------------------------------------------------------
+// Procedure: clearChanges()
+
+void PointClusterer::clearChanges()
+{
+  m_reset_keys.clear();
+  m_removed_keys.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: cellKey()
+
+long long PointClusterer::cellKey(int ix, int iy) const
+{
+  return((((long long)(ix)) << 32) | ((long long)((unsigned int)(iy))));
+}
+
+//---------------------------------------------------------
+// Procedure: cellKeyOf()
+
+long long PointClusterer::cellKeyOf(double x, double y) const
+{
+  int ix = (int)(floor(x / m_cell_size));
+  int iy = (int)(floor(y / m_cell_size));
+  return(cellKey(ix, iy));
+}
+
+//---------------------------------------------------------
+// Procedure: pointNearCell()
+//   Purpose: True if any point in the cell is within the cluster
+//            distance of the given point.
+
+bool PointClusterer::pointNearCell(double x, double y,
+				   const PCCell& cell) const
+{
+  double dist_sq = m_cluster_dist * m_cluster_dist;
+  for(unsigned int i=0; i<cell.ids.size(); i++) {
+    const PCPoint& pt = getPoint(cell.ids[i]);
+    double dx = pt.x - x;
+    double dy = pt.y - y;
+    if(((dx*dx) + (dy*dy)) <= dist_sq)
+      return(true);
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: cellsLinked()
+//   Purpose: True if any point in one cell is within the cluster
+//            distance of any point in the other.
+//      Note: Newest points are tried first, since a cell being
+//            pruned loses its oldest points first.
+
+bool PointClusterer::cellsLinked(const PCCell& cell_a,
+				 const PCCell& cell_b) const
+{
+  for(unsigned int i=cell_a.ids.size(); i>0; i--) {
+    const PCPoint& pt = getPoint(cell_a.ids[i-1]);
+    if(pointNearCell(pt.x, pt.y, cell_b))
+      return(true);
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: absorbCluster()
+
+void PointClusterer::absorbCluster(unsigned int from_cid,
+				   unsigned int into_cid)
+{
+  PCCluster& from = m_clusters[from_cid];
+  PCCluster& into = m_clusters[into_cid];
+
+  set<long long>::iterator p;
+  for(p=from.cells.begin(); p!=from.cells.end(); p++) {
+    m_cells[*p].cid = into_cid;
+    into.cells.insert(*p);
+  }
+  into.count += from.count;
+  m_clusters.erase(from_cid);
+
+  m_reset_keys.erase(keyOf(from_cid));
+  m_removed_keys.insert(keyOf(from_cid));
+  m_reset_keys.insert(keyOf(into_cid));
+}
+
+//---------------------------------------------------------
+// Procedure: splitCluster()
+//   Purpose: Find the connected groups of cells in the cluster. If
+//            more than one, the group with the most points keeps
+//            the cluster key and the others become new clusters.
+
+void PointClusterer::splitCluster(unsigned int cid)
+{
+  PCCluster& cluster = m_clusters[cid];
+  if(cluster.cells.size() <= 1)
+    return;
+
+  // Part 1: Label each cell with the index of its group
+  map<long long, unsigned int> group_of;
+  vector<vector<long long> >   groups;
+  vector<unsigned int>         group_count;
+
+  set<long long>::iterator p;
+  for(p=cluster.cells.begin(); p!=cluster.cells.end(); p++) {
+    if(group_of.count(*p))
+      continue;
+    unsigned int gix = groups.size();
+    groups.push_back(vector<long long>());
+    group_count.push_back(0);
+    group_of[*p] = gix;
+    groups[gix].push_back(*p);
+
+    for(unsigned int k=0; k<groups[gix].size(); k++) {
+      const PCCell& cell = m_cells[groups[gix][k]];
+      group_count[gix] += cell.ids.size();
+      for(int i=cell.ix-2; i<=cell.ix+2; i++) {
+	for(int j=cell.iy-2; j<=cell.iy+2; j++) {
+	  long long nkey = cellKey(i,j);
+	  if(!cluster.cells.count(nkey) || group_of.count(nkey))
+	    continue;
+	  if(cellsLinked(cell, m_cells[nkey])) {
+	    group_of[nkey] = gix;
+	    groups[gix].push_back(nkey);
+	  }
+	}
+      }
+    }
+  }
+  if(groups.size() <= 1)
+    return;
+
+  // Part 2: The largest group keeps the cluster id
+  unsigned int keep_gix = 0;
+  for(unsigned int g=1; g<groups.size(); g++)
+    if(group_count[g] > group_count[keep_gix])
+      keep_gix = g;
+
+  for(unsigned int g=0; g<groups.size(); g++) {
+    if(g == keep_gix)
+      continue;
+    unsigned int new_cid = m_next_cid++;
+    PCCluster& new_cluster = m_clusters[new_cid];
+    new_cluster.count = group_count[g];
+    for(unsigned int k=0; k<groups[g].size(); k++) {
+      m_cells[groups[g][k]].cid = new_cid;
+      new_cluster.cells.insert(groups[g][k]);
+      m_clusters[cid].cells.erase(groups[g][k]);
+    }
+    m_clusters[cid].count -= group_count[g];
+    m_reset_keys.insert(keyOf(new_cid));
+  }
+  m_reset_keys.insert(keyOf(cid));
+}
+
+//---------------------------------------------------------
+// Procedure: keyOf()
+
+string PointClusterer::keyOf(unsigned int cid) const
+{
+  return("pc_" + uintToString(cid));
+}
+
+//---------------------------------------------------------
+// Procedure: cidOf()
+//      Note: Returns an id never used if the key is malformed
+
+unsigned int PointClusterer::cidOf(const string& key) const
+{
+  if(!strBegins(key, "pc_"))
+    return(m_next_cid);
+  string num = key.substr(3);
+  if(!isNumber(num))
+    return(m_next_cid);
+  return((unsigned int)(atoi(num.c_str())));
+}
@@ -0,0 +1,119 @@
+/*****************************************************************/
+/*    FILE: PointClusterer.h                                     */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef POINT_CLUSTERER_HEADER
+#define POINT_CLUSTERER_HEADER
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include "XYPoint.h"
+
+// Online clustering of unlabeled points, e.g., lidar or radar
+// returns. Two points are in the same cluster if linked by a chain
+// of points, each within the cluster distance of the next, as in
+// DBSCAN. Points are held in a grid with cells sized so that all
+// points in a cell are within the cluster distance of each other.
+// A cell is therefore always wholly in one cluster, and neighbor
+// searches, merges and splits work on cells rather than points.
+// Points are expected to arrive in time order.
+
+class PointClusterer
+{
+public:
+  PointClusterer();
+  ~PointClusterer() {}
+
+  bool setClusterDist(double);
+
+  std::string addPoint(double x, double y, double tstamp);
+  void        pruneByAge(double max_age, double curr_time);
+
+  // Most recent first, limited to max_pts if max_pts > 0
+  std::vector<XYPoint> getPoints(const std::string& key,
+				 unsigned int max_pts=0) const;
+
+  unsigned int getClusterSize(const std::string& key) const;
+
+  // Keys of clusters merged or split (reset), or merged into another
+  // or emptied (removed), since the changes were last cleared.
+  std::set<std::string> getResetKeys() const   {return(m_reset_keys);}
+  std::set<std::string> getRemovedKeys() const {return(m_removed_keys);}
+  void clearChanges();
+
+  double       getClusterDist() const {return(m_cluster_dist);}
+  unsigned int size() const           {return(m_points.size());}
+  unsigned int clusterCount() const   {return(m_clusters.size());}
+  unsigned int cellCount() const      {return(m_cells.size());}
+
+ protected:
+  class PCPoint {
+  public:
+    double x;
+    double y;
+    double t;
+  };
+
+  class PCCell {
+  public:
+    std::vector<unsigned long> ids;  // ascending, i.e., oldest first
+    unsigned int cid;
+    int ix;
+    int iy;
+  };
+
+  class PCCluster {
+  public:
+    std::set<long long> cells;
+    unsigned int        count;
+  };
+
+ protected:
+  long long    cellKey(int ix, int iy) const;
+  long long    cellKeyOf(double x, double y) const;
+  bool         cellsLinked(const PCCell&, const PCCell&) const;
+  bool         pointNearCell(double x, double y, const PCCell&) const;
+  void         absorbCluster(unsigned int from_cid, unsigned int into_cid);
+  void         splitCluster(unsigned int cid);
+  std::string  keyOf(unsigned int cid) const;
+  unsigned int cidOf(const std::string& key) const;
+
+  const PCPoint& getPoint(unsigned long id) const
+  {return(m_points[id - m_base_id]);}
+
+ protected:
+  double m_cluster_dist;
+  double m_cell_size;
+
+  // Points in arrival order. Id of m_points[i] is m_base_id + i.
+  std::deque<PCPoint> m_points;
+  unsigned long       m_base_id;
+
+  std::map<long long, PCCell>       m_cells;
+  std::map<unsigned int, PCCluster> m_clusters;
+  unsigned int                      m_next_cid;
+
+  std::set<std::string> m_reset_keys;
+  std::set<std::string> m_removed_keys;
+};
+
+#endif
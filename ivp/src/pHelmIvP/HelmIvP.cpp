@@ -44,6 +44,7 @@
 #include "NodeRecord.h"
 #include "NodeRecordUtils.h"
 #include "ACTable.h"
+#include "SpanProfiler.h"
 
 using namespace std;
 
@@ -60,8 +61,6 @@ HelmIvP::HelmIvP()
   m_verbose        = "verbose";
   m_verbose_reset  = false;
   m_helm_iteration = 0;
-  m_bhv_count      = 0;
-  m_bhv_count_ever = 0;
   m_ok_skew        = 60; 
   m_skews_matter   = true;
   m_goals_mandatory = false; 
@@ -83,14 +82,13 @@ HelmIvP::HelmIvP()
 
   m_allow_override  = true;
   m_park_on_allstop = false;
+  m_ipf_binary      = false;
 
   m_ibuffer_curr_time_updated = false;
 
   m_rejournal_requested = true;
   m_reset_post_pending  = false;
 
-  m_prev_total_completed = 0;
-  
   m_init_vars_ready  = false;
   m_init_vars_done   = false;
 
@@ -100,7 +98,7 @@ HelmIvP::HelmIvP()
   m_nav_started = false;
   m_nav_grace = 5;
 
-  // The refresh vars handle the occasional clearing of the m_outgoing
+  // The refresh vars handle the occasional clearing of the m_poster
   // maps. These maps will be cleared when MOOS mail is received for the
   // variable given by m_refresh_var. The user can set minimum interval
   // between refreshes so the helm retains some control over refresh rate.
@@ -113,6 +111,10 @@ HelmIvP::HelmIvP()
   m_refresh_time     = 0;
 
   m_seed_random = true;
+
+  m_profile           = false;
+  m_profile_interval  = 1.0;
+  m_profile_post_time = 0;
   
   m_node_report_vars.push_back("AIS_REPORT");
   m_node_report_vars.push_back("NODE_REPORT");
@@ -125,6 +127,7 @@ HelmIvP::HelmIvP()
 
 HelmIvP::~HelmIvP()
 {
+  if(m_profile)      dumpProfile();
   if(m_info_buffer)  delete(m_info_buffer);
   if(m_ledger_snap)  delete(m_ledger_snap);
   if(m_bhv_set)      delete(m_bhv_set);
@@ -147,15 +150,7 @@ void HelmIvP::handlePrepareRestart()
   m_hengine = 0;
 
   m_bhv_files.clear();
-  m_outgoing_key_strings.clear();
-
-  m_outgoing_key_doubles.clear();
-  m_outgoing_timestamp.clear();
-  m_outgoing_sval.clear();
-  m_outgoing_dval.clear();
-  m_outgoing_iter.clear();
-  m_outgoing_bhv.clear();
-  m_outgoing_repinterval.clear();
+  m_poster.clear();
 
   m_ivp_domain = IvPDomain();
 
@@ -297,6 +292,10 @@ bool HelmIvP::OnNewMail(MOOSMSG_LIST &NewMail)
     }
     else if(moosvar == "IVPHELM_REJOURNAL")
       m_rejournal_requested = true;
+    else if(moosvar == "IVPHELM_PROFILE_DUMP") {
+      if(m_profile && !dumpProfile())
+	reportRunWarning("Unable to write profile: " + m_profile_file);
+    }
 
     // Added Nov1624. Helm will register only if a bhv does.
     else if(moosvar == "BHV_ABLE_FILTER") {
@@ -438,19 +437,22 @@ bool HelmIvP::Iterate()
   // on the current iteration.
   if(m_refresh_pending && 
      ((m_curr_time-m_refresh_time) > m_refresh_interval)) {
-    m_outgoing_key_strings.clear();
-    m_outgoing_key_doubles.clear();
+    m_poster.clearKeys();
     m_refresh_time = m_curr_time;
     m_refresh_pending = false;
   }
 
   registerNewVariables();
-  postModeMessages();
-  postBehaviorMessages();
-  postLifeEvents();
-  postDefaultVariables();
-
-  // Should be called after postBehaviorMessages() where warnings
+  m_poster.setCurrTime(m_curr_time);
+  m_poster.setStartTime(m_start_time);
+  m_poster.setIteration(m_helm_iteration);
+  m_poster.handleModeMessages(m_bhv_set);
+  m_poster.handleBehaviorMessages(m_bhv_set);
+  m_poster.handleLifeEvents(m_bhv_set);
+  m_poster.handleDefaultVariables(m_bhv_set);
+  deliverPostings();
+
+  // Should be called after deliverPostings() where warnings
   // are detected and the count is incremented.
   unsigned int warning_count = getWarningCount("all"); 
   m_helm_report.setWarningCount(warning_count);
@@ -540,6 +542,8 @@ bool HelmIvP::Iterate()
   
   Notify("IVPHELM_CREATE_CPU", m_helm_report.getCreateTime());
   Notify("IVPHELM_LOOP_CPU", m_helm_report.getLoopTime());
+  if(m_profile)
+    postProfile();
 
   bool changed_update_vars = m_bhv_set->refreshMapUpdateVars();
   if(changed_update_vars)
@@ -558,138 +562,44 @@ bool HelmIvP::Iterate()
 }
   
 //------------------------------------------------------------
-// Procedure: postBehaviorMessages()
-//      Note: Run once after every iteration of control loop.
-//            Each behavior has the chance to produce their 
-//            own message to be posted in both the info_buffer
-//            and to the MOOSDB. 
+// Procedure: deliverPostings()
+//      Note: Run once after every iteration of control loop, once
+//            the HelmPoster has collected the mode, behavior, life
+//            event and default variable postings of the iteration.
 
-void HelmIvP::postBehaviorMessages()
+void HelmIvP::deliverPostings()
 {
-  if(!m_bhv_set) 
-    return;
-  
-  // Added Aug 02 2012 to support enhanced warning reporting
-  vector<string> config_warnings = m_bhv_set->getWarnings();
-  for(unsigned int i=0; i<config_warnings.size(); i++) {
-    reportRunWarning(config_warnings[i]);
-    Notify("IVPHELM_BHVSET_WARNING", uintToString(i) + ":" + config_warnings[i]);
-  }
-  m_bhv_set->clearWarnings();
-  
-  unsigned bhv_count      = m_bhv_set->size();
-  if(bhv_count != m_bhv_count) {
-    Notify("IVPHELM_BHV_CNT", bhv_count);
-    m_bhv_count = bhv_count;
-  }
-
-  unsigned bhv_count_ever = m_bhv_set->getTCount();
-  if(bhv_count_ever != m_bhv_count_ever) {
-    Notify("IVPHELM_BHV_CNT_EVER", bhv_count_ever);
-    m_bhv_count_ever = bhv_count_ever;
-  }
-    
-  Notify("IVPHELM_ITER", m_helm_iteration);
-  for(unsigned i=0; i < bhv_count; i++) {
-    string bhv_descriptor = m_bhv_set->getDescriptor(i);
-    vector<VarDataPair> mvector = m_bhv_set->getMessages(i);
-
-    unsigned int j, msize = mvector.size();
-    for(j=0; j<msize; j++) {
-      VarDataPair msg = mvector[j];
-
-      string var   = msg.get_var();
-      string sdata = msg.get_sdata();
-      double ddata = msg.get_ddata();
-      string mkey  = msg.get_key();
-      bool   msg_is_string = msg.is_string();
-
-      bool key_change = true;
-      bool key_repeat = detectRepeatOnKey(var);
-      if(sdata == "")
-	key_change = detectChangeOnKey(mkey, ddata);
+  vector<string> warnings = m_poster.getRunWarnings();
+  for(unsigned int i=0; i<warnings.size(); i++)
+    reportRunWarning(warnings[i]);
+
+  vector<string> retractions = m_poster.getRetractions();
+  for(unsigned int i=0; i<retractions.size(); i++)
+    retractRunWarning(retractions[i]);
+
+  vector<HelmPosting> postings = m_poster.getPostings();
+  for(unsigned int i=0; i<postings.size(); i++) {
+    string var = postings[i].getVar();
+    string src = postings[i].getSrc();
+    if(postings[i].isString()) {
+      if(src == "")
+	Notify(var, postings[i].getSVal());
       else
-	key_change = detectChangeOnKey(mkey, sdata);
-
-      if(mkey == "repeatable")
-	key_repeat = true;
-
-      // Include warnings in this application's appcast
-      if(var == "BHV_WARNING") {
-	//if(mkey != "retract")
-	if(!strEnds(mkey, "retract"))
-	  reportRunWarning("BHV_WARNING: " + sdata);
-	else 
-	  retractRunWarning("BHV_WARNING: " + sdata);
-      }
-      else if(var == "BHV_ERROR")
-	reportRunWarning("BHV_ERROR: " + sdata);
-
-      // If posting an IvP Function, mux first and post the parts.
-      if(var == "BHV_IPF") { // mikerb
-
-#if 0
-	Notify("BHV_IPF", sdata);
-#endif
-#if 1
-	string id = bhv_descriptor + "^" + intToString(m_helm_iteration);
-	vector<string> svector = IvPFunctionToVector(sdata, id, 2000);
-	for(unsigned int k=0; k<svector.size(); k++)
-	  Notify("BHV_IPF", svector[k], bhv_descriptor);
-#endif
-      }
-      // Otherwise just post to the DB directly.
-      else {
-	if(msg_is_string) {
-	  m_info_buffer->setValue(var, sdata);
-	  if(key_change || key_repeat) {
-	    string aux = intToString(m_helm_iteration) + ":" + 
-	      bhv_descriptor;
-	    Notify(var, sdata, aux);
-	    m_outgoing_timestamp[var] = m_curr_time;
-	    m_outgoing_iter[var] = m_helm_iteration;
-	    m_outgoing_sval[var] = sdata;
-	    m_outgoing_bhv[var]  = bhv_descriptor;
-
-	    if(var == "BHV_EVENT")
-	      reportEvent(sdata);
-	  }
-	}
-	else {
-	  m_info_buffer->setValue(var, ddata);
-	  if(key_change || key_repeat) {
-	    string aux = intToString(m_helm_iteration) + ":" + 
-	      bhv_descriptor;
-	    Notify(var, ddata, aux);
-	    m_outgoing_timestamp[var] = m_curr_time;
-	    m_outgoing_iter[var] = m_helm_iteration;
-	    m_outgoing_dval[var] = ddata;
-	    m_outgoing_bhv[var]  = bhv_descriptor;
-	  }
-	}
-      }
+	Notify(var, postings[i].getSVal(), src);
+    }
+    else {
+      if(src == "")
+	Notify(var, postings[i].getDVal());
+      else
+	Notify(var, postings[i].getDVal(), src);
     }
-  }
-  // Determine if the list of state-space related variables for
-  // the behavior-set has changed and post the new set if so.
-
-  bool changed = m_bhv_set->updateStateSpaceVars();
-  if(changed) {
-    string state_vars = m_bhv_set->getStateSpaceVars();
-    Notify("IVPHELM_STATEVARS", state_vars);
   }
 
-  string helm_iter     = uintToString(m_helm_iteration);
+  vector<string> events = m_poster.getEvents();
+  for(unsigned int i=0; i<events.size(); i++)
+    reportEvent(events[i]);
 
-  string compl_pending = boolToString(m_bhv_set->getCompletedPending());
-  if(compl_pending != m_prev_compl_pending)
-    Notify("IVPHELM_COMPLETED_PENDING", compl_pending, helm_iter); 
-  m_prev_compl_pending = compl_pending;
-  
-  unsigned int total_completed = m_bhv_set->removeCompletedBehaviors();
-  if(total_completed != m_prev_total_completed)
-    Notify("IVPHELM_COMPLETED_COUNT", total_completed, helm_iter);
-  m_prev_total_completed = total_completed;
+  m_poster.clearPostings();
 }
 
 //------------------------------------------------------------
@@ -728,91 +638,50 @@ bool HelmIvP::buildReport()
       hold_on_status = "waiting";
   }  
   m_msgs << "Hold-On-Apps: " << hold_on_status << endl;
-  
-  ACTable actab(5);
-  actab << "Variable | Behavior | Time | Iter | Value";
-  actab.addHeaderLines();
-  actab.setColumnMaxWidth(4,55);
-  actab.setColumnNoPad(4);
-  map<string, double>::iterator q;
-  for(q=m_outgoing_timestamp.begin(); q!=m_outgoing_timestamp.end(); q++) {
-    string varname = q->first;
-    string value = "???";
-    if(m_outgoing_sval.count(varname))
-      value = m_outgoing_sval[varname];
-    else if(m_outgoing_dval.count(varname))
-      value = doubleToStringX(m_outgoing_dval[varname]);
-    double db_time = q->second - m_start_time;
-    string timestamp = doubleToString(db_time,2);
-    string bhv  = m_outgoing_bhv[varname];
-    string iter = uintToString(m_outgoing_iter[varname]);
-    actab << varname << bhv << timestamp << iter << value;
-  }
-  m_msgs << endl << endl;
-  m_msgs << actab.getFormattedString();
 
-  return(true);
-}
-
-//------------------------------------------------------------
-// Procedure: postLifeEvents()
-//      Note: Run once after every iteration of control loop.
-
-void HelmIvP::postLifeEvents()
-{
-  if(!m_bhv_set) 
-    return;
-  
-  vector<LifeEvent> events = m_bhv_set->getLifeEvents();
-  unsigned int i, vsize = events.size();
-  for(i=0; i<vsize; i++) {
-    double htime = m_curr_time - m_start_time;
-    string str = "time=" + doubleToString(htime, 2);
-    str += ", iter="  + intToString(m_helm_iteration);
-    str += ", bname=" + events[i].getBehaviorName();
-    str += ", btype=" + events[i].getBehaviorType();
-    str += ", event=" + events[i].getEventType();
-    str += ", seed="  + events[i].getSpawnString();
-    str += ", posting_index=" + uintToString(i);
-    Notify("IVPHELM_LIFE_EVENT", str);
+  if(m_profile) {
+    ACTable ptab(5);
+    ptab << "Profile | Count | p50(ms) | p90(ms) | Max(ms)";
+    ptab.addHeaderLines();
+    vector<string> names = profileNames();
+    for(unsigned int i=0; i<names.size(); i++) {
+      double p50, p90, pmax;
+      unsigned int count;
+      if(spanProfiler().getStats(names[i], p50, p90, pmax, count)) {
+	ptab << names[i] << uintToString(count) << doubleToString(p50,3);
+	ptab << doubleToString(p90,3) << doubleToString(pmax,3);
+      }
+    }
+    m_msgs << endl << ptab.getFormattedString() << endl;
   }
-  if(vsize > 0)
-    m_bhv_set->clearLifeEvents();
-}
-
-
-//------------------------------------------------------------
-// Procedure: postModeMessages()
-//      Note: Run once after every iteration of control loop.
-
-void HelmIvP::postModeMessages()
-{
-  if(!m_bhv_set) 
-    return;
   
-  vector<VarDataPair> mvector = m_bhv_set->getModeVarDataPairs();
-  unsigned int j, msize = mvector.size();
-
-  for(j=0; j<msize; j++) {
-    VarDataPair msg = mvector[j];
-    
-    string var   = msg.get_var();
-    string sdata = msg.get_sdata();
-    double ddata = msg.get_ddata();
-    string mkey  = msg.get_key();
+  m_msgs << endl << endl;
 
-    bool key_change = true;
-    if(msg.is_string()) {
-      key_change = detectChangeOnKey(mkey, sdata);
-      if(key_change)
-	Notify(var, sdata, "HELM_MODE");
-    }
-    else {
-      key_change = detectChangeOnKey(mkey, ddata);
-      if(key_change)
-	Notify(var, ddata, "HELM_MODE");
+  // The table of outgoing postings only changes when the poster
+  // notes a new posting, so it is reused until then
+  string inputs = uintToString(m_poster.getOutgoingRevision());
+  inputs += "," + doubleToString(m_start_time);
+  if(!reuseReportSection("postings", inputs)) {
+    ACTable actab(5);
+    actab << "Variable | Behavior | Time | Iter | Value";
+    actab.addHeaderLines();
+    actab.setColumnMaxWidth(4,55);
+    actab.setColumnNoPad(4);
+    map<string, double> outgoing_times = m_poster.getOutgoingTimes();
+    map<string, double>::iterator q;
+    for(q=outgoing_times.begin(); q!=outgoing_times.end(); q++) {
+      string varname = q->first;
+      string value = m_poster.getOutgoingValue(varname);
+      double db_time = q->second - m_start_time;
+      string timestamp = doubleToString(db_time,2);
+      string bhv  = m_poster.getOutgoingBehavior(varname);
+      string iter = uintToString(m_poster.getOutgoingIteration(varname));
+      actab << varname << bhv << timestamp << iter << value;
     }
+    postReportSection("postings", actab.getFormattedString());
   }
+
+  return(true);
 }
 
 //------------------------------------------------------------
@@ -945,57 +814,6 @@ void HelmIvP::handleInitialVarsPhase2()
   }
 }
 
-//------------------------------------------------------------
-// Procedure: postDefaultVariables()
-//
-//   Post the "default variables". These variable/value pairs are 
-//   provided in the behavior file. The post is made on each helm 
-//   iteration if the variable involved was not written to by any
-//   of the behaviors on this iteration. Thus all the behavior
-//   messages must be collected first (phase1) and the default
-//   values posted once compared against the list (phase 2).
-
-  
-void HelmIvP::postDefaultVariables()
-{
-  if(!m_bhv_set) return;
-
-  // Phase 1 - determine what variables were written to by the 
-  // behaviors during the last iteration.
-  vector<string> message_vars;
-  unsigned int i, bhv_cnt = m_bhv_set->size();
-  for(i=0; i < bhv_cnt; i++) {
-    vector<VarDataPair> mvector = m_bhv_set->getMessages(i);
-    unsigned int j, vsize = mvector.size();
-    for(j=0; j<vsize; j++) {
-      VarDataPair msg = mvector[j];
-      message_vars.push_back(msg.get_var());
-    }
-  }
-
-  // Phase 2 - Examine each of the default_messages and determine
-  // for each, if the variable was contained in one of the behavior
-  // messages for this iteration. If not, then post the default.
-  vector<VarDataPair> dvector = m_bhv_set->getDefaultVariables();
-  unsigned int j, dsize = dvector.size();
-  for(j=0; j<dsize; j++) {
-    VarDataPair msg = dvector[j];
-    string var = msg.get_var();
-    if(!vectorContains(message_vars, var)) {
-      if(msg.is_string()) {
-	string sdata  = msg.get_sdata();
-	m_info_buffer->setValue(var, sdata);
-	Notify(var, sdata);
-      }
-      else {
-	double ddata  = msg.get_ddata();
-	m_info_buffer->setValue(var, ddata);
-	Notify(var, ddata);
-      }
-    }
-  }
-}
-
 //------------------------------------------------------------
 // Procedure: setVerbosity()
 //    Values: verbose values: "verbose", "terse", "quiet"
@@ -1052,7 +870,7 @@ void HelmIvP::postHelmStatus()
   if(helm_status != "DISABLED")
     Notify("IVPHELM_STATE", helm_status);
   else {
-    bool changed = detectChangeOnKey("IVPHELM_STATE", helm_status);
+    bool changed = m_poster.detectChangeOnKey("IVPHELM_STATE", helm_status);
     if(changed)
       Notify("IVPHELM_STATE", helm_status);
   }
@@ -1127,6 +945,8 @@ void HelmIvP::registerVariables()
   registerSingleVariable("MOOS_MANUAL_OVERRIDE");
   registerSingleVariable("RESTART_HELM");
   registerSingleVariable("IVPHELM_REJOURNAL");
+  if(m_profile)
+    registerSingleVariable("IVPHELM_PROFILE_DUMP");
   registerSingleVariable("BHV_ABLE_FILTER");
   
   registerSingleVariable("NAV_X");
@@ -1215,6 +1035,49 @@ void HelmIvP::checkForTakeOver()
     helmStatusUpdate("ENABLED");
 }
 
+//--------------------------------------------------------
+// Procedure: profileNames()
+//      Note: Span names whose rolling times are reported. Behavior
+//            spans are named by the behavior descriptor.
+
+vector<string> HelmIvP::profileNames() const
+{
+  vector<string> names;
+  if(m_bhv_set) {
+    for(unsigned int i=0; i<m_bhv_set->size(); i++)
+      names.push_back(m_bhv_set->getDescriptor(i));
+  }
+  names.push_back("solve");
+  names.push_back("helm_iterate");
+  return(names);
+}
+
+//--------------------------------------------------------
+// Procedure: postProfile()
+
+void HelmIvP::postProfile()
+{
+  if((m_curr_time - m_profile_post_time) < m_profile_interval)
+    return;
+  m_profile_post_time = m_curr_time;
+
+  string summary = spanProfiler().getStatsSummary(profileNames());
+  if(summary != "")
+    Notify("IVPHELM_PROFILE", summary);
+}
+
+//--------------------------------------------------------
+// Procedure: dumpProfile()
+//      Note: Writes a Chrome trace of recent iterations and the
+//            collapsed stacks of all iterations so far.
+
+bool HelmIvP::dumpProfile()
+{
+  bool ok1 = spanProfiler().writeChromeTrace(m_profile_file + ".json");
+  bool ok2 = spanProfiler().writeCollapsed(m_profile_file + ".folded");
+  return(ok1 && ok2);
+}
+
 //--------------------------------------------------------
 // Procedure: OnStartUp()
 
@@ -1230,6 +1093,7 @@ bool HelmIvP::OnStartUp()
     m_info_buffer->setCurrTime(m_curr_time);
     m_info_buffer->setStartTime(m_helm_start_time);
   }
+  m_poster.setInfoBuffer(m_info_buffer);
     
   bool bhv_dir_not_found_ok = false;
   // ownship xis name of MOOS community, set in AppCastingMOOSApp::OnStartUp()
@@ -1316,6 +1180,12 @@ bool HelmIvP::OnStartUp()
       handled = handleConfigPMGen(value);
     else if(param == "OTHER_OVERRIDE_VAR") 
       handled = setNonWhiteVarOnString(m_additional_override, value);
+    else if(param == "IPF_ENCODING")
+      handled = handleConfigIPFEncoding(value);
+    else if(param == "PROFILE")
+      handled = setBooleanOnString(m_profile, value);
+    else if(param == "PROFILE_FILE")
+      handled = setNonWhiteVarOnString(m_profile_file, value);
 
     if(!handled)
       reportUnhandledConfigWarning(orig);
@@ -1323,6 +1193,10 @@ bool HelmIvP::OnStartUp()
 
   if(m_seed_random)
     seedRandom();
+
+  if(m_profile_file == "")
+    m_profile_file = "helm_prof_" + m_ownship;
+  spanProfiler().setEnabled(m_profile);
   
   // Check for Config Warnings first here after reading pHelmIvP block.
   if(getWarningCount("config") > 0) {
@@ -1367,6 +1241,8 @@ bool HelmIvP::OnStartUp()
   else // added nov1724
     m_hengine->setBehaviorSet(m_bhv_set);
 
+  m_bhv_set->setIPFBinary(m_ipf_binary);
+
   // Set the "ownship" parameter for all behaviors
   unsigned int i, bsize = m_bhv_set->size();
   for(i=0; i<bsize; i++) {
@@ -1412,6 +1288,22 @@ bool HelmIvP::handleConfigNodeSkew(const string& given_value)
   return(false);
 }
 
+//--------------------------------------------------------------------
+// Procedure: handleConfigIPFEncoding()
+//   Example: ipf_encoding = binary   (or text, the default)
+
+bool HelmIvP::handleConfigIPFEncoding(const string& value)
+{
+  string encoding = tolower(stripBlankEnds(value));
+  if(encoding == "text")
+    m_ipf_binary = false;
+  else if(encoding == "binary")
+    m_ipf_binary = true;
+  else
+    return(false);
+  return(true);
+}
+
 //--------------------------------------------------------------------
 // Procedure: handleConfigSkewAny()
 
@@ -1577,116 +1469,6 @@ bool HelmIvP::addBehaviorFile(string filename)
   return(true);
 }
 
-//--------------------------------------------------------------------
-// Procedure: detectRepeatOnKey()
-// Notes: When the helm posts a VarDataPair it may be posted with the
-//        understanding that subsequent posts are disallowed if the
-//        value has not changed. To indicate this, the VarDataPair sets
-//        its KEY field. 
-//        The helm may be configured to allow subsequent posts be made
-//        even if the value has not changed, even if the VarDataPair has
-//        set its key field. 
-//        This process determines if a given variable should be allowed
-//        to re-post, given the values in m_outgoing_timestamp, and 
-//        m_outgoing_repinterval.
-
-bool HelmIvP::detectRepeatOnKey(const string& key)
-{
-  // If no interval has been declared for this variable, repeat fails.
-  double interval = 0;
-  map<string, double>::iterator p;
-  p = m_outgoing_repinterval.find(key);
-  if(p==m_outgoing_repinterval.end())
-    return(false);
-  else
-    interval = p->second;
-  
-  if(interval <= 0)
-    return(false);
-
-  // If no interval has been declared for this variable, repeat fails.
-  double timestamp = 0;
-  p = m_outgoing_timestamp.find(key);
-  if(p == m_outgoing_timestamp.end())
-    return(false);
-  else
-    timestamp = p->second;
-
-  int    random_range = 100;
-  double elapsed_time = m_curr_time - timestamp;
-  if(elapsed_time < interval) {
-    int rand_int = rand() % random_range;
-    double threshold = (1 / interval) * random_range; 
-    if(rand_int < threshold)
-      return(true);
-    else
-      return(false);
-  }
-  return(false);
-}
-
-//--------------------------------------------------------------------
-// Procedure: detectChangeOnKey()
-//   Purpose: To determine if the given key-value pair is unique 
-//            against the last key-value posting.
-//      Note: The assumption is that if a change is detected, the caller
-//            will go ahead and make the posting. This assumption is 
-//            reflected in the fact that the m_outgoing_key_strings map
-//            is updated when a changed is detected.
-
-bool HelmIvP::detectChangeOnKey(const string& key, const string& value)
-{
-  if(key == "")
-    return(true);
-  map<string, string>::iterator p;
-  p = m_outgoing_key_strings.find(key);
-  if(p == m_outgoing_key_strings.end()) {
-    m_outgoing_key_strings[key] = value;
-    return(true);
-  }
-  else {
-    string old_value = p->second;
-    if(old_value == value)
-      return(false);
-    else {
-      // map is updated if changed detected.
-      m_outgoing_key_strings[key] = value;
-      return(true);
-    }
-  }
-}
-
-//--------------------------------------------------------------------
-// Procedure: detectChangeOnKey()
-//   Purpose: To determine if the given key-value pair is unique 
-//            against the last key-value posting.
-//      Note: The assumption is that if a change is detected, the caller
-//            will go ahead and make the posting. This assumption is 
-//            reflected in the fact that the m_outgoing_key_strings map is
-//            updated when a changed is detected.
-
-bool HelmIvP::detectChangeOnKey(const string& key, double value)
-{
-  if(key == "")
-    return(true);
-  map<string, double>::iterator p;
-  p = m_outgoing_key_doubles.find(key);
-  if(p == m_outgoing_key_doubles.end()) {
-    m_outgoing_key_doubles[key] = value;
-    return(true);
-  }
-  else {
-    double old_value = p->second;
-    if(old_value == value)
-      return(false);
-    else {
-      // map is updated if changed detected.
-      m_outgoing_key_doubles[key] = value;
-      return(true);
-    }
-  }
-}
-
 //--------------------------------------------------------------------
 // Procedure: postAllStop()
 //   Purpose: Post zero-values to all decision variables. 
@@ -34,6 +34,7 @@
 #include "IvPDomain.h"
 #include "BehaviorSet.h"
 #include "HelmEngine.h"
+#include "HelmPoster.h"
 
 class HelmIvP : public AppCastingMOOSApp
 {
@@ -54,6 +55,7 @@ public:
  protected:
   bool handleConfigNodeSkew(const std::string&);
   bool handleConfigSkewAny(const std::string&);
+  bool handleConfigIPFEncoding(const std::string&);
   bool handleConfigStandBy(const std::string&);
   bool handleConfigDomain(const std::string&);
   bool handleConfigHoldOnApp(std::string);
@@ -65,10 +67,7 @@ public:
   bool updateInfoBuffer(CMOOSMsg &Msg);
   void postHelmStatus();
   void postCharStatus();
-  void postBehaviorMessages();
-  void postLifeEvents();
-  void postModeMessages();
-  void postDefaultVariables();
+  void deliverPostings();
   void handleHelmStartMessages();
   void handleInitialVarsPhase1();
   void handleInitialVarsPhase2();
@@ -77,14 +76,11 @@ public:
   void registerNewVariables();
   void requestBehaviorLogging();
   void checkForTakeOver();
+  void postProfile();
+  bool dumpProfile();
+  std::vector<std::string> profileNames() const;
   void checkHoldOnApps(std::string);
   
-  bool detectChangeOnKey(const std::string& key, 
-			 const std::string& sval);
-  bool detectChangeOnKey(const std::string& key, 
-			 double dval);
-  bool detectRepeatOnKey(const std::string& key);
-
   void postAllStop(std::string msg="");
   bool processNodeReport(const std::string &);
   bool processNodeReportLocal(const std::string &);
@@ -106,6 +102,7 @@ protected:
   
   bool          m_allow_override;
   bool          m_park_on_allstop;
+  bool          m_ipf_binary;
   std::string   m_allstop_msg;
   IvPDomain     m_ivp_domain;
   BehaviorSet*  m_bhv_set;
@@ -127,7 +124,7 @@ protected:
   unsigned int  m_no_decisions;
   unsigned int  m_no_goal_decisions;
 
-  // The refresh vars handle the occasional clearing of the m_outgoing
+  // The refresh vars handle the occasional clearing of the m_poster
   // maps. These maps will be cleared when MOOS mail is received for the
   // variable given by m_refresh_var. The user can set minimum interval
   // between refreshes so the helm retains some control over refresh rate.
@@ -140,15 +137,10 @@ protected:
   double        m_refresh_interval;
   
   unsigned int  m_helm_iteration;
-  unsigned int  m_bhv_count;
-  unsigned int  m_bhv_count_ever;
   double        m_ok_skew;
   bool          m_skews_matter;
   bool          m_goals_mandatory;
   
-  unsigned int  m_prev_total_completed;
-  std::string   m_prev_compl_pending;
-  
   HelmReport    m_helm_report;
   HelmReport    m_prev_helm_report;
   HelmEngine*   m_hengine;
@@ -176,19 +168,10 @@ protected:
   // to the logger so it may record the .bhv files alongside others.
   std::set<std::string> m_bhv_files;
 
-  // Maps for keeping track of the previous outgoing behavior postings
-  // for comparison on current posting. Possibly supress if they match
-  std::map<std::string, std::string> m_outgoing_key_strings;
-  std::map<std::string, double>      m_outgoing_key_doubles;
-
-  // Maps for keeping track of when the last time a post happened for
-  // a particular variable, and whether or not repeat posts are wanted.
-  std::map<std::string, double>       m_outgoing_timestamp;
-  std::map<std::string, std::string>  m_outgoing_sval;
-  std::map<std::string, double>       m_outgoing_dval;
-  std::map<std::string, unsigned int> m_outgoing_iter;
-  std::map<std::string, std::string>  m_outgoing_bhv;
-  std::map<std::string, double>       m_outgoing_repinterval;
+  // Filters and collects the outgoing behavior postings. Holds the
+  // previous postings for comparison, possibly suppressing repeats.
+  HelmPoster    m_poster;
+
   std::map<std::string, double>       m_var_reg_time;
   
   // A flag maintained on each iteration indicating whether the 
@@ -212,6 +195,13 @@ protected:
   
   std::string  m_helm_prefix;
 
+  // Optional profiling of behavior, build and solve times. Rolling
+  // percentiles are posted at most every m_profile_interval secs.
+  bool         m_profile;
+  std::string  m_profile_file;
+  double       m_profile_interval;
+  double       m_profile_post_time;
+
   PlatModelGenerator m_plat_model_generator;
 };
 #endif 
@@ -111,6 +111,13 @@ void showExampleConfigAndExit()
   blk("  allow_park       = true      // or {false}                    ");
   blk("  park_on_allstop  = false     // or {true}                     ");
   blk("                                                                ");
+  blk("  // Encoding of posted IvP functions (BHV_IPF)                 ");
+  blk("  ipf_encoding     = text      // or {binary}                   ");
+  blk("                                                                ");
+  blk("  // Profile behavior, build and solve times (IVPHELM_PROFILE)  ");
+  blk("  profile          = false     // or {true}                     ");
+  blk("  profile_file     = helm_prof // Writes .json and .folded files");
+  blk("                                                                ");
   blk("  // Provide alternative to MOOS_MANUAL_OVERRIDE directive      ");
   blk("  other_override_var   = AUTONOMY_OVERRIDE                      ");
   blk("                                                                ");
@@ -160,6 +167,7 @@ void showInterfaceAndExit()
   blk("  RESTART_HELM                                                  ");
   blk("  IVPHELM_VERBOSE                                               ");
   blk("  IVPHELM_REJOURNAL                                             ");
+  blk("  IVPHELM_PROFILE_DUMP  = Any value, if profiling is enabled    ");
   blk("  APPCAST_REQ  = node=all,app=uFldCollObDetect,duration=3.0     ");
   blk("                 key=pMarineViewer:alphaapp,thresh=run_warning  ");
   blk("                                                                ");
@@ -186,6 +194,9 @@ void showInterfaceAndExit()
   blk("                                                                ");
   blk("  IVPHELM_CREATE_CPU    = CPU time to create IvP functions      ");
   blk("  IVPHELM_LOOP_CPU      = CPU time to create and solve IvP prob ");
+  blk("  IVPHELM_PROFILE       = waypt=0.12/0.31/0.88,...              ");
+  blk("                          Per behavior p50/p90/max in ms, if the");
+  blk("                          profile parameter is set to true.     ");
   blk("                                                                ");
   blk("  IVPHELM_DOMAIN        = speed,0,4,21:course,0,359,36          ");
   blk("  IVPHELM_LIFE_EVENT    = Desc of behavior spawn or death       ");
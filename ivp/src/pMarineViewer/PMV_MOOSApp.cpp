@@ -1442,6 +1442,17 @@ bool PMV_MOOSApp::buildReport()
   m_msgs << "Draw Count:       " << drawcount << endl; 
   m_msgs << "Draw Count Rate:  " << drawrate  << endl; 
 
+  // Frame times in ms. The max is since the last report.
+  double frame_avg = m_gui->mviewer->getFrameTimeAvg();
+  double frame_max = m_gui->mviewer->getFrameTimeMax();
+  m_gui->mviewer->resetFrameTimeMax();
+  string frame_fps = "n/a";
+  if(frame_avg > 0)
+    frame_fps = doubleToString(1000 / frame_avg, 1);
+  m_msgs << "Frame Time Avg:   " << doubleToString(frame_avg,2) << " ms" << endl;
+  m_msgs << "Frame Time Max:   " << doubleToString(frame_max,2) << " ms" << endl;
+  m_msgs << "Frame Rate Limit: " << frame_fps << " fps" << endl;
+
   double curr_time = m_gui->mviewer->getCurrTime();
   m_msgs << "Curr Time:        " << doubleToString(curr_time,2) << endl;
 
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <algorithm>
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
 #include "PMV_Viewer.h"
 #include "MBUtils.h"
 #include "MacroUtils.h"
@@ -68,6 +69,9 @@ PMV_Viewer::PMV_Viewer(int x, int y, int w, int h, const char *l)
   m_curr_time      = 0;
   m_draw_count     = 0;
   m_last_draw_time = 0;
+  m_frame_time     = 0;
+  m_frame_time_avg = 0;
+  m_frame_time_max = 0;
   
   m_centric_view   = "";
   m_centric_view_sticky = true;
@@ -117,6 +121,8 @@ void PMV_Viewer::draw()
     return;
 #endif
 
+  double frame_start = MOOSLocalTime(false);
+
   MarineViewer::draw();
   m_draw_count++;
 
@@ -127,15 +133,15 @@ void PMV_Viewer::draw()
 
   vector<string> vnames = m_geoshapes_map.getVehiNames();
   for(unsigned int i=0; i<vnames.size(); i++) {
-    vector<XYPolygon> polys   = m_geoshapes_map.getPolygons(vnames[i]);
-    vector<XYWedge>   wedges  = m_geoshapes_map.getWedges(vnames[i]);
-    vector<XYGrid>    grids   = m_geoshapes_map.getGrids(vnames[i]);
-    vector<XYConvexGrid> cgrids = m_geoshapes_map.getConvexGrids(vnames[i]);
-    vector<XYVector>  vectors = m_geoshapes_map.getVectors(vnames[i]);
-    vector<XYRangePulse> rng_pulses = m_geoshapes_map.getRangePulses(vnames[i]);
-    vector<XYCommsPulse> cms_pulses = m_geoshapes_map.getCommsPulses(vnames[i]);
-    const map<string, XYSeglr>   seglrs  = m_geoshapes_map.getSeglrs(vnames[i]);
-    const map<string, XYSegList> segls   = m_geoshapes_map.getSegLists(vnames[i]);
+    const VPlug_GeoShapes&   shapes  = m_geoshapes_map.getGeoShapes(vnames[i]);
+    const vector<XYWedge>&   wedges  = m_geoshapes_map.getWedges(vnames[i]);
+    const vector<XYGrid>&    grids   = m_geoshapes_map.getGrids(vnames[i]);
+    const vector<XYConvexGrid>& cgrids = m_geoshapes_map.getConvexGrids(vnames[i]);
+    const vector<XYVector>&  vectors = m_geoshapes_map.getVectors(vnames[i]);
+    const vector<XYRangePulse>& rng_pulses = m_geoshapes_map.getRangePulses(vnames[i]);
+    const vector<XYCommsPulse>& cms_pulses = m_geoshapes_map.getCommsPulses(vnames[i]);
+    const map<string, XYSeglr>&   seglrs = m_geoshapes_map.getSeglrs(vnames[i]);
+    const map<string, XYSegList>& segls  = m_geoshapes_map.getSegLists(vnames[i]);
     const map<string, XYPoint>&  points  = m_geoshapes_map.getPoints(vnames[i]);
     const map<string, XYCircle>& circles = m_geoshapes_map.getCircles(vnames[i]);
     const map<string, XYOval>& ovals = m_geoshapes_map.getOvals(vnames[i]);
@@ -143,7 +149,7 @@ void PMV_Viewer::draw()
     const map<string, XYMarker>& markers = m_geoshapes_map.getMarkers(vnames[i]);
     const map<string, XYTextBox>& textboxes = m_geoshapes_map.getTextBoxes(vnames[i]);
 
-    drawPolygons(polys);
+    drawPolygons(shapes, vnames[i]);
     drawGrids(grids);
     drawConvexGrids(cgrids);
     drawSegLists(segls);
@@ -200,6 +206,14 @@ void PMV_Viewer::draw()
   }
 
   glFlush();
+
+  m_frame_time = (MOOSLocalTime(false) - frame_start) * 1000;
+  if(m_draw_count == 1)
+    m_frame_time_avg = m_frame_time;
+  else
+    m_frame_time_avg = (0.9 * m_frame_time_avg) + (0.1 * m_frame_time);
+  if(m_frame_time > m_frame_time_max)
+    m_frame_time_max = m_frame_time;
 }
 
 //-------------------------------------------------------------
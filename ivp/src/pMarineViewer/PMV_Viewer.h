@@ -79,6 +79,12 @@ class PMV_Viewer : public MarineViewer
   double       getTimeWarp() const {return(m_time_warp);}
   double       getElapsed() const {return(m_elapsed);}
 
+  // Wall clock time spent in draw(), in milliseconds
+  double       getFrameTime() const    {return(m_frame_time);}
+  double       getFrameTimeAvg() const {return(m_frame_time_avg);}
+  double       getFrameTimeMax() const {return(m_frame_time_max);}
+  void         resetFrameTimeMax()     {m_frame_time_max = 0;}
+
   void   setVerbose(bool bval=true) {m_verbose=bval;}
   
   void   clearGeoShapes(std::string vname, std::string shape, std::string stype);
@@ -107,6 +113,10 @@ class PMV_Viewer : public MarineViewer
   unsigned int m_draw_count;
   double       m_last_draw_time;
 
+  double       m_frame_time;
+  double       m_frame_time_avg;
+  double       m_frame_time_max;
+
   bool         m_verbose;
   
   // Member variables for holding scoped info
@@ -46,6 +46,7 @@ ObstacleManager::ObstacleManager()
   
   m_max_pts_per_cluster = 20;
   m_max_age_per_point   = 20;
+  m_cluster_min_pts     = 3;
 
   m_poly_label_thresh = 25;
   m_poly_shade_thresh = 100;
@@ -160,6 +161,7 @@ bool ObstacleManager::Iterate()
   AppCastingMOOSApp::Iterate();
 
   manageMemory();
+  updateClusters();
   updatePointHulls();
   updatePolyRanges();
   postConvexHullUpdates();
@@ -200,6 +202,13 @@ bool ObstacleManager::OnStartUp()
       handled = setUIntOnString(m_max_pts_per_cluster, value);
     else if(param == "max_age_per_point")
       handled = setPosDoubleOnString(m_max_age_per_point, value);
+    else if(param == "cluster_dist") {
+      double dval = atof(value.c_str());
+      if(isNumber(value))
+	handled = m_clusterer.setClusterDist(dval);
+    }
+    else if(param == "cluster_min_pts")
+      handled = setUIntOnString(m_cluster_min_pts, value);
     else if(param == "post_dist_to_polys")
       handled = handleConfigPostDistToPolys(value);
     else if(param == "post_view_polys")
@@ -286,6 +295,7 @@ void ObstacleManager::registerVariables()
 //            currently is consistent with an XYPoint, but we custom parse
 //            here to decouple from the geometry string parsing library.
 //   Example: TRACKED_FEATURE = "x=23,y=99,key=b"
+//      Note: The key may be omitted if clustering is enabled.
 
 XYPoint ObstacleManager::customStringToPoint(string point_str)
 {
@@ -308,7 +318,9 @@ XYPoint ObstacleManager::customStringToPoint(string point_str)
       obstacle_key_str = value;
   }
 
-  if((x_str == "") || (y_str == "") || (obstacle_key_str == ""))
+  if((x_str == "") || (y_str == ""))
+    return(null_pt);
+  if((obstacle_key_str == "") && (m_clusterer.getClusterDist() <= 0))
     return(null_pt);
 
   double x = atof(x_str.c_str());
@@ -417,10 +429,25 @@ bool ObstacleManager::handleMailNewPoint(string value)
   string key = newpt.get_msg();
   if(key == "")
     key = newpt.get_label();
+
+  // Part 4: A point with no key, if clustering, is added to the
+  //         cluster it falls in. The cluster key is the obstacle
+  //         key. An obstacle is made once the cluster is big enough.
+  if((key == "") && (m_clusterer.getClusterDist() > 0)) {
+    key = m_clusterer.addPoint(newpt.x(), newpt.y(), m_curr_time);
+    if(m_map_obstacles.count(key) == 0) {
+      if(m_clusterer.getClusterSize(key) >= m_cluster_min_pts) {
+	m_map_obstacles[key].setMaxPts(m_max_pts_per_cluster);
+	m_map_obstacles[key].setPoints(m_clusterer.getPoints(key, m_max_pts_per_cluster));
+	onNewObstacle("points");  
+      }
+      return(true);
+    }
+  }
   if(key == "") 
     key = "generic";
 
-  // Part 4: Add the new point to the points associated with that key
+  // Part 5: Add the new point to the points associated with that key
   m_map_obstacles[key].addPoint(newpt);
   m_map_obstacles[key].setChanged(true);
   m_map_obstacles[key].setMaxPts(m_max_pts_per_cluster);
@@ -459,16 +486,22 @@ bool ObstacleManager::updatePointHulls()
     if(!p->second.hasChanged() && !thresh_crossed)
       continue;
     string key = p->first;
-    vector<XYPoint> points = p->second.getPoints();
-    if(points.size() == 0)
+    if(p->second.size() == 0)
       continue;
     
     XYPolygon poly;
     if(m_lasso) {
       reportEvent("gen_lasso");
-      poly = genPseudoHull(points, m_lasso_radius);
+      poly = genPseudoHull(p->second.getPoints(), m_lasso_radius);
     }
     else {
+      // Points inside the hull do not change it. If no new point
+      // fell outside, and no hull point has expired, no update.
+      bool hull_changed = p->second.hullChanged();
+      if(!hull_changed && !thresh_crossed && (p->second.getPoly().size() > 0))
+	continue;
+      
+      vector<XYPoint> points = p->second.getHullPoints();
       ConvexHullGenerator chgen;
       for(unsigned int i=0; i<points.size(); i++) 
 	chgen.addPoint(points[i].x(), points[i].y(), points[i].get_label());
@@ -809,26 +842,68 @@ void ObstacleManager::manageMemory()
     
   // Part 2: Free memory for obstacles flagged above
   set<string>::iterator q;
-  for(q=keys_to_forget.begin(); q!=keys_to_forget.end(); q++) {
-    string key = *q;
+  for(q=keys_to_forget.begin(); q!=keys_to_forget.end(); q++)
+    releaseObstacle(*q);
+}
 
-    // Post inactive view poly to erase this poly
-    if(m_post_view_polys) {
-      XYPolygon poly = m_map_obstacles[key].getPoly();
-      string spec = poly.get_spec_inactive();
-      Notify("VIEW_POLYGON", spec);
-    }
+//------------------------------------------------------------
+// Procedure: releaseObstacle()
 
-    // Post to alert variabe that this obstacle is resolved
-    Notify("OBM_RESOLVED", key);
-    m_alerts_resolved++;
-    reportEvent("OBM_RESOLVED=" + key);
+void ObstacleManager::releaseObstacle(string key)
+{
+  // Post inactive view poly to erase this poly
+  if(m_post_view_polys) {
+    XYPolygon poly = m_map_obstacles[key].getPoly();
+    string spec = poly.get_spec_inactive();
+    Notify("VIEW_POLYGON", spec);
+  }
+  
+  // Post to alert variabe that this obstacle is resolved
+  Notify("OBM_RESOLVED", key);
+  m_alerts_resolved++;
+  reportEvent("OBM_RESOLVED=" + key);
+  
+  // Update key obstacle manager state
+  m_map_obstacles.erase(key);
+  m_obstacles_released++;
+}
 
-    
-    // Update key obstacle manager state
-    m_map_obstacles.erase(key);
-    m_obstacles_released++;
+//------------------------------------------------------------
+// Procedure: updateClusters()
+//   Purpose: Age out clustered points, then bring obstacles in line
+//            with clusters that were merged, split or emptied since
+//            the last iteration. Points simply added to a cluster
+//            were already added to its obstacle as they arrived.
+
+void ObstacleManager::updateClusters()
+{
+  if(m_clusterer.getClusterDist() <= 0)
+    return;
+
+  m_clusterer.pruneByAge(m_max_age_per_point, m_curr_time);
+
+  set<string> removed_keys = m_clusterer.getRemovedKeys();
+  set<string>::iterator p;
+  for(p=removed_keys.begin(); p!=removed_keys.end(); p++) {
+    if(m_map_obstacles.count(*p))
+      releaseObstacle(*p);
   }
+
+  set<string> reset_keys = m_clusterer.getResetKeys();
+  for(p=reset_keys.begin(); p!=reset_keys.end(); p++) {
+    string key = *p;
+    unsigned int csize = m_clusterer.getClusterSize(key);
+    bool known = (m_map_obstacles.count(key) > 0);
+    if((csize == 0) || (!known && (csize < m_cluster_min_pts)))
+      continue;
+
+    m_map_obstacles[key].setMaxPts(m_max_pts_per_cluster);
+    m_map_obstacles[key].setPoints(m_clusterer.getPoints(key, m_max_pts_per_cluster));
+    if(!known)
+      onNewObstacle("points");
+  }
+
+  m_clusterer.clearChanges();
 }
 
 
@@ -938,6 +1013,10 @@ bool ObstacleManager::buildReport()
   string str_max_pts_per = uintToString(m_max_pts_per_cluster);
   string str_max_age_per = doubleToStringX(m_max_age_per_point);
 
+  string str_cluster_dist = "off";
+  if(m_clusterer.getClusterDist() > 0)
+    str_cluster_dist = doubleToStringX(m_clusterer.getClusterDist());
+
   string str_navx = doubleToStringX(m_nav_x,1);
   string str_navy = doubleToStringX(m_nav_y,1);
   string str_nav = "(" + str_navx + "," + str_navy + ")";
@@ -951,6 +1030,8 @@ bool ObstacleManager::buildReport()
   m_msgs << "  max_pts_per_cluster: " << str_max_pts_per   << endl;
   m_msgs << "  max_age_per_point:   " << str_max_age_per   << endl;
   m_msgs << "  ignore_range:        " << str_ignore_rng    << endl;
+  m_msgs << "  cluster_dist:        " << str_cluster_dist  << endl;
+  m_msgs << "  cluster_min_pts:     " << m_cluster_min_pts << endl;
   m_msgs << "Configuration (given_obstacles):            " << endl;
   m_msgs << "  given_max_duration: " << m_given_max_duration << endl;
   m_msgs << "Configuration (viewing):                    " << endl;
@@ -976,6 +1057,10 @@ bool ObstacleManager::buildReport()
   m_msgs << "  Points Received:   " << m_points_total      << endl;
   m_msgs << "  Points Invalid:    " << m_points_invalid    << endl;
   m_msgs << "  Points Ignored:    " << m_points_ignored    << endl;
+  if(m_clusterer.getClusterDist() > 0) {
+    m_msgs << "  Points Clustered:  " << m_clusterer.size()   << endl;
+    m_msgs << "  Clusters:          " << m_clusterer.clusterCount() << endl;
+  }
   m_msgs << "State: (given_obstacles):                   " << endl;
   m_msgs << "  Given Obstacles (mail) ever: " << m_given_mail_ever << endl;
   m_msgs << "  Given Obstacles (mail) good: " << m_given_mail_good << endl;
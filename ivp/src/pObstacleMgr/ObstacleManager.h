@@ -27,6 +27,7 @@
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
 #include "XYPolygon.h"
 #include "Obstacle.h"
+#include "PointClusterer.h"
 #include "VarDataPair.h"
 #include "MailFlagSet.h"
 #include <set>
@@ -71,7 +72,9 @@ protected:
 
   bool updatePointHulls();
   void updatePolyRanges();
+  void updateClusters();
   void manageMemory();
+  void releaseObstacle(std::string obstacle_key);
 
   void postFlags(const std::vector<VarDataPair>& flags);
   
@@ -102,6 +105,9 @@ private: // Configuration variables
   unsigned int m_max_pts_per_cluster;
   double       m_max_age_per_point;
 
+  // Clustering of points with no key (off if cluster_dist unset)
+  unsigned int m_cluster_min_pts;
+
   // Configuring Lasso option
   bool         m_lasso;
   unsigned int m_lasso_points;
@@ -140,6 +146,8 @@ private: // State variables
   unsigned int m_obstacles_ever;
   
   std::map<std::string, Obstacle> m_map_obstacles;
+
+  PointClusterer m_clusterer;
 };
 
 #endif 
@@ -101,6 +101,10 @@ void showExampleConfigAndExit()
   blk("  max_pts_per_cluster = 20   // default is 20                   ");
   blk("  max_age_per_point   = 20   // (secs)  default is 20           ");
   blk("                                                                ");
+  blk("  cluster_dist    = 5        // (meters) cluster points w/ no   ");
+  blk("                             // label. Default is off           ");
+  blk("  cluster_min_pts = 3        // default is 3                    ");
+  blk("                                                                ");
   blk("  alert_range  = 20          // (meters) default is 20          ");
   blk("  ignore_range = -1          // (meters) default is -1, (off)   ");
   blk("                                                                ");
@@ -141,6 +145,7 @@ void showInterfaceAndExit()
   blk("SUBSCRIPTIONS:                                                  ");
   blk("------------------------------------                            ");
   blk("  TRACKED_FEATURE = x=5,y=8,label=a,size=4,color=1              ");
+  blk("  TRACKED_FEATURE = x=5,y=8   // No label, if cluster_dist set ");
   blk("  GIVEN_OBSTACLE  = pts={90.2,-80.4:...:85.4,-80.4},label=ob_23 ");
   blk("                                                                ");
   blk("  NAV_X = 103.0                                                 ");
@@ -22,6 +22,8 @@
 /*****************************************************************/
 
 #include <iterator>
+#include <cmath>
+#include <algorithm>
 #include "SearchGrid.h"
 #include "MBUtils.h"
 #include "NodeRecord.h"
@@ -40,6 +42,11 @@ SearchGrid::SearchGrid()
   m_report_deltas = true;
   m_grid_label    = "psg";
   m_grid_var_name = "VIEW_GRID";
+  m_sweep         = false;
+  m_sweep_max_gap = 100;
+
+  m_reports_handled = 0;
+  m_cells_swept     = 0;
 }
 
 //---------------------------------------------------------
@@ -141,6 +148,10 @@ bool SearchGrid::OnStartUp()
 	handled = setNonWhiteVarOnString(m_grid_label, value);
       else if(param == "grid_var_name")
 	handled = setNonWhiteVarOnString(m_grid_var_name, toupper(value));
+      else if(param == "sweep")
+	handled = setBooleanOnString(m_sweep, value);
+      else if(param == "sweep_max_gap")
+	handled = setNonNegDoubleOnString(m_sweep_max_gap, value);
       
       if(!handled)
 	reportUnhandledConfigWarning(orig);
@@ -172,6 +183,12 @@ void SearchGrid::registerVariables()
 
 //------------------------------------------------------------
 // Procedure: handleMailNodeReport()
+//      Note: Each cell containing the reported position is credited
+//            once. If sweeping, each cell crossed on the way from
+//            the vehicle's previous position is also credited once,
+//            leaving out the cells at either end of the leg, which
+//            were credited by their own reports. Legs longer than
+//            sweep_max_gap (e.g., after a dropout) are not swept.
 
 void SearchGrid::handleMailNodeReport(string str)
 {
@@ -181,15 +198,41 @@ void SearchGrid::handleMailNodeReport(string str)
 
   double posx = record.getX();
   double posy = record.getY();
-
-  for(unsigned int ix=0; ix<m_grid.size(); ix++) {
-    bool contained = m_grid.ptIntersect(ix, posx, posy);
-    if(contained) {
-      m_map_deltas[ix] = m_map_deltas[ix] + 1;
-      m_grid.incVal(ix, 1);
+  m_reports_handled++;
+
+  vector<unsigned int> cells = m_grid.getCellsAt(posx, posy);
+
+  if(m_sweep) {
+    string vname = record.getName();
+    if(m_map_prev_x.count(vname)) {
+      double prevx = m_map_prev_x[vname];
+      double prevy = m_map_prev_y[vname];
+      double gap = hypot(posx-prevx, posy-prevy);
+      if((gap > 0) && ((m_sweep_max_gap <= 0) || (gap <= m_sweep_max_gap))) {
+	vector<unsigned int> prev_cells = m_grid.getCellsAt(prevx, prevy);
+	vector<unsigned int> seg_cells;
+	seg_cells = m_grid.getCellsOnSeg(prevx, prevy, posx, posy);
+	for(unsigned int i=0; i<seg_cells.size(); i++) {
+	  unsigned int ix = seg_cells[i];
+	  if(find(cells.begin(), cells.end(), ix) != cells.end())
+	    continue;
+	  if(find(prev_cells.begin(), prev_cells.end(), ix) != prev_cells.end())
+	    continue;
+	  m_map_deltas[ix] = m_map_deltas[ix] + 1;
+	  m_grid.incVal(ix, 1);
+	  m_cells_swept++;
+	}
+      }
     }
+    m_map_prev_x[vname] = posx;
+    m_map_prev_y[vname] = posy;
   }
 
+  for(unsigned int i=0; i<cells.size(); i++) {
+    unsigned int ix = cells[i];
+    m_map_deltas[ix] = m_map_deltas[ix] + 1;
+    m_grid.incVal(ix, 1);
+  }
 }
 
 //------------------------------------------------------------
@@ -257,7 +300,11 @@ bool SearchGrid::buildReport()
   m_msgs << "Grid characteristics: " << endl;
   m_msgs << "      Cells: " << m_grid.size() << endl;  
   m_msgs << "  Cell size: " << doubleToStringX(cell_sizex) << "x" << 
-    doubleToStringX(cell_sizey,4) << endl << endl;
+    doubleToStringX(cell_sizey,4) << endl;
+  m_msgs << "    Reports: " << m_reports_handled << endl;
+  if(m_sweep)
+    m_msgs << "      Swept: " << m_cells_swept << " cells" << endl;
+  m_msgs << endl;
 
   ACTable actab(6,2);
   actab.setColumnJustify(1, "right");
@@ -24,6 +24,8 @@
 #ifndef SEARCH_GRID_MOOS_APP_HEADER
 #define SEARCH_GRID_MOOS_APP_HEADER
 
+#include <map>
+#include <string>
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
 #include "XYConvexGrid.h"
 #include "ExFilterSet.h"
@@ -52,6 +54,9 @@ protected: // Config vars
   std::string m_grid_label;
   std::string m_grid_var_name;
 
+  bool        m_sweep;
+  double      m_sweep_max_gap;
+
   ExFilterSet m_filter_set;
 
 protected: // State vars
@@ -60,6 +65,13 @@ protected: // State vars
 
   std::map<unsigned int, double> m_map_deltas;
 
+  // Last reported position per vehicle, for swept coverage
+  std::map<std::string, double> m_map_prev_x;
+  std::map<std::string, double> m_map_prev_y;
+
+  unsigned int m_reports_handled;
+  unsigned int m_cells_swept;
+
 };
 
 #endif 
@@ -39,6 +39,10 @@ void showSynopsis()
   blk("  The pSearchGrid application  is a module for storing a        ");
   blk("  history of vehicle positions in a 2D grid defined over a      ");
   blk("  region of operation.                                          ");
+  blk("                                                                ");
+  blk("  With sweep=true, cells crossed between two successive reports ");
+  blk("  from the same vehicle are credited too, so coverage does not  ");
+  blk("  depend on the report rate relative to the vehicle speed.      ");
 }
 
 //----------------------------------------------------------------
@@ -93,6 +97,8 @@ void showExampleConfigAndExit()
   blk("  grid_label    = psg          // default                       ");
   blk("  match_name    = abe                                           ");
   blk("  ignore_name   = ben                                           ");
+  blk("  sweep         = false        // default                       ");
+  blk("  sweep_max_gap = 100          // default (meters)              ");
   blk("                                                                ");
   blk("  grid_config = pts={-50,-40: -10,0: 180,0: 180,-150: -50,-150} ");
   blk("  grid_config = cell_size=5                                     ");
@@ -210,7 +210,11 @@ void AppCastMonitor::RegisterVariables()
 
 bool AppCastMonitor::handleMailAppCast(const string& str)
 {
-  AppCast appcast   = string2AppCast(str);
+  string full_str;
+  if(!m_delta_cache.resolve(str, full_str))
+    return(false);
+
+  AppCast appcast   = string2AppCast(full_str);
   string  node_name = appcast.getNodeName();
 
   if(node_name == "")
@@ -95,6 +95,8 @@ class AppCastMonitor : public CMOOSApp
   
   AppCastRepo  m_repo;
 
+  AppCastDeltaCache m_delta_cache;
+
   std::string  m_mission_hash;
 };
 
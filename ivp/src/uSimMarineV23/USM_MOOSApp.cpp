@@ -293,78 +293,13 @@ bool USM_MOOSApp::OnStartUp()
     string line  = *p;
     string param = tolower(biteStringX(line, '='));
     string value = line;
-    double dval  = atof(value.c_str());
-
-    bool handled = false;
-    if((param == "start_x") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "start_y") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "start_heading") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "start_speed") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "start_depth") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "buoyancy_rate") && isNumber(value))
-      handled = m_model.setParam(param, dval);
-    else if((param == "drift_x") && isNumber(value))
-      handled = m_model.setDriftX(dval, "");
-    else if((param == "drift_y") && isNumber(value))
-      handled = m_model.setDriftY(dval, "");
-
-    else if(param == "wind_conditions")
-      handled = m_model.setParam("wind_conditions", value);
-    else if(param == "polar_plot")
-      handled = m_model.setParam("polar_plot", value);
+
+    bool handled = m_model.handleConfigParam(param, value);
+    if(handled)
+      continue;
     
-    else if(param == "turn_spd_map_full_speed")
-      handled = m_model.setTSMapFullSpeed(value);
-    else if(param == "turn_spd_map_null_speed")
-      handled = m_model.setTSMapNullSpeed(value);
-    else if(param == "turn_spd_map_full_rate")
-      handled = m_model.setTSMapFullRate(value);
-    else if(param == "turn_spd_map_null_rate")
-      handled = m_model.setTSMapNullRate(value);
-
-    else if((param == "rotate_speed") && isNumber(value))
-      handled = m_model.setParam("rotate_speed", dval);
-    else if((param == "max_acceleration") && isNumber(value))
-      handled = m_model.setParam("max_acceleration", dval);
-    else if((param == "max_deceleration") && isNumber(value))
-      handled = m_model.setParam("max_deceleration", dval);
-    else if((param == "max_depth_rate") && isNumber(value))
-      handled = m_model.setParam("max_depth_rate", dval);
-    else if((param == "max_depth_rate_speed") && isNumber(value))
-      handled = m_model.setParam("max_depth_rate_speed", dval);
-    else if((param == "max_rudder_degs_per_sec") && isNumber(value))
-      handled = m_model.setMaxRudderDegreesPerSec(dval);
-    else if(param == "prefix")
+    if(param == "prefix")
       handled = setNonWhiteVarOnString(m_sim_prefix, value);
-    else if(param == "drift_vector")
-      handled = m_model.setDriftVector(value, "");
-    else if(param == "sim_pause")
-      handled = m_model.setPaused(value);
-    else if(param == "dual_state")
-      handled = m_model.setDualState(value);
-    else if(param == "start_pos")
-      handled = m_model.initPosition(value);
-    else if(param == "thrust_reflect")
-      m_model.setThrustReflect(value);
-    else if(param == "thrust_mode_diff") 
-      handled = m_model.setThrustModeDiff(value);
-    else if(param == "thrust_mode_reverse")
-      m_model.setThrustModeReverse(value);	
-    else if((param == "thrust_factor") && isNumber(value))
-      m_model.setThrustFactor(dval);
-    else if(param == "thrust_map")
-      handled = m_model.handleFullThrustMapping(value);
-    else if(param == "thrust_map_fan")
-      handled = m_model.handleFullThrustMapFan(value);
-    else if((param == "turn_rate") && isNumber(value))
-      handled = m_model.setParam("turn_rate", dval);
-    else if((param == "default_water_depth") && isNumber(value))
-      handled = m_model.setParam("water_depth", dval);
     else if(param == "trim_tolerance") 
       handled = setDoubleOnString(m_pitch_tolerance, value);
     else if(param == "max_trim_delay") 
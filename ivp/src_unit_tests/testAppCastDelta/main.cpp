@@ -0,0 +1,190 @@
+/*****************************************************************/
+/*    FILE: main.cpp (testAppCastDelta)                          */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <set>
+#include "MBUtils.h"
+#include "MOOS/libMOOS/Thirdparty/AppCasting/AppCast.h"
+#include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastDelta.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: randomValue()
+//   Purpose: A report value, optionally holding the appcast
+//            separators or text that looks like a delta op.
+
+string randomValue(bool seps)
+{
+  string str = intToString(rand() % 1000);
+  if(!seps)
+    return(str);
+
+  string odd[] = {"!@", "!@#", "!", "@", "#", "!!@", "=3", "-2", "+x",
+		  "ops=", "acbase=1", ""};
+  int form = rand() % 14;
+  if(form < 12)
+    str += odd[form];
+  if(rand() % 3 == 0)
+    str = odd[rand() % 12] + str;
+  return(str);
+}
+
+//--------------------------------------------------------
+// Procedure: editLines()
+//   Purpose: Change a few report lines, now and then adding or
+//            removing one, as a report changes between posts.
+
+void editLines(vector<string>& lines, bool seps)
+{
+  unsigned int changes = 1 + (rand() % 3);
+  for(unsigned int i=0; i<changes; i++) {
+    unsigned int ix = rand() % lines.size();
+    lines[ix] = "  Var" + uintToString(ix) + ": " + randomValue(seps);
+  }
+  if((rand() % 5 == 0) && (lines.size() > 2))
+    lines.erase(lines.begin() + (rand() % lines.size()));
+  if(rand() % 5 == 0) {
+    unsigned int ix = rand() % (lines.size()+1);
+    lines.insert(lines.begin() + ix, "  New: " + randomValue(seps));
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: buildAppCast()
+
+string buildAppCast(const vector<string>& lines, unsigned int iter)
+{
+  string msgs;
+  for(unsigned int i=0; i<lines.size(); i++)
+    msgs += lines[i] + "\n";
+
+  AppCast ac;
+  ac.setProcName("uFoo");
+  ac.setNodeName("abe");
+  ac.setIteration(iter);
+  ac.msg(msgs);
+  return(ac.getAppCastString());
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int posts    = 50;
+  unsigned int amt      = 20;
+  unsigned int interval = 20;
+  bool         seps     = false;
+  int          seed     = 1;
+  set<unsigned int> missed;
+  set<unsigned int> lapsed;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "posts="))
+      posts = atoi(argi.substr(6).c_str());
+    else if(strBegins(argi, "lines="))
+      amt = atoi(argi.substr(6).c_str());
+    else if(strBegins(argi, "interval="))
+      interval = atoi(argi.substr(9).c_str());
+    else if(strBegins(argi, "seps="))
+      seps = (argi.substr(5) == "true");
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "miss=") || strBegins(argi, "lapse=")) {
+      string val = argi.substr(argi.find('=')+1);
+      vector<string> svector = parseString(val, ',');
+      for(unsigned int j=0; j<svector.size(); j++) {
+	unsigned int post = atoi(svector[j].c_str());
+	if(strBegins(argi, "miss="))
+	  missed.insert(post);
+	else
+	  lapsed.insert(post);
+      }
+    }
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testAppCastDelta: post a changing appcast as keyframes and  " << endl;
+      cout << "deltas, and rebuild it with an AppCastDeltaCache. Posts     " << endl;
+      cout << "given by miss= are not seen by the reader. Posts given by   " << endl;
+      cout << "lapse= follow a new client request, so are keyframes.       " << endl;
+      cout << "Example:                                                    " << endl;
+      cout << "$ testAppCastDelta posts=50 miss=10 lapse=15                " << endl;
+      cout << "keyframes=3,deltas=47,match=45,differ=0,dropped=4           " << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  if((amt == 0) || (interval == 0))
+    return(cmdLineErr("lines and interval must be positive. Exiting."));
+
+  srand(seed);
+  vector<string> lines;
+  for(unsigned int i=0; i<amt; i++)
+    lines.push_back("  Var" + uintToString(i) + ": " + randomValue(seps));
+
+  // The sender, as in AppCastingMOOSApp::appcastPostString()
+  unsigned int seq = 0;
+  unsigned int since_keyframe = 0;
+  bool         keyframe_due = true;
+  string       last;
+
+  AppCastDeltaCache cache;
+  unsigned int keyframes = 0;
+  unsigned int deltas = 0;
+  unsigned int match  = 0;
+  unsigned int differ = 0;
+  unsigned int dropped = 0;
+
+  for(unsigned int i=1; i<=posts; i++) {
+    if(i > 1)
+      editLines(lines, seps);
+    string full = buildAppCast(lines, i);
+
+    seq++;
+    since_keyframe++;
+    if((since_keyframe >= interval) || (lapsed.count(i)))
+      keyframe_due = true;
+
+    string post;
+    if(!keyframe_due) {
+      post = appCastDelta(last, full, seq, seq-1);
+      if(post.length() >= full.length())
+	post = "";
+    }
+    if(post == "") {
+      post = appCastKeyFrame(full, seq);
+      since_keyframe = 0;
+      keyframe_due = false;
+      keyframes++;
+    }
+    else
+      deltas++;
+    last = full;
+
+    // The reader
+    if(missed.count(i))
+      continue;
+    string result;
+    if(!cache.resolve(post, result))
+      dropped++;
+    else if(result == full)
+      match++;
+    else
+      differ++;
+  }
+
+  cout << "keyframes=" << keyframes << ",deltas=" << deltas;
+  cout << ",match=" << match << ",differ=" << differ;
+  cout << ",dropped=" << dropped << endl;
+  return(0);
+}
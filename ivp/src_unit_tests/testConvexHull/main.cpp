@@ -1,68 +1,204 @@
-/*****************************************************************/
-/*    NAME: Michael Benjamin                                     */
-/*    FILE: main.cpp (testConvexHull)                            */
-/*    DATE: Jun 5, 2020                                          */
-/*****************************************************************/
-           
-#include <iostream>
-#include <cstdlib>
-#include "GeomUtils.h"
-#include "ConvexHullGenerator.h"
-#include "XYFormatUtilsPoly.h"
-#include "XYFormatUtilsSegl.h"
-
-using namespace std;
-
-int cmdLineErr(string msg) {cout << msg << endl; return(1);}
- 
-int main(int argc, char** argv) 
-{
-  string pts = "pts={107.5,-53.5:112,-43.8:112,-46.1:111.7,-49.3:108.3,-52.7:107.7,-53.3}";
-
-  pts = "pts={108.9,-39.9:107.88,-38.88:112,-43:110.32,-41.32:109.39,-40.39:107.8,-38.8:108.02,-39.02:108.19,-39.19:110.16,-41.16:111.68,-42.68:108.9,-39.9:107.52,-38.52:108.9,-39.9:108.65,-39.65:108.61,-39.61:105.96,-38:107.35,-38.35:103.81,-38:102.14,-38:109.01,-40.01}";
-
-  pts = "pts={96.02,-42.98:96.76,-42.05:98.56,-39.8:98.72,-39.6:99.92,-38.1:100.08,-38:107,-38}";
-  
-  for(int i=1; i<argc; i++) {
-    string argi = argv[i];
-    cout << "argi:[" << argi << "]" << endl;
-    if(strBegins(argi, "pts="))
-      pts = argi;
-    else if((argi=="-h") || (argi=="--help")) {
-      cout << "testConvexHull: test ConvexHullGenerator utility " << endl;
-      cout << "Example:                                         " << endl;
-      cout << "$ testConvexHull pts={107.5,-53.5:112,-43.8:112,-46.1:111.7,-49.3:108.3,-52.7:107.7,-53.3}" << endl;
-      cout << "hull=6" << endl;
-      return(0);
-    }
-    else if(strBegins(argi, "id="))
-      argi = "just ignore id fields";
-    else {
-      cout << "Error: arg[" << argi << "] Exiting." << endl;
-      return(1);
-    }  
-  }  
-     
-  if(pts == "")
-    return(cmdLineErr("pts are not set. Exiting."));
-
-  XYSegList segl = string2SegList(pts);
-  if(segl.size() == 0) {
-    cout << "Empty set of points, or bad point string" << endl;
-    return(2);
-  }
-    
-  
-  ConvexHullGenerator generator;
-  for(unsigned int i=0; i<segl.size(); i++) 
-    generator.addPoint(segl.get_vx(i), segl.get_vy(i));
-
-  XYPolygon hull_poly = generator.generateConvexHull();
-  if(hull_poly.is_convex())
-    cout << "hull=" << uintToString(hull_poly.size()) << endl;
-  else
-    cout << "hull=0" << endl;
-
-  return(0);
-}
- 
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    FILE: main.cpp (testConvexHull)                            */
+/*    DATE: Jun 5, 2020                                          */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "GeomUtils.h"
+#include "ConvexHullGenerator.h"
+#include "XYFormatUtilsPoly.h"
+#include "XYFormatUtilsSegl.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: cross()
+
+double cross(const XYPoint& o, const XYPoint& a, const XYPoint& b)
+{
+  return((a.x()-o.x())*(b.y()-o.y()) - (a.y()-o.y())*(b.x()-o.x()));
+}
+
+bool lessXY(const XYPoint& a, const XYPoint& b)
+{
+  if(a.x() != b.x())
+    return(a.x() < b.x());
+  return(a.y() < b.y());
+}
+
+//--------------------------------------------------------
+// Procedure: refHull()
+//   Purpose: Reference hull by the monotone chain method, with
+//            duplicate and colinear points left out.
+
+vector<XYPoint> refHull(vector<XYPoint> pts)
+{
+  sort(pts.begin(), pts.end(), lessXY);
+  vector<XYPoint> hull(2*pts.size());
+  unsigned int k = 0;
+  for(unsigned int i=0; i<pts.size(); i++) {
+    while((k >= 2) && (cross(hull[k-2], hull[k-1], pts[i]) <= 0))
+      k--;
+    hull[k++] = pts[i];
+  }
+  unsigned int lower = k+1;
+  for(int i=(int)(pts.size())-2; i>=0; i--) {
+    while((k >= lower) && (cross(hull[k-2], hull[k-1], pts[i]) <= 0))
+      k--;
+    hull[k++] = pts[i];
+  }
+  if(k > 1)
+    k--;
+  hull.resize(k);
+  return(hull);
+}
+
+//--------------------------------------------------------
+// Procedure: hullMatches()
+//   Purpose: True if the generated hull has the same vertices as the
+//            reference hull. If the points are all on one line or at
+//            one spot, the generator pads them into a small polygon,
+//            which then only needs to hold all the points.
+
+bool hullMatches(const vector<XYPoint>& pts)
+{
+  ConvexHullGenerator generator;
+  for(unsigned int i=0; i<pts.size(); i++)
+    generator.addPoint(pts[i].x(), pts[i].y());
+  XYPolygon hull_poly = generator.generateConvexHull();
+
+  vector<XYPoint> ref = refHull(pts);
+  if(ref.size() < 3) {
+    if(!hull_poly.is_convex())
+      return(false);
+    for(unsigned int i=0; i<pts.size(); i++) {
+      if(!hull_poly.contains(pts[i]) &&
+	 (hull_poly.dist_to_poly(pts[i].x(), pts[i].y()) > 1e-6))
+	return(false);
+    }
+    return(true);
+  }
+
+  if(!hull_poly.is_convex() || (hull_poly.size() != ref.size()))
+    return(false);
+  for(unsigned int i=0; i<ref.size(); i++) {
+    bool found = false;
+    for(unsigned int j=0; (j<hull_poly.size()) && !found; j++) {
+      if((fabs(hull_poly.get_vx(j) - ref[i].x()) < 1e-9) &&
+	 (fabs(hull_poly.get_vy(j) - ref[i].y()) < 1e-9))
+	found = true;
+    }
+    if(!found)
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: randomPoints()
+//   Purpose: Points on a small integer grid so that duplicate and
+//            colinear points are common. Every third set also gets
+//            a run of points along a line through the set.
+
+vector<XYPoint> randomPoints(unsigned int set_ix, int range)
+{
+  vector<XYPoint> pts;
+  unsigned int amt = 3 + (rand() % 30);
+  for(unsigned int i=0; i<amt; i++) {
+    double x = rand() % (range+1);
+    double y = rand() % (range+1);
+    pts.push_back(XYPoint(x, y));
+  }
+  if((set_ix % 3) == 0) {
+    int dx = (rand() % 3) - 1;
+    int dy = (rand() % 3) - 1;
+    for(int k=0; k<=range; k++)
+      pts.push_back(XYPoint(k*dx + range, k*dy + range));
+  }
+  if((set_ix % 5) == 0)
+    pts.push_back(pts[0]);
+  return(pts);
+}
+
+int main(int argc, char** argv)
+{
+  string pts;
+  int    sets  = 0;
+  int    seed  = 1;
+  int    range = 10;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "pts="))
+      pts = argi.substr(4);
+    else if(strBegins(argi, "sets="))
+      sets = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "range="))
+      range = atoi(argi.substr(6).c_str());
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testConvexHull: test ConvexHullGenerator utility " << endl;
+      cout << "Example:                                         " << endl;
+      cout << "$ testConvexHull pts=107.5,-53.5:112,-43.8:112,-46.1:111.7,-49.3:108.3,-52.7:107.7,-53.3" << endl;
+      cout << "hull=6,ref=match" << endl;
+      cout << "$ testConvexHull sets=1000 seed=3" << endl;
+      cout << "sets=1000,differ=0" << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  // Random sets compared against the reference hull
+  if(sets > 0) {
+    srand(seed);
+    unsigned int differ = 0;
+    for(int i=0; i<sets; i++) {
+      if(!hullMatches(randomPoints(i, range)))
+	differ++;
+    }
+    cout << "sets=" << sets << ",differ=" << differ << endl;
+    return(0);
+  }
+
+  if(pts == "")
+    return(cmdLineErr("pts are not set. Exiting."));
+
+  XYSegList segl = string2SegList(pts);
+  if(segl.size() == 0) {
+    cout << "Empty set of points, or bad point string" << endl;
+    return(2);
+  }
+
+  vector<XYPoint> points;
+  ConvexHullGenerator generator;
+  for(unsigned int i=0; i<segl.size(); i++) {
+    generator.addPoint(segl.get_vx(i), segl.get_vy(i));
+    points.push_back(XYPoint(segl.get_vx(i), segl.get_vy(i)));
+  }
+
+  XYPolygon hull_poly = generator.generateConvexHull();
+  if(hull_poly.is_convex())
+    cout << "hull=" << uintToString(hull_poly.size());
+  else
+    cout << "hull=0";
+
+  if(hullMatches(points))
+    cout << ",ref=match" << endl;
+  else
+    cout << ",ref=differ" << endl;
+
+  return(0);
+}
@@ -0,0 +1,296 @@
+/*****************************************************************/
+/*    FILE: main.cpp (testFunctionEncoderBin)                    */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "MBUtils.h"
+#include "BuildUtils.h"
+#include "AOF_Gaussian.h"
+#include "OF_Reflector.h"
+#include "FunctionEncoderBin.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: buildFunction()
+//   Purpose: A gaussian over the given domain with uniform pieces
+//            of the given size.
+
+IvPFunction *buildFunction(const IvPDomain& domain, int pcs, int deg)
+{
+  AOF_Gaussian aof(domain);
+  aof.setParam("xcent", 40);
+  aof.setParam("ycent", 20);
+  aof.setParam("sigma", 18);
+  aof.setParam("range", 120);
+  aof.initialize();
+
+  OF_Reflector reflector(&aof, deg);
+  reflector.create(pcs);
+  IvPFunction *ipf = reflector.extractIvPFunction();
+  if(ipf) {
+    ipf->setPWT(75);
+    ipf->setContextStr("testbin");
+  }
+  return(ipf);
+}
+
+//--------------------------------------------------------
+// Procedure: sameFunction()
+//   Purpose: True if the decoded function has the same pieces as the
+//            original, with weights to the four decimal places kept
+//            by the encoding.
+
+bool sameFunction(IvPFunction *ipf, IvPFunction *dec)
+{
+  if(!ipf || !dec)
+    return(false);
+  if((ipf->getPWT() != dec->getPWT()) ||
+     (ipf->getContextStr() != dec->getContextStr()))
+    return(false);
+
+  PDMap *pdmap = ipf->getPDMap();
+  PDMap *dmap  = dec->getPDMap();
+  if((pdmap->size() != dmap->size()) ||
+     (pdmap->getDegree() != dmap->getDegree()))
+    return(false);
+
+  int dim = ipf->getDim();
+  int wtc = (pdmap->getDegree() * dim) + 1;
+  for(int i=0; i<pdmap->size(); i++) {
+    IvPBox *a = pdmap->bx(i);
+    IvPBox *b = dmap->bx(i);
+    for(int d=0; d<dim; d++) {
+      if((a->pt(d,0) != b->pt(d,0)) || (a->pt(d,1) != b->pt(d,1)) ||
+	 (a->bd(d,0) != b->bd(d,0)) || (a->bd(d,1) != b->bd(d,1)))
+	return(false);
+    }
+    for(int j=0; j<wtc; j++) {
+      if(fabs(a->wt(j) - b->wt(j)) > 0.000051)
+	return(false);
+    }
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: boxesInDomain()
+//   Purpose: True if every piece of the function is a proper box
+//            within its domain.
+
+bool boxesInDomain(IvPFunction *ipf)
+{
+  PDMap *pdmap = ipf->getPDMap();
+  IvPDomain domain = pdmap->getDomain();
+  int dim = ipf->getDim();
+  for(int i=0; i<pdmap->size(); i++) {
+    IvPBox *box = pdmap->bx(i);
+    if(!box)
+      return(false);
+    for(int d=0; d<dim; d++) {
+      int var_max = (int)(domain.getVarPoints(d)) - 1;
+      if((box->pt(d,0) < 0) || (box->pt(d,0) > box->pt(d,1)) ||
+	 (box->pt(d,1) > var_max))
+	return(false);
+    }
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedures: Hand encoding of a function of constant pieces, one
+//             per weight delta, laid out as in FunctionEncoderBin.cpp
+
+void putVarint(vector<unsigned char>& buff, unsigned long long v)
+{
+  while(v >= 0x80) {
+    buff.push_back((unsigned char)(v | 0x80));
+    v >>= 7;
+  }
+  buff.push_back((unsigned char)(v));
+}
+
+void putZigzag(vector<unsigned char>& buff, long long v)
+{
+  putVarint(buff, ((unsigned long long)(v) << 1) ^
+	    (unsigned long long)(v >> 63));
+}
+
+vector<unsigned char> encodeBox(const string& dstr,
+				const vector<long long>& gel,
+				const vector<long long>& box,
+				const vector<long long>& wts)
+{
+  vector<unsigned char> buff;
+  unsigned int dim = gel.size();
+  buff.push_back(1);  // version
+  buff.push_back(0);  // flags
+  putVarint(buff, 0);
+  putVarint(buff, dstr.length());
+  buff.insert(buff.end(), dstr.begin(), dstr.end());
+  putVarint(buff, dim);
+  putVarint(buff, wts.size());
+  putVarint(buff, 0);
+  double pwt = 1;
+  unsigned long long bits;
+  memcpy(&bits, &pwt, 8);
+  for(int i=0; i<8; i++)
+    buff.push_back((unsigned char)(bits >> (i*8)));
+  for(unsigned int d=0; d<dim; d++)
+    putVarint(buff, gel[d]);
+  // Later pieces repeat the first, only the weight changes
+  for(unsigned int i=0; i<wts.size(); i++) {
+    for(unsigned int d=0; d<dim; d++) {
+      putZigzag(buff, (i == 0) ? box[2*d] : 0);
+      putZigzag(buff, box[(2*d)+1]);
+    }
+    putZigzag(buff, wts[i]);
+  }
+  return(buff);
+}
+
+//--------------------------------------------------------
+// Procedure: parseInts()
+//   Purpose: Integers separated by commas or colons
+
+vector<long long> parseInts(string str)
+{
+  vector<long long> ints;
+  str = findReplace(str, ':', ',');
+  vector<string> svector = parseString(str, ',');
+  for(unsigned int i=0; i<svector.size(); i++)
+    ints.push_back(atoll(svector[i].c_str()));
+  return(ints);
+}
+
+int main(int argc, char** argv)
+{
+  string dstr = "x,0,100,101:y,0,50,51";
+  string box_str;
+  string gel_str;
+  string wts_str = "10000";
+  int    pcs   = 0;
+  int    deg   = 1;
+  int    fuzz  = 0;
+  int    seed  = 1;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "dom="))
+      dstr = argi.substr(4);
+    else if(strBegins(argi, "pcs="))
+      pcs = atoi(argi.substr(4).c_str());
+    else if(strBegins(argi, "deg="))
+      deg = atoi(argi.substr(4).c_str());
+    else if(strBegins(argi, "box="))
+      box_str = argi.substr(4);
+    else if(strBegins(argi, "gel="))
+      gel_str = argi.substr(4);
+    else if(strBegins(argi, "wts="))
+      wts_str = argi.substr(4);
+    else if(strBegins(argi, "fuzz="))
+      fuzz = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testFunctionEncoderBin: test the binary IvP function form  " << endl;
+      cout << "A box is given as low,extent per dimension, in grid units, " << endl;
+      cout << "with a piece for each weight delta given, e.g., wts=1,2.   " << endl;
+      cout << "Example:                                                   " << endl;
+      cout << "$ testFunctionEncoderBin pcs=200 deg=1                     " << endl;
+      cout << "pcs=153,match=true,smatch=true                             " << endl;
+      cout << "$ testFunctionEncoderBin box=10,5:0,51                     " << endl;
+      cout << "decoded=false                                              " << endl;
+      cout << "$ testFunctionEncoderBin pcs=50 fuzz=5000 seed=2           " << endl;
+      cout << "trials=5000,bad=0                                          " << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  IvPDomain domain = stringToDomain(dstr);
+  if(domain.size() == 0)
+    return(cmdLineErr("Bad domain. Exiting."));
+
+  // Hand encoded pieces, valid or not
+  if(box_str != "") {
+    vector<long long> box = parseInts(box_str);
+    vector<long long> wts = parseInts(wts_str);
+    vector<long long> gel(domain.size(), 0);
+    if(gel_str != "")
+      gel = parseInts(gel_str);
+    if((box.size() != 2*domain.size()) || (gel.size() != domain.size()))
+      return(cmdLineErr("Bad box or gel for the domain. Exiting."));
+    if(wts.size() == 0)
+      return(cmdLineErr("Bad weights. Exiting."));
+
+    vector<unsigned char> buff = encodeBox(dstr, gel, box, wts);
+    IvPFunction *dec = BinaryToIvPFunction(buff);
+    cout << "decoded=" << boolToString(dec != 0);
+    if(dec) {
+      cout << ",inside=" << boolToString(boxesInDomain(dec));
+      delete(dec);
+    }
+    cout << endl;
+    return(0);
+  }
+
+  if(pcs <= 0)
+    return(cmdLineErr("pcs is not set. Exiting."));
+
+  IvPFunction *ipf = buildFunction(domain, pcs, deg);
+  if(!ipf)
+    return(cmdLineErr("Unable to build function. Exiting."));
+
+  // Corrupted or cut short encodings must be rejected, or decode
+  // to pieces within the domain
+  if(fuzz > 0) {
+    srand(seed);
+    vector<unsigned char> good = IvPFunctionToBinary(ipf);
+    unsigned int bad = 0;
+    for(int i=0; i<fuzz; i++) {
+      vector<unsigned char> buff = good;
+      if(i % 4 == 0)
+	buff.resize(rand() % buff.size());
+      else {
+	int flips = 1 + (rand() % 3);
+	for(int k=0; k<flips; k++)
+	  buff[rand() % buff.size()] = (unsigned char)(rand() % 256);
+      }
+      IvPFunction *dec = BinaryToIvPFunction(buff);
+      if(dec) {
+	if(!boxesInDomain(dec))
+	  bad++;
+	delete(dec);
+      }
+    }
+    cout << "trials=" << fuzz << ",bad=" << bad << endl;
+    delete(ipf);
+    return(0);
+  }
+
+  // Round trip through the binary and the binary string forms
+  vector<unsigned char> buff = IvPFunctionToBinary(ipf);
+  IvPFunction *dec  = BinaryToIvPFunction(buff);
+  IvPFunction *sdec = StringBinToIvPFunction(IvPFunctionToStringBin(ipf));
+
+  cout << "pcs=" << ipf->size();
+  cout << ",match=" << boolToString(sameFunction(ipf, dec));
+  cout << ",smatch=" << boolToString(sameFunction(ipf, sdec)) << endl;
+
+  delete(ipf);
+  delete(dec);
+  delete(sdec);
+  return(0);
+}
@@ -0,0 +1,187 @@
+/*****************************************************************/
+/*    FILE: main.cpp (testLogSketch)                             */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "MBUtils.h"
+#include "HyperLogLog.h"
+#include "QuantileSketch.h"
+#include "ALogStats.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: randomValue()
+//   Purpose: A value drawn from one of a few distributions with
+//            rather different shapes and scales.
+
+double randomValue(const string& dist)
+{
+  double u = (double)(rand()) / ((double)(RAND_MAX) + 1);
+  if(dist == "uniform")
+    return(u * 1000);
+  if(dist == "exp")
+    return(-log(1 - u) * 50);
+  if(dist == "signed")
+    return((u - 0.5) * 200);
+  if(dist == "wide")
+    return(pow(10, (u * 8) - 2));
+  if(dist == "ints")
+    return((double)(rand() % 20));
+  return(u);
+}
+
+//--------------------------------------------------------
+// Procedure: hllCheck()
+//   Purpose: Adds amt distinct strings, each dups times, round robin
+//            over parts sketches which are then merged. The estimate
+//            must be within three standard errors of the exact count.
+
+bool hllCheck(unsigned int amt, unsigned int dups, unsigned int parts)
+{
+  vector<HyperLogLog> hlls(parts);
+  unsigned int next = 0;
+  for(unsigned int i=0; i<amt; i++) {
+    string str = "src_" + uintToString(rand()) + "_" + uintToString(i);
+    for(unsigned int j=0; j<dups; j++) {
+      hlls[next].add(str);
+      next = (next + 1) % parts;
+    }
+  }
+  HyperLogLog hll;
+  for(unsigned int i=0; i<parts; i++)
+    hll.merge(hlls[i]);
+
+  // Standard error is 1.04/sqrt(m) with m=1024 registers
+  double err = fabs(hll.estimate() - (double)(amt));
+  return(err <= (3 * 1.04 / 32) * (double)(amt));
+}
+
+//--------------------------------------------------------
+// Procedure: qsCheck()
+//   Purpose: Adds amt values, round robin over parts sketches which
+//            are then merged. Each percentile must be within 1% of
+//            the exact value of the same rank.
+
+bool qsCheck(unsigned int amt, const string& dist, unsigned int parts)
+{
+  vector<QuantileSketch> sketches(parts);
+  vector<double> vals;
+  for(unsigned int i=0; i<amt; i++) {
+    double val = randomValue(dist);
+    vals.push_back(val);
+    sketches[i % parts].add(val);
+  }
+  QuantileSketch sketch;
+  for(unsigned int i=0; i<parts; i++)
+    sketch.merge(sketches[i]);
+  if(sketch.count() != amt)
+    return(false);
+
+  sort(vals.begin(), vals.end());
+  for(unsigned int i=0; i<=100; i++) {
+    double q = (double)(i) / 100;
+    double exact = vals[(unsigned int)(q * (double)(amt - 1))];
+    double err = fabs(sketch.quantile(q) - exact);
+    if(err > (0.01 * fabs(exact)) + 1e-9)
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: srcCheck()
+//   Purpose: Log lines for one variable from amt sources. With no
+//            limit set the source list must be exact, otherwise the
+//            count is estimated beyond the limit.
+
+string srcCheck(unsigned int amt, unsigned int max)
+{
+  ALogStats stats;
+  stats.setMaxSources(max);
+  for(unsigned int i=0; i<amt*2; i++) {
+    string line = doubleToString(i, 2) + "  DEPLOY  ";
+    line += "pNode" + uintToString(i % amt) + "  true";
+    stats.addLine(line.c_str(), line.length());
+  }
+  const ALogVarStats& vstats = stats.getVarStats(0);
+  unsigned int listed = parseString(vstats.getSources(), ',').size();
+  string result = "listed=" + uintToString(listed);
+  result += ",count=" + uintToString(vstats.getSourceCount());
+  return(result);
+}
+
+int main(int argc, char** argv)
+{
+  string dist = "uniform";
+  int    hll  = 0;
+  int    qs   = 0;
+  int    srcs = 0;
+  int    max  = 0;
+  int    dups = 1;
+  int    parts = 1;
+  int    seed = 1;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "hll="))
+      hll = atoi(argi.substr(4).c_str());
+    else if(strBegins(argi, "qs="))
+      qs = atoi(argi.substr(3).c_str());
+    else if(strBegins(argi, "srcs="))
+      srcs = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "max="))
+      max = atoi(argi.substr(4).c_str());
+    else if(strBegins(argi, "dist="))
+      dist = argi.substr(5);
+    else if(strBegins(argi, "dups="))
+      dups = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "parts="))
+      parts = atoi(argi.substr(6).c_str());
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testLogSketch: test the alogscan sketches against exact " << endl;
+      cout << "counts, merging the given number of parts.              " << endl;
+      cout << "Example:                                                " << endl;
+      cout << "$ testLogSketch hll=5000 parts=4                        " << endl;
+      cout << "count=5000,within=true                                  " << endl;
+      cout << "$ testLogSketch qs=20000 dist=exp                       " << endl;
+      cout << "count=20000,within=true                                 " << endl;
+      cout << "$ testLogSketch srcs=100 max=32                         " << endl;
+      cout << "listed=32,count=101                                     " << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  if((dups <= 0) || (parts <= 0))
+    return(cmdLineErr("Bad dups or parts. Exiting."));
+  srand(seed);
+
+  if(hll > 0) {
+    cout << "count=" << hll << ",within=";
+    cout << boolToString(hllCheck(hll, dups, parts)) << endl;
+  }
+  else if(qs > 0) {
+    cout << "count=" << qs << ",within=";
+    cout << boolToString(qsCheck(qs, dist, parts)) << endl;
+  }
+  else if(srcs > 0)
+    cout << srcCheck(srcs, max) << endl;
+  else
+    return(cmdLineErr("hll, qs or srcs is not set. Exiting."));
+
+  return(0);
+}
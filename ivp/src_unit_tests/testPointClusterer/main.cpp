@@ -0,0 +1,181 @@
+/*****************************************************************/
+/*    FILE: main.cpp (testPointClusterer)                        */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include "MBUtils.h"
+#include "PointClusterer.h"
+#include "XYFormatUtilsSegl.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: bruteClusters()
+//   Purpose: Number of connected components of the given points,
+//            with points linked if within dist of each other.
+
+unsigned int bruteClusters(const deque<XYPoint>& pts, double dist)
+{
+  vector<int> comp(pts.size(), -1);
+  unsigned int count = 0;
+  for(unsigned int i=0; i<pts.size(); i++) {
+    if(comp[i] >= 0)
+      continue;
+    vector<unsigned int> todo(1, i);
+    comp[i] = count;
+    while(todo.size() > 0) {
+      unsigned int a = todo.back();
+      todo.pop_back();
+      for(unsigned int b=0; b<pts.size(); b++) {
+	if(comp[b] >= 0)
+	  continue;
+	double dx = pts[a].x() - pts[b].x();
+	double dy = pts[a].y() - pts[b].y();
+	if(((dx*dx) + (dy*dy)) <= (dist*dist)) {
+	  comp[b] = count;
+	  todo.push_back(b);
+	}
+      }
+    }
+    count++;
+  }
+  return(count);
+}
+
+//--------------------------------------------------------
+// Procedure: randomCheck()
+//   Purpose: Feed random points, pruning by age as they arrive, and
+//            compare the cluster count with a brute force count after
+//            each point. Returns the number of disagreements.
+
+unsigned int randomCheck(unsigned int amt, double dist, double age,
+			 double size, unsigned int& checks)
+{
+  PointClusterer clusterer;
+  clusterer.setClusterDist(dist);
+
+  deque<XYPoint> live;
+  unsigned int differ = 0;
+  for(unsigned int i=0; i<amt; i++) {
+    double x = size * ((double)(rand()) / RAND_MAX);
+    double y = size * ((double)(rand()) / RAND_MAX);
+    double t = i;
+    clusterer.addPoint(x, y, t);
+    XYPoint pt(x, y);
+    pt.set_time(t);
+    live.push_back(pt);
+
+    clusterer.pruneByAge(age, t);
+    while((live.size() > 0) && ((t - live.front().get_time()) > age))
+      live.pop_front();
+
+    checks++;
+    if((clusterer.size() != live.size()) ||
+       (clusterer.clusterCount() != bruteClusters(live, dist)))
+      differ++;
+  }
+  return(differ);
+}
+
+int main(int argc, char** argv)
+{
+  string pts;
+  double dist  = 1;
+  double age   = -1;
+  int    amt   = 0;
+  int    seed  = 1;
+  double size  = 20;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "pts="))
+      pts = argi.substr(4);
+    else if(strBegins(argi, "dist="))
+      setDoubleOnString(dist, argi.substr(5));
+    else if(strBegins(argi, "age="))
+      setDoubleOnString(age, argi.substr(4));
+    else if(strBegins(argi, "rand="))
+      amt = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if(strBegins(argi, "size="))
+      setDoubleOnString(size, argi.substr(5));
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testPointClusterer: test PointClusterer merges and splits" << endl;
+      cout << "Points get time stamps 0,1,2,... in the given order. With " << endl;
+      cout << "age=A, points older than A are pruned after the last add. " << endl;
+      cout << "Example:                                                  " << endl;
+      cout << "$ testPointClusterer dist=1 pts=0,0:1.8,0:0.9,0           " << endl;
+      cout << "clusters=1,sizes=3,removed=1,reset=1                      " << endl;
+      cout << "$ testPointClusterer rand=2000 dist=1 age=300 seed=2      " << endl;
+      cout << "checks=2000,differ=0                                      " << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  if(dist <= 0)
+    return(cmdLineErr("dist must be positive. Exiting."));
+
+  // Random points compared against brute force connected components
+  if(amt > 0) {
+    if(age < 0)
+      age = amt;
+    srand(seed);
+    unsigned int checks = 0;
+    unsigned int differ = randomCheck(amt, dist, age, size, checks);
+    cout << "checks=" << checks << ",differ=" << differ << endl;
+    return(0);
+  }
+
+  if(pts == "")
+    return(cmdLineErr("pts are not set. Exiting."));
+
+  XYSegList segl = string2SegList(pts);
+  if(segl.size() == 0)
+    return(cmdLineErr("Empty set of points, or bad point string. Exiting."));
+
+  PointClusterer clusterer;
+  clusterer.setClusterDist(dist);
+
+  for(unsigned int i=0; i<segl.size(); i++)
+    clusterer.addPoint(segl.get_vx(i), segl.get_vy(i), i);
+  if(age >= 0)
+    clusterer.pruneByAge(age, segl.size()-1);
+
+  // Cluster keys are pc_0, pc_1, ... and a split may create a new
+  // one for each part, so probe well past the number of points.
+  vector<unsigned int> sizes;
+  for(unsigned int i=0; i<(3 * segl.size()); i++) {
+    string key = "pc_" + uintToString(i);
+    unsigned int cluster_size = clusterer.getClusterSize(key);
+    if(cluster_size > 0)
+      sizes.push_back(cluster_size);
+  }
+  sort(sizes.begin(), sizes.end());
+  reverse(sizes.begin(), sizes.end());
+
+  string sizes_str;
+  for(unsigned int i=0; i<sizes.size(); i++) {
+    if(i > 0)
+      sizes_str += ":";
+    sizes_str += uintToString(sizes[i]);
+  }
+
+  cout << "clusters=" << clusterer.clusterCount();
+  cout << ",sizes=" << sizes_str;
+  cout << ",removed=" << clusterer.getRemovedKeys().size();
+  cout << ",reset=" << clusterer.getResetKeys().size() << endl;
+  return(0);
+}
@@ -0,0 +1,384 @@
+/*****************************************************************/
+/*    FILE: main.cpp (testSpecScan)                              */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include "MBUtils.h"
+#include "XYSpecScan.h"
+#include "XYFormatUtilsPoly.h"
+#include "XYFormatUtilsSegl.h"
+
+using namespace std;
+
+int cmdLineErr(string msg) {cout << msg << endl; return(1);}
+
+//--------------------------------------------------------
+// Procedure: refStandard2Poly()
+//   Purpose: Reference parse of a standard polygon spec, the general
+//            loop of stringStandard2Poly() without the scanner.
+
+XYPolygon refStandard2Poly(string str)
+{
+  XYPolygon null_poly;
+  XYPolygon new_poly;
+
+  string rest = stripBlankEnds(str);
+  while(rest != "") {
+    string left = stripBlankEnds(biteString(rest, '='));
+    rest = stripBlankEnds(rest);
+
+    if(left == "pts") {
+      string pstr = biteStringX(rest, '}');
+      if(pstr == "")
+	return(null_poly);
+      if(pstr[0] != '{')
+	return(null_poly);
+      else
+	pstr = pstr.substr(1);
+      if(rest != "") {
+	if(rest[0] != ',')
+	  return(null_poly);
+	else
+	  rest = rest.substr(1);
+      }
+
+      vector<string> svector = parseString(pstr, ':');
+      for(unsigned int i=0; i<svector.size(); i++) {
+	string vertex = stripBlankEnds(svector[i]);
+	string xstr = biteStringX(vertex, ',');
+	string ystr = biteStringX(vertex, ',');
+	string zstr = biteStringX(vertex, ',');
+	string pstr = biteStringX(vertex, ',');
+	string property;
+	if(!isNumber(xstr) || !isNumber(ystr))
+	  return(null_poly);
+	double xval = atof(xstr.c_str());
+	double yval = atof(ystr.c_str());
+	double zval = 0;
+	if(isNumber(zstr))
+	  zval = atof(zstr.c_str());
+	else if(zstr != "")
+	  property = zstr;
+	if(pstr != "") {
+	  if(property != "")
+	    property += ",";
+	  property += pstr;
+	}
+	new_poly.add_vertex(xval, yval, zval, property, false);
+      }
+      new_poly.determine_convexity();
+    }
+    else {
+      string right = stripBlankEnds(biteString(rest, ','));
+      rest = stripBlankEnds(rest);
+      new_poly.set_param(left, right);
+    }
+  }
+
+  if(new_poly.is_convex())
+    return(new_poly);
+  if(new_poly.active() == false) {
+    null_poly.set_label(new_poly.get_label());
+    null_poly.set_active(false);
+  }
+  return(null_poly);
+}
+
+//--------------------------------------------------------
+// Procedure: refStandard2SegList()
+//   Purpose: Reference parse of a standard seglist spec, the general
+//            loop of stringStandard2SegList() without the scanner.
+
+XYSegList refStandard2SegList(string str)
+{
+  XYSegList null_segl;
+  XYSegList new_seglist;
+
+  string rest = str;
+  while(rest != "") {
+    string left = biteStringX(rest, '=');
+
+    if(left == "tags") {
+      EdgeTagSet edge_tags;
+      bool ok = edge_tags.setOnSpec(rest);
+      if(ok)
+	new_seglist.set_edge_tags(edge_tags);
+    }
+
+    if(left == "pts") {
+      string pstr = biteStringX(rest, '}');
+      if(pstr == "")
+	return(null_segl);
+      if(pstr[0] != '{')
+	return(null_segl);
+      else
+	pstr = pstr.substr(1);
+      if(rest != "") {
+	if(rest[0] != ',')
+	  return(null_segl);
+	else
+	  rest = rest.substr(1);
+      }
+
+      vector<string> svector = parseString(pstr, ':');
+      for(unsigned int i=0; i<svector.size(); i++) {
+	string vertex = stripBlankEnds(svector[i]);
+	string xstr = biteStringX(vertex, ',');
+	string ystr = biteStringX(vertex, ',');
+	string zstr = biteStringX(vertex, ',');
+	string pstr = biteStringX(vertex, ',');
+	string property;
+	if(!isNumber(xstr) || !isNumber(ystr))
+	  return(null_segl);
+	double xval = atof(xstr.c_str());
+	double yval = atof(ystr.c_str());
+	double zval = 0;
+	if(isNumber(zstr))
+	  zval = atof(zstr.c_str());
+	else if(zstr != "")
+	  property = zstr;
+	if(pstr != "") {
+	  if(property != "")
+	    property += ",";
+	  property += pstr;
+	}
+	new_seglist.add_vertex(xval, yval, zval, property);
+      }
+    }
+    else {
+      string right = biteStringX(rest, ',');
+      new_seglist.set_param(left, right);
+    }
+  }
+  return(new_seglist);
+}
+
+//--------------------------------------------------------
+// Procedure: sameVertices()
+
+bool sameVertices(const XYSegList& a, const XYSegList& b)
+{
+  if(a.size() != b.size())
+    return(false);
+  for(unsigned int i=0; i<a.size(); i++) {
+    if((a.get_vx(i) != b.get_vx(i)) || (a.get_vy(i) != b.get_vy(i)) ||
+       (a.get_vz(i) != b.get_vz(i)) || (a.get_vprop(i) != b.get_vprop(i)))
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: polyMatches()
+//   Purpose: True if stringStandard2Poly() builds the same polygon
+//            as the reference parse. The scanner is only a shortcut,
+//            so the two must agree whether or not it took the spec.
+
+bool polyMatches(const string& spec)
+{
+  XYPolygon poly = stringStandard2Poly(spec);
+  XYPolygon ref  = refStandard2Poly(spec);
+
+  if(poly.is_convex() != ref.is_convex())
+    return(false);
+  if(poly.active() != ref.active())
+    return(false);
+  if(!sameVertices(poly, ref))
+    return(false);
+  return(poly.get_spec() == ref.get_spec());
+}
+
+//--------------------------------------------------------
+// Procedure: seglMatches()
+//   Purpose: True if stringStandard2SegList() builds the same seglist
+//            as the reference parse.
+
+bool seglMatches(const string& spec)
+{
+  XYSegList segl = stringStandard2SegList(spec);
+  XYSegList ref  = refStandard2SegList(spec);
+
+  if(segl.active() != ref.active())
+    return(false);
+  if(!sameVertices(segl, ref))
+    return(false);
+  if(segl.get_edge_tags().getSpec() != ref.get_edge_tags().getSpec())
+    return(false);
+  return(segl.get_spec() == ref.get_spec());
+}
+
+//--------------------------------------------------------
+// Procedure: randomNumber()
+//   Purpose: A number string, now and then one that is not quite
+//            a number, or one with blanks around it.
+
+string randomNumber()
+{
+  string str = intToString((rand() % 401) - 200);
+  int form = rand() % 40;
+  if(form == 0)
+    str += "." + intToString(rand() % 100);
+  else if(form == 1)
+    str = "+" + str;
+  else if(form == 2)
+    str = "-." + intToString(rand() % 10);
+  else if(form == 3)
+    str += ".";
+  else if(form == 4)
+    str += ".5.5";
+  else if(form == 5)
+    str += "x";
+  else if(form == 6)
+    str = " " + str + " ";
+  else if(form == 7)
+    str = "";
+  return(str);
+}
+
+//--------------------------------------------------------
+// Procedure: randomSpec()
+//   Purpose: A standard spec much like get_spec() produces, with
+//            the odd flaw or rare form mixed in so that both the
+//            scanner and the general loop get exercised.
+
+string randomSpec()
+{
+  unsigned int amt = 1 + (rand() % 6);
+  string pts;
+  for(unsigned int i=0; i<amt; i++) {
+    if(i > 0)
+      pts += ":";
+    if(rand() % 20 == 0)
+      pts += " ";
+    pts += randomNumber() + "," + randomNumber();
+    int z = rand() % 10;
+    if(z == 0)
+      pts += "," + randomNumber();
+    else if(z == 1)
+      pts += ",prop";
+    else if(z == 2)
+      pts += ",3,prop";
+  }
+
+  string params[] = {"label=foo", "active=false", "edge_color=red",
+		     "vertex_size=3", "source=bar", "msg=", "label = b ar",
+		     "tags=x", "pts={1,1:2,2}", "duration=5"};
+  vector<string> parts;
+  if(rand() % 15)
+    parts.push_back("pts={" + pts + "}");
+  else
+    parts.push_back("pts=" + pts);
+  unsigned int pamt = rand() % 4;
+  for(unsigned int i=0; i<pamt; i++) {
+    string param = params[rand() % 10];
+    if(rand() % 2)
+      parts.push_back(param);
+    else
+      parts.insert(parts.begin(), param);
+  }
+
+  string spec;
+  for(unsigned int i=0; i<parts.size(); i++) {
+    if(i > 0)
+      spec += (rand() % 10) ? "," : " , ";
+    spec += parts[i];
+  }
+  if(rand() % 20 == 0)
+    spec += ",";
+  if(rand() % 20 == 0)
+    spec = "  " + spec + "\t";
+  return(spec);
+}
+
+int main(int argc, char** argv)
+{
+  string spec;
+  string type  = "poly";
+  int    specs = 0;
+  int    seed  = 1;
+
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if(strBegins(argi, "spec="))
+      spec = argi.substr(5);
+    else if(strBegins(argi, "type=") && ((argi == "type=poly") ||
+					   (argi == "type=segl")))
+      type = argi.substr(5);
+    else if(strBegins(argi, "specs="))
+      specs = atoi(argi.substr(6).c_str());
+    else if(strBegins(argi, "seed="))
+      seed = atoi(argi.substr(5).c_str());
+    else if((argi=="-h") || (argi=="--help")) {
+      cout << "testSpecScan: test scanStandardSpec() against the general " << endl;
+      cout << "parse of a standard polygon, or with type=segl seglist,   " << endl;
+      cout << "spec. Use [] for braces.                                  " << endl;
+      cout << "Example:                                                  " << endl;
+      cout << "$ testSpecScan spec=pts=[0,0:10,0:10,10],label=foo        " << endl;
+      cout << "scan=true,pts=3,ref=match                                 " << endl;
+      cout << "$ testSpecScan specs=10000 seed=2                         " << endl;
+      cout << "specs=10000,scanned=2163,differ=0                         " << endl;
+      cout << "$ testSpecScan type=segl spec=pts=[0,0:10,0,3,prop]       " << endl;
+      cout << "scan=false,pts=2,ref=match                                " << endl;
+      return(0);
+    }
+    else if(strBegins(argi, "id="))
+      argi = "just ignore id fields";
+    else {
+      cout << "Error: arg[" << argi << "] Exiting." << endl;
+      return(1);
+    }
+  }
+
+  // Random specs compared against the reference parse
+  if(specs > 0) {
+    srand(seed);
+    unsigned int scanned = 0;
+    unsigned int differ  = 0;
+    for(int i=0; i<specs; i++) {
+      string rspec = randomSpec();
+      XYSpecFields fields;
+      if(scanStandardSpec(rspec, fields))
+	scanned++;
+      bool match = false;
+      if(type == "segl")
+	match = seglMatches(rspec);
+      else
+	match = polyMatches(rspec);
+      if(!match)
+	differ++;
+    }
+    cout << "specs=" << specs << ",scanned=" << scanned;
+    cout << ",differ=" << differ << endl;
+    return(0);
+  }
+
+  if(spec == "")
+    return(cmdLineErr("spec is not set. Exiting."));
+
+  spec = findReplace(spec, '[', '{');
+  spec = findReplace(spec, ']', '}');
+
+  XYSpecFields fields;
+  bool scanned = scanStandardSpec(spec, fields);
+  unsigned int pts = 0;
+  bool match = false;
+  if(type == "segl") {
+    pts = stringStandard2SegList(spec).size();
+    match = seglMatches(spec);
+  }
+  else {
+    pts = stringStandard2Poly(spec).size();
+    match = polyMatches(spec);
+  }
+
+  cout << "scan=" << boolToString(scanned);
+  cout << ",pts=" << uintToString(pts);
+  if(match)
+    cout << ",ref=match" << endl;
+  else
+    cout << ",ref=differ" << endl;
+
+  return(0);
+}